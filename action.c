@@ -739,6 +739,7 @@ int do_action(struct run_act_ctx* h, struct action* a, struct sip_msg* msg)
 				msg->new_uri.s=0;
 				msg->parsed_uri_ok=0; /* invalidate current parsed uri*/
 				ruri_mark_new(); /* available for forking */
+				pv_vcache_invalidate();
 			};
 			ret=1;
 			break;
@@ -788,6 +789,7 @@ int do_action(struct run_act_ctx* h, struct action* a, struct sip_msg* msg)
 					msg->new_uri.s[len]=0;
 					msg->new_uri.len=len;
 					ruri_mark_new(); /* available for forking */
+					pv_vcache_invalidate();
 
 					ret=1;
 					break;
@@ -1068,6 +1070,7 @@ int do_action(struct run_act_ctx* h, struct action* a, struct sip_msg* msg)
 				msg->new_uri.len=crt-new_uri;
 				msg->parsed_uri_ok=0;
 				ruri_mark_new(); /* available for forking */
+				pv_vcache_invalidate();
 				ret=1;
 				break;
 		case IF_T:
@@ -1564,6 +1567,7 @@ int run_actions(struct run_act_ctx* h, struct action* a, struct sip_msg* msg)
 	int ret;
 	struct sr_module *mod;
 	unsigned int ms = 0;
+	int ms_limit;
 
 	ret=E_UNSPEC;
 	h->rec_lev++;
@@ -1592,15 +1596,17 @@ int run_actions(struct run_act_ctx* h, struct action* a, struct sip_msg* msg)
 		ret=1;
 	}
 
+	/* the cfg values do not change while the message is processed */
+	ms_limit = cfg_get(core, core_cfg, latency_limit_action);
 	for (t=a; t!=0; t=t->next){
-		if(unlikely(cfg_get(core, core_cfg, latency_limit_action)>0))
+		if(unlikely(ms_limit>0))
 			ms = TICKS_TO_MS(get_ticks_raw());
 		_cfg_crt_action = t;
 		ret=do_action(h, t, msg);
 		_cfg_crt_action = 0;
-		if(unlikely(cfg_get(core, core_cfg, latency_limit_action)>0)) {
+		if(unlikely(ms_limit>0)) {
 			ms = TICKS_TO_MS(get_ticks_raw()) - ms;
-			if(ms >= cfg_get(core, core_cfg, latency_limit_action)) {
+			if(ms >= ms_limit) {
 				LOG(cfg_get(core, core_cfg, latency_log),
 						"alert - action [%s (%d)]"
 						" cfg [%s:%d] took too long [%u ms]\n",
@@ -0,0 +1,11856 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 106 "cfg.y"
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/ip.h>
+#include <arpa/inet.h>
+#include <string.h>
+#include <errno.h>
+#include "route_struct.h"
+#include "globals.h"
+#ifdef SHM_MEM
+#include "shm_init.h"
+#endif /* SHM_MEM */
+#include "route.h"
+#include "switch.h"
+#include "dprint.h"
+#include "sr_module.h"
+#include "modparam.h"
+#include "ip_addr.h"
+#include "resolve.h"
+#include "socket_info.h"
+#include "name_alias.h"
+#include "ut.h"
+#include "dset.h"
+#include "select.h"
+#include "flags.h"
+#include "tcp_init.h"
+#include "tcp_options.h"
+#include "sctp_core.h"
+#include "pvar.h"
+#include "lvalue.h"
+#include "rvalue.h"
+#include "sr_compat.h"
+#include "msg_translator.h"
+
+#include "ppcfg.h"
+#include "pvapi.h"
+#include "config.h"
+#include "cfg_core.h"
+#include "cfg/cfg.h"
+#ifdef CORE_TLS
+#include "tls/tls_config.h"
+#endif
+#include "timer_ticks.h"
+
+#ifdef DEBUG_DMALLOC
+#include <dmalloc.h>
+#endif
+
+/* hack to avoid alloca usage in the generated C file (needed for compiler
+ with no built in alloca, like icc*/
+#undef _ALLOCA_H
+
+#define onsend_check(s) \
+	do{\
+		if (rt!=ONSEND_ROUTE) yyerror( s " allowed only in onsend_routes");\
+	}while(0)
+
+	#define IF_AUTO_BIND_IPV6(x) x
+
+#ifdef USE_DNS_CACHE
+	#define IF_DNS_CACHE(x) x
+#else
+	#define IF_DNS_CACHE(x) warn("dns cache support not compiled in")
+#endif
+
+#ifdef USE_DNS_FAILOVER
+	#define IF_DNS_FAILOVER(x) x
+#else
+	#define IF_DNS_FAILOVER(x) warn("dns failover support not compiled in")
+#endif
+
+#ifdef USE_NAPTR
+	#define IF_NAPTR(x) x
+#else
+	#define IF_NAPTR(x) warn("dns naptr support not compiled in")
+#endif
+
+#ifdef USE_DST_BLACKLIST
+	#define IF_DST_BLACKLIST(x) x
+#else
+	#define IF_DST_BLACKLIST(x) warn("dst blacklist support not compiled in")
+#endif
+
+#ifdef USE_SCTP
+	#define IF_SCTP(x) x
+#else
+	#define IF_SCTP(x) warn("sctp support not compiled in")
+#endif
+
+#ifdef USE_RAW_SOCKS
+	#define IF_RAW_SOCKS(x) x
+#else
+	#define IF_RAW_SOCKS(x) warn("raw socket support not compiled in")
+#endif
+
+
+extern int yylex();
+/* safer then using yytext which can be array or pointer */
+extern char* yy_number_str;
+
+static void yyerror(char* s, ...);
+static void yyerror_at(struct cfg_pos* pos, char* s, ...);
+static char* tmp;
+static int i_tmp;
+static unsigned u_tmp;
+static struct socket_id* lst_tmp;
+static struct name_lst*  nl_tmp;
+static int rt;  /* Type of route block for find_export */
+static str* str_tmp;
+static str s_tmp;
+static struct ip_addr* ip_tmp;
+static struct avp_spec* s_attr;
+static select_t sel;
+static select_t* sel_ptr;
+static pv_spec_t* pv_spec;
+static struct action *mod_func_action;
+static struct lvalue* lval_tmp;
+static struct rvalue* rval_tmp;
+
+static void warn(char* s, ...);
+static void warn_at(struct cfg_pos* pos, char* s, ...);
+static void get_cpos(struct cfg_pos* pos);
+static struct rval_expr* mk_rve_rval(enum rval_type, void* v);
+static struct rval_expr* mk_rve1(enum rval_expr_op op, struct rval_expr* rve1);
+static struct rval_expr* mk_rve2(enum rval_expr_op op, struct rval_expr* rve1,
+									struct rval_expr* rve2);
+static int rval_expr_int_check(struct rval_expr *rve);
+static int warn_ct_rve(struct rval_expr *rve, char* name);
+static struct socket_id* mk_listen_id(char*, int, int);
+static struct name_lst* mk_name_lst(char* name, int flags);
+static struct socket_id* mk_listen_id2(struct name_lst*, int, int);
+static void free_name_lst(struct name_lst* lst);
+static void free_socket_id_lst(struct socket_id* i);
+
+static struct case_stms* mk_case_stm(struct rval_expr* ct, int is_re, 
+									struct action* a, int* err);
+static int case_check_type(struct case_stms* stms);
+static int case_check_default(struct case_stms* stms);
+static int mod_f_params_pre_fixup(struct action* a);
+static void free_mod_func_action(struct action* a);
+
+
+extern int line;
+extern int column;
+extern int startcolumn;
+extern int startline;
+extern char *finame;
+
+#define set_cfg_pos(x) \
+	do{\
+		if(x) {\
+		(x)->cline = line;\
+		(x)->cfile = (finame!=0)?finame:((cfg_file!=0)?cfg_file:"default");\
+		}\
+	}while(0)
+
+
+
+#line 235 "cfg.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "cfg.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_FORWARD = 3,                    /* FORWARD  */
+  YYSYMBOL_FORWARD_TCP = 4,                /* FORWARD_TCP  */
+  YYSYMBOL_FORWARD_TLS = 5,                /* FORWARD_TLS  */
+  YYSYMBOL_FORWARD_SCTP = 6,               /* FORWARD_SCTP  */
+  YYSYMBOL_FORWARD_UDP = 7,                /* FORWARD_UDP  */
+  YYSYMBOL_EXIT = 8,                       /* EXIT  */
+  YYSYMBOL_DROP = 9,                       /* DROP  */
+  YYSYMBOL_RETURN = 10,                    /* RETURN  */
+  YYSYMBOL_BREAK = 11,                     /* BREAK  */
+  YYSYMBOL_LOG_TOK = 12,                   /* LOG_TOK  */
+  YYSYMBOL_ERROR = 13,                     /* ERROR  */
+  YYSYMBOL_ROUTE = 14,                     /* ROUTE  */
+  YYSYMBOL_ROUTE_REQUEST = 15,             /* ROUTE_REQUEST  */
+  YYSYMBOL_ROUTE_FAILURE = 16,             /* ROUTE_FAILURE  */
+  YYSYMBOL_ROUTE_ONREPLY = 17,             /* ROUTE_ONREPLY  */
+  YYSYMBOL_ROUTE_REPLY = 18,               /* ROUTE_REPLY  */
+  YYSYMBOL_ROUTE_BRANCH = 19,              /* ROUTE_BRANCH  */
+  YYSYMBOL_ROUTE_SEND = 20,                /* ROUTE_SEND  */
+  YYSYMBOL_ROUTE_EVENT = 21,               /* ROUTE_EVENT  */
+  YYSYMBOL_EXEC = 22,                      /* EXEC  */
+  YYSYMBOL_SET_HOST = 23,                  /* SET_HOST  */
+  YYSYMBOL_SET_HOSTPORT = 24,              /* SET_HOSTPORT  */
+  YYSYMBOL_SET_HOSTPORTTRANS = 25,         /* SET_HOSTPORTTRANS  */
+  YYSYMBOL_PREFIX = 26,                    /* PREFIX  */
+  YYSYMBOL_STRIP = 27,                     /* STRIP  */
+  YYSYMBOL_STRIP_TAIL = 28,                /* STRIP_TAIL  */
+  YYSYMBOL_SET_USERPHONE = 29,             /* SET_USERPHONE  */
+  YYSYMBOL_APPEND_BRANCH = 30,             /* APPEND_BRANCH  */
+  YYSYMBOL_REMOVE_BRANCH = 31,             /* REMOVE_BRANCH  */
+  YYSYMBOL_CLEAR_BRANCHES = 32,            /* CLEAR_BRANCHES  */
+  YYSYMBOL_SET_USER = 33,                  /* SET_USER  */
+  YYSYMBOL_SET_USERPASS = 34,              /* SET_USERPASS  */
+  YYSYMBOL_SET_PORT = 35,                  /* SET_PORT  */
+  YYSYMBOL_SET_URI = 36,                   /* SET_URI  */
+  YYSYMBOL_REVERT_URI = 37,                /* REVERT_URI  */
+  YYSYMBOL_FORCE_RPORT = 38,               /* FORCE_RPORT  */
+  YYSYMBOL_ADD_LOCAL_RPORT = 39,           /* ADD_LOCAL_RPORT  */
+  YYSYMBOL_FORCE_TCP_ALIAS = 40,           /* FORCE_TCP_ALIAS  */
+  YYSYMBOL_UDP_MTU = 41,                   /* UDP_MTU  */
+  YYSYMBOL_UDP_MTU_TRY_PROTO = 42,         /* UDP_MTU_TRY_PROTO  */
+  YYSYMBOL_UDP4_RAW = 43,                  /* UDP4_RAW  */
+  YYSYMBOL_UDP4_RAW_MTU = 44,              /* UDP4_RAW_MTU  */
+  YYSYMBOL_UDP4_RAW_TTL = 45,              /* UDP4_RAW_TTL  */
+  YYSYMBOL_IF = 46,                        /* IF  */
+  YYSYMBOL_ELSE = 47,                      /* ELSE  */
+  YYSYMBOL_SET_ADV_ADDRESS = 48,           /* SET_ADV_ADDRESS  */
+  YYSYMBOL_SET_ADV_PORT = 49,              /* SET_ADV_PORT  */
+  YYSYMBOL_FORCE_SEND_SOCKET = 50,         /* FORCE_SEND_SOCKET  */
+  YYSYMBOL_SET_FWD_NO_CONNECT = 51,        /* SET_FWD_NO_CONNECT  */
+  YYSYMBOL_SET_RPL_NO_CONNECT = 52,        /* SET_RPL_NO_CONNECT  */
+  YYSYMBOL_SET_FWD_CLOSE = 53,             /* SET_FWD_CLOSE  */
+  YYSYMBOL_SET_RPL_CLOSE = 54,             /* SET_RPL_CLOSE  */
+  YYSYMBOL_SWITCH = 55,                    /* SWITCH  */
+  YYSYMBOL_CASE = 56,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 57,                   /* DEFAULT  */
+  YYSYMBOL_WHILE = 58,                     /* WHILE  */
+  YYSYMBOL_CFG_SELECT = 59,                /* CFG_SELECT  */
+  YYSYMBOL_CFG_RESET = 60,                 /* CFG_RESET  */
+  YYSYMBOL_URIHOST = 61,                   /* URIHOST  */
+  YYSYMBOL_URIPORT = 62,                   /* URIPORT  */
+  YYSYMBOL_MAX_LEN = 63,                   /* MAX_LEN  */
+  YYSYMBOL_SETFLAG = 64,                   /* SETFLAG  */
+  YYSYMBOL_RESETFLAG = 65,                 /* RESETFLAG  */
+  YYSYMBOL_ISFLAGSET = 66,                 /* ISFLAGSET  */
+  YYSYMBOL_SETAVPFLAG = 67,                /* SETAVPFLAG  */
+  YYSYMBOL_RESETAVPFLAG = 68,              /* RESETAVPFLAG  */
+  YYSYMBOL_ISAVPFLAGSET = 69,              /* ISAVPFLAGSET  */
+  YYSYMBOL_METHOD = 70,                    /* METHOD  */
+  YYSYMBOL_URI = 71,                       /* URI  */
+  YYSYMBOL_FROM_URI = 72,                  /* FROM_URI  */
+  YYSYMBOL_TO_URI = 73,                    /* TO_URI  */
+  YYSYMBOL_SRCIP = 74,                     /* SRCIP  */
+  YYSYMBOL_SRCPORT = 75,                   /* SRCPORT  */
+  YYSYMBOL_DSTIP = 76,                     /* DSTIP  */
+  YYSYMBOL_DSTPORT = 77,                   /* DSTPORT  */
+  YYSYMBOL_TOIP = 78,                      /* TOIP  */
+  YYSYMBOL_TOPORT = 79,                    /* TOPORT  */
+  YYSYMBOL_SNDIP = 80,                     /* SNDIP  */
+  YYSYMBOL_SNDPORT = 81,                   /* SNDPORT  */
+  YYSYMBOL_SNDPROTO = 82,                  /* SNDPROTO  */
+  YYSYMBOL_SNDAF = 83,                     /* SNDAF  */
+  YYSYMBOL_PROTO = 84,                     /* PROTO  */
+  YYSYMBOL_AF = 85,                        /* AF  */
+  YYSYMBOL_MYSELF = 86,                    /* MYSELF  */
+  YYSYMBOL_MSGLEN = 87,                    /* MSGLEN  */
+  YYSYMBOL_UDP = 88,                       /* UDP  */
+  YYSYMBOL_TCP = 89,                       /* TCP  */
+  YYSYMBOL_TLS = 90,                       /* TLS  */
+  YYSYMBOL_SCTP = 91,                      /* SCTP  */
+  YYSYMBOL_WS = 92,                        /* WS  */
+  YYSYMBOL_WSS = 93,                       /* WSS  */
+  YYSYMBOL_DEBUG_V = 94,                   /* DEBUG_V  */
+  YYSYMBOL_FORK = 95,                      /* FORK  */
+  YYSYMBOL_FORK_DELAY = 96,                /* FORK_DELAY  */
+  YYSYMBOL_MODINIT_DELAY = 97,             /* MODINIT_DELAY  */
+  YYSYMBOL_LOGSTDERROR = 98,               /* LOGSTDERROR  */
+  YYSYMBOL_LOGFACILITY = 99,               /* LOGFACILITY  */
+  YYSYMBOL_LOGNAME = 100,                  /* LOGNAME  */
+  YYSYMBOL_LOGCOLOR = 101,                 /* LOGCOLOR  */
+  YYSYMBOL_LISTEN = 102,                   /* LISTEN  */
+  YYSYMBOL_ADVERTISE = 103,                /* ADVERTISE  */
+  YYSYMBOL_ALIAS = 104,                    /* ALIAS  */
+  YYSYMBOL_SR_AUTO_ALIASES = 105,          /* SR_AUTO_ALIASES  */
+  YYSYMBOL_DNS = 106,                      /* DNS  */
+  YYSYMBOL_REV_DNS = 107,                  /* REV_DNS  */
+  YYSYMBOL_DNS_TRY_IPV6 = 108,             /* DNS_TRY_IPV6  */
+  YYSYMBOL_DNS_TRY_NAPTR = 109,            /* DNS_TRY_NAPTR  */
+  YYSYMBOL_DNS_SRV_LB = 110,               /* DNS_SRV_LB  */
+  YYSYMBOL_DNS_UDP_PREF = 111,             /* DNS_UDP_PREF  */
+  YYSYMBOL_DNS_TCP_PREF = 112,             /* DNS_TCP_PREF  */
+  YYSYMBOL_DNS_TLS_PREF = 113,             /* DNS_TLS_PREF  */
+  YYSYMBOL_DNS_SCTP_PREF = 114,            /* DNS_SCTP_PREF  */
+  YYSYMBOL_DNS_RETR_TIME = 115,            /* DNS_RETR_TIME  */
+  YYSYMBOL_DNS_RETR_NO = 116,              /* DNS_RETR_NO  */
+  YYSYMBOL_DNS_SERVERS_NO = 117,           /* DNS_SERVERS_NO  */
+  YYSYMBOL_DNS_USE_SEARCH = 118,           /* DNS_USE_SEARCH  */
+  YYSYMBOL_DNS_SEARCH_FMATCH = 119,        /* DNS_SEARCH_FMATCH  */
+  YYSYMBOL_DNS_NAPTR_IGNORE_RFC = 120,     /* DNS_NAPTR_IGNORE_RFC  */
+  YYSYMBOL_DNS_CACHE_INIT = 121,           /* DNS_CACHE_INIT  */
+  YYSYMBOL_DNS_USE_CACHE = 122,            /* DNS_USE_CACHE  */
+  YYSYMBOL_DNS_USE_FAILOVER = 123,         /* DNS_USE_FAILOVER  */
+  YYSYMBOL_DNS_CACHE_FLAGS = 124,          /* DNS_CACHE_FLAGS  */
+  YYSYMBOL_DNS_CACHE_NEG_TTL = 125,        /* DNS_CACHE_NEG_TTL  */
+  YYSYMBOL_DNS_CACHE_MIN_TTL = 126,        /* DNS_CACHE_MIN_TTL  */
+  YYSYMBOL_DNS_CACHE_MAX_TTL = 127,        /* DNS_CACHE_MAX_TTL  */
+  YYSYMBOL_DNS_CACHE_MEM = 128,            /* DNS_CACHE_MEM  */
+  YYSYMBOL_DNS_CACHE_GC_INT = 129,         /* DNS_CACHE_GC_INT  */
+  YYSYMBOL_DNS_CACHE_DEL_NONEXP = 130,     /* DNS_CACHE_DEL_NONEXP  */
+  YYSYMBOL_AUTO_BIND_IPV6 = 131,           /* AUTO_BIND_IPV6  */
+  YYSYMBOL_DST_BLST_INIT = 132,            /* DST_BLST_INIT  */
+  YYSYMBOL_USE_DST_BLST = 133,             /* USE_DST_BLST  */
+  YYSYMBOL_DST_BLST_MEM = 134,             /* DST_BLST_MEM  */
+  YYSYMBOL_DST_BLST_TTL = 135,             /* DST_BLST_TTL  */
+  YYSYMBOL_DST_BLST_GC_INT = 136,          /* DST_BLST_GC_INT  */
+  YYSYMBOL_DST_BLST_UDP_IMASK = 137,       /* DST_BLST_UDP_IMASK  */
+  YYSYMBOL_DST_BLST_TCP_IMASK = 138,       /* DST_BLST_TCP_IMASK  */
+  YYSYMBOL_DST_BLST_TLS_IMASK = 139,       /* DST_BLST_TLS_IMASK  */
+  YYSYMBOL_DST_BLST_SCTP_IMASK = 140,      /* DST_BLST_SCTP_IMASK  */
+  YYSYMBOL_PORT = 141,                     /* PORT  */
+  YYSYMBOL_STAT = 142,                     /* STAT  */
+  YYSYMBOL_CHILDREN = 143,                 /* CHILDREN  */
+  YYSYMBOL_SOCKET_WORKERS = 144,           /* SOCKET_WORKERS  */
+  YYSYMBOL_FOLD_CONST_COND = 145,          /* FOLD_CONST_COND  */
+  YYSYMBOL_UDP_RCV_BATCH = 146,            /* UDP_RCV_BATCH  */
+  YYSYMBOL_UDP_SND_BATCH = 147,            /* UDP_SND_BATCH  */
+  YYSYMBOL_UDP_REUSE_PORT = 148,           /* UDP_REUSE_PORT  */
+  YYSYMBOL_SOCKET_CPU_AFFINITY = 149,      /* SOCKET_CPU_AFFINITY  */
+  YYSYMBOL_CHECK_VIA = 150,                /* CHECK_VIA  */
+  YYSYMBOL_PHONE2TEL = 151,                /* PHONE2TEL  */
+  YYSYMBOL_MEMLOG = 152,                   /* MEMLOG  */
+  YYSYMBOL_MEMDBG = 153,                   /* MEMDBG  */
+  YYSYMBOL_MEMSUM = 154,                   /* MEMSUM  */
+  YYSYMBOL_MEMSAFETY = 155,                /* MEMSAFETY  */
+  YYSYMBOL_MEMJOIN = 156,                  /* MEMJOIN  */
+  YYSYMBOL_CORELOG = 157,                  /* CORELOG  */
+  YYSYMBOL_SIP_WARNING = 158,              /* SIP_WARNING  */
+  YYSYMBOL_SERVER_SIGNATURE = 159,         /* SERVER_SIGNATURE  */
+  YYSYMBOL_SERVER_HEADER = 160,            /* SERVER_HEADER  */
+  YYSYMBOL_USER_AGENT_HEADER = 161,        /* USER_AGENT_HEADER  */
+  YYSYMBOL_REPLY_TO_VIA = 162,             /* REPLY_TO_VIA  */
+  YYSYMBOL_LOADMODULE = 163,               /* LOADMODULE  */
+  YYSYMBOL_LOADPATH = 164,                 /* LOADPATH  */
+  YYSYMBOL_MODPARAM = 165,                 /* MODPARAM  */
+  YYSYMBOL_MAXBUFFER = 166,                /* MAXBUFFER  */
+  YYSYMBOL_SQL_BUFFER_SIZE = 167,          /* SQL_BUFFER_SIZE  */
+  YYSYMBOL_USER = 168,                     /* USER  */
+  YYSYMBOL_GROUP = 169,                    /* GROUP  */
+  YYSYMBOL_CHROOT = 170,                   /* CHROOT  */
+  YYSYMBOL_WDIR = 171,                     /* WDIR  */
+  YYSYMBOL_MHOMED = 172,                   /* MHOMED  */
+  YYSYMBOL_DISABLE_TCP = 173,              /* DISABLE_TCP  */
+  YYSYMBOL_TCP_ACCEPT_ALIASES = 174,       /* TCP_ACCEPT_ALIASES  */
+  YYSYMBOL_TCP_CHILDREN = 175,             /* TCP_CHILDREN  */
+  YYSYMBOL_TCP_CONNECT_TIMEOUT = 176,      /* TCP_CONNECT_TIMEOUT  */
+  YYSYMBOL_TCP_SEND_TIMEOUT = 177,         /* TCP_SEND_TIMEOUT  */
+  YYSYMBOL_TCP_CON_LIFETIME = 178,         /* TCP_CON_LIFETIME  */
+  YYSYMBOL_TCP_POLL_METHOD = 179,          /* TCP_POLL_METHOD  */
+  YYSYMBOL_TCP_MAX_CONNECTIONS = 180,      /* TCP_MAX_CONNECTIONS  */
+  YYSYMBOL_TLS_MAX_CONNECTIONS = 181,      /* TLS_MAX_CONNECTIONS  */
+  YYSYMBOL_TCP_NO_CONNECT = 182,           /* TCP_NO_CONNECT  */
+  YYSYMBOL_TCP_SOURCE_IPV4 = 183,          /* TCP_SOURCE_IPV4  */
+  YYSYMBOL_TCP_SOURCE_IPV6 = 184,          /* TCP_SOURCE_IPV6  */
+  YYSYMBOL_TCP_OPT_FD_CACHE = 185,         /* TCP_OPT_FD_CACHE  */
+  YYSYMBOL_TCP_OPT_BUF_WRITE = 186,        /* TCP_OPT_BUF_WRITE  */
+  YYSYMBOL_TCP_OPT_CONN_WQ_MAX = 187,      /* TCP_OPT_CONN_WQ_MAX  */
+  YYSYMBOL_TCP_OPT_WQ_MAX = 188,           /* TCP_OPT_WQ_MAX  */
+  YYSYMBOL_TCP_OPT_RD_BUF = 189,           /* TCP_OPT_RD_BUF  */
+  YYSYMBOL_TCP_OPT_WQ_BLK = 190,           /* TCP_OPT_WQ_BLK  */
+  YYSYMBOL_TCP_OPT_DEFER_ACCEPT = 191,     /* TCP_OPT_DEFER_ACCEPT  */
+  YYSYMBOL_TCP_OPT_DELAYED_ACK = 192,      /* TCP_OPT_DELAYED_ACK  */
+  YYSYMBOL_TCP_OPT_SYNCNT = 193,           /* TCP_OPT_SYNCNT  */
+  YYSYMBOL_TCP_OPT_LINGER2 = 194,          /* TCP_OPT_LINGER2  */
+  YYSYMBOL_TCP_OPT_KEEPALIVE = 195,        /* TCP_OPT_KEEPALIVE  */
+  YYSYMBOL_TCP_OPT_KEEPIDLE = 196,         /* TCP_OPT_KEEPIDLE  */
+  YYSYMBOL_TCP_OPT_KEEPINTVL = 197,        /* TCP_OPT_KEEPINTVL  */
+  YYSYMBOL_TCP_OPT_KEEPCNT = 198,          /* TCP_OPT_KEEPCNT  */
+  YYSYMBOL_TCP_OPT_CRLF_PING = 199,        /* TCP_OPT_CRLF_PING  */
+  YYSYMBOL_TCP_OPT_ACCEPT_NO_CL = 200,     /* TCP_OPT_ACCEPT_NO_CL  */
+  YYSYMBOL_TCP_CLONE_RCVBUF = 201,         /* TCP_CLONE_RCVBUF  */
+  YYSYMBOL_DISABLE_TLS = 202,              /* DISABLE_TLS  */
+  YYSYMBOL_ENABLE_TLS = 203,               /* ENABLE_TLS  */
+  YYSYMBOL_TLSLOG = 204,                   /* TLSLOG  */
+  YYSYMBOL_TLS_PORT_NO = 205,              /* TLS_PORT_NO  */
+  YYSYMBOL_TLS_METHOD = 206,               /* TLS_METHOD  */
+  YYSYMBOL_TLS_HANDSHAKE_TIMEOUT = 207,    /* TLS_HANDSHAKE_TIMEOUT  */
+  YYSYMBOL_TLS_SEND_TIMEOUT = 208,         /* TLS_SEND_TIMEOUT  */
+  YYSYMBOL_SSLv23 = 209,                   /* SSLv23  */
+  YYSYMBOL_SSLv2 = 210,                    /* SSLv2  */
+  YYSYMBOL_SSLv3 = 211,                    /* SSLv3  */
+  YYSYMBOL_TLSv1 = 212,                    /* TLSv1  */
+  YYSYMBOL_TLS_VERIFY = 213,               /* TLS_VERIFY  */
+  YYSYMBOL_TLS_REQUIRE_CERTIFICATE = 214,  /* TLS_REQUIRE_CERTIFICATE  */
+  YYSYMBOL_TLS_CERTIFICATE = 215,          /* TLS_CERTIFICATE  */
+  YYSYMBOL_TLS_PRIVATE_KEY = 216,          /* TLS_PRIVATE_KEY  */
+  YYSYMBOL_TLS_CA_LIST = 217,              /* TLS_CA_LIST  */
+  YYSYMBOL_DISABLE_SCTP = 218,             /* DISABLE_SCTP  */
+  YYSYMBOL_ENABLE_SCTP = 219,              /* ENABLE_SCTP  */
+  YYSYMBOL_SCTP_CHILDREN = 220,            /* SCTP_CHILDREN  */
+  YYSYMBOL_ADVERTISED_ADDRESS = 221,       /* ADVERTISED_ADDRESS  */
+  YYSYMBOL_ADVERTISED_PORT = 222,          /* ADVERTISED_PORT  */
+  YYSYMBOL_DISABLE_CORE = 223,             /* DISABLE_CORE  */
+  YYSYMBOL_OPEN_FD_LIMIT = 224,            /* OPEN_FD_LIMIT  */
+  YYSYMBOL_SHM_MEM_SZ = 225,               /* SHM_MEM_SZ  */
+  YYSYMBOL_SHM_FORCE_ALLOC = 226,          /* SHM_FORCE_ALLOC  */
+  YYSYMBOL_MLOCK_PAGES = 227,              /* MLOCK_PAGES  */
+  YYSYMBOL_REAL_TIME = 228,                /* REAL_TIME  */
+  YYSYMBOL_RT_PRIO = 229,                  /* RT_PRIO  */
+  YYSYMBOL_RT_POLICY = 230,                /* RT_POLICY  */
+  YYSYMBOL_RT_TIMER1_PRIO = 231,           /* RT_TIMER1_PRIO  */
+  YYSYMBOL_RT_TIMER1_POLICY = 232,         /* RT_TIMER1_POLICY  */
+  YYSYMBOL_RT_TIMER2_PRIO = 233,           /* RT_TIMER2_PRIO  */
+  YYSYMBOL_RT_TIMER2_POLICY = 234,         /* RT_TIMER2_POLICY  */
+  YYSYMBOL_MCAST_LOOPBACK = 235,           /* MCAST_LOOPBACK  */
+  YYSYMBOL_MCAST_TTL = 236,                /* MCAST_TTL  */
+  YYSYMBOL_TOS = 237,                      /* TOS  */
+  YYSYMBOL_PMTU_DISCOVERY = 238,           /* PMTU_DISCOVERY  */
+  YYSYMBOL_KILL_TIMEOUT = 239,             /* KILL_TIMEOUT  */
+  YYSYMBOL_MAX_WLOOPS = 240,               /* MAX_WLOOPS  */
+  YYSYMBOL_PVBUFSIZE = 241,                /* PVBUFSIZE  */
+  YYSYMBOL_PVBUFSLOTS = 242,               /* PVBUFSLOTS  */
+  YYSYMBOL_HTTP_REPLY_PARSE = 243,         /* HTTP_REPLY_PARSE  */
+  YYSYMBOL_VERSION_TABLE_CFG = 244,        /* VERSION_TABLE_CFG  */
+  YYSYMBOL_CFG_DESCRIPTION = 245,          /* CFG_DESCRIPTION  */
+  YYSYMBOL_SERVER_ID = 246,                /* SERVER_ID  */
+  YYSYMBOL_LATENCY_LOG = 247,              /* LATENCY_LOG  */
+  YYSYMBOL_LATENCY_LIMIT_DB = 248,         /* LATENCY_LIMIT_DB  */
+  YYSYMBOL_LATENCY_LIMIT_ACTION = 249,     /* LATENCY_LIMIT_ACTION  */
+  YYSYMBOL_MSG_TIME = 250,                 /* MSG_TIME  */
+  YYSYMBOL_FLAGS_DECL = 251,               /* FLAGS_DECL  */
+  YYSYMBOL_AVPFLAGS_DECL = 252,            /* AVPFLAGS_DECL  */
+  YYSYMBOL_ATTR_MARK = 253,                /* ATTR_MARK  */
+  YYSYMBOL_SELECT_MARK = 254,              /* SELECT_MARK  */
+  YYSYMBOL_ATTR_FROM = 255,                /* ATTR_FROM  */
+  YYSYMBOL_ATTR_TO = 256,                  /* ATTR_TO  */
+  YYSYMBOL_ATTR_FROMURI = 257,             /* ATTR_FROMURI  */
+  YYSYMBOL_ATTR_TOURI = 258,               /* ATTR_TOURI  */
+  YYSYMBOL_ATTR_FROMUSER = 259,            /* ATTR_FROMUSER  */
+  YYSYMBOL_ATTR_TOUSER = 260,              /* ATTR_TOUSER  */
+  YYSYMBOL_ATTR_FROMDOMAIN = 261,          /* ATTR_FROMDOMAIN  */
+  YYSYMBOL_ATTR_TODOMAIN = 262,            /* ATTR_TODOMAIN  */
+  YYSYMBOL_ATTR_GLOBAL = 263,              /* ATTR_GLOBAL  */
+  YYSYMBOL_ADDEQ = 264,                    /* ADDEQ  */
+  YYSYMBOL_SUBST = 265,                    /* SUBST  */
+  YYSYMBOL_SUBSTDEF = 266,                 /* SUBSTDEF  */
+  YYSYMBOL_SUBSTDEFS = 267,                /* SUBSTDEFS  */
+  YYSYMBOL_EQUAL = 268,                    /* EQUAL  */
+  YYSYMBOL_LOG_OR = 269,                   /* LOG_OR  */
+  YYSYMBOL_LOG_AND = 270,                  /* LOG_AND  */
+  YYSYMBOL_BIN_OR = 271,                   /* BIN_OR  */
+  YYSYMBOL_BIN_AND = 272,                  /* BIN_AND  */
+  YYSYMBOL_BIN_XOR = 273,                  /* BIN_XOR  */
+  YYSYMBOL_BIN_LSHIFT = 274,               /* BIN_LSHIFT  */
+  YYSYMBOL_BIN_RSHIFT = 275,               /* BIN_RSHIFT  */
+  YYSYMBOL_EQUAL_T = 276,                  /* EQUAL_T  */
+  YYSYMBOL_DIFF = 277,                     /* DIFF  */
+  YYSYMBOL_MATCH = 278,                    /* MATCH  */
+  YYSYMBOL_INTEQ = 279,                    /* INTEQ  */
+  YYSYMBOL_INTDIFF = 280,                  /* INTDIFF  */
+  YYSYMBOL_STREQ = 281,                    /* STREQ  */
+  YYSYMBOL_STRDIFF = 282,                  /* STRDIFF  */
+  YYSYMBOL_GT = 283,                       /* GT  */
+  YYSYMBOL_LT = 284,                       /* LT  */
+  YYSYMBOL_GTE = 285,                      /* GTE  */
+  YYSYMBOL_LTE = 286,                      /* LTE  */
+  YYSYMBOL_PLUS = 287,                     /* PLUS  */
+  YYSYMBOL_MINUS = 288,                    /* MINUS  */
+  YYSYMBOL_STAR = 289,                     /* STAR  */
+  YYSYMBOL_SLASH = 290,                    /* SLASH  */
+  YYSYMBOL_MODULO = 291,                   /* MODULO  */
+  YYSYMBOL_NOT = 292,                      /* NOT  */
+  YYSYMBOL_UNARY = 293,                    /* UNARY  */
+  YYSYMBOL_BIN_NOT = 294,                  /* BIN_NOT  */
+  YYSYMBOL_DEFINED = 295,                  /* DEFINED  */
+  YYSYMBOL_INTCAST = 296,                  /* INTCAST  */
+  YYSYMBOL_STRCAST = 297,                  /* STRCAST  */
+  YYSYMBOL_DOT = 298,                      /* DOT  */
+  YYSYMBOL_STRLEN = 299,                   /* STRLEN  */
+  YYSYMBOL_STREMPTY = 300,                 /* STREMPTY  */
+  YYSYMBOL_NUMBER = 301,                   /* NUMBER  */
+  YYSYMBOL_ID = 302,                       /* ID  */
+  YYSYMBOL_NUM_ID = 303,                   /* NUM_ID  */
+  YYSYMBOL_STRING = 304,                   /* STRING  */
+  YYSYMBOL_IPV6ADDR = 305,                 /* IPV6ADDR  */
+  YYSYMBOL_PVAR = 306,                     /* PVAR  */
+  YYSYMBOL_AVP_OR_PVAR = 307,              /* AVP_OR_PVAR  */
+  YYSYMBOL_EVENT_RT_NAME = 308,            /* EVENT_RT_NAME  */
+  YYSYMBOL_COMMA = 309,                    /* COMMA  */
+  YYSYMBOL_SEMICOLON = 310,                /* SEMICOLON  */
+  YYSYMBOL_RPAREN = 311,                   /* RPAREN  */
+  YYSYMBOL_LPAREN = 312,                   /* LPAREN  */
+  YYSYMBOL_LBRACE = 313,                   /* LBRACE  */
+  YYSYMBOL_RBRACE = 314,                   /* RBRACE  */
+  YYSYMBOL_LBRACK = 315,                   /* LBRACK  */
+  YYSYMBOL_RBRACK = 316,                   /* RBRACK  */
+  YYSYMBOL_CR = 317,                       /* CR  */
+  YYSYMBOL_COLON = 318,                    /* COLON  */
+  YYSYMBOL_YYACCEPT = 319,                 /* $accept  */
+  YYSYMBOL_cfg = 320,                      /* cfg  */
+  YYSYMBOL_statements = 321,               /* statements  */
+  YYSYMBOL_statement = 322,                /* statement  */
+  YYSYMBOL_323_1 = 323,                    /* $@1  */
+  YYSYMBOL_324_2 = 324,                    /* $@2  */
+  YYSYMBOL_325_3 = 325,                    /* $@3  */
+  YYSYMBOL_326_4 = 326,                    /* $@4  */
+  YYSYMBOL_327_5 = 327,                    /* $@5  */
+  YYSYMBOL_listen_id = 328,                /* listen_id  */
+  YYSYMBOL_listen_id_lst = 329,            /* listen_id_lst  */
+  YYSYMBOL_listen_id2 = 330,               /* listen_id2  */
+  YYSYMBOL_proto = 331,                    /* proto  */
+  YYSYMBOL_eqproto = 332,                  /* eqproto  */
+  YYSYMBOL_port = 333,                     /* port  */
+  YYSYMBOL_phostport = 334,                /* phostport  */
+  YYSYMBOL_listen_phostport = 335,         /* listen_phostport  */
+  YYSYMBOL_id_lst = 336,                   /* id_lst  */
+  YYSYMBOL_intno = 337,                    /* intno  */
+  YYSYMBOL_flags_decl = 338,               /* flags_decl  */
+  YYSYMBOL_flag_list = 339,                /* flag_list  */
+  YYSYMBOL_flag_spec = 340,                /* flag_spec  */
+  YYSYMBOL_flag_name = 341,                /* flag_name  */
+  YYSYMBOL_avpflags_decl = 342,            /* avpflags_decl  */
+  YYSYMBOL_avpflag_list = 343,             /* avpflag_list  */
+  YYSYMBOL_avpflag_spec = 344,             /* avpflag_spec  */
+  YYSYMBOL_assign_stm = 345,               /* assign_stm  */
+  YYSYMBOL_cfg_var_id = 346,               /* cfg_var_id  */
+  YYSYMBOL_cfg_var = 347,                  /* cfg_var  */
+  YYSYMBOL_module_stm = 348,               /* module_stm  */
+  YYSYMBOL_ip = 349,                       /* ip  */
+  YYSYMBOL_ipv4 = 350,                     /* ipv4  */
+  YYSYMBOL_ipv6addr = 351,                 /* ipv6addr  */
+  YYSYMBOL_ipv6 = 352,                     /* ipv6  */
+  YYSYMBOL_route_name = 353,               /* route_name  */
+  YYSYMBOL_route_main = 354,               /* route_main  */
+  YYSYMBOL_route_stm = 355,                /* route_stm  */
+  YYSYMBOL_failure_route_stm = 356,        /* failure_route_stm  */
+  YYSYMBOL_route_reply_main = 357,         /* route_reply_main  */
+  YYSYMBOL_onreply_route_stm = 358,        /* onreply_route_stm  */
+  YYSYMBOL_359_6 = 359,                    /* $@6  */
+  YYSYMBOL_360_7 = 360,                    /* $@7  */
+  YYSYMBOL_branch_route_stm = 361,         /* branch_route_stm  */
+  YYSYMBOL_send_route_stm = 362,           /* send_route_stm  */
+  YYSYMBOL_event_route_stm = 363,          /* event_route_stm  */
+  YYSYMBOL_preprocess_stm = 364,           /* preprocess_stm  */
+  YYSYMBOL_equalop = 365,                  /* equalop  */
+  YYSYMBOL_cmpop = 366,                    /* cmpop  */
+  YYSYMBOL_strop = 367,                    /* strop  */
+  YYSYMBOL_rve_equalop = 368,              /* rve_equalop  */
+  YYSYMBOL_rve_cmpop = 369,                /* rve_cmpop  */
+  YYSYMBOL_uri_type = 370,                 /* uri_type  */
+  YYSYMBOL_eint_op_onsend = 371,           /* eint_op_onsend  */
+  YYSYMBOL_eint_op = 372,                  /* eint_op  */
+  YYSYMBOL_eip_op_onsend = 373,            /* eip_op_onsend  */
+  YYSYMBOL_eip_op = 374,                   /* eip_op  */
+  YYSYMBOL_exp_elem = 375,                 /* exp_elem  */
+  YYSYMBOL_ipnet = 376,                    /* ipnet  */
+  YYSYMBOL_host = 377,                     /* host  */
+  YYSYMBOL_host_if_id = 378,               /* host_if_id  */
+  YYSYMBOL_host_or_if = 379,               /* host_or_if  */
+  YYSYMBOL_fcmd = 380,                     /* fcmd  */
+  YYSYMBOL_stm = 381,                      /* stm  */
+  YYSYMBOL_actions = 382,                  /* actions  */
+  YYSYMBOL_action = 383,                   /* action  */
+  YYSYMBOL_if_cmd = 384,                   /* if_cmd  */
+  YYSYMBOL_ct_rval = 385,                  /* ct_rval  */
+  YYSYMBOL_single_case = 386,              /* single_case  */
+  YYSYMBOL_case_stms = 387,                /* case_stms  */
+  YYSYMBOL_switch_cmd = 388,               /* switch_cmd  */
+  YYSYMBOL_while_cmd = 389,                /* while_cmd  */
+  YYSYMBOL_select_param = 390,             /* select_param  */
+  YYSYMBOL_select_params = 391,            /* select_params  */
+  YYSYMBOL_select_id = 392,                /* select_id  */
+  YYSYMBOL_393_8 = 393,                    /* $@8  */
+  YYSYMBOL_attr_class_spec = 394,          /* attr_class_spec  */
+  YYSYMBOL_attr_name_spec = 395,           /* attr_name_spec  */
+  YYSYMBOL_attr_spec = 396,                /* attr_spec  */
+  YYSYMBOL_attr_mark = 397,                /* attr_mark  */
+  YYSYMBOL_attr_id = 398,                  /* attr_id  */
+  YYSYMBOL_attr_id_num_idx = 399,          /* attr_id_num_idx  */
+  YYSYMBOL_attr_id_no_idx = 400,           /* attr_id_no_idx  */
+  YYSYMBOL_attr_id_ass = 401,              /* attr_id_ass  */
+  YYSYMBOL_attr_id_any = 402,              /* attr_id_any  */
+  YYSYMBOL_attr_id_any_str = 403,          /* attr_id_any_str  */
+  YYSYMBOL_pvar = 404,                     /* pvar  */
+  YYSYMBOL_avp_pvar = 405,                 /* avp_pvar  */
+  YYSYMBOL_assign_op = 406,                /* assign_op  */
+  YYSYMBOL_lval = 407,                     /* lval  */
+  YYSYMBOL_rval = 408,                     /* rval  */
+  YYSYMBOL_rve_un_op = 409,                /* rve_un_op  */
+  YYSYMBOL_rval_expr = 410,                /* rval_expr  */
+  YYSYMBOL_assign_action = 411,            /* assign_action  */
+  YYSYMBOL_avpflag_oper = 412,             /* avpflag_oper  */
+  YYSYMBOL_cmd = 413,                      /* cmd  */
+  YYSYMBOL_414_9 = 414,                    /* $@9  */
+  YYSYMBOL_func_params = 415,              /* func_params  */
+  YYSYMBOL_func_param = 416,               /* func_param  */
+  YYSYMBOL_ret_cmd = 417                   /* ret_cmd  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  406
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   11794
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  319
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  99
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  833
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1556
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   573
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   666,   666,   669,   670,   671,   674,   675,   676,   677,
+     678,   679,   679,   680,   680,   681,   682,   682,   683,   683,
+     684,   684,   685,   686,   689,   707,   716,   731,   732,   738,
+     739,   743,   744,   745,   746,   747,   750,   751,   752,   753,
+     754,   755,   756,   759,   760,   763,   764,   765,   766,   767,
+     771,   772,   773,   774,   775,   779,   780,   783,   784,   787,
+     788,   790,   791,   794,   797,   803,   804,   808,   809,   812,
+     813,   816,   822,   823,   824,   825,   826,   827,   828,   829,
+     830,   833,   834,   840,   841,   842,   843,   844,   845,   846,
+     847,   848,   849,   850,   851,   852,   853,   854,   855,   856,
+     857,   858,   859,   860,   861,   863,   864,   865,   866,   867,
+     868,   869,   870,   871,   872,   873,   874,   875,   876,   877,
+     878,   879,   880,   881,   882,   883,   884,   885,   886,   887,
+     888,   889,   890,   891,   892,   893,   894,   895,   896,   897,
+     898,   899,   900,   903,   904,   907,   908,   911,   912,   913,
+     914,   917,   918,   921,   922,   925,   926,   929,   930,   931,
+     936,   937,   938,   939,   940,   941,   942,   943,   944,   945,
+     946,   947,   948,   949,   950,   951,   952,   953,   954,   955,
+     956,   957,   958,   959,   960,   961,   962,   963,   964,   965,
+     966,   967,   968,   969,   970,   971,   972,   973,   976,   977,
+     984,   991,   992,   993,   994,   995,   996,   997,   998,   999,
+    1000,  1001,  1002,  1003,  1010,  1011,  1018,  1019,  1026,  1027,
+    1034,  1035,  1042,  1043,  1053,  1054,  1068,  1082,  1083,  1090,
+    1091,  1098,  1099,  1106,  1107,  1116,  1117,  1126,  1127,  1134,
+    1135,  1142,  1143,  1150,  1151,  1158,  1159,  1166,  1167,  1174,
+    1175,  1182,  1183,  1190,  1191,  1198,  1199,  1206,  1207,  1214,
+    1215,  1222,  1223,  1230,  1231,  1238,  1239,  1246,  1247,  1254,
+    1255,  1262,  1263,  1270,  1271,  1278,  1279,  1286,  1287,  1294,
+    1295,  1302,  1309,  1316,  1323,  1330,  1337,  1338,  1345,  1346,
+    1353,  1354,  1361,  1362,  1369,  1370,  1377,  1378,  1385,  1386,
+    1393,  1394,  1401,  1402,  1409,  1410,  1411,  1412,  1415,  1416,
+    1419,  1420,  1421,  1422,  1435,  1449,  1451,  1462,  1463,  1464,
+    1465,  1471,  1472,  1482,  1483,  1484,  1485,  1486,  1487,  1494,
+    1495,  1502,  1503,  1504,  1505,  1506,  1507,  1508,  1509,  1510,
+    1511,  1512,  1513,  1514,  1515,  1516,  1517,  1518,  1519,  1526,
+    1527,  1534,  1535,  1536,  1563,  1564,  1565,  1566,  1567,  1568,
+    1569,  1570,  1571,  1572,  1573,  1574,  1575,  1576,  1577,  1578,
+    1579,  1580,  1581,  1582,  1583,  1584,  1585,  1586,  1587,  1589,
+    1590,  1592,  1594,  1595,  1596,  1599,  1600,  1603,  1604,  1605,
+    1608,  1609,  1613,  1618,  1623,  1628,  1633,  1636,  1641,  1649,
+    1655,  1656,  1661,  1662,  1667,  1668,  1679,  1690,  1693,  1694,
+    1697,  1726,  1741,  1742,  1746,  1756,  1757,  1761,  1762,  1766,
+    1775,  1793,  1794,  1797,  1806,  1824,  1828,  1829,  1834,  1834,
+    1843,  1844,  1846,  1845,  1870,  1875,  1884,  1902,  1904,  1913,
+    1931,  1933,  1952,  1955,  1956,  1957,  1958,  1959,  1960,  1982,
+    1983,  1984,  1985,  1988,  1989,  1990,  1991,  1994,  1995,  2001,
+    2002,  2003,  2004,  2005,  2006,  2007,  2010,  2011,  2012,  2013,
+    2020,  2021,  2022,  2029,  2030,  2031,  2035,  2036,  2037,  2038,
+    2039,  2044,  2045,  2048,  2049,  2050,  2056,  2058,  2060,  2061,
+    2063,  2065,  2067,  2069,  2071,  2072,  2074,  2075,  2076,  2077,
+    2079,  2081,  2083,  2085,  2087,  2089,  2090,  2126,  2128,  2130,
+    2132,  2135,  2137,  2139,  2141,  2158,  2159,  2170,  2171,  2175,
+    2176,  2192,  2208,  2209,  2212,  2213,  2214,  2223,  2224,  2240,
+    2256,  2258,  2265,  2307,  2308,  2311,  2312,  2313,  2316,  2317,
+    2318,  2319,  2320,  2321,  2322,  2323,  2326,  2334,  2344,  2361,
+    2368,  2375,  2382,  2389,  2394,  2399,  2400,  2401,  2402,  2403,
+    2406,  2415,  2422,  2447,  2463,  2464,  2469,  2488,  2497,  2509,
+    2524,  2525,  2528,  2528,  2538,  2539,  2540,  2541,  2542,  2543,
+    2544,  2545,  2546,  2549,  2552,  2553,  2556,  2563,  2566,  2573,
+    2579,  2580,  2589,  2590,  2591,  2594,  2595,  2607,  2631,  2642,
+    2673,  2677,  2687,  2701,  2713,  2714,  2716,  2717,  2718,  2732,
+    2733,  2734,  2735,  2736,  2737,  2738,  2742,  2743,  2744,  2757,
+    2763,  2764,  2765,  2766,  2767,  2768,  2769,  2770,  2771,  2772,
+    2773,  2774,  2775,  2776,  2777,  2795,  2796,  2797,  2798,  2799,
+    2800,  2801,  2802,  2803,  2804,  2805,  2806,  2807,  2808,  2809,
+    2810,  2811,  2813,  2815,  2816,  2817,  2818,  2819,  2822,  2840,
+    2841,  2842,  2845,  2846,  2847,  2848,  2849,  2850,  2851,  2852,
+    2853,  2854,  2855,  2856,  2857,  2858,  2859,  2860,  2861,  2862,
+    2863,  2864,  2865,  2866,  2867,  2868,  2869,  2870,  2871,  2872,
+    2873,  2874,  2875,  2876,  2877,  2878,  2879,  2887,  2895,  2903,
+    2911,  2919,  2927,  2935,  2943,  2951,  2952,  2954,  2962,  2970,
+    2978,  2987,  2996,  3005,  3013,  3022,  3030,  3031,  3033,  3036,
+    3037,  3038,  3039,  3046,  3053,  3054,  3060,  3067,  3068,  3074,
+    3081,  3082,  3088,  3091,  3094,  3095,  3096,  3099,  3100,  3101,
+    3110,  3119,  3120,  3121,  3122,  3123,  3124,  3125,  3126,  3127,
+    3128,  3129,  3130,  3131,  3132,  3133,  3134,  3135,  3136,  3140,
+    3144,  3145,  3146,  3147,  3148,  3149,  3150,  3151,  3152,  3153,
+    3154,  3155,  3156,  3157,  3158,  3159,  3160,  3161,  3162,  3163,
+    3164,  3165,  3166,  3167,  3168,  3169,  3170,  3171,  3179,  3187,
+    3195,  3196,  3198,  3200,  3211,  3212,  3213,  3229,  3230,  3231,
+    3235,  3238,  3239,  3242,  3245,  3248,  3251,  3254,  3257,  3260,
+    3263,  3266,  3269,  3270,  3271,  3274,  3275,  3276,  3276,  3304,
+    3306,  3308,  3309,  3312,  3329,  3333,  3337,  3341,  3346,  3350,
+    3355,  3359,  3363,  3367
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "FORWARD",
+  "FORWARD_TCP", "FORWARD_TLS", "FORWARD_SCTP", "FORWARD_UDP", "EXIT",
+  "DROP", "RETURN", "BREAK", "LOG_TOK", "ERROR", "ROUTE", "ROUTE_REQUEST",
+  "ROUTE_FAILURE", "ROUTE_ONREPLY", "ROUTE_REPLY", "ROUTE_BRANCH",
+  "ROUTE_SEND", "ROUTE_EVENT", "EXEC", "SET_HOST", "SET_HOSTPORT",
+  "SET_HOSTPORTTRANS", "PREFIX", "STRIP", "STRIP_TAIL", "SET_USERPHONE",
+  "APPEND_BRANCH", "REMOVE_BRANCH", "CLEAR_BRANCHES", "SET_USER",
+  "SET_USERPASS", "SET_PORT", "SET_URI", "REVERT_URI", "FORCE_RPORT",
+  "ADD_LOCAL_RPORT", "FORCE_TCP_ALIAS", "UDP_MTU", "UDP_MTU_TRY_PROTO",
+  "UDP4_RAW", "UDP4_RAW_MTU", "UDP4_RAW_TTL", "IF", "ELSE",
+  "SET_ADV_ADDRESS", "SET_ADV_PORT", "FORCE_SEND_SOCKET",
+  "SET_FWD_NO_CONNECT", "SET_RPL_NO_CONNECT", "SET_FWD_CLOSE",
+  "SET_RPL_CLOSE", "SWITCH", "CASE", "DEFAULT", "WHILE", "CFG_SELECT",
+  "CFG_RESET", "URIHOST", "URIPORT", "MAX_LEN", "SETFLAG", "RESETFLAG",
+  "ISFLAGSET", "SETAVPFLAG", "RESETAVPFLAG", "ISAVPFLAGSET", "METHOD",
+  "URI", "FROM_URI", "TO_URI", "SRCIP", "SRCPORT", "DSTIP", "DSTPORT",
+  "TOIP", "TOPORT", "SNDIP", "SNDPORT", "SNDPROTO", "SNDAF", "PROTO", "AF",
+  "MYSELF", "MSGLEN", "UDP", "TCP", "TLS", "SCTP", "WS", "WSS", "DEBUG_V",
+  "FORK", "FORK_DELAY", "MODINIT_DELAY", "LOGSTDERROR", "LOGFACILITY",
+  "LOGNAME", "LOGCOLOR", "LISTEN", "ADVERTISE", "ALIAS", "SR_AUTO_ALIASES",
+  "DNS", "REV_DNS", "DNS_TRY_IPV6", "DNS_TRY_NAPTR", "DNS_SRV_LB",
+  "DNS_UDP_PREF", "DNS_TCP_PREF", "DNS_TLS_PREF", "DNS_SCTP_PREF",
+  "DNS_RETR_TIME", "DNS_RETR_NO", "DNS_SERVERS_NO", "DNS_USE_SEARCH",
+  "DNS_SEARCH_FMATCH", "DNS_NAPTR_IGNORE_RFC", "DNS_CACHE_INIT",
+  "DNS_USE_CACHE", "DNS_USE_FAILOVER", "DNS_CACHE_FLAGS",
+  "DNS_CACHE_NEG_TTL", "DNS_CACHE_MIN_TTL", "DNS_CACHE_MAX_TTL",
+  "DNS_CACHE_MEM", "DNS_CACHE_GC_INT", "DNS_CACHE_DEL_NONEXP",
+  "AUTO_BIND_IPV6", "DST_BLST_INIT", "USE_DST_BLST", "DST_BLST_MEM",
+  "DST_BLST_TTL", "DST_BLST_GC_INT", "DST_BLST_UDP_IMASK",
+  "DST_BLST_TCP_IMASK", "DST_BLST_TLS_IMASK", "DST_BLST_SCTP_IMASK",
+  "PORT", "STAT", "CHILDREN", "SOCKET_WORKERS", "FOLD_CONST_COND",
+  "UDP_RCV_BATCH", "UDP_SND_BATCH", "UDP_REUSE_PORT",
+  "SOCKET_CPU_AFFINITY", "CHECK_VIA", "PHONE2TEL", "MEMLOG", "MEMDBG",
+  "MEMSUM", "MEMSAFETY", "MEMJOIN", "CORELOG", "SIP_WARNING",
+  "SERVER_SIGNATURE", "SERVER_HEADER", "USER_AGENT_HEADER", "REPLY_TO_VIA",
+  "LOADMODULE", "LOADPATH", "MODPARAM", "MAXBUFFER", "SQL_BUFFER_SIZE",
+  "USER", "GROUP", "CHROOT", "WDIR", "MHOMED", "DISABLE_TCP",
+  "TCP_ACCEPT_ALIASES", "TCP_CHILDREN", "TCP_CONNECT_TIMEOUT",
+  "TCP_SEND_TIMEOUT", "TCP_CON_LIFETIME", "TCP_POLL_METHOD",
+  "TCP_MAX_CONNECTIONS", "TLS_MAX_CONNECTIONS", "TCP_NO_CONNECT",
+  "TCP_SOURCE_IPV4", "TCP_SOURCE_IPV6", "TCP_OPT_FD_CACHE",
+  "TCP_OPT_BUF_WRITE", "TCP_OPT_CONN_WQ_MAX", "TCP_OPT_WQ_MAX",
+  "TCP_OPT_RD_BUF", "TCP_OPT_WQ_BLK", "TCP_OPT_DEFER_ACCEPT",
+  "TCP_OPT_DELAYED_ACK", "TCP_OPT_SYNCNT", "TCP_OPT_LINGER2",
+  "TCP_OPT_KEEPALIVE", "TCP_OPT_KEEPIDLE", "TCP_OPT_KEEPINTVL",
+  "TCP_OPT_KEEPCNT", "TCP_OPT_CRLF_PING", "TCP_OPT_ACCEPT_NO_CL",
+  "TCP_CLONE_RCVBUF", "DISABLE_TLS", "ENABLE_TLS", "TLSLOG", "TLS_PORT_NO",
+  "TLS_METHOD", "TLS_HANDSHAKE_TIMEOUT", "TLS_SEND_TIMEOUT", "SSLv23",
+  "SSLv2", "SSLv3", "TLSv1", "TLS_VERIFY", "TLS_REQUIRE_CERTIFICATE",
+  "TLS_CERTIFICATE", "TLS_PRIVATE_KEY", "TLS_CA_LIST", "DISABLE_SCTP",
+  "ENABLE_SCTP", "SCTP_CHILDREN", "ADVERTISED_ADDRESS", "ADVERTISED_PORT",
+  "DISABLE_CORE", "OPEN_FD_LIMIT", "SHM_MEM_SZ", "SHM_FORCE_ALLOC",
+  "MLOCK_PAGES", "REAL_TIME", "RT_PRIO", "RT_POLICY", "RT_TIMER1_PRIO",
+  "RT_TIMER1_POLICY", "RT_TIMER2_PRIO", "RT_TIMER2_POLICY",
+  "MCAST_LOOPBACK", "MCAST_TTL", "TOS", "PMTU_DISCOVERY", "KILL_TIMEOUT",
+  "MAX_WLOOPS", "PVBUFSIZE", "PVBUFSLOTS", "HTTP_REPLY_PARSE",
+  "VERSION_TABLE_CFG", "CFG_DESCRIPTION", "SERVER_ID", "LATENCY_LOG",
+  "LATENCY_LIMIT_DB", "LATENCY_LIMIT_ACTION", "MSG_TIME", "FLAGS_DECL",
+  "AVPFLAGS_DECL", "ATTR_MARK", "SELECT_MARK", "ATTR_FROM", "ATTR_TO",
+  "ATTR_FROMURI", "ATTR_TOURI", "ATTR_FROMUSER", "ATTR_TOUSER",
+  "ATTR_FROMDOMAIN", "ATTR_TODOMAIN", "ATTR_GLOBAL", "ADDEQ", "SUBST",
+  "SUBSTDEF", "SUBSTDEFS", "EQUAL", "LOG_OR", "LOG_AND", "BIN_OR",
+  "BIN_AND", "BIN_XOR", "BIN_LSHIFT", "BIN_RSHIFT", "EQUAL_T", "DIFF",
+  "MATCH", "INTEQ", "INTDIFF", "STREQ", "STRDIFF", "GT", "LT", "GTE",
+  "LTE", "PLUS", "MINUS", "STAR", "SLASH", "MODULO", "NOT", "UNARY",
+  "BIN_NOT", "DEFINED", "INTCAST", "STRCAST", "DOT", "STRLEN", "STREMPTY",
+  "NUMBER", "ID", "NUM_ID", "STRING", "IPV6ADDR", "PVAR", "AVP_OR_PVAR",
+  "EVENT_RT_NAME", "COMMA", "SEMICOLON", "RPAREN", "LPAREN", "LBRACE",
+  "RBRACE", "LBRACK", "RBRACK", "CR", "COLON", "$accept", "cfg",
+  "statements", "statement", "$@1", "$@2", "$@3", "$@4", "$@5",
+  "listen_id", "listen_id_lst", "listen_id2", "proto", "eqproto", "port",
+  "phostport", "listen_phostport", "id_lst", "intno", "flags_decl",
+  "flag_list", "flag_spec", "flag_name", "avpflags_decl", "avpflag_list",
+  "avpflag_spec", "assign_stm", "cfg_var_id", "cfg_var", "module_stm",
+  "ip", "ipv4", "ipv6addr", "ipv6", "route_name", "route_main",
+  "route_stm", "failure_route_stm", "route_reply_main",
+  "onreply_route_stm", "$@6", "$@7", "branch_route_stm", "send_route_stm",
+  "event_route_stm", "preprocess_stm", "equalop", "cmpop", "strop",
+  "rve_equalop", "rve_cmpop", "uri_type", "eint_op_onsend", "eint_op",
+  "eip_op_onsend", "eip_op", "exp_elem", "ipnet", "host", "host_if_id",
+  "host_or_if", "fcmd", "stm", "actions", "action", "if_cmd", "ct_rval",
+  "single_case", "case_stms", "switch_cmd", "while_cmd", "select_param",
+  "select_params", "select_id", "$@8", "attr_class_spec", "attr_name_spec",
+  "attr_spec", "attr_mark", "attr_id", "attr_id_num_idx", "attr_id_no_idx",
+  "attr_id_ass", "attr_id_any", "attr_id_any_str", "pvar", "avp_pvar",
+  "assign_op", "lval", "rval", "rve_un_op", "rval_expr", "assign_action",
+  "avpflag_oper", "cmd", "$@9", "func_params", "func_param", "ret_cmd", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-1029)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-818)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    2578,  -188,    36,    14,  -182,  -168,  -155,  -112,   -96,   -40,
+   -1029,   -33,   -23,   -22,   -18,    -1,    13,    22,    28,    37,
+     387,   388,   400,   424,   165,   192,   573,   630,   631,   740,
+     751,   754,   755,   756,   768,   773,   779,   784,   796,   802,
+     806,   810,   812,   813,   824,   841,   845,   846,   858,   859,
+     878,   879,   880,   881,   887,   888,   889,   444,   459,   469,
+     474,   475,   500,   507,   511,   516,   524,   530,   534,   550,
+     554,   558,   562,   575,   583,   633,   652,   666,   686,    64,
+      33,    38,   720,   753,   758,   765,   782,   788,   789,   819,
+     820,   823,   828,   836,   837,   840,   852,   857,   861,   865,
+     877,   882,   884,   890,   891,   892,   894,   885,   893,   901,
+     929,   935,   936,   937,   947,   959,   986,   987,   989,  1003,
+    1012,  1014,  1037,  1039,  1040,  1049,  1050,  1051,  1054,  1055,
+    1056,  1092,  1095,  1096,  1097,  1098,  1099,  1102,  1103,  1111,
+    1113,  1220,  1221,  1222,  1223,  1224,  1225,  1226,  1227,  1228,
+     895,  1229,  1230,  1231,  1232,  1233,  1236,  1238,  1239,  1240,
+    1241,  1242,   105,   220,   100,   119,   126, -1029, -1029, -1029,
+     168,  1502, -1029,   203,   283,   403,   803,   883, -1029, -1029,
+   -1029,  -230, -1029, -1029,   587, -1029, -1029, -1029, -1029,   -90,
+   -1029,    53,   169,   776,   309,   251,   253,   313,   312,   339,
+     434,   435,    54,   191,   460,    43,    70,   531,   585,   593,
+   -1029,   609, -1029,   610, -1029,   623, -1029,  -213, -1029,  -213,
+   -1029,  -213, -1029,  -213, -1029,   648, -1029,   651, -1029,   664,
+   -1029,   673, -1029,   694, -1029,   747, -1029,   833, -1029,   960,
+   -1029,  1067, -1029,  1074, -1029,  1211, -1029,  1212, -1029,  1234,
+   -1029,  1235, -1029,  1237, -1029,  1247, -1029,  1249, -1029,  1250,
+   -1029,  1251, -1029,  1253, -1029,  1263, -1029,  1268, -1029,  1269,
+   -1029,  1270, -1029,  1271, -1029,  1274,   602,  1273,   605,   606,
+     611,   618,   621,   622,   624,   625,   632,   316,   317,   323,
+     333,   351,   405,   634,   635,   209,   219,   636, -1029, -1029,
+   -1029,   229, -1029, -1029,  1275,   637,   640,   224,   255,   256,
+     261,   642,   643,   644,   645,   407,   431,   498,   264,   646,
+     647,   649,   650,    20,   656,   657, -1029,  1277, -1029,  1279,
+   -1029,  1280, -1029,  1281,   658,   659,   660,   661,   662,   663,
+     669,   670,   671,   672,   674,   675,   676,   677,   678,   704,
+     679,   680,   681,   682,   235,   242,   247,   683,   684,   693,
+      76,   695,   696,   697,   698,   699,   700,   701,   702,   703,
+     706,   708,   712,   713,   714,   715,   143, -1029,  1282,   716,
+     717,   719,   724,   727,   257,  1283,   728,   729,   730,   733,
+   -1029, -1029, -1029, -1029,  1215,  1207, -1029, -1029, -1029,  1217,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029,  -188, -1029,    47,
+      40,  1214, -1029,    52, -1029,    83, -1029,   102, -1029,    16,
+   -1029,     9,  1284, -1029, -1029, -1029, -1029,  1213, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+    1285, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029,   655, -1029, -1029, -1029, -1029,   948,
+    1286, -1029,  1210,  1216,   839,  1427, -1029, -1029, -1029, -1029,
+   -1029,  -219, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,  1296, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,   655,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029,  -100,  1287,  -100, -1029,   -90, -1029, 11484,
+   -1029, 11484,   -90, -1029, 11484,   -90, -1029, 11484,   -90, -1029,
+    1403,  1264,  1276, 11484,    56, -1029,  1288,  1404,  1401,  1278,
+     555,   897, -1029,   948,   288,   297,  1289, -1029, -1029, -1029,
+    1398,    49,    71,    72,    77,    80, 10462, 10773, 10858, -1029,
+      81,   104,   106,  1219,   108,   114,   127,   128,   129,   134,
+     135,   137,  1435,   139,   145,   150,   153,  1443,  1444,  1445,
+    1446,  1447, 10964,   156,   161,   163,  1448,  1449,  1450,  1451,
+    6119, 10964,   172,   177,   179,   182,   184, -1029, -1029, -1029,
+   -1029,   190, -1029, -1029, -1029,    10,  3482, -1029, -1029, -1029,
+   -1029,   930, -1029, -1029, -1029, -1029, -1029,  1265,  1454,   200,
+   -1029,  1455,  3551,  1479,  3621,  1480,  3933,  1481,  1482,   226,
+    1243,  4002, -1029,  1453,  1244,   948, -1029, -1029, -1029, -1029,
+   -1029, -1029,  1272,  1452, -1029, -1029, -1029, -1029, -1029,  1462,
+    1486, -1029,   123, -1029,   154, -1029,   162, -1029,   178, -1029,
+     199,   795, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029,  -129, -1029,  -129, -1029,   854, -1029, -1029,
+    1285, -1029, -1029,  6432,  6519,  6623,  1488,  1489, -1029,  5517,
+   11363, -1029,   808, -1029,   777, -1029,   834, -1029, -1029, -1029,
+     930, -1029, -1029, -1029, -1029, -1029, -1029, -1029,  6936,  2577,
+    5615,  2577,  5928,  2577, -1029,   246, -1029,   268, -1029,  7023,
+    1498, -1029,   271, -1029,   273, -1029,   275, -1029,   276, -1029,
+     737, -1029,   738, -1029,  1492, -1029,   141,  1494, -1029,   277,
+   -1029,   278, -1029,   279, -1029,   281,  1495,  1496,  1497,   206,
+     780,  7127, 10360, -1029,   233, -1029,   739, -1029,    98,  1499,
+    1500,  1504,  1505, -1029,  1131, 10360, -1029,   291, -1029,   292,
+   -1029,   -38, -1029,   638, -1029,   685, -1029,  1501, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029,  1511, -1029,  1517, -1029, 10964, -1029, -1029,
+      34, -1029, -1029,  1520, -1029,  1521, -1029,  1522,  1523, -1029,
+    1292,  1294,     9, -1029, 11484,  1516, -1029,  -199,  1536,  -107,
+   11484,  1527,   -85, -1029,   -50, -1029,   -36,  -172,  1547,    -7,
+     442,   462,   908,  1549,   501,   757,   791,   920,  1550,   856,
+     866,   870,   993,  1551,   919,   949,   961,  1071, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029,  7440,  5111,  5424, -1029,  1100,
+    1545, -1029, -1029, -1029, -1029, -1029, -1029,  7527,  7631,  1553,
+   -1029,  1605,  1606,  1610,  1611,  1176,  1569,  1574,  4071, -1029,
+    7944, -1029, -1029, -1029, -1029, -1029,  8031,  8135, -1029,  1261,
+    1586, -1029, -1029,  8448,  8535,  8639,  8952, 10964, 10964, 10964,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029,  9039,  9143,  9456,  9543,  9647,  9960, 10047, -1029, -1029,
+    1591,  1594,  1593,  1595,  1596,  1616,    31,  1503,  1618,  1619,
+    1620,  1622,  1631,  1632,  1636,  1637,  1638,  1646,  1659,  1660,
+    1661, -1029,  1662, -1029,  1663, -1029,  1664,  1665,  1674,  1685,
+    1687,  1688,  1689,  1691, -1029, -1029, -1029,  1700,  1701, -1029,
+    1705,  1706, 11484,  1860, -1029,  1707,  1755,  1757,  1758,  1760,
+    1598,  1754,  1762, -1029, -1029, -1029, -1029,    62, -1029,  1763,
+    1766,  1765,  1767,  1768,  1769,  1770,  1771,  1772,  1773, 10964,
+    1775,  1793,  2577,   967, -1029,   930, -1029,  1776, -1029, 11484,
+   11484, 11484, 11484,  1806,  1807,  1844,  4141,  1815, -1029, -1029,
+    1803,  1805,  4453, -1029,    29, -1029,  1816, -1029,  1819, -1029,
+     170,   239,  1820, -1029, -1029,   705, -1029,  1821, -1029,  1824,
+   -1029,  1830, -1029, -1029,   731, -1029,  1831, -1029,  1832, -1029,
+    1833, -1029, -1029,   766, -1029,  1835, -1029,  1836, -1029,  1837,
+   -1029, -1029,   774, -1029,  1839, -1029,  1840, -1029,  1841, -1029,
+   -1029,  1886,  1066, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029,  1066, -1029, -1029,  1066, -1029, -1029, -1029,  1828,
+   -1029,  1846,  1834,  1756,  1838,  2148, -1029, -1029, -1029, -1029,
+   -1029, -1029,  1955,  1066, -1029,  1066, -1029,   946, -1029,  2271,
+     655,  1817,  1856, -1029,  -184,  1066,  -227, -1029,  2901, -1029,
+    1152, -1029,  2231, -1029,  1195,  1774,  2165,  1107, -1029,   848,
+   -1029,   848, -1029, -1029, -1029, -1029, -1029, -1029, -1029,  1066,
+   -1029,   946, -1029,  1814, -1029, -1029,  1843, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029,  4522, 11173, -1029,
+   -1029, -1029, -1029, -1029,   586,   948, -1029,  1864,  6015,  1861,
+   -1029, -1029,     2, -1029, 11275, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029,  2577,   968, -1029, -1029, -1029,  -100, -1029,
+   -1029,   267,  4591,  4661,  4973,  5042, -1029, -1029,   -88, -1029,
+    1847, -1029, -1029, -1029,  1842,  1869,  1870,  1871, -1029, -1029,
+   -1029, -1029,  1872,  1873,  1874,  1875,  1876,  1878,  1879,  1880,
+    1883,  1889,  1890,  1891,  1892,  1894,  1895,  1896,  1898,  1899,
+    1900,  1901,  1902,   -82,  1545, -1029, -1029, -1029, -1029,    21,
+    1903,  1904,  1905, -1029, -1029, -1029, -1029,  1929, -1029,  1930,
+   10151,  1931,  2577, 11484, -1029, -1029,  1906,  2191, 10964, -1029,
+    1907,  1909,  1910, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029,  1934,  1935, -1029, -1029,   655,
+   -1029, -1029, -1029, -1029,  -199, 11484,  1936,  1937,  2347,  2893,
+   -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029, -1029,  2962,
+   11484, 11484, -1029,  3031,  3101,  3413
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     391,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   390,    22,    23,
+       0,     0,     4,     0,     0,     0,     0,     0,     8,     9,
+       6,     0,   388,    10,     0,    15,     7,   389,   430,     0,
+     431,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      93,     0,    95,     0,    97,     0,    99,     0,   101,     0,
+     103,     0,   105,     0,   107,     0,   109,     0,   111,     0,
+     113,     0,   115,     0,   117,     0,   119,     0,   121,     0,
+     123,     0,   125,     0,   127,     0,   131,     0,   129,     0,
+     133,     0,   135,     0,   137,     0,   139,     0,   141,     0,
+     143,     0,   145,     0,   147,     0,   149,     0,   151,     0,
+     153,     0,   155,     0,   157,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   400,   399,
+     402,     0,   401,   407,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   243,     0,   245,     0,
+     247,     0,   249,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   356,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      60,    66,    65,    59,    61,    63,    68,    71,    67,    69,
+     444,   443,   446,   445,   448,   447,     1,     5,     3,     0,
+       0,     0,    12,     0,    14,     0,    17,     0,    19,     0,
+      21,     0,     0,   428,   414,   415,   416,     0,   379,   378,
+     377,   376,   381,    31,    32,    33,    34,    35,   380,   383,
+       0,    57,   382,   385,   384,   387,   386,    73,    72,    75,
+      74,    77,    76,    79,    78,    81,    80,    83,    82,    85,
+      84,    87,    86,   315,   526,   524,   525,    25,   411,     0,
+       0,    30,    50,     0,    55,   313,    24,   408,   412,   409,
+     527,    26,   317,   316,   319,   318,    89,    88,    91,    90,
+      92,    94,    96,    98,   100,   102,   104,   106,   108,   110,
+     112,   114,   116,   118,   120,   122,   124,   126,   130,   128,
+     132,   134,   136,   138,   140,   142,   144,   146,   148,   150,
+     152,   154,   156,   164,   158,   159,   166,   165,   168,   167,
+     170,   169,   172,   171,   174,   173,   176,   175,   178,   177,
+     180,   179,   182,   181,   184,   183,   186,   185,   188,   187,
+     190,   189,   192,   191,   194,   193,   196,   195,   306,   305,
+     308,   307,   310,   309,   312,   311,   404,   403,     0,   161,
+     160,   163,   162,   201,   200,   199,   204,   203,   202,   207,
+     206,   205,   210,   209,   208,   212,   211,   214,   213,   216,
+     215,   218,   217,   220,   219,   222,   221,   224,   223,   227,
+     225,   226,   229,   228,   231,   230,   233,   232,   235,     0,
+     234,   237,   236,   239,   238,   241,   240,   242,   244,   246,
+     248,   251,   250,   253,   252,   255,   254,   257,   256,   259,
+     258,   261,   260,   263,   262,   265,   264,   267,   266,   269,
+     268,   271,   270,   273,   272,   275,   274,   277,   276,   279,
+     278,   284,   280,   281,   282,   283,   296,   295,   298,   297,
+     286,   285,   288,   287,   290,   289,   292,   291,   294,   293,
+     300,   299,   302,   301,   304,   303,   321,   320,   323,   322,
+     325,   324,   327,   326,   329,   328,   331,   330,   333,   332,
+     335,   334,   337,   336,   339,   338,   341,   340,   343,   342,
+     345,   344,   347,   346,   349,   348,   351,   350,   354,   352,
+     353,   355,   358,   357,   360,   359,   362,   361,   364,   363,
+     366,   365,   198,   197,   367,   369,   368,   371,   370,   373,
+     372,   375,   374,     0,     0,     0,   421,     0,   422,     0,
+     425,     0,     0,   437,     0,     0,   440,     0,     0,   442,
+       0,     0,     0,     0,     0,    58,     0,    27,     0,     0,
+       0,     0,    56,     0,     0,     0,     0,    62,    64,    70,
+       0,     0,     0,     0,     0,     0,   829,   826,   830,   833,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   782,   784,   786,
+     789,     0,     0,     0,     0,     0,   803,   805,   807,   809,
+       0,     0,     0,     0,     0,     0,     0,   659,   660,   661,
+     586,     0,   598,   599,   544,     0,     0,   536,   539,   540,
+     541,     0,   590,   591,   601,   602,   603,     0,     0,     0,
+     532,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   434,     0,     0,     0,    29,   413,    54,    44,
+      43,    51,    52,     0,   531,   526,   529,   530,   528,     0,
+       0,   672,     0,   694,     0,   705,     0,   716,     0,   683,
+       0,     0,   470,   471,   472,   483,   476,   484,   477,   482,
+     474,   481,   473,     0,   475,     0,   478,     0,   479,   572,
+     618,   616,   617,     0,     0,     0,     0,     0,   605,     0,
+       0,   604,     0,   480,     0,   485,     0,   611,   610,   609,
+       0,   592,   594,   593,   606,   607,   608,   619,     0,   828,
+       0,   825,     0,   832,   720,     0,   737,     0,   741,     0,
+       0,   745,     0,   764,     0,   767,     0,   748,     0,   754,
+       0,   751,     0,   757,     0,   760,     0,     0,   773,     0,
+     776,     0,   770,     0,   779,     0,     0,     0,     0,     0,
+       0,     0,     0,   795,     0,   798,     0,   801,     0,     0,
+       0,     0,     0,   564,     0,     0,   812,     0,   815,     0,
+     724,     0,   727,     0,   730,     0,   819,     0,   545,   538,
+     537,   419,   535,   574,   575,   576,   577,   578,   579,   580,
+     581,   582,   583,     0,   584,   587,   600,     0,   543,   735,
+       0,   542,   423,     0,   435,     0,   438,     0,     0,   396,
+     392,   393,     0,   429,     0,     0,    28,     0,     0,     0,
+       0,     0,     0,   519,     0,   662,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   489,   449,
+     450,   458,   451,   452,   457,     0,     0,     0,   514,     0,
+       0,   657,   640,   642,   621,   643,   622,     0,     0,     0,
+     827,   592,   593,   607,   608,     0,     0,     0,     0,   493,
+       0,   498,   453,   454,   455,   456,     0,     0,   510,     0,
+     587,   641,   620,     0,     0,     0,     0,     0,     0,     0,
+     459,   460,   465,   461,   462,   463,   464,   466,   467,   468,
+     469,     0,     0,     0,     0,     0,     0,     0,   824,   831,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   756,     0,   759,     0,   762,     0,     0,     0,     0,
+       0,     0,     0,     0,   781,   783,   785,     0,     0,   788,
+       0,     0,     0,   546,   533,     0,     0,     0,     0,     0,
+      45,     0,     0,   802,   804,   806,   808,     0,   566,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   820,
+       0,     0,   658,     0,   597,     0,   595,     0,   596,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    53,   314,
+       0,     0,     0,   673,     0,   671,     0,   664,     0,   665,
+       0,     0,     0,   663,   695,     0,   693,     0,   686,     0,
+     687,     0,   685,   706,     0,   704,     0,   697,     0,   698,
+       0,   696,   717,     0,   715,     0,   708,     0,   709,     0,
+     707,   684,     0,   682,     0,   675,     0,   676,     0,   674,
+     488,     0,   486,   504,    36,    37,    38,    39,    40,    41,
+      42,   502,   503,   501,   499,   500,   513,   511,   512,   567,
+     571,   573,     0,     0,     0,     0,   615,   637,   614,   613,
+     612,   492,     0,   490,   497,   495,   496,   494,   509,     0,
+      57,     0,   517,   505,   507,   506,     0,   654,   636,   653,
+     635,   649,   628,   650,   629,   630,   631,   632,   644,   623,
+     645,   624,   646,   625,   647,   626,   648,   627,   652,   634,
+     651,   633,   721,     0,   718,   738,     0,   742,   740,   739,
+     743,   746,   744,   765,   763,   768,   766,   749,   747,   755,
+     753,   752,   750,   761,   758,   774,   772,   777,   775,   771,
+     769,   780,   778,   790,   787,   792,   791,     0,     0,   794,
+     793,   797,   796,   800,     0,     0,   799,     0,     0,     0,
+     563,   561,     0,   813,     0,   816,   814,   722,   723,   725,
+     726,   728,   729,   823,     0,   822,   585,   589,     0,   734,
+     587,     0,     0,     0,     0,     0,   394,   395,     0,   433,
+       0,   405,   406,   420,     0,     0,     0,     0,   523,   521,
+     522,   520,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   655,   638,   656,   639,     0,
+       0,     0,     0,   534,   547,    49,    46,    47,   565,     0,
+       0,     0,   548,   554,   562,   560,    57,     0,     0,   818,
+       0,     0,     0,   424,   436,   439,   441,   397,   398,   410,
+     669,   670,   667,   668,   666,   691,   692,   689,   690,   688,
+     702,   703,   700,   701,   699,   713,   714,   711,   712,   710,
+     680,   681,   678,   679,   677,     0,     0,   570,   518,   516,
+     515,   588,   719,   736,     0,   557,     0,     0,     0,     0,
+     810,   811,   821,   733,   732,   731,   569,   568,    48,     0,
+     558,   552,   559,     0,     0,     0
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+   -1029, -1029, -1029,  1979, -1029, -1029, -1029, -1029, -1029,  -358,
+    1297,  1390,  -187,  1077, -1028, -1029, -1029,  -146,  -194, -1029,
+    1490, -1029,  -162, -1029,  1487, -1029, -1029,  -417, -1029, -1029,
+    -860,  1938,  1744,  1933,   160, -1029, -1029, -1029, -1029, -1029,
+   -1029, -1029, -1029, -1029, -1029, -1029,  -869, -1029,  -829, -1029,
+   -1029,  1173, -1029, -1029, -1029,  1174, -1029, -1029,   290,  -523,
+   -1029,  -177,  -977,  -711,  -795, -1029,   778,   867, -1029, -1029,
+   -1029,   799, -1029, -1029, -1029, -1029,  1057,  -725,  -432,  -734,
+   -1029,  -677, -1029, -1029, -1029,  -456,  -701, -1029, -1029, -1029,
+   -1029,   107,  -727, -1029, -1029, -1029, -1029,   771, -1029
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,   170,   171,   172,   173,   174,   175,   176,   177,   471,
+     758,   472,   473,  1291,   861,  1192,   474,   475,   911,   178,
+     393,   394,   395,   179,   398,   399,   180,   181,   182,   183,
+     476,   477,   478,   479,   427,   411,   412,   414,   184,   185,
+     753,   853,   416,   418,   420,   186,  1074,  1107,  1075,  1136,
+    1137,   912,   913,   914,   915,   916,   917,  1323,  1047,   480,
+     481,   918,  1183,   826,   827,   828,  1481,  1401,  1402,   829,
+     830,  1300,  1301,   919,  1080,  1013,  1014,  1015,   920,   921,
+     922,   923,   834,   924,  1217,   925,   926,  1017,   837,   927,
+     928,  1095,   838,   839,   840,   997,  1414,  1415,   841
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     442,   397,   677,   448,   751,   832,   438,   832,  1198,  1228,
+     832,   998,  1046,   832,  1051,   190,  1056,   749,  1061,   832,
+    1066,   611,  1528,   493,  1076,   494,  1077,   495,  1079,   496,
+     842,  1002,   996,   844,   300,  1213,   846,   188,   836,   303,
+     836,   738,   851,   836,   463,  1106,   836,  1002,   736,  1002,
+     871,  1002,   836,   740,   428,   457,  1002,   852,  1398,  1399,
+     483,   440,   833,  1397,   833,   298,    10,   833,   421,   764,
+     833,   482,   873,   875,   441,   440,   833,   676,   877,   765,
+     187,   879,   934,  1100,   743,   422,   191,  1109,   441,  1417,
+     859,  1434,   832,   545,   547,   549,   551,   553,   555,  1189,
+     192,   400,   860,   746,  1240,   936,   390,   938,   832,   941,
+     832,   757,   832,   193,  1241,   943,  1240,   832,  1398,  1399,
+     402,   594,   596,   598,  1041,   836,  1241,   404,   945,   947,
+     949,   433,   434,   435,   436,   951,   953,  1242,   955,  1243,
+     958,   836,  1162,   836,   708,   836,   960,  1069,  1070,   833,
+     836,   962,  1072,  1073,   964,  1048,   194,   973,   433,   434,
+     435,   436,   975,  1053,   977,   833,   210,   833,   406,   833,
+     430,  1438,   195,   986,   833,  1091,   832,  1184,   988,  1058,
+     990,   440,  1096,   992,  1042,   994,   433,   434,   435,   436,
+    1184,   996,   459,   212,   441,  1110,  1091,  1230,  1091,  1098,
+    1063,  1019,   391,  1096,   392,  1096,   440,  1177,  1094,   836,
+     560,   424,   425,  1497,   426,  1049,  1498,   409,   410,   441,
+     562,   396,  1525,  1054,  1234,   573,  1235,  1029,   196,  1094,
+     566,  1094,  1092,   833,  1185,   197,   664,  1091,   832,  1059,
+    1440,   866,   868,   666,  1096,   198,   199,  1140,   668,  1322,
+     200,   832,   443,  1092,   445,  1092,   576,   579,   722,  1236,
+    1064,  1237,   582,  1203,   391,   599,   392,   201,  1491,  1143,
+    1094,   836,  1149,  1238,  1151,  1239,  1153,  1155,  1166,  1168,
+    1170,   202,  1172,   835,   836,   835,  1216,   820,   835,   864,
+     203,   835,  1199,  1201,  1092,   833,   204,   835,   867,   413,
+     832,   301,  1245,  1002,  1246,   205,   832,   831,   833,   831,
+     439,   167,   831,   449,   447,   831,  1484,   544,   546,  1218,
+     999,   831,  1529,  1226,   548,   468,   468,  -427,   762,  1232,
+    1435,   750,   437,   836,   550,   470,   470,   302,  1214,   836,
+     451,   823,  1358,  -817,   464,   465,   466,   467,   468,  -426,
+     304,   189,   552,  -418,   429,   469,   458,   833,   470,   437,
+    -417,   872,   737,   833,   832,   741,  1476,   742,   299,  -432,
+     835,   464,   465,   466,   467,   468,  1400,   464,   465,   466,
+     467,   468,   469,   874,   876,   470,   835,   437,   835,   878,
+     835,   470,   880,   935,   831,   835,   744,   836,   745,   464,
+     465,   466,   467,   468,   401,   863,   554,   391,   593,   392,
+     831,  1474,   831,   470,   831,   747,   937,   748,   939,   831,
+     942,   833,   415,   403,   609,  1043,   944,  1044,   468,   440,
+     405,  1002,   595,   211,  1045,   453,   455,  1002,   470,   946,
+     948,   950,   441,  1079,   709,   710,   952,   954,   832,   956,
+    1079,   959,  1163,  1093,   835,   609,  1043,   961,  1050,   468,
+     213,   461,   963,   609,  1043,   965,  1055,   468,   974,   470,
+     431,  1387,  1439,   976,  1093,   978,  1093,   470,   831,   609,
+    1043,   836,  1060,   468,   987,   832,   832,   832,   832,   989,
+    1420,   991,   832,   470,   993,   460,   995,   757,   832,   597,
+     609,  1043,  -817,  1065,   468,   833,  1548,  1178,  1422,  1423,
+    1424,  1425,  1020,   561,   470,  1093,   835,  1179,   836,   836,
+     836,   836,   391,   563,   392,   836,   574,  1030,   575,   835,
+    1031,   836,   484,   567,   464,   465,   466,   467,   468,   665,
+     831,  1441,   833,   833,   833,   833,   667,  1141,   470,   833,
+    1142,   669,   444,   831,   446,   833,   858,   577,   580,   578,
+     581,   723,   825,   583,   825,   584,   600,   825,   601,   391,
+     825,   392,  1144,   397,   214,  1150,   825,  1152,   835,  1154,
+    1156,  1167,  1169,  1171,   835,  1173,   486,  1475,  1215,   865,
+     465,   466,  1002,  1184,   488,  1200,  1202,   440,   865,   465,
+     466,   440,   831,   523,   440,   440,   526,   528,   831,  1530,
+     441,   440,   530,   450,   441,  1225,  1186,   441,   441,   532,
+    1190,   440,   534,   536,   441,   538,   540,  1002,  1002,  1002,
+    1002,   216,   218,   542,   441,   556,   558,   564,   569,   440,
+     452,   571,   835,   585,   587,   589,   591,   602,   604,   825,
+     606,   608,   441,   832,   832,   206,   207,   613,   615,   621,
+     623,   625,   627,   629,   631,   825,   831,   825,   208,   825,
+     633,   635,   637,   639,   825,   641,   643,   645,   647,   649,
+     656,   658,   660,   662,   670,   672,   836,   836,   832,   832,
+     832,   832,   209,   440,   674,   440,   678,   680,   682,   684,
+     686,   688,   690,   692,   694,   651,   441,   696,   441,   698,
+     833,   833,   276,   700,   702,   704,   706,   712,   714,   440,
+     716,   836,   836,   836,   836,   718,   835,   277,   720,   725,
+     727,   729,   441,   825,   731,   454,   456,   278,  1157,  1159,
+    1187,   220,   279,   280,  1002,   833,   833,   833,   833,   832,
+     831,  1247,   222,  1248,  1002,   224,   226,   228,  1002,  1002,
+    1002,   462,  1164,   835,   835,   835,   835,  1443,   281,   230,
+     835,  1249,  1539,  1250,   232,   282,   835,   432,  1101,   283,
+     234,  1180,   836,  1181,   284,   236,   440,   831,   831,   831,
+     831,  1191,   285,  1448,   831,   825,  1068,   238,   286,   441,
+     831,   832,   287,   240,   832,   832,   833,   242,   825,  1099,
+    1254,   244,  1255,   246,   248,   832,   832,   832,   288,   832,
+     832,   832,   289,   417,  1549,   250,   290,  1553,  1453,  1204,
+     291,  1206,   485,  1208,   836,  1108,  1458,   836,   836,  1554,
+    1555,   215,   252,   292,   859,  1231,   254,   256,   836,   836,
+     836,   293,   836,   836,   836,  1078,   860,   825,   833,   258,
+     260,   833,   833,   825,   433,   434,   435,   436,   433,   434,
+     435,   436,   833,   833,   833,   859,   833,   833,   833,   262,
+     264,   266,   268,   929,   931,   933,   487,   860,   270,   272,
+     274,   326,   328,   330,   489,   332,   377,   770,   217,   219,
+     423,   294,   843,   524,   419,   845,   527,   529,   847,   972,
+     490,   491,   531,   652,   653,   654,   655,   984,   985,   533,
+     295,   825,   535,   537,   492,   539,   541,   433,   434,   435,
+     436,   835,   835,   543,   296,   557,   559,   565,   570,  1205,
+     391,   572,   392,   586,   588,   590,   592,   603,   605,   497,
+     607,   609,   498,   756,   297,   831,   831,   614,   616,   622,
+     624,   626,   628,   630,   632,   499,   835,   835,   835,   835,
+     634,   636,   638,   640,   500,   642,   644,   646,   648,   650,
+     657,   659,   661,   663,   671,   673,  1207,   391,   305,   392,
+     831,   831,   831,   831,   675,   501,   679,   681,   683,   685,
+     687,   689,   691,   693,   695,   825,  1444,   697,   221,   699,
+    1082,  1084,  1086,   701,   703,   705,   707,   713,   715,   223,
+     717,   306,   225,   227,   229,   719,   307,   835,   721,   726,
+     728,   730,  1449,   308,   732,  1112,   231,  1477,  1158,  1160,
+    1188,   233,   825,   825,   825,   825,  1147,   235,   502,   825,
+     309,   831,   237,  1069,  1070,   825,   310,   311,  1072,  1073,
+    1102,  1103,  1104,  1105,   239,   437,  1256,  1454,  1257,   437,
+     241,  1069,  1070,  1071,   243,  1459,  1072,  1073,   245,   835,
+     247,   249,   835,   835,  1069,  1070,  1071,   312,   313,  1072,
+    1073,   314,   251,   835,   835,   835,   315,   835,   835,   835,
+    1258,  1296,  1259,   831,   316,   317,   831,   831,   318,   253,
+    1069,  1070,  1071,   255,   257,  1072,  1073,   831,   831,   831,
+     319,   831,   831,   831,  1212,   320,   259,   261,   437,   321,
+    1069,  1070,  1470,   322,   503,  1072,  1073,  1133,  1134,  1135,
+     464,   465,   466,   467,   468,   323,   263,   265,   267,   269,
+     324,   469,   325,   334,   470,   271,   273,   275,   327,   329,
+     331,   335,   333,   378,  1052,  1263,  1057,  1264,  1062,   336,
+    1067,   882,   883,   884,   885,  1265,   887,  1266,   889,  1267,
+     891,  1268,  1282,  1292,  1295,  1003,  1004,  1005,  1006,  1007,
+    1008,  1009,  1010,  1011,  1303,  1305,  1240,   337,   464,   465,
+     466,   467,   468,   338,   339,   340,  1241,  1313,  1240,   469,
+     825,   825,   470,  1315,  1317,   341,  1325,  1251,  1241,  1252,
+    1328,  1330,  1332,  1334,  1335,  1336,  1337,   342,  1272,  1260,
+    1273,  1261,  1012,  1131,  1132,  1133,  1134,  1135,  1339,  1341,
+    1343,  1345,  1347,  1349,  1351,   825,   825,   825,   825,   464,
+     465,   466,   467,   468,   343,   344,  1490,   345,  1274,  1492,
+    1275,   504,  1318,   470,   771,   772,   773,   774,   775,  1526,
+    1276,   346,  1277,   780,   781,   782,  1418,  1488,  1419,  1489,
+     347,  1240,   348,   783,   784,   785,   786,   787,   788,   789,
+     790,  1241,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,  1269,   801,  1270,   349,   825,   350,   351,   803,
+     804,   805,   806,   807,   808,   809,  1413,   352,   353,   354,
+     812,   813,   355,   356,   357,   814,   815,   816,   817,   818,
+     819,   881,   882,   883,   884,   885,   886,   887,   888,   889,
+     890,   891,   892,   893,   894,   895,   896,  1319,   898,  1127,
+    1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,   825,  1240,
+     358,   825,   825,   359,   360,   361,   362,   363,   505,  1241,
+     364,   365,   825,   825,   825,   506,   825,   825,   825,   366,
+    1278,   367,  1279,  1120,  1121,  1122,  1123,  1124,  1125,  1126,
+    1127,  1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,  1324,
+    1113,  1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,
+    1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,
+    1133,  1134,  1135,  1115,  1116,  1117,  1118,  1119,  1120,  1121,
+    1122,  1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,
+    1132,  1133,  1134,  1135,  1197,  1113,  1114,  1115,  1116,  1117,
+    1118,  1119,  1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,
+    1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,  1117,  1118,
+    1119,  1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,  1128,
+    1129,  1130,  1131,  1132,  1133,  1134,  1135,  1307,   368,   369,
+     370,   371,   372,   373,   374,   375,   376,   379,   380,   381,
+     382,   383,    -2,   407,   384,  1482,   385,   386,   387,   388,
+     389,  1487,   507,   508,   820,   899,   -11,   -11,   -13,     2,
+       3,   -16,   -18,   -20,   733,   734,   735,   739,   760,   754,
+     763,   940,   849,  1016,   761,   509,   510,  1223,   511,  1224,
+       4,  1032,  1035,     5,     6,     7,     8,     9,   512,   900,
+     513,   514,   515,   901,   516,   902,   903,   904,   905,    10,
+     906,   907,  1320,  1321,   517,   908,   468,   822,   823,   518,
+     519,   520,   521,   971,   910,   522,   470,   525,   617,   568,
+     618,   619,   620,   711,   724,   752,   755,  1482,   768,   854,
+    1037,   468,   850,   869,   857,  1413,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,   766,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   848,   856,   855,   870,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   957,   157,   158,
+     159,   160,   161,   162,   163,   966,   967,   968,   969,   970,
+     979,   980,   981,   982,  1018,  1021,  1034,   164,   165,   166,
+    1038,  1039,  1113,  1114,  1115,  1116,  1117,  1118,  1119,  1120,
+    1121,  1122,  1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,
+    1131,  1132,  1133,  1134,  1135,  1023,  1025,  1027,  1028,  1040,
+    1087,  1088,  1148,  1161,   167,  1165,  1174,  1175,  1176,  1210,
+    1193,  1194,   168,  1209,  1359,  1195,  1196,  1227,   996,   169,
+    -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,
+    -519,  -519,  1211,  1219,  1220,  1221,  1222,  1229,  1233,  -519,
+    -519,  -519,  -519,  -519,  -519,  -519,  -519,  1299,  -519,  -519,
+    -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,  1244,  -519,
+    1253,  1262,  1271,  -519,  1306,  -519,  -519,  -519,  -519,  -519,
+    -519,  -519,  -519,  -590,  -591,  -519,  -519,  -519,  -602,  -603,
+    1308,  -519,  -519,  -519,  -519,  -519,  -519,   996,  1309,  -487,
+    -487,  -487,  -487,  -487,  -487,  -487,  -487,  -487,  -487,  -487,
+    -487,  1326,  1352,  1353,  1354,  1356,  1355,  1388,  -487,  -487,
+    -487,  -487,  -487,  -487,  -487,  -487,  1394,  -487,  -487,  -487,
+    -487,  -487,  -487,  -487,  -487,  -487,  -487,  1357,  -487,  1360,
+    1361,  1362,  -487,  1363,  -487,  -487,  -487,  -487,  -487,  -487,
+    -487,  -487,  1364,  1365,  -487,  -487,  -487,  1366,  1367,  1368,
+    -487,  -487,  -487,  -487,  -487,  -487,  1078,  1369,  -491,  -491,
+    -491,  -491,  -491,  -491,  -491,  -491,  -491,  -491,  -491,  -491,
+    1370,  1371,  1372,  1373,  1374,  1375,  1376,  -491,  -491,  -491,
+    -491,  -491,  -491,  -491,  -491,  1377,  -491,  -491,  -491,  -491,
+    -491,  -491,  -491,  -491,  -491,  -491,  1378,  -491,  1379,  1380,
+    1381,  -491,  1382,  -491,  -491,  -491,  -491,  -491,  -491,  -491,
+    -491,  1383,  1384,  -491,  -491,  -491,  1385,  1386,  1389,  -491,
+    -491,  -491,  -491,  -491,  -491,  1113,  1114,  1115,  1116,  1117,
+    1118,  1119,  1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,
+    1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,  1118,  1119,
+    1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,  1128,  1129,
+    1130,  1131,  1132,  1133,  1134,  1135,  1390,  1466,  1391,  1392,
+    -519,  1393,  1395,  1396,  1403,  1404,  1405,  1012,  1406,  1407,
+    1408,  1409,  1410,  1411,  1412,  1421,  -519,  -519,  -519,  -519,
+    -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,
+    -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,  -519,  1417,
+    1426,  1427,  1428,  1430,  1431,  -519,  1432,  1436,  1471,  -519,
+    1437,  1442,  1445,  -519,  -519,  1446,  -519,  -519,  -519,  -817,
+    -519,  1447,  1450,  1451,  1452,  -519,  1455,  1456,  1457,  -487,
+    1460,  1461,  1462,  1463,  1464,  1465,  1469,  1472,  1499,  1467,
+     408,   862,  1036,  1500,  1294,  -487,  -487,  -487,  -487,  -487,
+    -487,  -487,  -487,  -487,  -487,  -487,  -487,  -487,  -487,  -487,
+    -487,  -487,  -487,  -487,  -487,  -487,  -487,  -487,  1478,  1483,
+    1501,  1502,  1503,  1504,  1505,  1506,  1507,  1508,  -487,  1509,
+    1510,  1511,  -487,  -487,  1512,  -487,  -487,  -487,  -817,  -487,
+    1513,  1514,  1515,  1516,  -487,  1517,  1518,  1519,  -491,  1520,
+    1521,  1522,  1523,  1524,   759,  1532,  1533,  1540,  1543,  1531,
+    1544,  1545,   769,   767,  -491,  -491,  -491,  -491,  -491,  -491,
+    -491,  -491,  -491,  -491,  -491,  -491,  -491,  -491,  -491,  -491,
+    -491,  -491,  -491,  -491,  -491,  -491,  -491,  1534,  1535,  1538,
+    1546,  1547,  1297,  1298,  1550,  1551,   612,  -491,  1537,  1542,
+     610,  -491,  -491,  1527,  -491,  -491,  -491,  1416,  -491,  1485,
+       0,     0,  1078,  -491,  -508,  -508,  -508,  -508,  -508,  -508,
+    -508,  -508,  -508,  -508,  -508,  -508,     0,     0,     0,     0,
+       0,     0,     0,  -508,  -508,  -508,  -508,  -508,  -508,  -508,
+    -508,     0,  -508,  -508,  -508,  -508,  -508,  -508,  -508,  -508,
+    -508,  -508,     0,  -508,     0,     0,     0,  -508,     0,  -508,
+    -508,  -508,  -508,  -508,  -508,  -508,  -508,     0,     0,  -508,
+    -508,  -508,     0,     0,     0,  -508,  -508,  -508,  -508,  -508,
+    -508,     0,     0,     0,     0,     0,     0,     0,  1552,     0,
+     771,   772,   773,   774,   775,   776,   777,   778,   779,   780,
+     781,   782,     0,     0,     0,     0,     0,     0,     0,   783,
+     784,   785,   786,   787,   788,   789,   790,     0,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,     0,   801,
+       0,     0,     0,   802,     0,   803,   804,   805,   806,   807,
+     808,   809,   810,  -551,  -551,   811,   812,   813,     0,     0,
+       0,   814,   815,   816,   817,   818,   819,  1113,  1114,  1115,
+    1116,  1117,  1118,  1119,  1120,  1121,  1122,  1123,  1124,  1125,
+    1126,  1127,  1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,
+    1119,  1120,  1121,  1122,  1123,  1124,  1125,  1126,  1127,  1128,
+    1129,  1130,  1131,  1132,  1133,  1134,  1135,     0,     0,  1468,
+    1113,  1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,
+    1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,
+    1133,  1134,  1135,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1541,  1116,  1117,  1118,  1119,  1120,  1121,  1122,
+    1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,
+    1133,  1134,  1135,     0,  -508,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    -508,  -508,  -508,  -508,  -508,  -508,  -508,  -508,  -508,  -508,
+    -508,  -508,  -508,  -508,  -508,  -508,  -508,  -508,  -508,  -508,
+    -508,  -508,  -508,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -508,     0,     0,     0,  -508,  -508,     1,
+    -508,  -508,  -508,     0,  -508,     0,     0,     0,     0,  -508,
+       0,     0,   -11,   -11,   -13,     2,     3,   -16,   -18,   -20,
+     820,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     4,     0,     0,     5,
+       6,     7,     8,     9,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    10,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   821,
+       0,     0,     0,   822,   823,     0,     0,   824,     0,     0,
+       0,  -551,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,     0,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,     0,     0,     0,
+       0,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,     0,   157,   158,   159,   160,   161,   162,
+     163,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   164,   165,   166,  1113,  1114,  1115,  1116,
+    1117,  1118,  1119,  1120,  1121,  1122,  1123,  1124,  1125,  1126,
+    1127,  1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     167,     0,     0,     0,     0,     0,     0,     0,   168,     0,
+       0,     0,     0,     0,  1000,   169,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,   802,
+       0,   803,   804,   805,   806,   807,   808,   809,   810,  -553,
+    -553,   811,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,  1000,     0,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,   802,     0,
+     803,   804,   805,   806,   807,   808,   809,   810,  -555,  -555,
+     811,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,  -549,  -549,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,     0,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,   820,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,  -556,  -556,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,  1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,
+    1123,  1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,
+    1133,  1134,  1135,     0,     0,   821,     0,     0,     0,   822,
+     823,     0,     0,   824,     0,     0,     0,  -553,     0,     0,
+       0,     0,     0,     0,     0,   820,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   821,     0,     0,     0,   822,   823,
+       0,     0,   824,     0,     0,     0,  -555,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,     0,  -549,     0,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,  1000,  -556,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,   802,
+       0,   803,   804,   805,   806,   807,   808,   809,   810,  -550,
+    -550,   811,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,  1000,     0,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,   802,     0,
+     803,   804,   805,   806,   807,   808,   809,   810,     0,     0,
+     811,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,     0,     0,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,     0,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,   820,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,     0,     0,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   821,     0,     0,     0,   822,
+     823,     0,     0,   824,     0,     0,     0,  -550,     0,     0,
+       0,     0,     0,     0,     0,   820,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   821,     0,     0,     0,   822,   823,
+       0,     0,   824,     0,     0,     0,  1001,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,     0,  1022,     0,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,  1000,  1024,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,   802,
+       0,   803,   804,   805,   806,   807,   808,   809,   810,     0,
+       0,   811,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,  1000,     0,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,   802,     0,
+     803,   804,   805,   806,   807,   808,   809,   810,     0,     0,
+     811,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,     0,     0,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,     0,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,   820,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,     0,     0,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   821,     0,     0,     0,   822,
+     823,     0,     0,   824,     0,     0,     0,  1026,     0,     0,
+       0,     0,     0,     0,     0,   820,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   821,     0,     0,     0,   822,   823,
+       0,     0,   824,     0,     0,     0,  1033,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,     0,  1310,     0,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,  1000,  1429,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,   802,
+       0,   803,   804,   805,   806,   807,   808,   809,   810,     0,
+       0,   811,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,  1000,     0,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,   802,     0,
+     803,   804,   805,   806,   807,   808,   809,   810,     0,     0,
+     811,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,     0,     0,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,     0,  1000,     0,   771,   772,   773,   774,   775,   776,
+     777,   778,   779,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,   820,   802,     0,   803,
+     804,   805,   806,   807,   808,   809,   810,     0,     0,   811,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   821,     0,     0,     0,   822,
+     823,     0,     0,   824,     0,     0,     0,  1433,     0,     0,
+       0,     0,     0,     0,     0,   820,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   821,     0,     0,     0,   822,   823,
+       0,     0,   824,     0,     0,     0,  1473,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,     0,  1493,     0,     0,     0,     0,
+       0,     0,     0,     0,   820,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   821,     0,     0,     0,   822,   823,     0,
+       0,   824,     0,     0,  1000,  1494,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,   802,
+       0,   803,   804,   805,   806,   807,   808,   809,   810,     0,
+       0,   811,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,  1000,     0,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,   802,     0,
+     803,   804,   805,   806,   807,   808,   809,   810,     0,     0,
+     811,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,  1283,     0,   771,   772,   773,   774,   775,     0,
+       0,     0,     0,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,     0,     0,   803,
+     804,   805,   806,   807,   808,   809,     0,     0,     0,     0,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,   881,   882,   883,   884,   885,   886,   887,   888,   889,
+     890,   891,   892,   893,   894,   895,   896,   897,   898,  1284,
+    1285,  1286,  1287,  1288,  1289,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   820,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   821,     0,     0,     0,   822,
+     823,     0,     0,   824,     0,     0,     0,  1495,     0,     0,
+       0,     0,     0,     0,     0,   820,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   821,     0,     0,     0,   822,   823,
+       0,     0,   824,     0,     0,     0,  1496,     0,     0,     0,
+       0,     0,     0,     0,   820,   899,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   900,
+    1290,     0,     0,   901,     0,   902,   903,   904,   905,     0,
+     906,   907,   441,   821,     0,   908,     0,   822,   823,     0,
+       0,     0,     0,   971,   910,  1293,     0,   771,   772,   773,
+     774,   775,     0,     0,     0,     0,   780,   781,   782,     0,
+       0,     0,     0,     0,     0,     0,   783,   784,   785,   786,
+     787,   788,   789,   790,     0,   791,   792,   793,   794,   795,
+     796,   797,   798,   799,   800,     0,   801,     0,     0,     0,
+       0,     0,   803,   804,   805,   806,   807,   808,   809,     0,
+       0,     0,     0,   812,   813,     0,     0,     0,   814,   815,
+     816,   817,   818,   819,   881,   882,   883,   884,   885,   886,
+     887,   888,   889,   890,   891,   892,   893,   894,   895,   896,
+     897,   898,  1284,  1285,  1286,  1287,  1288,  1289,  1089,     0,
+     771,   772,   773,   774,   775,     0,     0,     0,     0,   780,
+     781,   782,     0,     0,     0,     0,     0,     0,     0,   783,
+     784,   785,   786,   787,   788,   789,   790,     0,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,     0,   801,
+       0,     0,     0,     0,     0,   803,   804,   805,   806,   807,
+     808,   809,     0,     0,     0,     0,   812,   813,     0,     0,
+       0,   814,   815,   816,   817,   818,   819,   881,   882,   883,
+     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
+     894,   895,   896,   897,   898,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1089,     0,   771,   772,
+     773,   774,   775,     0,     0,     0,     0,   780,   781,   782,
+       0,     0,     0,     0,     0,     0,     0,   783,   784,   785,
+     786,   787,   788,   789,   790,     0,   791,   792,   793,   794,
+     795,   796,   797,   798,   799,   800,     0,   801,     0,     0,
+       0,     0,     0,   803,   804,   805,   806,   807,   808,   809,
+       0,     0,     0,     0,   812,   813,     0,   820,   899,   814,
+     815,   816,   817,   818,   819,   881,   882,   883,   884,   885,
+     886,   887,   888,   889,   890,   891,   892,   893,   894,   895,
+     896,   897,   898,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   900,  1290,     0,     0,   901,     0,   902,   903,
+     904,   905,     0,   906,   907,   441,   821,     0,   908,     0,
+     822,   823,     0,     0,     0,     0,   971,   910,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     820,   899,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   900,     0,     0,     0,   901,
+       0,   902,   903,   904,   905,     0,   906,   907,   441,   821,
+       0,   908,     0,   822,   823,     0,     0,     0,  1090,   971,
+     910,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   820,   899,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   900,     0,     0,     0,   901,     0,   902,
+     903,   904,   905,     0,   906,   907,   441,   821,     0,   908,
+       0,   822,   823,     0,     0,     0,  1138,   971,   910,  1089,
+       0,   771,   772,   773,   774,   775,     0,     0,     0,     0,
+     780,   781,   782,     0,     0,     0,     0,     0,     0,     0,
+     783,   784,   785,   786,   787,   788,   789,   790,     0,   791,
+     792,   793,   794,   795,   796,   797,   798,   799,   800,     0,
+     801,     0,     0,     0,     0,     0,   803,   804,   805,   806,
+     807,   808,   809,     0,     0,     0,     0,   812,   813,     0,
+       0,     0,   814,   815,   816,   817,   818,   819,   881,   882,
+     883,   884,   885,   886,   887,   888,   889,   890,   891,   892,
+     893,   894,   895,   896,   897,   898,  1479,     0,   771,   772,
+     773,   774,   775,     0,     0,     0,     0,   780,   781,   782,
+       0,     0,     0,     0,     0,     0,     0,   783,   784,   785,
+     786,   787,   788,   789,   790,     0,   791,   792,   793,   794,
+     795,   796,   797,   798,   799,   800,     0,   801,     0,     0,
+       0,     0,     0,   803,   804,   805,   806,   807,   808,   809,
+       0,     0,     0,     0,   812,   813,     0,     0,     0,   814,
+     815,   816,   817,   818,   819,   881,   882,   883,   884,   885,
+     886,   887,   888,   889,   890,   891,   892,   893,   894,   895,
+     896,   897,   898,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     983,     0,   771,   772,   773,   774,   775,     0,     0,     0,
+       0,   780,   781,   782,     0,     0,     0,     0,     0,     0,
+       0,   783,   784,   785,   786,   787,   788,   789,   790,     0,
+     791,   792,   793,   794,   795,   796,   797,   798,   799,   800,
+       0,   801,     0,     0,     0,     0,     0,   803,   804,   805,
+     806,   807,   808,   809,     0,     0,     0,     0,   812,   813,
+       0,   820,   899,   814,   815,   816,   817,   818,   819,   881,
+     882,   883,   884,   885,   886,   887,   888,   889,   890,   891,
+     892,   893,   894,   895,   896,   897,   898,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   900,     0,     0,     0,
+     901,     0,   902,   903,   904,   905,     0,   906,   907,   441,
+     821,     0,   908,     0,   822,   823,     0,     0,     0,  1139,
+     971,   910,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   820,   899,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   900,     0,  1480,     0,   901,     0,   902,
+     903,   904,   905,     0,   906,   907,   441,   821,     0,   908,
+       0,   822,   823,     0,     0,     0,     0,   971,   910,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   820,   899,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   900,     0,     0,
+       0,   901,     0,   902,   903,   904,   905,     0,   906,   907,
+     441,   821,     0,   908,     0,   822,   823,     0,     0,     0,
+       0,   971,   910,  1081,     0,   771,   772,   773,   774,   775,
+       0,     0,     0,     0,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,     0,     0,
+     803,   804,   805,   806,   807,   808,   809,     0,     0,     0,
+       0,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,   881,   882,   883,   884,   885,   886,   887,   888,
+     889,   890,   891,   892,   893,   894,   895,   896,   897,   898,
+    1083,     0,   771,   772,   773,   774,   775,     0,     0,     0,
+       0,   780,   781,   782,     0,     0,     0,     0,     0,     0,
+       0,   783,   784,   785,   786,   787,   788,   789,   790,     0,
+     791,   792,   793,   794,   795,   796,   797,   798,   799,   800,
+       0,   801,     0,     0,     0,     0,     0,   803,   804,   805,
+     806,   807,   808,   809,     0,     0,     0,     0,   812,   813,
+       0,     0,     0,   814,   815,   816,   817,   818,   819,   881,
+     882,   883,   884,   885,   886,   887,   888,   889,   890,   891,
+     892,   893,   894,   895,   896,   897,   898,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1085,     0,   771,   772,   773,   774,
+     775,     0,     0,     0,     0,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,     0,
+       0,   803,   804,   805,   806,   807,   808,   809,     0,     0,
+       0,     0,   812,   813,     0,   820,   899,   814,   815,   816,
+     817,   818,   819,   881,   882,   883,   884,   885,   886,   887,
+     888,   889,   890,   891,   892,   893,   894,   895,   896,   897,
+     898,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     900,     0,     0,     0,   901,     0,   902,   903,   904,   905,
+       0,   906,   907,   441,   821,     0,   908,     0,   822,   823,
+       0,     0,     0,     0,   971,   910,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   820,   899,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   900,     0,     0,
+       0,   901,     0,   902,   903,   904,   905,     0,   906,   907,
+     441,   821,     0,   908,     0,   822,   823,     0,     0,     0,
+       0,   971,   910,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   820,   899,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   900,     0,     0,     0,   901,     0,   902,   903,   904,
+     905,     0,   906,   907,   441,   821,     0,   908,     0,   822,
+     823,     0,     0,     0,     0,   971,   910,  1111,     0,   771,
+     772,   773,   774,   775,     0,     0,     0,     0,   780,   781,
+     782,     0,     0,     0,     0,     0,     0,     0,   783,   784,
+     785,   786,   787,   788,   789,   790,     0,   791,   792,   793,
+     794,   795,   796,   797,   798,   799,   800,     0,   801,     0,
+       0,     0,     0,     0,   803,   804,   805,   806,   807,   808,
+     809,     0,     0,     0,     0,   812,   813,     0,     0,     0,
+     814,   815,   816,   817,   818,   819,   881,   882,   883,   884,
+     885,   886,   887,   888,   889,   890,   891,   892,   893,   894,
+     895,   896,   897,   898,  1145,     0,   771,   772,   773,   774,
+     775,     0,     0,     0,     0,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,     0,
+       0,   803,   804,   805,   806,   807,   808,   809,     0,     0,
+       0,     0,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,   881,   882,   883,   884,   885,   886,   887,
+     888,   889,   890,   891,   892,   893,   894,   895,   896,   897,
+     898,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1089,     0,
+     771,   772,   773,   774,   775,     0,     0,     0,     0,   780,
+     781,   782,     0,     0,     0,     0,     0,     0,     0,   783,
+     784,   785,   786,   787,   788,   789,   790,     0,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,     0,   801,
+       0,     0,     0,     0,     0,   803,   804,   805,   806,   807,
+     808,   809,     0,     0,     0,     0,   812,   813,     0,   820,
+     899,   814,   815,   816,   817,   818,   819,   881,   882,   883,
+     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
+     894,   895,   896,   897,   898,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   900,     0,     0,     0,   901,     0,
+     902,   903,   904,   905,     0,   906,   907,   441,   821,     0,
+     908,     0,   822,   823,     0,     0,     0,     0,   971,   910,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   820,   899,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   900,     0,     0,     0,   901,     0,   902,   903,   904,
+     905,     0,   906,   907,   441,  1146,     0,   908,     0,   822,
+     823,     0,     0,     0,     0,   971,   910,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     820,   899,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   900,     0,     0,     0,   901,
+       0,   902,   903,   904,   905,     0,   906,   907,   441,   821,
+       0,   908,     0,   822,   823,     0,     0,     0,     0,   971,
+     910,  1280,     0,   771,   772,   773,   774,   775,     0,     0,
+       0,     0,   780,   781,   782,     0,     0,     0,     0,     0,
+       0,     0,   783,   784,   785,   786,   787,   788,   789,   790,
+       0,   791,   792,   793,   794,   795,   796,   797,   798,   799,
+     800,     0,   801,     0,     0,     0,     0,     0,   803,   804,
+     805,   806,   807,   808,   809,     0,     0,     0,     0,   812,
+     813,     0,     0,     0,   814,   815,   816,   817,   818,   819,
+     881,   882,   883,   884,   885,   886,   887,   888,   889,   890,
+     891,   892,   893,   894,   895,   896,   897,   898,  1302,     0,
+     771,   772,   773,   774,   775,     0,     0,     0,     0,   780,
+     781,   782,     0,     0,     0,     0,     0,     0,     0,   783,
+     784,   785,   786,   787,   788,   789,   790,     0,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,     0,   801,
+       0,     0,     0,     0,     0,   803,   804,   805,   806,   807,
+     808,   809,     0,     0,     0,     0,   812,   813,     0,     0,
+       0,   814,   815,   816,   817,   818,   819,   881,   882,   883,
+     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
+     894,   895,   896,   897,   898,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1304,     0,   771,   772,   773,   774,   775,     0,
+       0,     0,     0,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,     0,     0,   803,
+     804,   805,   806,   807,   808,   809,     0,     0,     0,     0,
+     812,   813,     0,   820,   899,   814,   815,   816,   817,   818,
+     819,   881,   882,   883,   884,   885,   886,   887,   888,   889,
+     890,   891,   892,   893,   894,   895,   896,   897,   898,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   900,     0,
+       0,     0,   901,     0,   902,   903,   904,   905,     0,   906,
+     907,   441,  1281,     0,   908,     0,   822,   823,     0,     0,
+       0,     0,   971,   910,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     820,   899,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   900,     0,     0,     0,   901,
+       0,   902,   903,   904,   905,     0,   906,   907,   441,   821,
+       0,   908,     0,   822,   823,     0,     0,     0,     0,   971,
+     910,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   820,   899,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   900,
+       0,     0,     0,   901,     0,   902,   903,   904,   905,     0,
+     906,   907,   441,   821,     0,   908,     0,   822,   823,     0,
+       0,     0,     0,   971,   910,  1311,     0,   771,   772,   773,
+     774,   775,     0,     0,     0,     0,   780,   781,   782,     0,
+       0,     0,     0,     0,     0,     0,   783,   784,   785,   786,
+     787,   788,   789,   790,     0,   791,   792,   793,   794,   795,
+     796,   797,   798,   799,   800,     0,   801,     0,     0,     0,
+       0,     0,   803,   804,   805,   806,   807,   808,   809,     0,
+       0,     0,     0,   812,   813,     0,     0,     0,   814,   815,
+     816,   817,   818,   819,   881,   882,   883,   884,   885,   886,
+     887,   888,   889,   890,   891,   892,   893,   894,   895,   896,
+    1312,   898,  1314,     0,   771,   772,   773,   774,   775,     0,
+       0,     0,     0,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,     0,     0,   803,
+     804,   805,   806,   807,   808,   809,     0,     0,     0,     0,
+     812,   813,     0,     0,     0,   814,   815,   816,   817,   818,
+     819,   881,   882,   883,   884,   885,   886,   887,   888,   889,
+     890,   891,   892,   893,   894,   895,   896,   897,   898,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1316,     0,   771,   772,
+     773,   774,   775,     0,     0,     0,     0,   780,   781,   782,
+       0,     0,     0,     0,     0,     0,     0,   783,   784,   785,
+     786,   787,   788,   789,   790,     0,   791,   792,   793,   794,
+     795,   796,   797,   798,   799,   800,     0,   801,     0,     0,
+       0,     0,     0,   803,   804,   805,   806,   807,   808,   809,
+       0,     0,     0,     0,   812,   813,     0,   820,   899,   814,
+     815,   816,   817,   818,   819,   881,   882,   883,   884,   885,
+     886,   887,   888,   889,   890,   891,   892,   893,   894,   895,
+     896,   897,   898,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   900,     0,     0,     0,   901,     0,   902,   903,
+     904,   905,     0,   906,   907,   441,   821,     0,   908,     0,
+     822,   823,     0,     0,     0,     0,   971,   910,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   820,   899,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   900,
+       0,     0,     0,   901,     0,   902,   903,   904,   905,     0,
+     906,   907,   441,   821,     0,   908,     0,   822,   823,     0,
+       0,     0,     0,   971,   910,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   820,   899,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   900,     0,     0,     0,   901,     0,   902,
+     903,   904,   905,     0,   906,   907,   441,   821,     0,   908,
+       0,   822,   823,     0,     0,     0,     0,   971,   910,  1327,
+       0,   771,   772,   773,   774,   775,     0,     0,     0,     0,
+     780,   781,   782,     0,     0,     0,     0,     0,     0,     0,
+     783,   784,   785,   786,   787,   788,   789,   790,     0,   791,
+     792,   793,   794,   795,   796,   797,   798,   799,   800,     0,
+     801,     0,     0,     0,     0,     0,   803,   804,   805,   806,
+     807,   808,   809,     0,     0,     0,     0,   812,   813,     0,
+       0,     0,   814,   815,   816,   817,   818,   819,   881,   882,
+     883,   884,   885,   886,   887,   888,   889,   890,   891,   892,
+     893,   894,   895,   896,   897,   898,  1329,     0,   771,   772,
+     773,   774,   775,     0,     0,     0,     0,   780,   781,   782,
+       0,     0,     0,     0,     0,     0,     0,   783,   784,   785,
+     786,   787,   788,   789,   790,     0,   791,   792,   793,   794,
+     795,   796,   797,   798,   799,   800,     0,   801,     0,     0,
+       0,     0,     0,   803,   804,   805,   806,   807,   808,   809,
+       0,     0,     0,     0,   812,   813,     0,     0,     0,   814,
+     815,   816,   817,   818,   819,   881,   882,   883,   884,   885,
+     886,   887,   888,   889,   890,   891,   892,   893,   894,   895,
+     896,   897,   898,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1331,     0,   771,   772,   773,   774,   775,     0,     0,     0,
+       0,   780,   781,   782,     0,     0,     0,     0,     0,     0,
+       0,   783,   784,   785,   786,   787,   788,   789,   790,     0,
+     791,   792,   793,   794,   795,   796,   797,   798,   799,   800,
+       0,   801,     0,     0,     0,     0,     0,   803,   804,   805,
+     806,   807,   808,   809,     0,     0,     0,     0,   812,   813,
+       0,   820,   899,   814,   815,   816,   817,   818,   819,   881,
+     882,   883,   884,   885,   886,   887,   888,   889,   890,   891,
+     892,   893,   894,   895,   896,   897,   898,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   900,     0,     0,     0,
+     901,     0,   902,   903,   904,   905,     0,   906,   907,   441,
+     821,     0,   908,     0,   822,   823,     0,     0,     0,     0,
+     971,   910,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   820,   899,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   900,     0,     0,     0,   901,     0,   902,
+     903,   904,   905,     0,   906,   907,   441,   821,     0,   908,
+       0,   822,   823,     0,     0,     0,     0,   971,   910,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   820,   899,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   900,     0,     0,
+       0,   901,     0,   902,   903,   904,   905,     0,   906,   907,
+     441,   821,     0,   908,     0,   822,   823,     0,     0,     0,
+       0,   971,   910,  1333,     0,   771,   772,   773,   774,   775,
+       0,     0,     0,     0,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,     0,     0,
+     803,   804,   805,   806,   807,   808,   809,     0,     0,     0,
+       0,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,   881,   882,   883,   884,   885,   886,   887,   888,
+     889,   890,   891,   892,   893,   894,   895,   896,   897,   898,
+    1338,     0,   771,   772,   773,   774,   775,     0,     0,     0,
+       0,   780,   781,   782,     0,     0,     0,     0,     0,     0,
+       0,   783,   784,   785,   786,   787,   788,   789,   790,     0,
+     791,   792,   793,   794,   795,   796,   797,   798,   799,   800,
+       0,   801,     0,     0,     0,     0,     0,   803,   804,   805,
+     806,   807,   808,   809,     0,     0,     0,     0,   812,   813,
+       0,     0,     0,   814,   815,   816,   817,   818,   819,   881,
+     882,   883,   884,   885,   886,   887,   888,   889,   890,   891,
+     892,   893,   894,   895,   896,   897,   898,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1340,     0,   771,   772,   773,   774,
+     775,     0,     0,     0,     0,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,     0,
+       0,   803,   804,   805,   806,   807,   808,   809,     0,     0,
+       0,     0,   812,   813,     0,   820,   899,   814,   815,   816,
+     817,   818,   819,   881,   882,   883,   884,   885,   886,   887,
+     888,   889,   890,   891,   892,   893,   894,   895,   896,   897,
+     898,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     900,     0,     0,     0,   901,     0,   902,   903,   904,   905,
+       0,   906,   907,   441,   821,     0,   908,     0,   822,   823,
+       0,     0,     0,     0,   971,   910,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   820,   899,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   900,     0,     0,
+       0,   901,     0,   902,   903,   904,   905,     0,   906,   907,
+     441,   821,     0,   908,     0,   822,   823,     0,     0,     0,
+       0,   971,   910,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   820,   899,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   900,     0,     0,     0,   901,     0,   902,   903,   904,
+     905,     0,   906,   907,   441,   821,     0,   908,     0,   822,
+     823,     0,     0,     0,     0,   971,   910,  1342,     0,   771,
+     772,   773,   774,   775,     0,     0,     0,     0,   780,   781,
+     782,     0,     0,     0,     0,     0,     0,     0,   783,   784,
+     785,   786,   787,   788,   789,   790,     0,   791,   792,   793,
+     794,   795,   796,   797,   798,   799,   800,     0,   801,     0,
+       0,     0,     0,     0,   803,   804,   805,   806,   807,   808,
+     809,     0,     0,     0,     0,   812,   813,     0,     0,     0,
+     814,   815,   816,   817,   818,   819,   881,   882,   883,   884,
+     885,   886,   887,   888,   889,   890,   891,   892,   893,   894,
+     895,   896,   897,   898,  1344,     0,   771,   772,   773,   774,
+     775,     0,     0,     0,     0,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,     0,
+       0,   803,   804,   805,   806,   807,   808,   809,     0,     0,
+       0,     0,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,   881,   882,   883,   884,   885,   886,   887,
+     888,   889,   890,   891,   892,   893,   894,   895,   896,   897,
+     898,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1346,     0,
+     771,   772,   773,   774,   775,     0,     0,     0,     0,   780,
+     781,   782,     0,     0,     0,     0,     0,     0,     0,   783,
+     784,   785,   786,   787,   788,   789,   790,     0,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,     0,   801,
+       0,     0,     0,     0,     0,   803,   804,   805,   806,   807,
+     808,   809,     0,     0,     0,     0,   812,   813,     0,   820,
+     899,   814,   815,   816,   817,   818,   819,   881,   882,   883,
+     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
+     894,   895,   896,   897,   898,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   900,     0,     0,     0,   901,     0,
+     902,   903,   904,   905,     0,   906,   907,   441,   821,     0,
+     908,     0,   822,   823,     0,     0,     0,     0,   971,   910,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   820,   899,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   900,     0,     0,     0,   901,     0,   902,   903,   904,
+     905,     0,   906,   907,   441,   821,     0,   908,     0,   822,
+     823,     0,     0,     0,     0,   971,   910,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     820,   899,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   900,     0,     0,     0,   901,
+       0,   902,   903,   904,   905,     0,   906,   907,   441,   821,
+       0,   908,     0,   822,   823,     0,     0,     0,     0,   971,
+     910,  1348,     0,   771,   772,   773,   774,   775,     0,     0,
+       0,     0,   780,   781,   782,     0,     0,     0,     0,     0,
+       0,     0,   783,   784,   785,   786,   787,   788,   789,   790,
+       0,   791,   792,   793,   794,   795,   796,   797,   798,   799,
+     800,     0,   801,     0,     0,     0,     0,     0,   803,   804,
+     805,   806,   807,   808,   809,     0,     0,     0,     0,   812,
+     813,     0,     0,     0,   814,   815,   816,   817,   818,   819,
+     881,   882,   883,   884,   885,   886,   887,   888,   889,   890,
+     891,   892,   893,   894,   895,   896,   897,   898,  1350,     0,
+     771,   772,   773,   774,   775,     0,     0,     0,     0,   780,
+     781,   782,     0,     0,     0,     0,     0,     0,     0,   783,
+     784,   785,   786,   787,   788,   789,   790,     0,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,     0,   801,
+       0,     0,     0,     0,     0,   803,   804,   805,   806,   807,
+     808,   809,     0,     0,     0,     0,   812,   813,     0,     0,
+       0,   814,   815,   816,   817,   818,   819,   881,   882,   883,
+     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
+     894,   895,   896,   897,   898,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1536,     0,   771,   772,   773,   774,   775,     0,
+       0,     0,     0,   780,   781,   782,     0,     0,     0,     0,
+       0,     0,     0,   783,   784,   785,   786,   787,   788,   789,
+     790,     0,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,     0,   801,     0,     0,     0,     0,     0,   803,
+     804,   805,   806,   807,   808,   809,     0,     0,     0,     0,
+     812,   813,     0,   820,   899,   814,   815,   816,   817,   818,
+     819,   881,   882,   883,   884,   885,   886,   887,   888,   889,
+     890,   891,   892,   893,   894,   895,   896,   897,   898,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   900,     0,
+       0,     0,   901,     0,   902,   903,   904,   905,     0,   906,
+     907,   441,   821,     0,   908,     0,   822,   823,     0,     0,
+       0,     0,   971,   910,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     820,   899,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   900,     0,     0,     0,   901,
+       0,   902,   903,   904,   905,     0,   906,   907,   441,   821,
+       0,   908,     0,   822,   823,     0,     0,     0,     0,   971,
+     910,     0,     0,   771,   772,   773,   774,   775,   776,   777,
+     778,   779,   780,   781,   782,     0,     0,     0,     0,     0,
+       0,     0,   783,   784,   785,   786,   787,   788,   789,   790,
+       0,   791,   792,   793,   794,   795,   796,   797,   798,   799,
+     800,     0,   801,     0,   820,   899,   802,     0,   803,   804,
+     805,   806,   807,   808,   809,   810,     0,     0,   811,   812,
+     813,     0,     0,     0,   814,   815,   816,   817,   818,   819,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   900,
+       0,     0,     0,   901,     0,   902,   903,   904,   905,     0,
+     906,   907,   441,   821,     0,   908,     0,   822,   823,     0,
+       0,     0,     0,   971,   910,   771,   772,   773,   774,   775,
+       0,     0,     0,     0,   780,   781,   782,     0,     0,     0,
+       0,     0,     0,     0,   783,   784,   785,   786,   787,   788,
+     789,   790,     0,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,     0,   801,     0,     0,     0,     0,     0,
+     803,   804,   805,   806,   807,   808,   809,     0,     0,     0,
+       0,   812,   813,     0,     0,     0,   814,   815,   816,   817,
+     818,   819,   881,   882,   883,   884,   885,   886,   887,   888,
+     889,   890,   891,   892,   893,   894,   895,   896,   897,   898,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   820,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1113,
+    1114,  1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,  1123,
+    1124,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,  1133,
+    1134,  1135,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   821,     0,     0,     0,   822,   823,     0,     0,
+     824,     0,     0,  1182,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   820,   899,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     900,     0,     0,     0,   901,     0,   902,   903,   904,   905,
+       0,   906,   907,   441,   821,     0,   908,     0,   822,   823,
+       0,     0,     0,     0,   909,   910,   771,   772,   773,   774,
+     775,     0,     0,     0,     0,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,     0,
+       0,   803,   804,   805,   806,   807,   808,   809,     0,     0,
+       0,     0,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,   881,   882,   883,   884,   885,   886,   887,
+     888,   889,   890,   891,   892,   893,   894,   895,   896,   897,
+     898,   771,   772,   773,   774,   775,     0,     0,     0,     0,
+     780,   781,   782,     0,     0,     0,     0,     0,     0,     0,
+     783,   784,   785,   786,   787,   788,   789,   790,     0,   791,
+     792,   793,   794,   795,   796,   797,   798,   799,   800,     0,
+     801,     0,     0,     0,     0,     0,   803,   804,   805,   806,
+     807,   808,   809,     0,     0,     0,     0,   812,   813,     0,
+       0,     0,   814,   815,   816,   817,   818,   819,   881,   882,
+     883,   884,   885,   886,   887,   888,   889,   890,   891,   892,
+     893,   894,   895,   896,   897,   898,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   771,   772,   773,
+     774,   775,     0,     0,     0,     0,   780,   781,   782,     0,
+       0,     0,     0,     0,     0,     0,   783,   784,   785,   786,
+     787,   788,   789,   790,     0,   791,   792,   793,   794,   795,
+     796,   797,   798,   799,   800,     0,   801,     0,     0,     0,
+       0,     0,   803,   804,   805,   806,   807,   808,   809,     0,
+       0,     0,     0,   812,   813,     0,   820,   899,   814,   815,
+     816,   817,   818,   819,   881,   882,   883,   884,   885,   886,
+     887,   888,   889,   890,   891,   892,   893,   894,   895,   896,
+     897,   898,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   900,     0,     0,     0,   901,     0,   902,   903,   904,
+     905,     0,   906,   907,   441,   821,     0,   908,     0,   822,
+     823,     0,     0,     0,     0,   930,   910,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   820,   899,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   900,     0,     0,     0,
+     901,     0,   902,   903,   904,   905,     0,   906,   907,   441,
+     821,     0,   908,     0,   822,   823,     0,     0,     0,     0,
+     932,   910,     0,     0,     0,     0,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,   820,   899,   802,
+       0,   803,   804,   805,   806,   807,   808,   809,   810,     0,
+       0,   811,   812,   813,     0,     0,     0,   814,   815,   816,
+     817,   818,   819,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   900,     0,     0,     0,   901,     0,   902,   903,
+     904,   905,     0,   906,   907,   441,   821,     0,   908,     0,
+     822,   823,     0,     0,     0,     0,   971,   910,   771,   772,
+     773,   774,   775,     0,     0,     0,     0,   780,   781,   782,
+       0,     0,     0,     0,     0,     0,     0,   783,   784,   785,
+     786,   787,   788,   789,   790,     0,   791,   792,   793,   794,
+     795,   796,   797,   798,   799,   800,     0,   801,     0,     0,
+       0,     0,     0,   803,   804,   805,   806,   807,   808,   809,
+       0,     0,     0,     0,   812,   813,     0,     0,     0,   814,
+     815,   816,   817,   818,   819,   881,   882,   883,   884,   885,
+     886,   887,   888,   889,   890,   891,   892,   893,   894,   895,
+     896,   897,   898,     0,  1097,     0,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,     0,     0,
+       0,     0,     0,     0,     0,   783,   784,   785,   786,   787,
+     788,   789,   790,     0,   791,   792,   793,   794,   795,   796,
+     797,   798,   799,   800,     0,   801,     0,     0,     0,   802,
+       0,   803,   804,   805,   806,   807,   808,   809,   810,     0,
+       0,   811,   812,   813,     0,     0,   820,   814,   815,   816,
+     817,   818,   819,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   821,     0,     0,     0,   822,
+     823,     0,     0,   824,     0,     0,  1182,   771,   772,   773,
+     774,   775,   776,   777,   778,   779,   780,   781,   782,     0,
+       0,     0,     0,     0,     0,     0,   783,   784,   785,   786,
+     787,   788,   789,   790,     0,   791,   792,   793,   794,   795,
+     796,   797,   798,   799,   800,     0,   801,     0,   820,   899,
+     802,     0,   803,   804,   805,   806,   807,   808,   809,   810,
+       0,     0,   811,   812,   813,     0,     0,     0,   814,   815,
+     816,   817,   818,   819,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   900,     0,     0,     0,   901,     0,   902,
+     903,   904,   905,     0,   906,   907,  1486,   821,     0,   908,
+       0,   822,   823,     0,     0,     0,     0,   971,   910,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   820,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   821,     0,     0,     0,   822,
+     823,     0,     0,   824,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   820,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   821,     0,     0,     0,
+     822,   823,     0,     0,   824
+};
+
+static const yytype_int16 yycheck[] =
+{
+     194,   163,   360,   197,   421,   739,   193,   741,   985,  1037,
+     744,     1,   872,   747,   874,     1,   876,     1,   878,   753,
+     880,     1,     1,   217,   893,   219,   895,   221,   897,   223,
+     741,   826,     1,   744,     1,     1,   747,     1,   739,     1,
+     741,     1,   753,   744,     1,   914,   747,   842,     1,   844,
+       1,   846,   753,     1,     1,     1,   851,     1,    56,    57,
+     206,   288,   739,     1,   741,     1,    57,   744,   298,   288,
+     747,     1,     1,     1,   301,   288,   753,     1,     1,   298,
+     268,     1,     1,   912,     1,   315,   268,   916,   301,   316,
+     289,    62,   826,   287,   288,   289,   290,   291,   292,     1,
+     268,     1,   301,     1,   288,     1,     1,     1,   842,     1,
+     844,   469,   846,   268,   298,     1,   288,   851,    56,    57,
+       1,   315,   316,   317,     1,   826,   298,     1,     1,     1,
+       1,    88,    89,    90,    91,     1,     1,   309,     1,   311,
+       1,   842,     1,   844,     1,   846,     1,   276,   277,   826,
+     851,     1,   281,   282,     1,     1,   268,     1,    88,    89,
+      90,    91,     1,     1,     1,   842,     1,   844,     0,   846,
+       1,     1,   268,     1,   851,   909,   910,   972,     1,     1,
+       1,   288,   909,     1,    61,     1,    88,    89,    90,    91,
+     985,     1,     1,     1,   301,   920,   930,   304,   932,   910,
+       1,     1,   302,   930,   304,   932,   288,     1,   909,   910,
+       1,   301,   302,   301,   304,    61,   304,    14,    15,   301,
+       1,     1,   304,    61,   309,     1,   311,     1,   268,   930,
+       1,   932,   909,   910,     1,   268,     1,   971,   972,    61,
+       1,   764,   765,     1,   971,   268,   268,     1,     1,  1109,
+     268,   985,     1,   930,     1,   932,     1,     1,     1,   309,
+      61,   311,     1,   301,   302,     1,   304,   268,     1,     1,
+     971,   972,     1,   309,     1,   311,     1,     1,     1,     1,
+       1,   268,     1,   739,   985,   741,  1020,   253,   744,     1,
+     268,   747,     1,     1,   971,   972,   268,   753,     1,    16,
+    1034,   268,   309,  1098,   311,   268,  1040,   739,   985,   741,
+       1,   302,   744,     1,     1,   747,   314,     1,     1,  1020,
+     310,   753,   301,  1034,     1,   305,   305,   313,   474,  1040,
+     301,   315,   289,  1034,     1,   315,   315,   304,   304,  1040,
+       1,   307,   311,   312,   301,   302,   303,   304,   305,   313,
+     312,   315,     1,   313,   301,   312,   302,  1034,   315,   289,
+     313,   312,   315,  1040,  1098,   313,  1394,   315,   304,   313,
+     826,   301,   302,   303,   304,   305,   314,   301,   302,   303,
+     304,   305,   312,   312,   312,   315,   842,   289,   844,   312,
+     846,   315,   312,   312,   826,   851,   313,  1098,   315,   301,
+     302,   303,   304,   305,   304,   763,     1,   302,     1,   304,
+     842,  1388,   844,   315,   846,   313,   312,   315,   312,   851,
+     312,  1098,    19,   304,   301,   302,   312,   304,   305,   288,
+     304,  1226,     1,   268,   311,     1,     1,  1232,   315,   312,
+     312,   312,   301,  1312,   301,   302,   312,   312,  1182,   312,
+    1319,   312,   311,   909,   910,   301,   302,   312,   304,   305,
+     268,     1,   312,   301,   302,   312,   304,   305,   312,   315,
+     301,  1182,   302,   312,   930,   312,   932,   315,   910,   301,
+     302,  1182,   304,   305,   312,  1219,  1220,  1221,  1222,   312,
+    1215,   312,  1226,   315,   312,   304,   312,   855,  1232,     1,
+     301,   302,   312,   304,   305,  1182,  1534,   301,  1219,  1220,
+    1221,  1222,   312,   304,   315,   971,   972,   311,  1219,  1220,
+    1221,  1222,   302,   304,   304,  1226,   302,   301,   304,   985,
+     304,  1232,     1,   304,   301,   302,   303,   304,   305,   304,
+     972,   302,  1219,  1220,  1221,  1222,   304,   301,   315,  1226,
+     304,   304,   301,   985,   301,  1232,     1,   302,   302,   304,
+     304,   304,   739,   302,   741,   304,   302,   744,   304,   302,
+     747,   304,   304,   735,     1,   304,   753,   304,  1034,   304,
+     304,   304,   304,   304,  1040,   304,     1,     1,  1020,   301,
+     302,   303,  1387,  1388,     1,   304,   304,   288,   301,   302,
+     303,   288,  1034,     1,   288,   288,     1,     1,  1040,  1469,
+     301,   288,     1,   301,   301,  1032,   974,   301,   301,     1,
+     978,   288,     1,     1,   301,     1,     1,  1422,  1423,  1424,
+    1425,     1,     1,     1,   301,     1,     1,     1,     1,   288,
+     301,     1,  1098,     1,     1,     1,     1,     1,     1,   826,
+       1,     1,   301,  1387,  1388,   268,   268,     1,     1,     1,
+       1,     1,     1,     1,     1,   842,  1098,   844,   268,   846,
+       1,     1,     1,     1,   851,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,  1387,  1388,  1422,  1423,
+    1424,  1425,   268,   288,     1,   288,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,   301,     1,   301,     1,
+    1387,  1388,   268,     1,     1,     1,     1,     1,     1,   288,
+       1,  1422,  1423,  1424,  1425,     1,  1182,   268,     1,     1,
+       1,     1,   301,   910,     1,   301,   301,   268,     1,     1,
+       1,     1,   268,   268,  1539,  1422,  1423,  1424,  1425,  1483,
+    1182,   309,     1,   311,  1549,     1,     1,     1,  1553,  1554,
+    1555,   301,   956,  1219,  1220,  1221,  1222,    62,   268,     1,
+    1226,   309,  1483,   311,     1,   268,  1232,     1,     1,   268,
+       1,     1,  1483,   970,   268,     1,   288,  1219,  1220,  1221,
+    1222,   978,   268,    62,  1226,   972,     1,     1,   268,   301,
+    1232,  1535,   268,     1,  1538,  1539,  1483,     1,   985,     1,
+     309,     1,   311,     1,     1,  1549,  1550,  1551,   268,  1553,
+    1554,  1555,   268,    20,  1535,     1,   268,  1538,    62,   991,
+     268,   993,   301,   995,  1535,     1,    62,  1538,  1539,  1550,
+    1551,   268,     1,   268,   289,  1039,     1,     1,  1549,  1550,
+    1551,   268,  1553,  1554,  1555,     1,   301,  1034,  1535,     1,
+       1,  1538,  1539,  1040,    88,    89,    90,    91,    88,    89,
+      90,    91,  1549,  1550,  1551,   289,  1553,  1554,  1555,     1,
+       1,     1,     1,   776,   777,   778,   301,   301,     1,     1,
+       1,     1,     1,     1,   301,     1,     1,   737,   268,   268,
+     313,   268,   742,   301,    21,   745,   301,   301,   748,   802,
+     301,   301,   301,   209,   210,   211,   212,   810,   811,   301,
+     268,  1098,   301,   301,   301,   301,   301,    88,    89,    90,
+      91,  1387,  1388,   301,   268,   301,   301,   301,   301,   301,
+     302,   301,   304,   301,   301,   301,   301,   301,   301,   301,
+     301,   301,   301,   298,   268,  1387,  1388,   301,   301,   301,
+     301,   301,   301,   301,   301,   301,  1422,  1423,  1424,  1425,
+     301,   301,   301,   301,   301,   301,   301,   301,   301,   301,
+     301,   301,   301,   301,   301,   301,   301,   302,   268,   304,
+    1422,  1423,  1424,  1425,   301,   301,   301,   301,   301,   301,
+     301,   301,   301,   301,   301,  1182,   301,   301,   268,   301,
+     903,   904,   905,   301,   301,   301,   301,   301,   301,   268,
+     301,   268,   268,   268,   268,   301,   268,  1483,   301,   301,
+     301,   301,   301,   268,   301,   928,   268,  1395,   301,   301,
+     301,   268,  1219,  1220,  1221,  1222,   939,   268,   301,  1226,
+     268,  1483,   268,   276,   277,  1232,   268,   268,   281,   282,
+     283,   284,   285,   286,   268,   289,   309,   301,   311,   289,
+     268,   276,   277,   278,   268,   301,   281,   282,   268,  1535,
+     268,   268,  1538,  1539,   276,   277,   278,   268,   268,   281,
+     282,   268,   268,  1549,  1550,  1551,   268,  1553,  1554,  1555,
+     309,     1,   311,  1535,   268,   268,  1538,  1539,   268,   268,
+     276,   277,   278,   268,   268,   281,   282,  1549,  1550,  1551,
+     268,  1553,  1554,  1555,  1017,   268,   268,   268,   289,   268,
+     276,   277,  1326,   268,   301,   281,   282,   289,   290,   291,
+     301,   302,   303,   304,   305,   268,   268,   268,   268,   268,
+     268,   312,   268,   268,   315,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   874,   309,   876,   311,   878,   268,
+     880,    71,    72,    73,    74,   309,    76,   311,    78,   309,
+      80,   311,  1075,  1076,  1077,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,  1087,  1088,   288,   268,   301,   302,
+     303,   304,   305,   268,   268,   268,   298,  1100,   288,   312,
+    1387,  1388,   315,  1106,  1107,   268,  1109,   309,   298,   311,
+    1113,  1114,  1115,  1116,  1117,  1118,  1119,   268,   309,   309,
+     311,   311,   302,   287,   288,   289,   290,   291,  1131,  1132,
+    1133,  1134,  1135,  1136,  1137,  1422,  1423,  1424,  1425,   301,
+     302,   303,   304,   305,   268,   268,  1418,   268,   309,  1421,
+     311,   301,     1,   315,     3,     4,     5,     6,     7,  1463,
+     309,   268,   311,    12,    13,    14,   309,   309,   311,   311,
+     268,   288,   268,    22,    23,    24,    25,    26,    27,    28,
+      29,   298,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,   309,    42,   311,   268,  1483,   268,   268,    48,
+      49,    50,    51,    52,    53,    54,  1209,   268,   268,   268,
+      59,    60,   268,   268,   268,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,   283,
+     284,   285,   286,   287,   288,   289,   290,   291,  1535,   288,
+     268,  1538,  1539,   268,   268,   268,   268,   268,   301,   298,
+     268,   268,  1549,  1550,  1551,   301,  1553,  1554,  1555,   268,
+     309,   268,   311,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,   290,   291,  1109,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,   290,   291,   313,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,   290,   291,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   311,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,     0,     1,   268,  1398,   268,   268,   268,   268,
+     268,  1404,   301,   301,   253,   254,    14,    15,    16,    17,
+      18,    19,    20,    21,   309,   318,   309,   313,   318,   316,
+     103,   312,   268,   268,   318,   301,   301,   245,   301,   245,
+      38,   298,   298,    41,    42,    43,    44,    45,   301,   288,
+     301,   301,   301,   292,   301,   294,   295,   296,   297,    57,
+     299,   300,   301,   302,   301,   304,   305,   306,   307,   301,
+     301,   301,   301,   312,   313,   301,   315,   304,   301,   304,
+     301,   301,   301,   301,   301,   301,   301,  1480,   301,   301,
+     318,   305,   316,   304,   316,  1488,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   309,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
+     198,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,   308,   311,   309,   316,   213,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   312,   246,   247,
+     248,   249,   250,   251,   252,   312,   312,   312,   312,   312,
+     312,   312,   312,   312,   310,   310,   313,   265,   266,   267,
+     318,   309,   269,   270,   271,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
+     287,   288,   289,   290,   291,   316,   316,   316,   316,   313,
+     312,   312,   304,   311,   302,   311,   311,   311,   311,   298,
+     311,   311,   310,   312,   311,   311,   311,   301,     1,   317,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,   315,   313,   313,   313,   313,   301,   311,    22,
+      23,    24,    25,    26,    27,    28,    29,   302,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,   311,    42,
+     311,   311,   311,    46,   311,    48,    49,    50,    51,    52,
+      53,    54,    55,   268,   268,    58,    59,    60,   268,   268,
+     311,    64,    65,    66,    67,    68,    69,     1,   314,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,   315,   311,   309,   311,   309,   311,    47,    22,    23,
+      24,    25,    26,    27,    28,    29,   318,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,   311,    42,   311,
+     311,   311,    46,   311,    48,    49,    50,    51,    52,    53,
+      54,    55,   311,   311,    58,    59,    60,   311,   311,   311,
+      64,    65,    66,    67,    68,    69,     1,   311,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+     311,   311,   311,   311,   311,   311,   311,    22,    23,    24,
+      25,    26,    27,    28,    29,   311,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,   311,    42,   311,   311,
+     311,    46,   311,    48,    49,    50,    51,    52,    53,    54,
+      55,   311,   311,    58,    59,    60,   311,   311,   311,    64,
+      65,    66,    67,    68,    69,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,   290,   291,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   311,   311,   311,   311,
+     253,   311,   318,   311,   311,   309,   311,   302,   311,   311,
+     311,   311,   311,   311,   311,   309,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,   290,   291,   316,
+     304,   304,   268,   298,   311,   298,   311,   301,   304,   302,
+     301,   301,   301,   306,   307,   301,   309,   310,   311,   312,
+     313,   301,   301,   301,   301,   318,   301,   301,   301,   253,
+     301,   301,   301,   315,   298,   311,   290,   304,   301,   311,
+     171,   761,   855,   311,  1077,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,   290,   291,   314,   318,
+     311,   311,   311,   311,   311,   311,   311,   311,   302,   311,
+     311,   311,   306,   307,   311,   309,   310,   311,   312,   313,
+     311,   311,   311,   311,   318,   311,   311,   311,   253,   311,
+     311,   311,   311,   311,   470,   311,   311,   311,   311,   316,
+     311,   311,   735,   733,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   318,   318,   318,
+     316,   316,  1079,  1079,   318,   318,   323,   302,  1480,  1488,
+     322,   306,   307,  1464,   309,   310,   311,  1210,   313,  1402,
+      -1,    -1,     1,   318,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    -1,    42,
+      -1,    -1,    -1,    46,    -1,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    -1,    -1,
+      -1,    64,    65,    66,    67,    68,    69,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,   290,   291,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,    -1,    -1,   311,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   311,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,     1,
+     309,   310,   311,    -1,   313,    -1,    -1,    -1,    -1,   318,
+      -1,    -1,    14,    15,    16,    17,    18,    19,    20,    21,
+     253,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,    41,
+      42,    43,    44,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    57,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   302,
+      -1,    -1,    -1,   306,   307,    -1,    -1,   310,    -1,    -1,
+      -1,   314,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,    -1,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,    -1,   246,   247,   248,   249,   250,   251,
+     252,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   265,   266,   267,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   286,   287,   288,   289,   290,   291,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     302,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   310,    -1,
+      -1,    -1,    -1,    -1,     1,   317,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,     1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,   253,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,    -1,    -1,   302,    -1,    -1,    -1,   306,
+     307,    -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,
+      -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,     1,   314,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,     1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      58,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,   253,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,
+     307,    -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,
+      -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,     1,   314,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    58,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,     1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      58,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,   253,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,
+     307,    -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,
+      -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,     1,   314,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    58,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,     1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      58,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,   253,    46,    -1,    48,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    58,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,
+     307,    -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,
+      -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,
+      -1,   310,    -1,    -1,     1,   314,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    58,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,     1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,    -1,
+      48,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      58,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,     1,    -1,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    50,    51,    52,    53,    54,    -1,    -1,    -1,    -1,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,
+     307,    -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,   307,
+      -1,    -1,   310,    -1,    -1,    -1,   314,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,   254,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,
+     289,    -1,    -1,   292,    -1,   294,   295,   296,   297,    -1,
+     299,   300,   301,   302,    -1,   304,    -1,   306,   307,    -1,
+      -1,    -1,    -1,   312,   313,     1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,
+      -1,    -1,    48,    49,    50,    51,    52,    53,    54,    -1,
+      -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    -1,    42,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,    52,
+      53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,
+      -1,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    -1,    42,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    50,    51,    52,    53,    54,
+      -1,    -1,    -1,    -1,    59,    60,    -1,   253,   254,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   288,   289,    -1,    -1,   292,    -1,   294,   295,
+     296,   297,    -1,   299,   300,   301,   302,    -1,   304,    -1,
+     306,   307,    -1,    -1,    -1,    -1,   312,   313,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     253,   254,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,   292,
+      -1,   294,   295,   296,   297,    -1,   299,   300,   301,   302,
+      -1,   304,    -1,   306,   307,    -1,    -1,    -1,   311,   312,
+     313,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   253,   254,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   288,    -1,    -1,    -1,   292,    -1,   294,
+     295,   296,   297,    -1,   299,   300,   301,   302,    -1,   304,
+      -1,   306,   307,    -1,    -1,    -1,   311,   312,   313,     1,
+      -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
+      42,    -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,
+      52,    53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,
+      -1,    -1,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    -1,    42,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    50,    51,    52,    53,    54,
+      -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,    50,
+      51,    52,    53,    54,    -1,    -1,    -1,    -1,    59,    60,
+      -1,   253,   254,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,
+     292,    -1,   294,   295,   296,   297,    -1,   299,   300,   301,
+     302,    -1,   304,    -1,   306,   307,    -1,    -1,    -1,   311,
+     312,   313,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   253,   254,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   288,    -1,   290,    -1,   292,    -1,   294,
+     295,   296,   297,    -1,   299,   300,   301,   302,    -1,   304,
+      -1,   306,   307,    -1,    -1,    -1,    -1,   312,   313,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   253,   254,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,
+      -1,   292,    -1,   294,   295,   296,   297,    -1,   299,   300,
+     301,   302,    -1,   304,    -1,   306,   307,    -1,    -1,    -1,
+      -1,   312,   313,     1,    -1,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,    -1,
+      48,    49,    50,    51,    52,    53,    54,    -1,    -1,    -1,
+      -1,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,    50,
+      51,    52,    53,    54,    -1,    -1,    -1,    -1,    59,    60,
+      -1,    -1,    -1,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,
+      -1,    48,    49,    50,    51,    52,    53,    54,    -1,    -1,
+      -1,    -1,    59,    60,    -1,   253,   254,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,   297,
+      -1,   299,   300,   301,   302,    -1,   304,    -1,   306,   307,
+      -1,    -1,    -1,    -1,   312,   313,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   253,   254,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,
+      -1,   292,    -1,   294,   295,   296,   297,    -1,   299,   300,
+     301,   302,    -1,   304,    -1,   306,   307,    -1,    -1,    -1,
+      -1,   312,   313,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   253,   254,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,
+     297,    -1,   299,   300,   301,   302,    -1,   304,    -1,   306,
+     307,    -1,    -1,    -1,    -1,   312,   313,     1,    -1,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,
+      14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    -1,    42,    -1,
+      -1,    -1,    -1,    -1,    48,    49,    50,    51,    52,    53,
+      54,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,     1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,
+      -1,    48,    49,    50,    51,    52,    53,    54,    -1,    -1,
+      -1,    -1,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    -1,    42,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,    52,
+      53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,   253,
+     254,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,   292,    -1,
+     294,   295,   296,   297,    -1,   299,   300,   301,   302,    -1,
+     304,    -1,   306,   307,    -1,    -1,    -1,    -1,   312,   313,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   253,   254,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,
+     297,    -1,   299,   300,   301,   302,    -1,   304,    -1,   306,
+     307,    -1,    -1,    -1,    -1,   312,   313,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     253,   254,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,   292,
+      -1,   294,   295,   296,   297,    -1,   299,   300,   301,   302,
+      -1,   304,    -1,   306,   307,    -1,    -1,    -1,    -1,   312,
+     313,     1,    -1,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,
+      50,    51,    52,    53,    54,    -1,    -1,    -1,    -1,    59,
+      60,    -1,    -1,    -1,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    -1,    42,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,    52,
+      53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,
+      -1,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     1,    -1,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    50,    51,    52,    53,    54,    -1,    -1,    -1,    -1,
+      59,    60,    -1,   253,   254,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,
+      -1,    -1,   292,    -1,   294,   295,   296,   297,    -1,   299,
+     300,   301,   302,    -1,   304,    -1,   306,   307,    -1,    -1,
+      -1,    -1,   312,   313,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     253,   254,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,   292,
+      -1,   294,   295,   296,   297,    -1,   299,   300,   301,   302,
+      -1,   304,    -1,   306,   307,    -1,    -1,    -1,    -1,   312,
+     313,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,   254,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,
+      -1,    -1,    -1,   292,    -1,   294,   295,   296,   297,    -1,
+     299,   300,   301,   302,    -1,   304,    -1,   306,   307,    -1,
+      -1,    -1,    -1,   312,   313,     1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,
+      -1,    -1,    48,    49,    50,    51,    52,    53,    54,    -1,
+      -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,     1,    -1,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    50,    51,    52,    53,    54,    -1,    -1,    -1,    -1,
+      59,    60,    -1,    -1,    -1,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    -1,    42,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    50,    51,    52,    53,    54,
+      -1,    -1,    -1,    -1,    59,    60,    -1,   253,   254,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   288,    -1,    -1,    -1,   292,    -1,   294,   295,
+     296,   297,    -1,   299,   300,   301,   302,    -1,   304,    -1,
+     306,   307,    -1,    -1,    -1,    -1,   312,   313,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   253,   254,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,
+      -1,    -1,    -1,   292,    -1,   294,   295,   296,   297,    -1,
+     299,   300,   301,   302,    -1,   304,    -1,   306,   307,    -1,
+      -1,    -1,    -1,   312,   313,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   253,   254,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   288,    -1,    -1,    -1,   292,    -1,   294,
+     295,   296,   297,    -1,   299,   300,   301,   302,    -1,   304,
+      -1,   306,   307,    -1,    -1,    -1,    -1,   312,   313,     1,
+      -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
+      42,    -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,
+      52,    53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,
+      -1,    -1,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    -1,    42,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    50,    51,    52,    53,    54,
+      -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,    50,
+      51,    52,    53,    54,    -1,    -1,    -1,    -1,    59,    60,
+      -1,   253,   254,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,
+     292,    -1,   294,   295,   296,   297,    -1,   299,   300,   301,
+     302,    -1,   304,    -1,   306,   307,    -1,    -1,    -1,    -1,
+     312,   313,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   253,   254,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   288,    -1,    -1,    -1,   292,    -1,   294,
+     295,   296,   297,    -1,   299,   300,   301,   302,    -1,   304,
+      -1,   306,   307,    -1,    -1,    -1,    -1,   312,   313,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   253,   254,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,
+      -1,   292,    -1,   294,   295,   296,   297,    -1,   299,   300,
+     301,   302,    -1,   304,    -1,   306,   307,    -1,    -1,    -1,
+      -1,   312,   313,     1,    -1,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,    -1,
+      48,    49,    50,    51,    52,    53,    54,    -1,    -1,    -1,
+      -1,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,    50,
+      51,    52,    53,    54,    -1,    -1,    -1,    -1,    59,    60,
+      -1,    -1,    -1,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,
+      -1,    48,    49,    50,    51,    52,    53,    54,    -1,    -1,
+      -1,    -1,    59,    60,    -1,   253,   254,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,   297,
+      -1,   299,   300,   301,   302,    -1,   304,    -1,   306,   307,
+      -1,    -1,    -1,    -1,   312,   313,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   253,   254,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,
+      -1,   292,    -1,   294,   295,   296,   297,    -1,   299,   300,
+     301,   302,    -1,   304,    -1,   306,   307,    -1,    -1,    -1,
+      -1,   312,   313,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   253,   254,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,
+     297,    -1,   299,   300,   301,   302,    -1,   304,    -1,   306,
+     307,    -1,    -1,    -1,    -1,   312,   313,     1,    -1,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,
+      14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    -1,    42,    -1,
+      -1,    -1,    -1,    -1,    48,    49,    50,    51,    52,    53,
+      54,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,     1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,
+      -1,    48,    49,    50,    51,    52,    53,    54,    -1,    -1,
+      -1,    -1,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    -1,    42,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,    52,
+      53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,   253,
+     254,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,   292,    -1,
+     294,   295,   296,   297,    -1,   299,   300,   301,   302,    -1,
+     304,    -1,   306,   307,    -1,    -1,    -1,    -1,   312,   313,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   253,   254,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,
+     297,    -1,   299,   300,   301,   302,    -1,   304,    -1,   306,
+     307,    -1,    -1,    -1,    -1,   312,   313,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     253,   254,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,   292,
+      -1,   294,   295,   296,   297,    -1,   299,   300,   301,   302,
+      -1,   304,    -1,   306,   307,    -1,    -1,    -1,    -1,   312,
+     313,     1,    -1,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,
+      50,    51,    52,    53,    54,    -1,    -1,    -1,    -1,    59,
+      60,    -1,    -1,    -1,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    -1,    42,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,    52,
+      53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,    -1,
+      -1,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     1,    -1,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    -1,    42,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    50,    51,    52,    53,    54,    -1,    -1,    -1,    -1,
+      59,    60,    -1,   253,   254,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,
+      -1,    -1,   292,    -1,   294,   295,   296,   297,    -1,   299,
+     300,   301,   302,    -1,   304,    -1,   306,   307,    -1,    -1,
+      -1,    -1,   312,   313,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     253,   254,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,   292,
+      -1,   294,   295,   296,   297,    -1,   299,   300,   301,   302,
+      -1,   304,    -1,   306,   307,    -1,    -1,    -1,    -1,   312,
+     313,    -1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    -1,    42,    -1,   253,   254,    46,    -1,    48,    49,
+      50,    51,    52,    53,    54,    55,    -1,    -1,    58,    59,
+      60,    -1,    -1,    -1,    64,    65,    66,    67,    68,    69,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   288,
+      -1,    -1,    -1,   292,    -1,   294,   295,   296,   297,    -1,
+     299,   300,   301,   302,    -1,   304,    -1,   306,   307,    -1,
+      -1,    -1,    -1,   312,   313,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,    -1,
+      48,    49,    50,    51,    52,    53,    54,    -1,    -1,    -1,
+      -1,    59,    60,    -1,    -1,    -1,    64,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   253,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   302,    -1,    -1,    -1,   306,   307,    -1,    -1,
+     310,    -1,    -1,   313,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   253,   254,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,   297,
+      -1,   299,   300,   301,   302,    -1,   304,    -1,   306,   307,
+      -1,    -1,    -1,    -1,   312,   313,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    -1,
+      -1,    48,    49,    50,    51,    52,    53,    54,    -1,    -1,
+      -1,    -1,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    -1,
+      42,    -1,    -1,    -1,    -1,    -1,    48,    49,    50,    51,
+      52,    53,    54,    -1,    -1,    -1,    -1,    59,    60,    -1,
+      -1,    -1,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,
+      -1,    -1,    48,    49,    50,    51,    52,    53,    54,    -1,
+      -1,    -1,    -1,    59,    60,    -1,   253,   254,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   288,    -1,    -1,    -1,   292,    -1,   294,   295,   296,
+     297,    -1,   299,   300,   301,   302,    -1,   304,    -1,   306,
+     307,    -1,    -1,    -1,    -1,   312,   313,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   253,   254,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   288,    -1,    -1,    -1,
+     292,    -1,   294,   295,   296,   297,    -1,   299,   300,   301,
+     302,    -1,   304,    -1,   306,   307,    -1,    -1,    -1,    -1,
+     312,   313,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,   253,   254,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    58,    59,    60,    -1,    -1,    -1,    64,    65,    66,
+      67,    68,    69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   288,    -1,    -1,    -1,   292,    -1,   294,   295,
+     296,   297,    -1,   299,   300,   301,   302,    -1,   304,    -1,
+     306,   307,    -1,    -1,    -1,    -1,   312,   313,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    -1,    42,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    50,    51,    52,    53,    54,
+      -1,    -1,    -1,    -1,    59,    60,    -1,    -1,    -1,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    -1,     1,    -1,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    -1,    42,    -1,    -1,    -1,    46,
+      -1,    48,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    58,    59,    60,    -1,    -1,   253,    64,    65,    66,
+      67,    68,    69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,
+     307,    -1,    -1,   310,    -1,    -1,   313,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    -1,    42,    -1,   253,   254,
+      46,    -1,    48,    49,    50,    51,    52,    53,    54,    55,
+      -1,    -1,    58,    59,    60,    -1,    -1,    -1,    64,    65,
+      66,    67,    68,    69,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   288,    -1,    -1,    -1,   292,    -1,   294,
+     295,   296,   297,    -1,   299,   300,   301,   302,    -1,   304,
+      -1,   306,   307,    -1,    -1,    -1,    -1,   312,   313,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,   306,
+     307,    -1,    -1,   310,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   253,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   302,    -1,    -1,    -1,
+     306,   307,    -1,    -1,   310
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     1,    17,    18,    38,    41,    42,    43,    44,    45,
+      57,    94,    95,    96,    97,    98,    99,   100,   101,   102,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,   213,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   246,   247,   248,
+     249,   250,   251,   252,   265,   266,   267,   302,   310,   317,
+     320,   321,   322,   323,   324,   325,   326,   327,   338,   342,
+     345,   346,   347,   348,   357,   358,   364,   268,     1,   315,
+       1,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+       1,   268,     1,   268,     1,   268,     1,   268,     1,   268,
+       1,   268,     1,   268,     1,   268,     1,   268,     1,   268,
+       1,   268,     1,   268,     1,   268,     1,   268,     1,   268,
+       1,   268,     1,   268,     1,   268,     1,   268,     1,   268,
+       1,   268,     1,   268,     1,   268,     1,   268,     1,   268,
+       1,   268,     1,   268,     1,   268,     1,   268,     1,   268,
+       1,   268,     1,   268,     1,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,     1,   304,
+       1,   268,   304,     1,   312,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,     1,   268,     1,   268,
+       1,   268,     1,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,     1,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+       1,   302,   304,   339,   340,   341,     1,   341,   343,   344,
+       1,   304,     1,   304,     1,   304,     0,     1,   322,    14,
+      15,   354,   355,    16,   356,    19,   361,    20,   362,    21,
+     363,   298,   315,   313,   301,   302,   304,   353,     1,   301,
+       1,   301,     1,    88,    89,    90,    91,   289,   331,     1,
+     288,   301,   337,     1,   301,     1,   301,     1,   337,     1,
+     301,     1,   301,     1,   301,     1,   301,     1,   302,     1,
+     304,     1,   301,     1,   301,   302,   303,   304,   305,   312,
+     315,   328,   330,   331,   335,   336,   349,   350,   351,   352,
+     378,   379,     1,   336,     1,   301,     1,   301,     1,   301,
+     301,   301,   301,   337,   337,   337,   337,   301,   301,   301,
+     301,   301,   301,   301,   301,   301,   301,   301,   301,   301,
+     301,   301,   301,   301,   301,   301,   301,   301,   301,   301,
+     301,   301,   301,     1,   301,   304,     1,   301,     1,   301,
+       1,   301,     1,   301,     1,   301,     1,   301,     1,   301,
+       1,   301,     1,   301,     1,   337,     1,   337,     1,   337,
+       1,   337,     1,   337,     1,   337,     1,   301,     1,   301,
+       1,   304,     1,   304,     1,   301,     1,   304,   304,     1,
+     301,     1,   301,     1,   302,   304,     1,   302,   304,     1,
+     302,   304,     1,   302,   304,     1,   301,     1,   301,     1,
+     301,     1,   301,     1,   337,     1,   337,     1,   337,     1,
+     302,   304,     1,   301,     1,   301,     1,   301,     1,   301,
+     350,     1,   352,     1,   301,     1,   301,   301,   301,   301,
+     301,     1,   301,     1,   301,     1,   301,     1,   301,     1,
+     301,     1,   301,     1,   301,     1,   301,     1,   301,     1,
+     301,     1,   301,     1,   301,     1,   301,     1,   301,     1,
+     301,     1,   209,   210,   211,   212,     1,   301,     1,   301,
+       1,   301,     1,   301,     1,   304,     1,   304,     1,   304,
+       1,   301,     1,   301,     1,   301,     1,   328,     1,   301,
+       1,   301,     1,   301,     1,   301,     1,   301,     1,   301,
+       1,   301,     1,   301,     1,   301,     1,   301,     1,   301,
+       1,   301,     1,   301,     1,   301,     1,   301,     1,   301,
+     302,   301,     1,   301,     1,   301,     1,   301,     1,   301,
+       1,   301,     1,   304,   301,     1,   301,     1,   301,     1,
+     301,     1,   301,   309,   318,   309,     1,   315,     1,   313,
+       1,   313,   315,     1,   313,   315,     1,   313,   315,     1,
+     315,   346,   301,   359,   316,   301,   298,   328,   329,   351,
+     318,   318,   336,   103,   288,   298,   309,   339,   301,   343,
+     353,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    22,    23,    24,    25,    26,    27,    28,
+      29,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    42,    46,    48,    49,    50,    51,    52,    53,    54,
+      55,    58,    59,    60,    64,    65,    66,    67,    68,    69,
+     253,   302,   306,   307,   310,   380,   382,   383,   384,   388,
+     389,   397,   398,   400,   401,   404,   405,   407,   411,   412,
+     413,   417,   382,   353,   382,   353,   382,   353,   308,   268,
+     316,   382,     1,   360,   301,   309,   311,   316,     1,   289,
+     301,   333,   330,   328,     1,   301,   378,     1,   378,   304,
+     316,     1,   312,     1,   312,     1,   312,     1,   312,     1,
+     312,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,   254,
+     288,   292,   294,   295,   296,   297,   299,   300,   304,   312,
+     313,   337,   370,   371,   372,   373,   374,   375,   380,   392,
+     397,   398,   399,   400,   402,   404,   405,   408,   409,   410,
+     312,   410,   312,   410,     1,   312,     1,   312,     1,   312,
+     312,     1,   312,     1,   312,     1,   312,     1,   312,     1,
+     312,     1,   312,     1,   312,     1,   312,   312,     1,   312,
+       1,   312,     1,   312,     1,   312,   312,   312,   312,   312,
+     312,   312,   410,     1,   312,     1,   312,     1,   312,   312,
+     312,   312,   312,     1,   410,   410,     1,   312,     1,   312,
+       1,   312,     1,   312,     1,   312,     1,   414,     1,   310,
+       1,   314,   383,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   302,   394,   395,   396,   268,   406,   310,     1,
+     312,   310,   314,   316,   314,   316,   314,   316,   316,     1,
+     301,   304,   298,   314,   313,   298,   329,   318,   318,   309,
+     313,     1,    61,   302,   304,   311,   349,   377,     1,    61,
+     304,   349,   377,     1,    61,   304,   349,   377,     1,    61,
+     304,   349,   377,     1,    61,   304,   349,   377,     1,   276,
+     277,   278,   281,   282,   365,   367,   365,   365,     1,   365,
+     393,     1,   410,     1,   410,     1,   410,   312,   312,     1,
+     311,   398,   400,   404,   405,   410,   411,     1,   382,     1,
+     367,     1,   283,   284,   285,   286,   365,   366,     1,   367,
+     396,     1,   410,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   368,   369,   311,   311,
+       1,   301,   304,     1,   304,     1,   302,   410,   304,     1,
+     304,     1,   304,     1,   304,     1,   304,     1,   301,     1,
+     301,   311,     1,   311,   337,   311,     1,   304,     1,   304,
+       1,   304,     1,   304,   311,   311,   311,     1,   301,   311,
+       1,   331,   313,   381,   383,     1,   328,     1,   301,     1,
+     328,   331,   334,   311,   311,   311,   311,   313,   381,     1,
+     304,     1,   304,   301,   341,   301,   341,   301,   341,   312,
+     298,   315,   410,     1,   304,   397,   398,   403,   405,   313,
+     313,   313,   313,   245,   245,   346,   382,   301,   333,   301,
+     304,   337,   382,   311,   309,   311,   309,   311,   309,   311,
+     288,   298,   309,   311,   311,   309,   311,   309,   311,   309,
+     311,   309,   311,   311,   309,   311,   309,   311,   309,   311,
+     309,   311,   311,   309,   311,   309,   311,   309,   311,   309,
+     311,   311,   309,   311,   309,   311,   309,   311,   309,   311,
+       1,   302,   410,     1,    88,    89,    90,    91,    92,    93,
+     289,   332,   410,     1,   332,   410,     1,   370,   374,   302,
+     390,   391,     1,   410,     1,   410,   311,   311,   311,   314,
+     314,     1,    86,   410,     1,   410,     1,   410,     1,    86,
+     301,   302,   349,   376,   377,   410,   315,     1,   410,     1,
+     410,     1,   410,     1,   410,   410,   410,   410,     1,   410,
+       1,   410,     1,   410,     1,   410,     1,   410,     1,   410,
+       1,   410,   311,   309,   311,   311,   309,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   382,    47,   311,
+     311,   311,   311,   311,   318,   318,   311,     1,    56,    57,
+     314,   386,   387,   311,   309,   311,   311,   311,   311,   311,
+     311,   311,   311,   410,   415,   416,   395,   316,   309,   311,
+     396,   309,   382,   382,   382,   382,   304,   304,   268,   314,
+     298,   311,   311,   314,    62,   301,   301,   301,     1,   302,
+       1,   302,   301,    62,   301,   301,   301,   301,    62,   301,
+     301,   301,   301,    62,   301,   301,   301,   301,    62,   301,
+     301,   301,   301,   315,   298,   311,   311,   311,   311,   290,
+     337,   304,   304,   314,   381,     1,   333,   328,   314,     1,
+     290,   385,   410,   318,   314,   386,   301,   410,   309,   311,
+     341,     1,   341,   314,   314,   314,   314,   301,   304,   301,
+     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   304,   337,   390,     1,   301,
+     349,   316,   311,   311,   318,   318,     1,   385,   318,   382,
+     311,   311,   416,   311,   311,   311,   316,   316,   333,   382,
+     318,   318,     1,   382,   382,   382
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   319,   320,   321,   321,   321,   322,   322,   322,   322,
+     322,   323,   322,   324,   322,   322,   325,   322,   326,   322,
+     327,   322,   322,   322,   328,   328,   328,   329,   329,   330,
+     330,   331,   331,   331,   331,   331,   332,   332,   332,   332,
+     332,   332,   332,   333,   333,   334,   334,   334,   334,   334,
+     335,   335,   335,   335,   335,   336,   336,   337,   337,   338,
+     338,   339,   339,   340,   340,   341,   341,   342,   342,   343,
+     343,   344,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     345,   345,   345,   345,   345,   345,   345,   345,   345,   345,
+     346,   346,   347,   347,   347,   347,   347,   347,   347,   348,
+     348,   348,   348,   348,   348,   348,   348,   348,   349,   349,
+     350,   351,   352,   352,   353,   353,   353,   354,   354,   355,
+     355,   355,   355,   356,   356,   356,   357,   357,   359,   358,
+     358,   358,   360,   358,   358,   361,   361,   361,   362,   362,
+     362,   363,   363,   364,   364,   364,   364,   364,   364,   365,
+     365,   365,   365,   366,   366,   366,   366,   367,   367,   368,
+     368,   368,   368,   368,   368,   368,   369,   369,   369,   369,
+     370,   370,   370,   371,   371,   371,   372,   372,   372,   372,
+     372,   373,   373,   374,   374,   374,   375,   375,   375,   375,
+     375,   375,   375,   375,   375,   375,   375,   375,   375,   375,
+     375,   375,   375,   375,   375,   375,   375,   375,   375,   375,
+     375,   375,   375,   375,   375,   376,   376,   376,   376,   377,
+     377,   377,   377,   377,   378,   378,   378,   379,   379,   379,
+     379,   379,   380,   381,   381,   382,   382,   382,   383,   383,
+     383,   383,   383,   383,   383,   383,   384,   384,   385,   386,
+     386,   386,   386,   386,   386,   386,   386,   386,   386,   386,
+     387,   387,   388,   388,   388,   388,   389,   390,   390,   390,
+     391,   391,   393,   392,   394,   394,   394,   394,   394,   394,
+     394,   394,   394,   395,   396,   396,   397,   398,   399,   400,
+     401,   401,   402,   402,   402,   403,   403,   403,   404,   405,
+     406,   407,   407,   407,   408,   408,   408,   408,   408,   408,
+     408,   408,   408,   408,   408,   408,   409,   409,   409,   410,
+     410,   410,   410,   410,   410,   410,   410,   410,   410,   410,
+     410,   410,   410,   410,   410,   410,   410,   410,   410,   410,
+     410,   410,   410,   410,   410,   410,   410,   410,   410,   410,
+     410,   410,   410,   410,   410,   410,   410,   410,   411,   412,
+     412,   412,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   414,   413,   413,
+     415,   415,   415,   416,   417,   417,   417,   417,   417,   417,
+     417,   417,   417,   417
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     2,     1,     1,     1,     1,
+       1,     0,     2,     0,     2,     1,     0,     2,     0,     2,
+       0,     2,     1,     1,     1,     1,     1,     1,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     3,     5,     3,
+       1,     3,     3,     5,     3,     1,     2,     1,     2,     2,
+       2,     1,     3,     1,     3,     1,     1,     2,     2,     1,
+       3,     1,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     7,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     2,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     1,     2,
+       1,     1,     5,     5,     7,     7,     5,     8,     8,     2,
+       2,     2,     2,     3,     3,     8,     8,     2,     1,     1,
+       7,     1,     1,     3,     1,     1,     1,     1,     1,     4,
+       7,     2,     2,     4,     7,     2,     1,     1,     0,     5,
+       2,     2,     0,     8,     5,     4,     7,     2,     4,     7,
+       2,     7,     2,     2,     2,     2,     2,     2,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     3,     3,     2,
+       3,     3,     3,     2,     3,     3,     3,     3,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       2,     3,     3,     3,     2,     3,     3,     1,     3,     1,
+       3,     3,     3,     3,     1,     1,     1,     1,     3,     3,
+       3,     3,     1,     1,     3,     2,     1,     2,     2,     1,
+       1,     1,     2,     2,     1,     2,     3,     5,     1,     4,
+       5,     3,     4,     3,     2,     4,     5,     3,     4,     4,
+       2,     1,     5,     4,     2,     5,     3,     1,     4,     4,
+       3,     1,     0,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     1,     2,     5,     4,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     3,     1,     1,     1,     1,
+       2,     2,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     4,     4,
+       2,     2,     2,     2,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     4,     4,     2,     3,     1,
+       1,     1,     3,     4,     4,     4,     6,     6,     6,     6,
+       6,     4,     2,     4,     4,     4,     4,     6,     6,     6,
+       6,     6,     4,     2,     4,     4,     4,     4,     6,     6,
+       6,     6,     6,     4,     2,     4,     4,     4,     4,     6,
+       6,     6,     6,     6,     4,     2,     4,     4,     4,     4,
+       6,     6,     6,     6,     6,     4,     2,     4,     4,     6,
+       2,     4,     4,     4,     2,     4,     4,     2,     4,     4,
+       2,     6,     6,     6,     4,     2,     6,     2,     4,     4,
+       4,     2,     4,     4,     4,     2,     4,     4,     2,     4,
+       4,     2,     4,     4,     2,     4,     3,     2,     4,     3,
+       2,     4,     3,     4,     2,     4,     4,     2,     4,     4,
+       2,     4,     4,     2,     4,     4,     2,     4,     4,     2,
+       4,     3,     1,     3,     1,     3,     1,     4,     3,     1,
+       4,     4,     4,     4,     4,     2,     4,     4,     2,     4,
+       4,     2,     3,     1,     3,     1,     3,     1,     3,     1,
+       6,     6,     2,     4,     4,     2,     4,     0,     5,     2,
+       0,     3,     1,     1,     3,     2,     1,     3,     2,     1,
+       1,     3,     2,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* statements: statements statement  */
+#line 669 "cfg.y"
+                             {}
+#line 4832 "cfg.tab.c"
+    break;
+
+  case 4: /* statements: statement  */
+#line 670 "cfg.y"
+                    {}
+#line 4838 "cfg.tab.c"
+    break;
+
+  case 5: /* statements: statements error  */
+#line 671 "cfg.y"
+                           { yyerror(""); YYABORT;}
+#line 4844 "cfg.tab.c"
+    break;
+
+  case 11: /* $@1: %empty  */
+#line 679 "cfg.y"
+          {rt=REQUEST_ROUTE;}
+#line 4850 "cfg.tab.c"
+    break;
+
+  case 13: /* $@2: %empty  */
+#line 680 "cfg.y"
+          {rt=FAILURE_ROUTE;}
+#line 4856 "cfg.tab.c"
+    break;
+
+  case 16: /* $@3: %empty  */
+#line 682 "cfg.y"
+          {rt=BRANCH_ROUTE;}
+#line 4862 "cfg.tab.c"
+    break;
+
+  case 18: /* $@4: %empty  */
+#line 683 "cfg.y"
+          {rt=ONSEND_ROUTE;}
+#line 4868 "cfg.tab.c"
+    break;
+
+  case 20: /* $@5: %empty  */
+#line 684 "cfg.y"
+          {rt=EVENT_ROUTE;}
+#line 4874 "cfg.tab.c"
+    break;
+
+  case 24: /* listen_id: ip  */
+#line 689 "cfg.y"
+           {
+		if ((yyvsp[0].ipaddr)){
+			tmp=ip_addr2a((yyvsp[0].ipaddr));
+			if (tmp==0) {
+				LOG(L_CRIT, "ERROR: cfg. parser: bad ip "
+						"address.\n");
+				(yyval.strval)=0;
+			} else {
+				(yyval.strval)=pkg_malloc(strlen(tmp)+1);
+				if ((yyval.strval)==0) {
+					LOG(L_CRIT, "ERROR: cfg. parser: out of "
+							"memory.\n");
+				} else {
+					strncpy((yyval.strval), tmp, strlen(tmp)+1);
+				}
+			}
+		}
+	}
+#line 4897 "cfg.tab.c"
+    break;
+
+  case 25: /* listen_id: STRING  */
+#line 707 "cfg.y"
+                 {
+		(yyval.strval)=pkg_malloc(strlen((yyvsp[0].strval))+1);
+		if ((yyval.strval)==0) {
+				LOG(L_CRIT, "ERROR: cfg. parser: out of "
+						"memory.\n");
+		} else {
+				strncpy((yyval.strval), (yyvsp[0].strval), strlen((yyvsp[0].strval))+1);
+		}
+	}
+#line 4911 "cfg.tab.c"
+    break;
+
+  case 26: /* listen_id: host_or_if  */
+#line 716 "cfg.y"
+                     {
+		if ((yyvsp[0].strval)){
+			(yyval.strval)=pkg_malloc(strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+					LOG(L_CRIT, "ERROR: cfg. parser: out of "
+							"memory.\n");
+			} else {
+					strncpy((yyval.strval), (yyvsp[0].strval), strlen((yyvsp[0].strval))+1);
+			}
+		}
+	}
+#line 4927 "cfg.tab.c"
+    break;
+
+  case 27: /* listen_id_lst: listen_id  */
+#line 731 "cfg.y"
+                        { (yyval.name_l)=mk_name_lst((yyvsp[0].strval), SI_IS_MHOMED); }
+#line 4933 "cfg.tab.c"
+    break;
+
+  case 28: /* listen_id_lst: listen_id COMMA listen_id_lst  */
+#line 732 "cfg.y"
+                                        { (yyval.name_l)=mk_name_lst((yyvsp[-2].strval), SI_IS_MHOMED); 
+										if ((yyval.name_l)) (yyval.name_l)->next=(yyvsp[0].name_l);
+									}
+#line 4941 "cfg.tab.c"
+    break;
+
+  case 29: /* listen_id2: LPAREN listen_id_lst RPAREN  */
+#line 738 "cfg.y"
+                                    { (yyval.name_l)=(yyvsp[-1].name_l); }
+#line 4947 "cfg.tab.c"
+    break;
+
+  case 30: /* listen_id2: listen_id  */
+#line 739 "cfg.y"
+                        { (yyval.name_l)=mk_name_lst((yyvsp[0].strval), 0); }
+#line 4953 "cfg.tab.c"
+    break;
+
+  case 31: /* proto: UDP  */
+#line 743 "cfg.y"
+                { (yyval.intval)=PROTO_UDP; }
+#line 4959 "cfg.tab.c"
+    break;
+
+  case 32: /* proto: TCP  */
+#line 744 "cfg.y"
+                { (yyval.intval)=PROTO_TCP; }
+#line 4965 "cfg.tab.c"
+    break;
+
+  case 33: /* proto: TLS  */
+#line 745 "cfg.y"
+                { (yyval.intval)=PROTO_TLS; }
+#line 4971 "cfg.tab.c"
+    break;
+
+  case 34: /* proto: SCTP  */
+#line 746 "cfg.y"
+                { (yyval.intval)=PROTO_SCTP; }
+#line 4977 "cfg.tab.c"
+    break;
+
+  case 35: /* proto: STAR  */
+#line 747 "cfg.y"
+                { (yyval.intval)=0; }
+#line 4983 "cfg.tab.c"
+    break;
+
+  case 36: /* eqproto: UDP  */
+#line 750 "cfg.y"
+                { (yyval.intval)=PROTO_UDP; }
+#line 4989 "cfg.tab.c"
+    break;
+
+  case 37: /* eqproto: TCP  */
+#line 751 "cfg.y"
+                { (yyval.intval)=PROTO_TCP; }
+#line 4995 "cfg.tab.c"
+    break;
+
+  case 38: /* eqproto: TLS  */
+#line 752 "cfg.y"
+                { (yyval.intval)=PROTO_TLS; }
+#line 5001 "cfg.tab.c"
+    break;
+
+  case 39: /* eqproto: SCTP  */
+#line 753 "cfg.y"
+                { (yyval.intval)=PROTO_SCTP; }
+#line 5007 "cfg.tab.c"
+    break;
+
+  case 40: /* eqproto: WS  */
+#line 754 "cfg.y"
+                { (yyval.intval)=PROTO_WS; }
+#line 5013 "cfg.tab.c"
+    break;
+
+  case 41: /* eqproto: WSS  */
+#line 755 "cfg.y"
+                { (yyval.intval)=PROTO_WSS; }
+#line 5019 "cfg.tab.c"
+    break;
+
+  case 42: /* eqproto: STAR  */
+#line 756 "cfg.y"
+                { (yyval.intval)=0; }
+#line 5025 "cfg.tab.c"
+    break;
+
+  case 43: /* port: NUMBER  */
+#line 759 "cfg.y"
+                { (yyval.intval)=(yyvsp[0].intval); }
+#line 5031 "cfg.tab.c"
+    break;
+
+  case 44: /* port: STAR  */
+#line 760 "cfg.y"
+                { (yyval.intval)=0; }
+#line 5037 "cfg.tab.c"
+    break;
+
+  case 45: /* phostport: listen_id  */
+#line 763 "cfg.y"
+                                { (yyval.sockid)=mk_listen_id((yyvsp[0].strval), 0, 0); }
+#line 5043 "cfg.tab.c"
+    break;
+
+  case 46: /* phostport: listen_id COLON port  */
+#line 764 "cfg.y"
+                                { (yyval.sockid)=mk_listen_id((yyvsp[-2].strval), 0, (yyvsp[0].intval)); }
+#line 5049 "cfg.tab.c"
+    break;
+
+  case 47: /* phostport: proto COLON listen_id  */
+#line 765 "cfg.y"
+                                { (yyval.sockid)=mk_listen_id((yyvsp[0].strval), (yyvsp[-2].intval), 0); }
+#line 5055 "cfg.tab.c"
+    break;
+
+  case 48: /* phostport: proto COLON listen_id COLON port  */
+#line 766 "cfg.y"
+                                                { (yyval.sockid)=mk_listen_id((yyvsp[-2].strval), (yyvsp[-4].intval), (yyvsp[0].intval));}
+#line 5061 "cfg.tab.c"
+    break;
+
+  case 49: /* phostport: listen_id COLON error  */
+#line 767 "cfg.y"
+                                { (yyval.sockid)=0; yyerror(" port number expected"); }
+#line 5067 "cfg.tab.c"
+    break;
+
+  case 50: /* listen_phostport: listen_id2  */
+#line 771 "cfg.y"
+                                { (yyval.sockid)=mk_listen_id2((yyvsp[0].name_l), 0, 0); }
+#line 5073 "cfg.tab.c"
+    break;
+
+  case 51: /* listen_phostport: listen_id2 COLON port  */
+#line 772 "cfg.y"
+                                { (yyval.sockid)=mk_listen_id2((yyvsp[-2].name_l), 0, (yyvsp[0].intval)); }
+#line 5079 "cfg.tab.c"
+    break;
+
+  case 52: /* listen_phostport: proto COLON listen_id2  */
+#line 773 "cfg.y"
+                                        { (yyval.sockid)=mk_listen_id2((yyvsp[0].name_l), (yyvsp[-2].intval), 0); }
+#line 5085 "cfg.tab.c"
+    break;
+
+  case 53: /* listen_phostport: proto COLON listen_id2 COLON port  */
+#line 774 "cfg.y"
+                                                { (yyval.sockid)=mk_listen_id2((yyvsp[-2].name_l), (yyvsp[-4].intval), (yyvsp[0].intval));}
+#line 5091 "cfg.tab.c"
+    break;
+
+  case 54: /* listen_phostport: listen_id2 COLON error  */
+#line 775 "cfg.y"
+                                 { (yyval.sockid)=0; yyerror(" port number expected"); }
+#line 5097 "cfg.tab.c"
+    break;
+
+  case 55: /* id_lst: listen_phostport  */
+#line 779 "cfg.y"
+                                        {  (yyval.sockid)=(yyvsp[0].sockid) ; }
+#line 5103 "cfg.tab.c"
+    break;
+
+  case 56: /* id_lst: listen_phostport id_lst  */
+#line 780 "cfg.y"
+                                        { (yyval.sockid)=(yyvsp[-1].sockid);  if ((yyval.sockid)) (yyval.sockid)->next=(yyvsp[0].sockid); }
+#line 5109 "cfg.tab.c"
+    break;
+
+  case 58: /* intno: MINUS NUMBER  */
+#line 784 "cfg.y"
+                                    { (yyval.intval)=-(yyvsp[0].intval); }
+#line 5115 "cfg.tab.c"
+    break;
+
+  case 60: /* flags_decl: FLAGS_DECL error  */
+#line 788 "cfg.y"
+                                                 { yyerror("flag list expected\n"); }
+#line 5121 "cfg.tab.c"
+    break;
+
+  case 63: /* flag_spec: flag_name  */
+#line 794 "cfg.y"
+                                        { if (register_flag((yyvsp[0].strval),-1)<0)
+								yyerror("register flag failed");
+						}
+#line 5129 "cfg.tab.c"
+    break;
+
+  case 64: /* flag_spec: flag_name COLON NUMBER  */
+#line 797 "cfg.y"
+                                                       {
+						if (register_flag((yyvsp[-2].strval), (yyvsp[0].intval))<0)
+								yyerror("register flag failed");
+										}
+#line 5138 "cfg.tab.c"
+    break;
+
+  case 65: /* flag_name: STRING  */
+#line 803 "cfg.y"
+                                { (yyval.strval)=(yyvsp[0].strval); }
+#line 5144 "cfg.tab.c"
+    break;
+
+  case 66: /* flag_name: ID  */
+#line 804 "cfg.y"
+                                                { (yyval.strval)=(yyvsp[0].strval); }
+#line 5150 "cfg.tab.c"
+    break;
+
+  case 68: /* avpflags_decl: AVPFLAGS_DECL error  */
+#line 809 "cfg.y"
+                              { yyerror("avpflag list expected\n"); }
+#line 5156 "cfg.tab.c"
+    break;
+
+  case 71: /* avpflag_spec: flag_name  */
+#line 816 "cfg.y"
+                  {
+		if (register_avpflag((yyvsp[0].strval))==0)
+			yyerror("cannot declare avpflag");
+	}
+#line 5165 "cfg.tab.c"
+    break;
+
+  case 72: /* assign_stm: DEBUG_V EQUAL intno  */
+#line 822 "cfg.y"
+                            { default_core_cfg.debug=(yyvsp[0].intval); }
+#line 5171 "cfg.tab.c"
+    break;
+
+  case 73: /* assign_stm: DEBUG_V EQUAL error  */
+#line 823 "cfg.y"
+                               { yyerror("number  expected"); }
+#line 5177 "cfg.tab.c"
+    break;
+
+  case 74: /* assign_stm: FORK EQUAL NUMBER  */
+#line 824 "cfg.y"
+                             { dont_fork= ! (yyvsp[0].intval); }
+#line 5183 "cfg.tab.c"
+    break;
+
+  case 75: /* assign_stm: FORK EQUAL error  */
+#line 825 "cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 5189 "cfg.tab.c"
+    break;
+
+  case 76: /* assign_stm: FORK_DELAY EQUAL NUMBER  */
+#line 826 "cfg.y"
+                                   { set_fork_delay((yyvsp[0].intval)); }
+#line 5195 "cfg.tab.c"
+    break;
+
+  case 77: /* assign_stm: FORK_DELAY EQUAL error  */
+#line 827 "cfg.y"
+                                   { yyerror("number expected"); }
+#line 5201 "cfg.tab.c"
+    break;
+
+  case 78: /* assign_stm: MODINIT_DELAY EQUAL NUMBER  */
+#line 828 "cfg.y"
+                                      { set_modinit_delay((yyvsp[0].intval)); }
+#line 5207 "cfg.tab.c"
+    break;
+
+  case 79: /* assign_stm: MODINIT_DELAY EQUAL error  */
+#line 829 "cfg.y"
+                                      { yyerror("number expected"); }
+#line 5213 "cfg.tab.c"
+    break;
+
+  case 80: /* assign_stm: LOGSTDERROR EQUAL NUMBER  */
+#line 830 "cfg.y"
+                                   { if (!config_check)  /* if set from cmd line, don't overwrite from yyparse()*/ 
+					if(log_stderr == 0) log_stderr=(yyvsp[0].intval); 
+				   }
+#line 5221 "cfg.tab.c"
+    break;
+
+  case 81: /* assign_stm: LOGSTDERROR EQUAL error  */
+#line 833 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5227 "cfg.tab.c"
+    break;
+
+  case 82: /* assign_stm: LOGFACILITY EQUAL ID  */
+#line 834 "cfg.y"
+                               {
+		if ( (i_tmp=str2facility((yyvsp[0].strval)))==-1)
+			yyerror("bad facility (see syslog(3) man page)");
+		if (!config_check)
+			default_core_cfg.log_facility=i_tmp;
+	}
+#line 5238 "cfg.tab.c"
+    break;
+
+  case 83: /* assign_stm: LOGFACILITY EQUAL error  */
+#line 840 "cfg.y"
+                                  { yyerror("ID expected"); }
+#line 5244 "cfg.tab.c"
+    break;
+
+  case 84: /* assign_stm: LOGNAME EQUAL STRING  */
+#line 841 "cfg.y"
+                               { log_name=(yyvsp[0].strval); }
+#line 5250 "cfg.tab.c"
+    break;
+
+  case 85: /* assign_stm: LOGNAME EQUAL error  */
+#line 842 "cfg.y"
+                              { yyerror("string value expected"); }
+#line 5256 "cfg.tab.c"
+    break;
+
+  case 86: /* assign_stm: LOGCOLOR EQUAL NUMBER  */
+#line 843 "cfg.y"
+                                { log_color=(yyvsp[0].intval); }
+#line 5262 "cfg.tab.c"
+    break;
+
+  case 87: /* assign_stm: LOGCOLOR EQUAL error  */
+#line 844 "cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5268 "cfg.tab.c"
+    break;
+
+  case 88: /* assign_stm: DNS EQUAL NUMBER  */
+#line 845 "cfg.y"
+                             { received_dns|= ((yyvsp[0].intval))?DO_DNS:0; }
+#line 5274 "cfg.tab.c"
+    break;
+
+  case 89: /* assign_stm: DNS EQUAL error  */
+#line 846 "cfg.y"
+                          { yyerror("boolean value expected"); }
+#line 5280 "cfg.tab.c"
+    break;
+
+  case 90: /* assign_stm: REV_DNS EQUAL NUMBER  */
+#line 847 "cfg.y"
+                               { received_dns|= ((yyvsp[0].intval))?DO_REV_DNS:0; }
+#line 5286 "cfg.tab.c"
+    break;
+
+  case 91: /* assign_stm: REV_DNS EQUAL error  */
+#line 848 "cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5292 "cfg.tab.c"
+    break;
+
+  case 92: /* assign_stm: DNS_TRY_IPV6 EQUAL NUMBER  */
+#line 849 "cfg.y"
+                                      { default_core_cfg.dns_try_ipv6=(yyvsp[0].intval); }
+#line 5298 "cfg.tab.c"
+    break;
+
+  case 93: /* assign_stm: DNS_TRY_IPV6 error  */
+#line 850 "cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 5304 "cfg.tab.c"
+    break;
+
+  case 94: /* assign_stm: DNS_TRY_NAPTR EQUAL NUMBER  */
+#line 851 "cfg.y"
+                                       { IF_NAPTR(default_core_cfg.dns_try_naptr=(yyvsp[0].intval)); }
+#line 5310 "cfg.tab.c"
+    break;
+
+  case 95: /* assign_stm: DNS_TRY_NAPTR error  */
+#line 852 "cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5316 "cfg.tab.c"
+    break;
+
+  case 96: /* assign_stm: DNS_SRV_LB EQUAL NUMBER  */
+#line 853 "cfg.y"
+                                    { IF_DNS_FAILOVER(default_core_cfg.dns_srv_lb=(yyvsp[0].intval)); }
+#line 5322 "cfg.tab.c"
+    break;
+
+  case 97: /* assign_stm: DNS_SRV_LB error  */
+#line 854 "cfg.y"
+                           { yyerror("boolean value expected"); }
+#line 5328 "cfg.tab.c"
+    break;
+
+  case 98: /* assign_stm: DNS_UDP_PREF EQUAL intno  */
+#line 855 "cfg.y"
+                                   { IF_NAPTR(default_core_cfg.dns_udp_pref=(yyvsp[0].intval));}
+#line 5334 "cfg.tab.c"
+    break;
+
+  case 99: /* assign_stm: DNS_UDP_PREF error  */
+#line 856 "cfg.y"
+                             { yyerror("number expected"); }
+#line 5340 "cfg.tab.c"
+    break;
+
+  case 100: /* assign_stm: DNS_TCP_PREF EQUAL intno  */
+#line 857 "cfg.y"
+                                   { IF_NAPTR(default_core_cfg.dns_tcp_pref=(yyvsp[0].intval));}
+#line 5346 "cfg.tab.c"
+    break;
+
+  case 101: /* assign_stm: DNS_TCP_PREF error  */
+#line 858 "cfg.y"
+                             { yyerror("number expected"); }
+#line 5352 "cfg.tab.c"
+    break;
+
+  case 102: /* assign_stm: DNS_TLS_PREF EQUAL intno  */
+#line 859 "cfg.y"
+                                   { IF_NAPTR(default_core_cfg.dns_tls_pref=(yyvsp[0].intval));}
+#line 5358 "cfg.tab.c"
+    break;
+
+  case 103: /* assign_stm: DNS_TLS_PREF error  */
+#line 860 "cfg.y"
+                             { yyerror("number expected"); }
+#line 5364 "cfg.tab.c"
+    break;
+
+  case 104: /* assign_stm: DNS_SCTP_PREF EQUAL intno  */
+#line 861 "cfg.y"
+                                    { 
+								IF_NAPTR(default_core_cfg.dns_sctp_pref=(yyvsp[0].intval)); }
+#line 5371 "cfg.tab.c"
+    break;
+
+  case 105: /* assign_stm: DNS_SCTP_PREF error  */
+#line 863 "cfg.y"
+                              { yyerror("number expected"); }
+#line 5377 "cfg.tab.c"
+    break;
+
+  case 106: /* assign_stm: DNS_RETR_TIME EQUAL NUMBER  */
+#line 864 "cfg.y"
+                                       { default_core_cfg.dns_retr_time=(yyvsp[0].intval); }
+#line 5383 "cfg.tab.c"
+    break;
+
+  case 107: /* assign_stm: DNS_RETR_TIME error  */
+#line 865 "cfg.y"
+                              { yyerror("number expected"); }
+#line 5389 "cfg.tab.c"
+    break;
+
+  case 108: /* assign_stm: DNS_RETR_NO EQUAL NUMBER  */
+#line 866 "cfg.y"
+                                     { default_core_cfg.dns_retr_no=(yyvsp[0].intval); }
+#line 5395 "cfg.tab.c"
+    break;
+
+  case 109: /* assign_stm: DNS_RETR_NO error  */
+#line 867 "cfg.y"
+                            { yyerror("number expected"); }
+#line 5401 "cfg.tab.c"
+    break;
+
+  case 110: /* assign_stm: DNS_SERVERS_NO EQUAL NUMBER  */
+#line 868 "cfg.y"
+                                        { default_core_cfg.dns_servers_no=(yyvsp[0].intval); }
+#line 5407 "cfg.tab.c"
+    break;
+
+  case 111: /* assign_stm: DNS_SERVERS_NO error  */
+#line 869 "cfg.y"
+                               { yyerror("number expected"); }
+#line 5413 "cfg.tab.c"
+    break;
+
+  case 112: /* assign_stm: DNS_USE_SEARCH EQUAL NUMBER  */
+#line 870 "cfg.y"
+                                        { default_core_cfg.dns_search_list=(yyvsp[0].intval); }
+#line 5419 "cfg.tab.c"
+    break;
+
+  case 113: /* assign_stm: DNS_USE_SEARCH error  */
+#line 871 "cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5425 "cfg.tab.c"
+    break;
+
+  case 114: /* assign_stm: DNS_SEARCH_FMATCH EQUAL NUMBER  */
+#line 872 "cfg.y"
+                                           { default_core_cfg.dns_search_fmatch=(yyvsp[0].intval); }
+#line 5431 "cfg.tab.c"
+    break;
+
+  case 115: /* assign_stm: DNS_SEARCH_FMATCH error  */
+#line 873 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5437 "cfg.tab.c"
+    break;
+
+  case 116: /* assign_stm: DNS_NAPTR_IGNORE_RFC EQUAL NUMBER  */
+#line 874 "cfg.y"
+                                              { default_core_cfg.dns_naptr_ignore_rfc=(yyvsp[0].intval); }
+#line 5443 "cfg.tab.c"
+    break;
+
+  case 117: /* assign_stm: DNS_NAPTR_IGNORE_RFC error  */
+#line 875 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 5449 "cfg.tab.c"
+    break;
+
+  case 118: /* assign_stm: DNS_CACHE_INIT EQUAL NUMBER  */
+#line 876 "cfg.y"
+                                        { IF_DNS_CACHE(dns_cache_init=(yyvsp[0].intval)); }
+#line 5455 "cfg.tab.c"
+    break;
+
+  case 119: /* assign_stm: DNS_CACHE_INIT error  */
+#line 877 "cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5461 "cfg.tab.c"
+    break;
+
+  case 120: /* assign_stm: DNS_USE_CACHE EQUAL NUMBER  */
+#line 878 "cfg.y"
+                                       { IF_DNS_CACHE(default_core_cfg.use_dns_cache=(yyvsp[0].intval)); }
+#line 5467 "cfg.tab.c"
+    break;
+
+  case 121: /* assign_stm: DNS_USE_CACHE error  */
+#line 879 "cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5473 "cfg.tab.c"
+    break;
+
+  case 122: /* assign_stm: DNS_USE_FAILOVER EQUAL NUMBER  */
+#line 880 "cfg.y"
+                                          { IF_DNS_FAILOVER(default_core_cfg.use_dns_failover=(yyvsp[0].intval));}
+#line 5479 "cfg.tab.c"
+    break;
+
+  case 123: /* assign_stm: DNS_USE_FAILOVER error  */
+#line 881 "cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 5485 "cfg.tab.c"
+    break;
+
+  case 124: /* assign_stm: DNS_CACHE_FLAGS EQUAL NUMBER  */
+#line 882 "cfg.y"
+                                         { IF_DNS_CACHE(default_core_cfg.dns_cache_flags=(yyvsp[0].intval)); }
+#line 5491 "cfg.tab.c"
+    break;
+
+  case 125: /* assign_stm: DNS_CACHE_FLAGS error  */
+#line 883 "cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 5497 "cfg.tab.c"
+    break;
+
+  case 126: /* assign_stm: DNS_CACHE_NEG_TTL EQUAL NUMBER  */
+#line 884 "cfg.y"
+                                           { IF_DNS_CACHE(default_core_cfg.dns_neg_cache_ttl=(yyvsp[0].intval)); }
+#line 5503 "cfg.tab.c"
+    break;
+
+  case 127: /* assign_stm: DNS_CACHE_NEG_TTL error  */
+#line 885 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5509 "cfg.tab.c"
+    break;
+
+  case 128: /* assign_stm: DNS_CACHE_MAX_TTL EQUAL NUMBER  */
+#line 886 "cfg.y"
+                                           { IF_DNS_CACHE(default_core_cfg.dns_cache_max_ttl=(yyvsp[0].intval)); }
+#line 5515 "cfg.tab.c"
+    break;
+
+  case 129: /* assign_stm: DNS_CACHE_MAX_TTL error  */
+#line 887 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5521 "cfg.tab.c"
+    break;
+
+  case 130: /* assign_stm: DNS_CACHE_MIN_TTL EQUAL NUMBER  */
+#line 888 "cfg.y"
+                                           { IF_DNS_CACHE(default_core_cfg.dns_cache_min_ttl=(yyvsp[0].intval)); }
+#line 5527 "cfg.tab.c"
+    break;
+
+  case 131: /* assign_stm: DNS_CACHE_MIN_TTL error  */
+#line 889 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5533 "cfg.tab.c"
+    break;
+
+  case 132: /* assign_stm: DNS_CACHE_MEM EQUAL NUMBER  */
+#line 890 "cfg.y"
+                                       { IF_DNS_CACHE(default_core_cfg.dns_cache_max_mem=(yyvsp[0].intval)); }
+#line 5539 "cfg.tab.c"
+    break;
+
+  case 133: /* assign_stm: DNS_CACHE_MEM error  */
+#line 891 "cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5545 "cfg.tab.c"
+    break;
+
+  case 134: /* assign_stm: DNS_CACHE_GC_INT EQUAL NUMBER  */
+#line 892 "cfg.y"
+                                          { IF_DNS_CACHE(dns_timer_interval=(yyvsp[0].intval)); }
+#line 5551 "cfg.tab.c"
+    break;
+
+  case 135: /* assign_stm: DNS_CACHE_GC_INT error  */
+#line 893 "cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 5557 "cfg.tab.c"
+    break;
+
+  case 136: /* assign_stm: DNS_CACHE_DEL_NONEXP EQUAL NUMBER  */
+#line 894 "cfg.y"
+                                              { IF_DNS_CACHE(default_core_cfg.dns_cache_del_nonexp=(yyvsp[0].intval)); }
+#line 5563 "cfg.tab.c"
+    break;
+
+  case 137: /* assign_stm: DNS_CACHE_DEL_NONEXP error  */
+#line 895 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 5569 "cfg.tab.c"
+    break;
+
+  case 138: /* assign_stm: AUTO_BIND_IPV6 EQUAL NUMBER  */
+#line 896 "cfg.y"
+                                      {IF_AUTO_BIND_IPV6(auto_bind_ipv6 = (yyvsp[0].intval));}
+#line 5575 "cfg.tab.c"
+    break;
+
+  case 139: /* assign_stm: AUTO_BIND_IPV6 error  */
+#line 897 "cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5581 "cfg.tab.c"
+    break;
+
+  case 140: /* assign_stm: DST_BLST_INIT EQUAL NUMBER  */
+#line 898 "cfg.y"
+                                       { IF_DST_BLACKLIST(dst_blacklist_init=(yyvsp[0].intval)); }
+#line 5587 "cfg.tab.c"
+    break;
+
+  case 141: /* assign_stm: DST_BLST_INIT error  */
+#line 899 "cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5593 "cfg.tab.c"
+    break;
+
+  case 142: /* assign_stm: USE_DST_BLST EQUAL NUMBER  */
+#line 900 "cfg.y"
+                                    {
+		IF_DST_BLACKLIST(default_core_cfg.use_dst_blacklist=(yyvsp[0].intval));
+	}
+#line 5601 "cfg.tab.c"
+    break;
+
+  case 143: /* assign_stm: USE_DST_BLST error  */
+#line 903 "cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 5607 "cfg.tab.c"
+    break;
+
+  case 144: /* assign_stm: DST_BLST_MEM EQUAL NUMBER  */
+#line 904 "cfg.y"
+                                    {
+		IF_DST_BLACKLIST(default_core_cfg.blst_max_mem=(yyvsp[0].intval)); 
+	}
+#line 5615 "cfg.tab.c"
+    break;
+
+  case 145: /* assign_stm: DST_BLST_MEM error  */
+#line 907 "cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 5621 "cfg.tab.c"
+    break;
+
+  case 146: /* assign_stm: DST_BLST_TTL EQUAL NUMBER  */
+#line 908 "cfg.y"
+                                    {
+		IF_DST_BLACKLIST(default_core_cfg.blst_timeout=(yyvsp[0].intval));
+	}
+#line 5629 "cfg.tab.c"
+    break;
+
+  case 147: /* assign_stm: DST_BLST_TTL error  */
+#line 911 "cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 5635 "cfg.tab.c"
+    break;
+
+  case 148: /* assign_stm: DST_BLST_GC_INT EQUAL NUMBER  */
+#line 912 "cfg.y"
+                                       { IF_DST_BLACKLIST(blst_timer_interval=(yyvsp[0].intval));}
+#line 5641 "cfg.tab.c"
+    break;
+
+  case 149: /* assign_stm: DST_BLST_GC_INT error  */
+#line 913 "cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 5647 "cfg.tab.c"
+    break;
+
+  case 150: /* assign_stm: DST_BLST_UDP_IMASK EQUAL NUMBER  */
+#line 914 "cfg.y"
+                                          {
+		IF_DST_BLACKLIST(default_core_cfg.blst_udp_imask=(yyvsp[0].intval));
+	}
+#line 5655 "cfg.tab.c"
+    break;
+
+  case 151: /* assign_stm: DST_BLST_UDP_IMASK error  */
+#line 917 "cfg.y"
+                                   { yyerror("number(flags) expected"); }
+#line 5661 "cfg.tab.c"
+    break;
+
+  case 152: /* assign_stm: DST_BLST_TCP_IMASK EQUAL NUMBER  */
+#line 918 "cfg.y"
+                                          {
+		IF_DST_BLACKLIST(default_core_cfg.blst_tcp_imask=(yyvsp[0].intval));
+	}
+#line 5669 "cfg.tab.c"
+    break;
+
+  case 153: /* assign_stm: DST_BLST_TCP_IMASK error  */
+#line 921 "cfg.y"
+                                   { yyerror("number(flags) expected"); }
+#line 5675 "cfg.tab.c"
+    break;
+
+  case 154: /* assign_stm: DST_BLST_TLS_IMASK EQUAL NUMBER  */
+#line 922 "cfg.y"
+                                          {
+		IF_DST_BLACKLIST(default_core_cfg.blst_tls_imask=(yyvsp[0].intval));
+	}
+#line 5683 "cfg.tab.c"
+    break;
+
+  case 155: /* assign_stm: DST_BLST_TLS_IMASK error  */
+#line 925 "cfg.y"
+                                   { yyerror("number(flags) expected"); }
+#line 5689 "cfg.tab.c"
+    break;
+
+  case 156: /* assign_stm: DST_BLST_SCTP_IMASK EQUAL NUMBER  */
+#line 926 "cfg.y"
+                                           {
+		IF_DST_BLACKLIST(default_core_cfg.blst_sctp_imask=(yyvsp[0].intval));
+	}
+#line 5697 "cfg.tab.c"
+    break;
+
+  case 157: /* assign_stm: DST_BLST_SCTP_IMASK error  */
+#line 929 "cfg.y"
+                                    { yyerror("number(flags) expected"); }
+#line 5703 "cfg.tab.c"
+    break;
+
+  case 158: /* assign_stm: PORT EQUAL NUMBER  */
+#line 930 "cfg.y"
+                              { port_no=(yyvsp[0].intval); }
+#line 5709 "cfg.tab.c"
+    break;
+
+  case 159: /* assign_stm: STAT EQUAL STRING  */
+#line 931 "cfg.y"
+                            {
+		#ifdef STATS
+				stat_file=(yyvsp[0].strval);
+		#endif
+	}
+#line 5719 "cfg.tab.c"
+    break;
+
+  case 160: /* assign_stm: MAXBUFFER EQUAL NUMBER  */
+#line 936 "cfg.y"
+                                 { maxbuffer=(yyvsp[0].intval); }
+#line 5725 "cfg.tab.c"
+    break;
+
+  case 161: /* assign_stm: MAXBUFFER EQUAL error  */
+#line 937 "cfg.y"
+                                { yyerror("number expected"); }
+#line 5731 "cfg.tab.c"
+    break;
+
+  case 162: /* assign_stm: SQL_BUFFER_SIZE EQUAL NUMBER  */
+#line 938 "cfg.y"
+                                   { sql_buffer_size=(yyvsp[0].intval); }
+#line 5737 "cfg.tab.c"
+    break;
+
+  case 163: /* assign_stm: SQL_BUFFER_SIZE EQUAL error  */
+#line 939 "cfg.y"
+                                      { yyerror("number expected"); }
+#line 5743 "cfg.tab.c"
+    break;
+
+  case 164: /* assign_stm: PORT EQUAL error  */
+#line 940 "cfg.y"
+                              { yyerror("number expected"); }
+#line 5749 "cfg.tab.c"
+    break;
+
+  case 165: /* assign_stm: CHILDREN EQUAL NUMBER  */
+#line 941 "cfg.y"
+                                { children_no=(yyvsp[0].intval); }
+#line 5755 "cfg.tab.c"
+    break;
+
+  case 166: /* assign_stm: CHILDREN EQUAL error  */
+#line 942 "cfg.y"
+                               { yyerror("number expected"); }
+#line 5761 "cfg.tab.c"
+    break;
+
+  case 167: /* assign_stm: SOCKET_WORKERS EQUAL NUMBER  */
+#line 943 "cfg.y"
+                                      { socket_workers=(yyvsp[0].intval); }
+#line 5767 "cfg.tab.c"
+    break;
+
+  case 168: /* assign_stm: SOCKET_WORKERS EQUAL error  */
+#line 944 "cfg.y"
+                                     { yyerror("number expected"); }
+#line 5773 "cfg.tab.c"
+    break;
+
+  case 169: /* assign_stm: FOLD_CONST_COND EQUAL NUMBER  */
+#line 945 "cfg.y"
+                                       { fold_const_cond=(yyvsp[0].intval); }
+#line 5779 "cfg.tab.c"
+    break;
+
+  case 170: /* assign_stm: FOLD_CONST_COND EQUAL error  */
+#line 946 "cfg.y"
+                                      { yyerror("boolean value expected"); }
+#line 5785 "cfg.tab.c"
+    break;
+
+  case 171: /* assign_stm: UDP_RCV_BATCH EQUAL NUMBER  */
+#line 947 "cfg.y"
+                                     { udp_rcv_batch=(yyvsp[0].intval); }
+#line 5791 "cfg.tab.c"
+    break;
+
+  case 172: /* assign_stm: UDP_RCV_BATCH EQUAL error  */
+#line 948 "cfg.y"
+                                    { yyerror("number expected"); }
+#line 5797 "cfg.tab.c"
+    break;
+
+  case 173: /* assign_stm: UDP_SND_BATCH EQUAL NUMBER  */
+#line 949 "cfg.y"
+                                     { udp_snd_batch=(yyvsp[0].intval); }
+#line 5803 "cfg.tab.c"
+    break;
+
+  case 174: /* assign_stm: UDP_SND_BATCH EQUAL error  */
+#line 950 "cfg.y"
+                                    { yyerror("number expected"); }
+#line 5809 "cfg.tab.c"
+    break;
+
+  case 175: /* assign_stm: UDP_REUSE_PORT EQUAL NUMBER  */
+#line 951 "cfg.y"
+                                      { udp_reuse_port=(yyvsp[0].intval); }
+#line 5815 "cfg.tab.c"
+    break;
+
+  case 176: /* assign_stm: UDP_REUSE_PORT EQUAL error  */
+#line 952 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 5821 "cfg.tab.c"
+    break;
+
+  case 177: /* assign_stm: SOCKET_CPU_AFFINITY EQUAL NUMBER  */
+#line 953 "cfg.y"
+                                           { socket_cpu_affinity=(yyvsp[0].intval); }
+#line 5827 "cfg.tab.c"
+    break;
+
+  case 178: /* assign_stm: SOCKET_CPU_AFFINITY EQUAL error  */
+#line 954 "cfg.y"
+                                          { yyerror("number expected"); }
+#line 5833 "cfg.tab.c"
+    break;
+
+  case 179: /* assign_stm: CHECK_VIA EQUAL NUMBER  */
+#line 955 "cfg.y"
+                                 { check_via=(yyvsp[0].intval); }
+#line 5839 "cfg.tab.c"
+    break;
+
+  case 180: /* assign_stm: CHECK_VIA EQUAL error  */
+#line 956 "cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 5845 "cfg.tab.c"
+    break;
+
+  case 181: /* assign_stm: PHONE2TEL EQUAL NUMBER  */
+#line 957 "cfg.y"
+                                 { phone2tel=(yyvsp[0].intval); }
+#line 5851 "cfg.tab.c"
+    break;
+
+  case 182: /* assign_stm: PHONE2TEL EQUAL error  */
+#line 958 "cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 5857 "cfg.tab.c"
+    break;
+
+  case 183: /* assign_stm: MEMLOG EQUAL intno  */
+#line 959 "cfg.y"
+                             { default_core_cfg.memlog=(yyvsp[0].intval); }
+#line 5863 "cfg.tab.c"
+    break;
+
+  case 184: /* assign_stm: MEMLOG EQUAL error  */
+#line 960 "cfg.y"
+                             { yyerror("int value expected"); }
+#line 5869 "cfg.tab.c"
+    break;
+
+  case 185: /* assign_stm: MEMDBG EQUAL intno  */
+#line 961 "cfg.y"
+                             { default_core_cfg.memdbg=(yyvsp[0].intval); }
+#line 5875 "cfg.tab.c"
+    break;
+
+  case 186: /* assign_stm: MEMDBG EQUAL error  */
+#line 962 "cfg.y"
+                             { yyerror("int value expected"); }
+#line 5881 "cfg.tab.c"
+    break;
+
+  case 187: /* assign_stm: MEMSUM EQUAL intno  */
+#line 963 "cfg.y"
+                             { default_core_cfg.mem_summary=(yyvsp[0].intval); }
+#line 5887 "cfg.tab.c"
+    break;
+
+  case 188: /* assign_stm: MEMSUM EQUAL error  */
+#line 964 "cfg.y"
+                             { yyerror("int value expected"); }
+#line 5893 "cfg.tab.c"
+    break;
+
+  case 189: /* assign_stm: MEMSAFETY EQUAL intno  */
+#line 965 "cfg.y"
+                                { default_core_cfg.mem_safety=(yyvsp[0].intval); }
+#line 5899 "cfg.tab.c"
+    break;
+
+  case 190: /* assign_stm: MEMSAFETY EQUAL error  */
+#line 966 "cfg.y"
+                                { yyerror("int value expected"); }
+#line 5905 "cfg.tab.c"
+    break;
+
+  case 191: /* assign_stm: MEMJOIN EQUAL intno  */
+#line 967 "cfg.y"
+                              { default_core_cfg.mem_join=(yyvsp[0].intval); }
+#line 5911 "cfg.tab.c"
+    break;
+
+  case 192: /* assign_stm: MEMJOIN EQUAL error  */
+#line 968 "cfg.y"
+                              { yyerror("int value expected"); }
+#line 5917 "cfg.tab.c"
+    break;
+
+  case 193: /* assign_stm: CORELOG EQUAL intno  */
+#line 969 "cfg.y"
+                              { default_core_cfg.corelog=(yyvsp[0].intval); }
+#line 5923 "cfg.tab.c"
+    break;
+
+  case 194: /* assign_stm: CORELOG EQUAL error  */
+#line 970 "cfg.y"
+                              { yyerror("int value expected"); }
+#line 5929 "cfg.tab.c"
+    break;
+
+  case 195: /* assign_stm: SIP_WARNING EQUAL NUMBER  */
+#line 971 "cfg.y"
+                                   { sip_warning=(yyvsp[0].intval); }
+#line 5935 "cfg.tab.c"
+    break;
+
+  case 196: /* assign_stm: SIP_WARNING EQUAL error  */
+#line 972 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5941 "cfg.tab.c"
+    break;
+
+  case 197: /* assign_stm: VERSION_TABLE_CFG EQUAL STRING  */
+#line 973 "cfg.y"
+                                         { version_table.s=(yyvsp[0].strval);
+			version_table.len=strlen(version_table.s);
+	}
+#line 5949 "cfg.tab.c"
+    break;
+
+  case 198: /* assign_stm: VERSION_TABLE_CFG EQUAL error  */
+#line 976 "cfg.y"
+                                        { yyerror("string value expected"); }
+#line 5955 "cfg.tab.c"
+    break;
+
+  case 199: /* assign_stm: USER EQUAL STRING  */
+#line 977 "cfg.y"
+                                {
+		if (shm_initialized())
+			yyerror("user must be before any modparam or the"
+					" route blocks");
+		else if (user==0)
+			user=(yyvsp[0].strval); 
+	}
+#line 5967 "cfg.tab.c"
+    break;
+
+  case 200: /* assign_stm: USER EQUAL ID  */
+#line 984 "cfg.y"
+                                {
+		if (shm_initialized())
+			yyerror("user must be before any modparam or the"
+					" route blocks");
+		else if (user==0)
+			user=(yyvsp[0].strval);
+	}
+#line 5979 "cfg.tab.c"
+    break;
+
+  case 201: /* assign_stm: USER EQUAL error  */
+#line 991 "cfg.y"
+                                { yyerror("string value expected"); }
+#line 5985 "cfg.tab.c"
+    break;
+
+  case 202: /* assign_stm: GROUP EQUAL STRING  */
+#line 992 "cfg.y"
+                                 { group=(yyvsp[0].strval); }
+#line 5991 "cfg.tab.c"
+    break;
+
+  case 203: /* assign_stm: GROUP EQUAL ID  */
+#line 993 "cfg.y"
+                                 { group=(yyvsp[0].strval); }
+#line 5997 "cfg.tab.c"
+    break;
+
+  case 204: /* assign_stm: GROUP EQUAL error  */
+#line 994 "cfg.y"
+                                 { yyerror("string value expected"); }
+#line 6003 "cfg.tab.c"
+    break;
+
+  case 205: /* assign_stm: CHROOT EQUAL STRING  */
+#line 995 "cfg.y"
+                                  { chroot_dir=(yyvsp[0].strval); }
+#line 6009 "cfg.tab.c"
+    break;
+
+  case 206: /* assign_stm: CHROOT EQUAL ID  */
+#line 996 "cfg.y"
+                                  { chroot_dir=(yyvsp[0].strval); }
+#line 6015 "cfg.tab.c"
+    break;
+
+  case 207: /* assign_stm: CHROOT EQUAL error  */
+#line 997 "cfg.y"
+                                  { yyerror("string value expected"); }
+#line 6021 "cfg.tab.c"
+    break;
+
+  case 208: /* assign_stm: WDIR EQUAL STRING  */
+#line 998 "cfg.y"
+                                { working_dir=(yyvsp[0].strval); }
+#line 6027 "cfg.tab.c"
+    break;
+
+  case 209: /* assign_stm: WDIR EQUAL ID  */
+#line 999 "cfg.y"
+                                { working_dir=(yyvsp[0].strval); }
+#line 6033 "cfg.tab.c"
+    break;
+
+  case 210: /* assign_stm: WDIR EQUAL error  */
+#line 1000 "cfg.y"
+                                { yyerror("string value expected"); }
+#line 6039 "cfg.tab.c"
+    break;
+
+  case 211: /* assign_stm: MHOMED EQUAL NUMBER  */
+#line 1001 "cfg.y"
+                              { mhomed=(yyvsp[0].intval); }
+#line 6045 "cfg.tab.c"
+    break;
+
+  case 212: /* assign_stm: MHOMED EQUAL error  */
+#line 1002 "cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 6051 "cfg.tab.c"
+    break;
+
+  case 213: /* assign_stm: DISABLE_TCP EQUAL NUMBER  */
+#line 1003 "cfg.y"
+                                   {
+		#ifdef USE_TCP
+			tcp_disable=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6063 "cfg.tab.c"
+    break;
+
+  case 214: /* assign_stm: DISABLE_TCP EQUAL error  */
+#line 1010 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 6069 "cfg.tab.c"
+    break;
+
+  case 215: /* assign_stm: TCP_ACCEPT_ALIASES EQUAL NUMBER  */
+#line 1011 "cfg.y"
+                                          {
+		#ifdef USE_TCP
+			tcp_default_cfg.accept_aliases=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6081 "cfg.tab.c"
+    break;
+
+  case 216: /* assign_stm: TCP_ACCEPT_ALIASES EQUAL error  */
+#line 1018 "cfg.y"
+                                         { yyerror("boolean value expected"); }
+#line 6087 "cfg.tab.c"
+    break;
+
+  case 217: /* assign_stm: TCP_CHILDREN EQUAL NUMBER  */
+#line 1019 "cfg.y"
+                                    {
+		#ifdef USE_TCP
+			tcp_cfg_children_no=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6099 "cfg.tab.c"
+    break;
+
+  case 218: /* assign_stm: TCP_CHILDREN EQUAL error  */
+#line 1026 "cfg.y"
+                                   { yyerror("number expected"); }
+#line 6105 "cfg.tab.c"
+    break;
+
+  case 219: /* assign_stm: TCP_CONNECT_TIMEOUT EQUAL intno  */
+#line 1027 "cfg.y"
+                                          {
+		#ifdef USE_TCP
+			tcp_default_cfg.connect_timeout_s=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6117 "cfg.tab.c"
+    break;
+
+  case 220: /* assign_stm: TCP_CONNECT_TIMEOUT EQUAL error  */
+#line 1034 "cfg.y"
+                                          { yyerror("number expected"); }
+#line 6123 "cfg.tab.c"
+    break;
+
+  case 221: /* assign_stm: TCP_SEND_TIMEOUT EQUAL intno  */
+#line 1035 "cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_default_cfg.send_timeout=S_TO_TICKS((yyvsp[0].intval));
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6135 "cfg.tab.c"
+    break;
+
+  case 222: /* assign_stm: TCP_SEND_TIMEOUT EQUAL error  */
+#line 1042 "cfg.y"
+                                       { yyerror("number expected"); }
+#line 6141 "cfg.tab.c"
+    break;
+
+  case 223: /* assign_stm: TCP_CON_LIFETIME EQUAL intno  */
+#line 1043 "cfg.y"
+                                       {
+		#ifdef USE_TCP
+			if ((yyvsp[0].intval)<0)
+				tcp_default_cfg.con_lifetime=-1;
+			else
+				tcp_default_cfg.con_lifetime=S_TO_TICKS((yyvsp[0].intval));
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6156 "cfg.tab.c"
+    break;
+
+  case 224: /* assign_stm: TCP_CON_LIFETIME EQUAL error  */
+#line 1053 "cfg.y"
+                                       { yyerror("number expected"); }
+#line 6162 "cfg.tab.c"
+    break;
+
+  case 225: /* assign_stm: TCP_POLL_METHOD EQUAL ID  */
+#line 1054 "cfg.y"
+                                   {
+		#ifdef USE_TCP
+			tcp_poll_method=get_poll_type((yyvsp[0].strval));
+			if (tcp_poll_method==POLL_NONE) {
+				LOG(L_CRIT, "bad poll method name:"
+						" %s\n, try one of %s.\n",
+						(yyvsp[0].strval), poll_support);
+				yyerror("bad tcp_poll_method "
+						"value");
+			}
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6181 "cfg.tab.c"
+    break;
+
+  case 226: /* assign_stm: TCP_POLL_METHOD EQUAL STRING  */
+#line 1068 "cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_poll_method=get_poll_type((yyvsp[0].strval));
+			if (tcp_poll_method==POLL_NONE) {
+				LOG(L_CRIT, "bad poll method name:"
+						" %s\n, try one of %s.\n",
+						(yyvsp[0].strval), poll_support);
+				yyerror("bad tcp_poll_method "
+						"value");
+			}
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6200 "cfg.tab.c"
+    break;
+
+  case 227: /* assign_stm: TCP_POLL_METHOD EQUAL error  */
+#line 1082 "cfg.y"
+                                      { yyerror("poll method name expected"); }
+#line 6206 "cfg.tab.c"
+    break;
+
+  case 228: /* assign_stm: TCP_MAX_CONNECTIONS EQUAL NUMBER  */
+#line 1083 "cfg.y"
+                                           {
+		#ifdef USE_TCP
+			tcp_max_connections=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6218 "cfg.tab.c"
+    break;
+
+  case 229: /* assign_stm: TCP_MAX_CONNECTIONS EQUAL error  */
+#line 1090 "cfg.y"
+                                          { yyerror("number expected"); }
+#line 6224 "cfg.tab.c"
+    break;
+
+  case 230: /* assign_stm: TLS_MAX_CONNECTIONS EQUAL NUMBER  */
+#line 1091 "cfg.y"
+                                           {
+		#ifdef USE_TLS
+			tls_max_connections=(yyvsp[0].intval);
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 6236 "cfg.tab.c"
+    break;
+
+  case 231: /* assign_stm: TLS_MAX_CONNECTIONS EQUAL error  */
+#line 1098 "cfg.y"
+                                          { yyerror("number expected"); }
+#line 6242 "cfg.tab.c"
+    break;
+
+  case 232: /* assign_stm: TCP_NO_CONNECT EQUAL NUMBER  */
+#line 1099 "cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.no_connect=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6254 "cfg.tab.c"
+    break;
+
+  case 233: /* assign_stm: TCP_NO_CONNECT EQUAL error  */
+#line 1106 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 6260 "cfg.tab.c"
+    break;
+
+  case 234: /* assign_stm: TCP_SOURCE_IPV4 EQUAL ipv4  */
+#line 1107 "cfg.y"
+                                     {
+		#ifdef USE_TCP
+			if (tcp_set_src_addr((yyvsp[0].ipaddr))<0)
+				warn("tcp_source_ipv4 failed");
+		#else
+			warn("tcp support not compiled in");
+		#endif
+		pkg_free((yyvsp[0].ipaddr));
+	}
+#line 6274 "cfg.tab.c"
+    break;
+
+  case 235: /* assign_stm: TCP_SOURCE_IPV4 EQUAL error  */
+#line 1116 "cfg.y"
+                                      { yyerror("IPv4 address expected"); }
+#line 6280 "cfg.tab.c"
+    break;
+
+  case 236: /* assign_stm: TCP_SOURCE_IPV6 EQUAL ipv6  */
+#line 1117 "cfg.y"
+                                     {
+		#ifdef USE_TCP
+				if (tcp_set_src_addr((yyvsp[0].ipaddr))<0)
+					warn("tcp_source_ipv6 failed");
+		#else
+			warn("tcp support not compiled in");
+		#endif
+		pkg_free((yyvsp[0].ipaddr));
+	}
+#line 6294 "cfg.tab.c"
+    break;
+
+  case 237: /* assign_stm: TCP_SOURCE_IPV6 EQUAL error  */
+#line 1126 "cfg.y"
+                                      { yyerror("IPv6 address expected"); }
+#line 6300 "cfg.tab.c"
+    break;
+
+  case 238: /* assign_stm: TCP_OPT_FD_CACHE EQUAL NUMBER  */
+#line 1127 "cfg.y"
+                                        {
+		#ifdef USE_TCP
+			tcp_default_cfg.fd_cache=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6312 "cfg.tab.c"
+    break;
+
+  case 239: /* assign_stm: TCP_OPT_FD_CACHE EQUAL error  */
+#line 1134 "cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 6318 "cfg.tab.c"
+    break;
+
+  case 240: /* assign_stm: TCP_OPT_BUF_WRITE EQUAL NUMBER  */
+#line 1135 "cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.async=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6330 "cfg.tab.c"
+    break;
+
+  case 241: /* assign_stm: TCP_OPT_BUF_WRITE EQUAL error  */
+#line 1142 "cfg.y"
+                                        { yyerror("boolean value expected"); }
+#line 6336 "cfg.tab.c"
+    break;
+
+  case 242: /* assign_stm: TCP_OPT_CONN_WQ_MAX EQUAL NUMBER  */
+#line 1143 "cfg.y"
+                                           {
+		#ifdef USE_TCP
+			tcp_default_cfg.tcpconn_wq_max=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6348 "cfg.tab.c"
+    break;
+
+  case 243: /* assign_stm: TCP_OPT_CONN_WQ_MAX error  */
+#line 1150 "cfg.y"
+                                    { yyerror("boolean value expected"); }
+#line 6354 "cfg.tab.c"
+    break;
+
+  case 244: /* assign_stm: TCP_OPT_WQ_MAX EQUAL NUMBER  */
+#line 1151 "cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.tcp_wq_max=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6366 "cfg.tab.c"
+    break;
+
+  case 245: /* assign_stm: TCP_OPT_WQ_MAX error  */
+#line 1158 "cfg.y"
+                               { yyerror("number expected"); }
+#line 6372 "cfg.tab.c"
+    break;
+
+  case 246: /* assign_stm: TCP_OPT_RD_BUF EQUAL NUMBER  */
+#line 1159 "cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.rd_buf_size=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6384 "cfg.tab.c"
+    break;
+
+  case 247: /* assign_stm: TCP_OPT_RD_BUF error  */
+#line 1166 "cfg.y"
+                               { yyerror("number expected"); }
+#line 6390 "cfg.tab.c"
+    break;
+
+  case 248: /* assign_stm: TCP_OPT_WQ_BLK EQUAL NUMBER  */
+#line 1167 "cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.wq_blk_size=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6402 "cfg.tab.c"
+    break;
+
+  case 249: /* assign_stm: TCP_OPT_WQ_BLK error  */
+#line 1174 "cfg.y"
+                               { yyerror("number expected"); }
+#line 6408 "cfg.tab.c"
+    break;
+
+  case 250: /* assign_stm: TCP_OPT_DEFER_ACCEPT EQUAL NUMBER  */
+#line 1175 "cfg.y"
+                                            {
+		#ifdef USE_TCP
+			tcp_default_cfg.defer_accept=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6420 "cfg.tab.c"
+    break;
+
+  case 251: /* assign_stm: TCP_OPT_DEFER_ACCEPT EQUAL error  */
+#line 1182 "cfg.y"
+                                           { yyerror("boolean value expected"); }
+#line 6426 "cfg.tab.c"
+    break;
+
+  case 252: /* assign_stm: TCP_OPT_DELAYED_ACK EQUAL NUMBER  */
+#line 1183 "cfg.y"
+                                           {
+		#ifdef USE_TCP
+			tcp_default_cfg.delayed_ack=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6438 "cfg.tab.c"
+    break;
+
+  case 253: /* assign_stm: TCP_OPT_DELAYED_ACK EQUAL error  */
+#line 1190 "cfg.y"
+                                          { yyerror("boolean value expected"); }
+#line 6444 "cfg.tab.c"
+    break;
+
+  case 254: /* assign_stm: TCP_OPT_SYNCNT EQUAL NUMBER  */
+#line 1191 "cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.syncnt=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6456 "cfg.tab.c"
+    break;
+
+  case 255: /* assign_stm: TCP_OPT_SYNCNT EQUAL error  */
+#line 1198 "cfg.y"
+                                     { yyerror("number expected"); }
+#line 6462 "cfg.tab.c"
+    break;
+
+  case 256: /* assign_stm: TCP_OPT_LINGER2 EQUAL NUMBER  */
+#line 1199 "cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_default_cfg.linger2=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6474 "cfg.tab.c"
+    break;
+
+  case 257: /* assign_stm: TCP_OPT_LINGER2 EQUAL error  */
+#line 1206 "cfg.y"
+                                      { yyerror("number expected"); }
+#line 6480 "cfg.tab.c"
+    break;
+
+  case 258: /* assign_stm: TCP_OPT_KEEPALIVE EQUAL NUMBER  */
+#line 1207 "cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepalive=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6492 "cfg.tab.c"
+    break;
+
+  case 259: /* assign_stm: TCP_OPT_KEEPALIVE EQUAL error  */
+#line 1214 "cfg.y"
+                                        { yyerror("boolean value expected");}
+#line 6498 "cfg.tab.c"
+    break;
+
+  case 260: /* assign_stm: TCP_OPT_KEEPIDLE EQUAL NUMBER  */
+#line 1215 "cfg.y"
+                                        {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepidle=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6510 "cfg.tab.c"
+    break;
+
+  case 261: /* assign_stm: TCP_OPT_KEEPIDLE EQUAL error  */
+#line 1222 "cfg.y"
+                                       { yyerror("number expected"); }
+#line 6516 "cfg.tab.c"
+    break;
+
+  case 262: /* assign_stm: TCP_OPT_KEEPINTVL EQUAL NUMBER  */
+#line 1223 "cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepintvl=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6528 "cfg.tab.c"
+    break;
+
+  case 263: /* assign_stm: TCP_OPT_KEEPINTVL EQUAL error  */
+#line 1230 "cfg.y"
+                                        { yyerror("number expected"); }
+#line 6534 "cfg.tab.c"
+    break;
+
+  case 264: /* assign_stm: TCP_OPT_KEEPCNT EQUAL NUMBER  */
+#line 1231 "cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepcnt=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6546 "cfg.tab.c"
+    break;
+
+  case 265: /* assign_stm: TCP_OPT_KEEPCNT EQUAL error  */
+#line 1238 "cfg.y"
+                                      { yyerror("number expected"); }
+#line 6552 "cfg.tab.c"
+    break;
+
+  case 266: /* assign_stm: TCP_OPT_CRLF_PING EQUAL NUMBER  */
+#line 1239 "cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.crlf_ping=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6564 "cfg.tab.c"
+    break;
+
+  case 267: /* assign_stm: TCP_OPT_CRLF_PING EQUAL error  */
+#line 1246 "cfg.y"
+                                        { yyerror("boolean value expected"); }
+#line 6570 "cfg.tab.c"
+    break;
+
+  case 268: /* assign_stm: TCP_OPT_ACCEPT_NO_CL EQUAL NUMBER  */
+#line 1247 "cfg.y"
+                                            {
+		#ifdef USE_TCP
+			tcp_default_cfg.accept_no_cl=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6582 "cfg.tab.c"
+    break;
+
+  case 269: /* assign_stm: TCP_OPT_ACCEPT_NO_CL EQUAL error  */
+#line 1254 "cfg.y"
+                                           { yyerror("boolean value expected"); }
+#line 6588 "cfg.tab.c"
+    break;
+
+  case 270: /* assign_stm: TCP_CLONE_RCVBUF EQUAL NUMBER  */
+#line 1255 "cfg.y"
+                                        {
+		#ifdef USE_TCP
+			tcp_set_clone_rcvbuf((yyvsp[0].intval));
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6600 "cfg.tab.c"
+    break;
+
+  case 271: /* assign_stm: TCP_CLONE_RCVBUF EQUAL error  */
+#line 1262 "cfg.y"
+                                       { yyerror("number expected"); }
+#line 6606 "cfg.tab.c"
+    break;
+
+  case 272: /* assign_stm: DISABLE_TLS EQUAL NUMBER  */
+#line 1263 "cfg.y"
+                                   {
+		#ifdef USE_TLS
+			tls_disable=(yyvsp[0].intval);
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 6618 "cfg.tab.c"
+    break;
+
+  case 273: /* assign_stm: DISABLE_TLS EQUAL error  */
+#line 1270 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 6624 "cfg.tab.c"
+    break;
+
+  case 274: /* assign_stm: ENABLE_TLS EQUAL NUMBER  */
+#line 1271 "cfg.y"
+                                  {
+		#ifdef USE_TLS
+			tls_disable=!((yyvsp[0].intval));
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 6636 "cfg.tab.c"
+    break;
+
+  case 275: /* assign_stm: ENABLE_TLS EQUAL error  */
+#line 1278 "cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 6642 "cfg.tab.c"
+    break;
+
+  case 276: /* assign_stm: TLSLOG EQUAL NUMBER  */
+#line 1279 "cfg.y"
+                              {
+		#ifdef CORE_TLS
+			tls_log=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6654 "cfg.tab.c"
+    break;
+
+  case 277: /* assign_stm: TLSLOG EQUAL error  */
+#line 1286 "cfg.y"
+                             { yyerror("int value expected"); }
+#line 6660 "cfg.tab.c"
+    break;
+
+  case 278: /* assign_stm: TLS_PORT_NO EQUAL NUMBER  */
+#line 1287 "cfg.y"
+                                   {
+		#ifdef USE_TLS
+			tls_port_no=(yyvsp[0].intval);
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 6672 "cfg.tab.c"
+    break;
+
+  case 279: /* assign_stm: TLS_PORT_NO EQUAL error  */
+#line 1294 "cfg.y"
+                                  { yyerror("number expected"); }
+#line 6678 "cfg.tab.c"
+    break;
+
+  case 280: /* assign_stm: TLS_METHOD EQUAL SSLv23  */
+#line 1295 "cfg.y"
+                                  {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_SSLv23;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6690 "cfg.tab.c"
+    break;
+
+  case 281: /* assign_stm: TLS_METHOD EQUAL SSLv2  */
+#line 1302 "cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_SSLv2;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6702 "cfg.tab.c"
+    break;
+
+  case 282: /* assign_stm: TLS_METHOD EQUAL SSLv3  */
+#line 1309 "cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_SSLv3;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6714 "cfg.tab.c"
+    break;
+
+  case 283: /* assign_stm: TLS_METHOD EQUAL TLSv1  */
+#line 1316 "cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_TLSv1;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6726 "cfg.tab.c"
+    break;
+
+  case 284: /* assign_stm: TLS_METHOD EQUAL error  */
+#line 1323 "cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			yyerror("SSLv23, SSLv2, SSLv3 or TLSv1 expected");
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6738 "cfg.tab.c"
+    break;
+
+  case 285: /* assign_stm: TLS_VERIFY EQUAL NUMBER  */
+#line 1330 "cfg.y"
+                                  {
+		#ifdef CORE_TLS
+			tls_verify_cert=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6750 "cfg.tab.c"
+    break;
+
+  case 286: /* assign_stm: TLS_VERIFY EQUAL error  */
+#line 1337 "cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 6756 "cfg.tab.c"
+    break;
+
+  case 287: /* assign_stm: TLS_REQUIRE_CERTIFICATE EQUAL NUMBER  */
+#line 1338 "cfg.y"
+                                               {
+		#ifdef CORE_TLS
+			tls_require_cert=(yyvsp[0].intval);
+		#else
+			warn( "tls-in-core support not compiled in");
+		#endif
+	}
+#line 6768 "cfg.tab.c"
+    break;
+
+  case 288: /* assign_stm: TLS_REQUIRE_CERTIFICATE EQUAL error  */
+#line 1345 "cfg.y"
+                                              { yyerror("boolean value expected"); }
+#line 6774 "cfg.tab.c"
+    break;
+
+  case 289: /* assign_stm: TLS_CERTIFICATE EQUAL STRING  */
+#line 1346 "cfg.y"
+                                       {
+		#ifdef CORE_TLS
+			tls_cert_file=(yyvsp[0].strval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6786 "cfg.tab.c"
+    break;
+
+  case 290: /* assign_stm: TLS_CERTIFICATE EQUAL error  */
+#line 1353 "cfg.y"
+                                      { yyerror("string value expected"); }
+#line 6792 "cfg.tab.c"
+    break;
+
+  case 291: /* assign_stm: TLS_PRIVATE_KEY EQUAL STRING  */
+#line 1354 "cfg.y"
+                                       {
+		#ifdef CORE_TLS
+			tls_pkey_file=(yyvsp[0].strval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6804 "cfg.tab.c"
+    break;
+
+  case 292: /* assign_stm: TLS_PRIVATE_KEY EQUAL error  */
+#line 1361 "cfg.y"
+                                      { yyerror("string value expected"); }
+#line 6810 "cfg.tab.c"
+    break;
+
+  case 293: /* assign_stm: TLS_CA_LIST EQUAL STRING  */
+#line 1362 "cfg.y"
+                                   {
+		#ifdef CORE_TLS
+			tls_ca_file=(yyvsp[0].strval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6822 "cfg.tab.c"
+    break;
+
+  case 294: /* assign_stm: TLS_CA_LIST EQUAL error  */
+#line 1369 "cfg.y"
+                                  { yyerror("string value expected"); }
+#line 6828 "cfg.tab.c"
+    break;
+
+  case 295: /* assign_stm: TLS_HANDSHAKE_TIMEOUT EQUAL NUMBER  */
+#line 1370 "cfg.y"
+                                             {
+		#ifdef CORE_TLS
+			tls_handshake_timeout=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6840 "cfg.tab.c"
+    break;
+
+  case 296: /* assign_stm: TLS_HANDSHAKE_TIMEOUT EQUAL error  */
+#line 1377 "cfg.y"
+                                            { yyerror("number expected"); }
+#line 6846 "cfg.tab.c"
+    break;
+
+  case 297: /* assign_stm: TLS_SEND_TIMEOUT EQUAL NUMBER  */
+#line 1378 "cfg.y"
+                                        {
+		#ifdef CORE_TLS
+			tls_send_timeout=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 6858 "cfg.tab.c"
+    break;
+
+  case 298: /* assign_stm: TLS_SEND_TIMEOUT EQUAL error  */
+#line 1385 "cfg.y"
+                                       { yyerror("number expected"); }
+#line 6864 "cfg.tab.c"
+    break;
+
+  case 299: /* assign_stm: DISABLE_SCTP EQUAL NUMBER  */
+#line 1386 "cfg.y"
+                                    {
+		#ifdef USE_SCTP
+			sctp_disable=(yyvsp[0].intval);
+		#else
+			warn("sctp support not compiled in");
+		#endif
+	}
+#line 6876 "cfg.tab.c"
+    break;
+
+  case 300: /* assign_stm: DISABLE_SCTP EQUAL error  */
+#line 1393 "cfg.y"
+                                   { yyerror("boolean value expected"); }
+#line 6882 "cfg.tab.c"
+    break;
+
+  case 301: /* assign_stm: ENABLE_SCTP EQUAL NUMBER  */
+#line 1394 "cfg.y"
+                                   {
+		#ifdef USE_SCTP
+			sctp_disable=((yyvsp[0].intval)<=1)?!(yyvsp[0].intval):(yyvsp[0].intval);
+		#else
+			warn("sctp support not compiled in");
+		#endif
+	}
+#line 6894 "cfg.tab.c"
+    break;
+
+  case 302: /* assign_stm: ENABLE_SCTP EQUAL error  */
+#line 1401 "cfg.y"
+                                  { yyerror("boolean or number expected"); }
+#line 6900 "cfg.tab.c"
+    break;
+
+  case 303: /* assign_stm: SCTP_CHILDREN EQUAL NUMBER  */
+#line 1402 "cfg.y"
+                                     {
+		#ifdef USE_SCTP
+			sctp_children_no=(yyvsp[0].intval);
+		#else
+			warn("sctp support not compiled in");
+		#endif
+	}
+#line 6912 "cfg.tab.c"
+    break;
+
+  case 304: /* assign_stm: SCTP_CHILDREN EQUAL error  */
+#line 1409 "cfg.y"
+                                    { yyerror("number expected"); }
+#line 6918 "cfg.tab.c"
+    break;
+
+  case 305: /* assign_stm: SERVER_SIGNATURE EQUAL NUMBER  */
+#line 1410 "cfg.y"
+                                        { server_signature=(yyvsp[0].intval); }
+#line 6924 "cfg.tab.c"
+    break;
+
+  case 306: /* assign_stm: SERVER_SIGNATURE EQUAL error  */
+#line 1411 "cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 6930 "cfg.tab.c"
+    break;
+
+  case 307: /* assign_stm: SERVER_HEADER EQUAL STRING  */
+#line 1412 "cfg.y"
+                                     { server_hdr.s=(yyvsp[0].strval);
+			server_hdr.len=strlen(server_hdr.s);
+	}
+#line 6938 "cfg.tab.c"
+    break;
+
+  case 308: /* assign_stm: SERVER_HEADER EQUAL error  */
+#line 1415 "cfg.y"
+                                    { yyerror("string value expected"); }
+#line 6944 "cfg.tab.c"
+    break;
+
+  case 309: /* assign_stm: USER_AGENT_HEADER EQUAL STRING  */
+#line 1416 "cfg.y"
+                                         { user_agent_hdr.s=(yyvsp[0].strval);
+			user_agent_hdr.len=strlen(user_agent_hdr.s);
+	}
+#line 6952 "cfg.tab.c"
+    break;
+
+  case 310: /* assign_stm: USER_AGENT_HEADER EQUAL error  */
+#line 1419 "cfg.y"
+                                        { yyerror("string value expected"); }
+#line 6958 "cfg.tab.c"
+    break;
+
+  case 311: /* assign_stm: REPLY_TO_VIA EQUAL NUMBER  */
+#line 1420 "cfg.y"
+                                    { reply_to_via=(yyvsp[0].intval); }
+#line 6964 "cfg.tab.c"
+    break;
+
+  case 312: /* assign_stm: REPLY_TO_VIA EQUAL error  */
+#line 1421 "cfg.y"
+                                   { yyerror("boolean value expected"); }
+#line 6970 "cfg.tab.c"
+    break;
+
+  case 313: /* assign_stm: LISTEN EQUAL id_lst  */
+#line 1422 "cfg.y"
+                              {
+		for(lst_tmp=(yyvsp[0].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_iface(	lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto,
+									lst_tmp->flags)!=0) {
+				LOG(L_CRIT,  "ERROR: cfg. parser: failed to add listen"
+								" address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[0].sockid));
+	}
+#line 6988 "cfg.tab.c"
+    break;
+
+  case 314: /* assign_stm: LISTEN EQUAL id_lst ADVERTISE listen_id COLON NUMBER  */
+#line 1435 "cfg.y"
+                                                               {
+		for(lst_tmp=(yyvsp[-4].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_advertise_iface(	lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto,
+									(yyvsp[-2].strval), (yyvsp[0].intval),
+									lst_tmp->flags)!=0) {
+				LOG(L_CRIT,  "ERROR: cfg. parser: failed to add listen"
+								" address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[-4].sockid));
+	}
+#line 7007 "cfg.tab.c"
+    break;
+
+  case 315: /* assign_stm: LISTEN EQUAL error  */
+#line 1449 "cfg.y"
+                              { yyerror("ip address, interface name or"
+									" hostname expected"); }
+#line 7014 "cfg.tab.c"
+    break;
+
+  case 316: /* assign_stm: ALIAS EQUAL id_lst  */
+#line 1451 "cfg.y"
+                              {
+		for(lst_tmp=(yyvsp[0].sockid); lst_tmp; lst_tmp=lst_tmp->next){
+			add_alias(	lst_tmp->addr_lst->name,
+						strlen(lst_tmp->addr_lst->name),
+						lst_tmp->port, lst_tmp->proto);
+			for (nl_tmp=lst_tmp->addr_lst->next; nl_tmp; nl_tmp=nl_tmp->next)
+				add_alias(nl_tmp->name, strlen(nl_tmp->name),
+							lst_tmp->port, lst_tmp->proto);
+		}
+		free_socket_id_lst((yyvsp[0].sockid));
+	}
+#line 7030 "cfg.tab.c"
+    break;
+
+  case 317: /* assign_stm: ALIAS EQUAL error  */
+#line 1462 "cfg.y"
+                              { yyerror(" hostname expected"); }
+#line 7036 "cfg.tab.c"
+    break;
+
+  case 318: /* assign_stm: SR_AUTO_ALIASES EQUAL NUMBER  */
+#line 1463 "cfg.y"
+                                       { sr_auto_aliases=(yyvsp[0].intval); }
+#line 7042 "cfg.tab.c"
+    break;
+
+  case 319: /* assign_stm: SR_AUTO_ALIASES EQUAL error  */
+#line 1464 "cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7048 "cfg.tab.c"
+    break;
+
+  case 320: /* assign_stm: ADVERTISED_ADDRESS EQUAL listen_id  */
+#line 1465 "cfg.y"
+                                             {
+		if ((yyvsp[0].strval)){
+			default_global_address.s=(yyvsp[0].strval);
+			default_global_address.len=strlen((yyvsp[0].strval));
+		}
+	}
+#line 7059 "cfg.tab.c"
+    break;
+
+  case 321: /* assign_stm: ADVERTISED_ADDRESS EQUAL error  */
+#line 1471 "cfg.y"
+                                         {yyerror("ip address or hostname expected"); }
+#line 7065 "cfg.tab.c"
+    break;
+
+  case 322: /* assign_stm: ADVERTISED_PORT EQUAL NUMBER  */
+#line 1472 "cfg.y"
+                                       {
+		tmp=int2str((yyvsp[0].intval), &i_tmp);
+		if ((default_global_port.s=pkg_malloc(i_tmp))==0) {
+			LOG(L_CRIT, "ERROR: cfg. parser: out of memory.\n");
+			default_global_port.len=0;
+		} else {
+			default_global_port.len=i_tmp;
+			memcpy(default_global_port.s, tmp, default_global_port.len);
+		};
+	}
+#line 7080 "cfg.tab.c"
+    break;
+
+  case 323: /* assign_stm: ADVERTISED_PORT EQUAL error  */
+#line 1482 "cfg.y"
+                                     {yyerror("ip address or hostname expected"); }
+#line 7086 "cfg.tab.c"
+    break;
+
+  case 324: /* assign_stm: DISABLE_CORE EQUAL NUMBER  */
+#line 1483 "cfg.y"
+                                    { disable_core_dump=(yyvsp[0].intval); }
+#line 7092 "cfg.tab.c"
+    break;
+
+  case 325: /* assign_stm: DISABLE_CORE EQUAL error  */
+#line 1484 "cfg.y"
+                                   { yyerror("boolean value expected"); }
+#line 7098 "cfg.tab.c"
+    break;
+
+  case 326: /* assign_stm: OPEN_FD_LIMIT EQUAL NUMBER  */
+#line 1485 "cfg.y"
+                                     { open_files_limit=(yyvsp[0].intval); }
+#line 7104 "cfg.tab.c"
+    break;
+
+  case 327: /* assign_stm: OPEN_FD_LIMIT EQUAL error  */
+#line 1486 "cfg.y"
+                                    { yyerror("number expected"); }
+#line 7110 "cfg.tab.c"
+    break;
+
+  case 328: /* assign_stm: SHM_MEM_SZ EQUAL NUMBER  */
+#line 1487 "cfg.y"
+                                  {
+		if (shm_initialized())
+			yyerror("shm/shm_mem_size must be before any modparam or the"
+					" route blocks");
+		else if (shm_mem_size == 0)
+			shm_mem_size=(yyvsp[0].intval) * 1024 * 1024;
+	}
+#line 7122 "cfg.tab.c"
+    break;
+
+  case 329: /* assign_stm: SHM_MEM_SZ EQUAL error  */
+#line 1494 "cfg.y"
+                                 { yyerror("number expected"); }
+#line 7128 "cfg.tab.c"
+    break;
+
+  case 330: /* assign_stm: SHM_FORCE_ALLOC EQUAL NUMBER  */
+#line 1495 "cfg.y"
+                                       {
+		if (shm_initialized())
+			yyerror("shm_force_alloc must be before any modparam or the"
+					" route blocks");
+		else
+			shm_force_alloc=(yyvsp[0].intval);
+	}
+#line 7140 "cfg.tab.c"
+    break;
+
+  case 331: /* assign_stm: SHM_FORCE_ALLOC EQUAL error  */
+#line 1502 "cfg.y"
+                                      { yyerror("boolean value expected"); }
+#line 7146 "cfg.tab.c"
+    break;
+
+  case 332: /* assign_stm: MLOCK_PAGES EQUAL NUMBER  */
+#line 1503 "cfg.y"
+                                   { mlock_pages=(yyvsp[0].intval); }
+#line 7152 "cfg.tab.c"
+    break;
+
+  case 333: /* assign_stm: MLOCK_PAGES EQUAL error  */
+#line 1504 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 7158 "cfg.tab.c"
+    break;
+
+  case 334: /* assign_stm: REAL_TIME EQUAL NUMBER  */
+#line 1505 "cfg.y"
+                                 { real_time=(yyvsp[0].intval); }
+#line 7164 "cfg.tab.c"
+    break;
+
+  case 335: /* assign_stm: REAL_TIME EQUAL error  */
+#line 1506 "cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 7170 "cfg.tab.c"
+    break;
+
+  case 336: /* assign_stm: RT_PRIO EQUAL NUMBER  */
+#line 1507 "cfg.y"
+                               { rt_prio=(yyvsp[0].intval); }
+#line 7176 "cfg.tab.c"
+    break;
+
+  case 337: /* assign_stm: RT_PRIO EQUAL error  */
+#line 1508 "cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 7182 "cfg.tab.c"
+    break;
+
+  case 338: /* assign_stm: RT_POLICY EQUAL NUMBER  */
+#line 1509 "cfg.y"
+                                 { rt_policy=(yyvsp[0].intval); }
+#line 7188 "cfg.tab.c"
+    break;
+
+  case 339: /* assign_stm: RT_POLICY EQUAL error  */
+#line 1510 "cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 7194 "cfg.tab.c"
+    break;
+
+  case 340: /* assign_stm: RT_TIMER1_PRIO EQUAL NUMBER  */
+#line 1511 "cfg.y"
+                                      { rt_timer1_prio=(yyvsp[0].intval); }
+#line 7200 "cfg.tab.c"
+    break;
+
+  case 341: /* assign_stm: RT_TIMER1_PRIO EQUAL error  */
+#line 1512 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 7206 "cfg.tab.c"
+    break;
+
+  case 342: /* assign_stm: RT_TIMER1_POLICY EQUAL NUMBER  */
+#line 1513 "cfg.y"
+                                        { rt_timer1_policy=(yyvsp[0].intval); }
+#line 7212 "cfg.tab.c"
+    break;
+
+  case 343: /* assign_stm: RT_TIMER1_POLICY EQUAL error  */
+#line 1514 "cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7218 "cfg.tab.c"
+    break;
+
+  case 344: /* assign_stm: RT_TIMER2_PRIO EQUAL NUMBER  */
+#line 1515 "cfg.y"
+                                      { rt_timer2_prio=(yyvsp[0].intval); }
+#line 7224 "cfg.tab.c"
+    break;
+
+  case 345: /* assign_stm: RT_TIMER2_PRIO EQUAL error  */
+#line 1516 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 7230 "cfg.tab.c"
+    break;
+
+  case 346: /* assign_stm: RT_TIMER2_POLICY EQUAL NUMBER  */
+#line 1517 "cfg.y"
+                                        { rt_timer2_policy=(yyvsp[0].intval); }
+#line 7236 "cfg.tab.c"
+    break;
+
+  case 347: /* assign_stm: RT_TIMER2_POLICY EQUAL error  */
+#line 1518 "cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7242 "cfg.tab.c"
+    break;
+
+  case 348: /* assign_stm: MCAST_LOOPBACK EQUAL NUMBER  */
+#line 1519 "cfg.y"
+                                      {
+		#ifdef USE_MCAST
+			mcast_loopback=(yyvsp[0].intval);
+		#else
+			warn("no multicast support compiled in");
+		#endif
+	}
+#line 7254 "cfg.tab.c"
+    break;
+
+  case 349: /* assign_stm: MCAST_LOOPBACK EQUAL error  */
+#line 1526 "cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 7260 "cfg.tab.c"
+    break;
+
+  case 350: /* assign_stm: MCAST_TTL EQUAL NUMBER  */
+#line 1527 "cfg.y"
+                                 {
+		#ifdef USE_MCAST
+			mcast_ttl=(yyvsp[0].intval);
+		#else
+			warn("no multicast support compiled in");
+		#endif
+	}
+#line 7272 "cfg.tab.c"
+    break;
+
+  case 351: /* assign_stm: MCAST_TTL EQUAL error  */
+#line 1534 "cfg.y"
+                                { yyerror("number expected"); }
+#line 7278 "cfg.tab.c"
+    break;
+
+  case 352: /* assign_stm: TOS EQUAL NUMBER  */
+#line 1535 "cfg.y"
+                           { tos=(yyvsp[0].intval); }
+#line 7284 "cfg.tab.c"
+    break;
+
+  case 353: /* assign_stm: TOS EQUAL ID  */
+#line 1536 "cfg.y"
+                       { if (strcasecmp((yyvsp[0].strval),"IPTOS_LOWDELAY")) {
+			tos=IPTOS_LOWDELAY;
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_THROUGHPUT")) {
+			tos=IPTOS_THROUGHPUT;
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_RELIABILITY")) {
+			tos=IPTOS_RELIABILITY;
+#if defined(IPTOS_MINCOST)
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_MINCOST")) {
+			tos=IPTOS_MINCOST;
+#endif
+#if defined(IPTOS_LOWCOST)
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_LOWCOST")) {
+			tos=IPTOS_LOWCOST;
+#endif
+		} else {
+			yyerror("invalid tos value - allowed: "
+				"IPTOS_LOWDELAY,IPTOS_THROUGHPUT,"
+				"IPTOS_RELIABILITY"
+#if defined(IPTOS_LOWCOST)
+				",IPTOS_LOWCOST"
+#endif
+#if !defined(IPTOS_MINCOST)
+				",IPTOS_MINCOST"
+#endif
+				"\n");
+		}
+	}
+#line 7316 "cfg.tab.c"
+    break;
+
+  case 354: /* assign_stm: TOS EQUAL error  */
+#line 1563 "cfg.y"
+                          { yyerror("number expected"); }
+#line 7322 "cfg.tab.c"
+    break;
+
+  case 355: /* assign_stm: PMTU_DISCOVERY EQUAL NUMBER  */
+#line 1564 "cfg.y"
+                                      { pmtu_discovery=(yyvsp[0].intval); }
+#line 7328 "cfg.tab.c"
+    break;
+
+  case 356: /* assign_stm: PMTU_DISCOVERY error  */
+#line 1565 "cfg.y"
+                               { yyerror("number expected"); }
+#line 7334 "cfg.tab.c"
+    break;
+
+  case 357: /* assign_stm: KILL_TIMEOUT EQUAL NUMBER  */
+#line 1566 "cfg.y"
+                                    { ser_kill_timeout=(yyvsp[0].intval); }
+#line 7340 "cfg.tab.c"
+    break;
+
+  case 358: /* assign_stm: KILL_TIMEOUT EQUAL error  */
+#line 1567 "cfg.y"
+                                   { yyerror("number expected"); }
+#line 7346 "cfg.tab.c"
+    break;
+
+  case 359: /* assign_stm: MAX_WLOOPS EQUAL NUMBER  */
+#line 1568 "cfg.y"
+                                  { default_core_cfg.max_while_loops=(yyvsp[0].intval); }
+#line 7352 "cfg.tab.c"
+    break;
+
+  case 360: /* assign_stm: MAX_WLOOPS EQUAL error  */
+#line 1569 "cfg.y"
+                                 { yyerror("number expected"); }
+#line 7358 "cfg.tab.c"
+    break;
+
+  case 361: /* assign_stm: PVBUFSIZE EQUAL NUMBER  */
+#line 1570 "cfg.y"
+                                 { pv_set_buffer_size((yyvsp[0].intval)); }
+#line 7364 "cfg.tab.c"
+    break;
+
+  case 362: /* assign_stm: PVBUFSIZE EQUAL error  */
+#line 1571 "cfg.y"
+                                { yyerror("number expected"); }
+#line 7370 "cfg.tab.c"
+    break;
+
+  case 363: /* assign_stm: PVBUFSLOTS EQUAL NUMBER  */
+#line 1572 "cfg.y"
+                                  { pv_set_buffer_slots((yyvsp[0].intval)); }
+#line 7376 "cfg.tab.c"
+    break;
+
+  case 364: /* assign_stm: PVBUFSLOTS EQUAL error  */
+#line 1573 "cfg.y"
+                                 { yyerror("number expected"); }
+#line 7382 "cfg.tab.c"
+    break;
+
+  case 365: /* assign_stm: HTTP_REPLY_PARSE EQUAL NUMBER  */
+#line 1574 "cfg.y"
+                                        { http_reply_parse=(yyvsp[0].intval); }
+#line 7388 "cfg.tab.c"
+    break;
+
+  case 366: /* assign_stm: HTTP_REPLY_PARSE EQUAL error  */
+#line 1575 "cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7394 "cfg.tab.c"
+    break;
+
+  case 367: /* assign_stm: SERVER_ID EQUAL NUMBER  */
+#line 1576 "cfg.y"
+                             { server_id=(yyvsp[0].intval); }
+#line 7400 "cfg.tab.c"
+    break;
+
+  case 368: /* assign_stm: LATENCY_LOG EQUAL NUMBER  */
+#line 1577 "cfg.y"
+                               { default_core_cfg.latency_log=(yyvsp[0].intval); }
+#line 7406 "cfg.tab.c"
+    break;
+
+  case 369: /* assign_stm: LATENCY_LOG EQUAL error  */
+#line 1578 "cfg.y"
+                                   { yyerror("number  expected"); }
+#line 7412 "cfg.tab.c"
+    break;
+
+  case 370: /* assign_stm: LATENCY_LIMIT_DB EQUAL NUMBER  */
+#line 1579 "cfg.y"
+                                    { default_core_cfg.latency_limit_db=(yyvsp[0].intval); }
+#line 7418 "cfg.tab.c"
+    break;
+
+  case 371: /* assign_stm: LATENCY_LIMIT_DB EQUAL error  */
+#line 1580 "cfg.y"
+                                        { yyerror("number  expected"); }
+#line 7424 "cfg.tab.c"
+    break;
+
+  case 372: /* assign_stm: LATENCY_LIMIT_ACTION EQUAL NUMBER  */
+#line 1581 "cfg.y"
+                                        { default_core_cfg.latency_limit_action=(yyvsp[0].intval); }
+#line 7430 "cfg.tab.c"
+    break;
+
+  case 373: /* assign_stm: LATENCY_LIMIT_ACTION EQUAL error  */
+#line 1582 "cfg.y"
+                                            { yyerror("number  expected"); }
+#line 7436 "cfg.tab.c"
+    break;
+
+  case 374: /* assign_stm: MSG_TIME EQUAL NUMBER  */
+#line 1583 "cfg.y"
+                            { sr_msg_time=(yyvsp[0].intval); }
+#line 7442 "cfg.tab.c"
+    break;
+
+  case 375: /* assign_stm: MSG_TIME EQUAL error  */
+#line 1584 "cfg.y"
+                                { yyerror("number  expected"); }
+#line 7448 "cfg.tab.c"
+    break;
+
+  case 376: /* assign_stm: UDP_MTU EQUAL NUMBER  */
+#line 1585 "cfg.y"
+                               { default_core_cfg.udp_mtu=(yyvsp[0].intval); }
+#line 7454 "cfg.tab.c"
+    break;
+
+  case 377: /* assign_stm: UDP_MTU EQUAL error  */
+#line 1586 "cfg.y"
+                              { yyerror("number expected"); }
+#line 7460 "cfg.tab.c"
+    break;
+
+  case 378: /* assign_stm: FORCE_RPORT EQUAL NUMBER  */
+#line 1588 "cfg.y"
+                { default_core_cfg.force_rport=(yyvsp[0].intval); fix_global_req_flags(0, 0); }
+#line 7466 "cfg.tab.c"
+    break;
+
+  case 379: /* assign_stm: FORCE_RPORT EQUAL error  */
+#line 1589 "cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 7472 "cfg.tab.c"
+    break;
+
+  case 380: /* assign_stm: UDP_MTU_TRY_PROTO EQUAL proto  */
+#line 1591 "cfg.y"
+                { default_core_cfg.udp_mtu_try_proto=(yyvsp[0].intval); fix_global_req_flags(0, 0); }
+#line 7478 "cfg.tab.c"
+    break;
+
+  case 381: /* assign_stm: UDP_MTU_TRY_PROTO EQUAL error  */
+#line 1593 "cfg.y"
+                { yyerror("TCP, TLS, SCTP or UDP expected"); }
+#line 7484 "cfg.tab.c"
+    break;
+
+  case 382: /* assign_stm: UDP4_RAW EQUAL intno  */
+#line 1594 "cfg.y"
+                               { IF_RAW_SOCKS(default_core_cfg.udp4_raw=(yyvsp[0].intval)); }
+#line 7490 "cfg.tab.c"
+    break;
+
+  case 383: /* assign_stm: UDP4_RAW EQUAL error  */
+#line 1595 "cfg.y"
+                               { yyerror("number expected"); }
+#line 7496 "cfg.tab.c"
+    break;
+
+  case 384: /* assign_stm: UDP4_RAW_MTU EQUAL NUMBER  */
+#line 1596 "cfg.y"
+                                    {
+		IF_RAW_SOCKS(default_core_cfg.udp4_raw_mtu=(yyvsp[0].intval));
+	}
+#line 7504 "cfg.tab.c"
+    break;
+
+  case 385: /* assign_stm: UDP4_RAW_MTU EQUAL error  */
+#line 1599 "cfg.y"
+                                   { yyerror("number expected"); }
+#line 7510 "cfg.tab.c"
+    break;
+
+  case 386: /* assign_stm: UDP4_RAW_TTL EQUAL NUMBER  */
+#line 1600 "cfg.y"
+                                    {
+		IF_RAW_SOCKS(default_core_cfg.udp4_raw_ttl=(yyvsp[0].intval));
+	}
+#line 7518 "cfg.tab.c"
+    break;
+
+  case 387: /* assign_stm: UDP4_RAW_TTL EQUAL error  */
+#line 1603 "cfg.y"
+                                   { yyerror("number expected"); }
+#line 7524 "cfg.tab.c"
+    break;
+
+  case 389: /* assign_stm: error EQUAL  */
+#line 1605 "cfg.y"
+                      { yyerror("unknown config variable"); }
+#line 7530 "cfg.tab.c"
+    break;
+
+  case 391: /* cfg_var_id: DEFAULT  */
+#line 1609 "cfg.y"
+                  { (yyval.strval)="default" ; }
+#line 7536 "cfg.tab.c"
+    break;
+
+  case 392: /* cfg_var: cfg_var_id DOT cfg_var_id EQUAL NUMBER  */
+#line 1613 "cfg.y"
+                                               {
+		if (cfg_declare_int((yyvsp[-4].strval), (yyvsp[-2].strval), (yyvsp[0].intval), 0, 0, NULL)) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 7546 "cfg.tab.c"
+    break;
+
+  case 393: /* cfg_var: cfg_var_id DOT cfg_var_id EQUAL STRING  */
+#line 1618 "cfg.y"
+                                                 {
+		if (cfg_declare_str((yyvsp[-4].strval), (yyvsp[-2].strval), (yyvsp[0].strval), NULL)) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 7556 "cfg.tab.c"
+    break;
+
+  case 394: /* cfg_var: cfg_var_id DOT cfg_var_id EQUAL NUMBER CFG_DESCRIPTION STRING  */
+#line 1623 "cfg.y"
+                                                                        {
+		if (cfg_declare_int((yyvsp[-6].strval), (yyvsp[-4].strval), (yyvsp[-2].intval), 0, 0, (yyvsp[0].strval))) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 7566 "cfg.tab.c"
+    break;
+
+  case 395: /* cfg_var: cfg_var_id DOT cfg_var_id EQUAL STRING CFG_DESCRIPTION STRING  */
+#line 1628 "cfg.y"
+                                                                        {
+		if (cfg_declare_str((yyvsp[-6].strval), (yyvsp[-4].strval), (yyvsp[-2].strval), (yyvsp[0].strval))) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 7576 "cfg.tab.c"
+    break;
+
+  case 396: /* cfg_var: cfg_var_id DOT cfg_var_id EQUAL error  */
+#line 1633 "cfg.y"
+                                                { 
+		yyerror("number or string expected"); 
+	}
+#line 7584 "cfg.tab.c"
+    break;
+
+  case 397: /* cfg_var: cfg_var_id LBRACK NUMBER RBRACK DOT cfg_var_id EQUAL NUMBER  */
+#line 1636 "cfg.y"
+                                                                      {
+		if (cfg_ginst_var_int((yyvsp[-7].strval), (yyvsp[-5].intval), (yyvsp[-2].strval), (yyvsp[0].intval))) {
+			yyerror("variable cannot be added to the group instance");
+		}
+	}
+#line 7594 "cfg.tab.c"
+    break;
+
+  case 398: /* cfg_var: cfg_var_id LBRACK NUMBER RBRACK DOT cfg_var_id EQUAL STRING  */
+#line 1641 "cfg.y"
+                                                                      {
+		if (cfg_ginst_var_string((yyvsp[-7].strval), (yyvsp[-5].intval), (yyvsp[-2].strval), (yyvsp[0].strval))) {
+			yyerror("variable cannot be added to the group instance");
+		}
+	}
+#line 7604 "cfg.tab.c"
+    break;
+
+  case 399: /* module_stm: LOADMODULE STRING  */
+#line 1649 "cfg.y"
+                          {
+		DBG("loading module %s\n", (yyvsp[0].strval));
+			if (load_module((yyvsp[0].strval))!=0) {
+				yyerror("failed to load module");
+			}
+	}
+#line 7615 "cfg.tab.c"
+    break;
+
+  case 400: /* module_stm: LOADMODULE error  */
+#line 1655 "cfg.y"
+                                { yyerror("string expected"); }
+#line 7621 "cfg.tab.c"
+    break;
+
+  case 401: /* module_stm: LOADPATH STRING  */
+#line 1656 "cfg.y"
+                          {
+		DBG("loading modules under %s\n", (yyvsp[0].strval));
+		printf("loading modules under %s\n", (yyvsp[0].strval));
+		mods_dir = (yyvsp[0].strval);
+	}
+#line 7631 "cfg.tab.c"
+    break;
+
+  case 402: /* module_stm: LOADPATH error  */
+#line 1661 "cfg.y"
+                                { yyerror("string expected"); }
+#line 7637 "cfg.tab.c"
+    break;
+
+  case 403: /* module_stm: LOADPATH EQUAL STRING  */
+#line 1662 "cfg.y"
+                                {
+		DBG("loading modules under %s\n", (yyvsp[0].strval));
+		printf("loading modules under %s\n", (yyvsp[0].strval));
+		mods_dir = (yyvsp[0].strval);
+	}
+#line 7647 "cfg.tab.c"
+    break;
+
+  case 404: /* module_stm: LOADPATH EQUAL error  */
+#line 1667 "cfg.y"
+                                { yyerror("string expected"); }
+#line 7653 "cfg.tab.c"
+    break;
+
+  case 405: /* module_stm: MODPARAM LPAREN STRING COMMA STRING COMMA STRING RPAREN  */
+#line 1668 "cfg.y"
+                                                                  {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		if (set_mod_param_regex((yyvsp[-5].strval), (yyvsp[-3].strval), PARAM_STRING, (yyvsp[-1].strval)) != 0) {
+			 yyerror("Can't set module parameter");
+		}
+	}
+#line 7669 "cfg.tab.c"
+    break;
+
+  case 406: /* module_stm: MODPARAM LPAREN STRING COMMA STRING COMMA intno RPAREN  */
+#line 1679 "cfg.y"
+                                                                 {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		if (set_mod_param_regex((yyvsp[-5].strval), (yyvsp[-3].strval), PARAM_INT, (void*)(yyvsp[-1].intval)) != 0) {
+			 yyerror("Can't set module parameter");
+		}
+	}
+#line 7685 "cfg.tab.c"
+    break;
+
+  case 407: /* module_stm: MODPARAM error  */
+#line 1690 "cfg.y"
+                         { yyerror("Invalid arguments"); }
+#line 7691 "cfg.tab.c"
+    break;
+
+  case 408: /* ip: ipv4  */
+#line 1693 "cfg.y"
+              { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 7697 "cfg.tab.c"
+    break;
+
+  case 409: /* ip: ipv6  */
+#line 1694 "cfg.y"
+                { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 7703 "cfg.tab.c"
+    break;
+
+  case 410: /* ipv4: NUMBER DOT NUMBER DOT NUMBER DOT NUMBER  */
+#line 1697 "cfg.y"
+                                                {
+		(yyval.ipaddr)=pkg_malloc(sizeof(struct ip_addr));
+		if ((yyval.ipaddr)==0) {
+			LOG(L_CRIT, "ERROR: cfg. parser: out of memory.\n");
+		} else {
+			memset((yyval.ipaddr), 0, sizeof(struct ip_addr));
+			(yyval.ipaddr)->af=AF_INET;
+			(yyval.ipaddr)->len=4;
+			if (((yyvsp[-6].intval)>255) || ((yyvsp[-6].intval)<0) ||
+				((yyvsp[-4].intval)>255) || ((yyvsp[-4].intval)<0) ||
+				((yyvsp[-2].intval)>255) || ((yyvsp[-2].intval)<0) ||
+				((yyvsp[0].intval)>255) || ((yyvsp[0].intval)<0)) {
+				yyerror("invalid ipv4 address");
+				(yyval.ipaddr)->u.addr32[0]=0;
+				/* $$=0; */
+			} else {
+				(yyval.ipaddr)->u.addr[0]=(yyvsp[-6].intval);
+				(yyval.ipaddr)->u.addr[1]=(yyvsp[-4].intval);
+				(yyval.ipaddr)->u.addr[2]=(yyvsp[-2].intval);
+				(yyval.ipaddr)->u.addr[3]=(yyvsp[0].intval);
+				/*
+				$$=htonl( ($1<<24)|
+				($3<<16)| ($5<<8)|$7 );
+				*/
+			}
+		}
+	}
+#line 7735 "cfg.tab.c"
+    break;
+
+  case 411: /* ipv6addr: IPV6ADDR  */
+#line 1726 "cfg.y"
+                 {
+		(yyval.ipaddr)=pkg_malloc(sizeof(struct ip_addr));
+		if ((yyval.ipaddr)==0) {
+			LOG(L_CRIT, "ERROR: cfg. parser: out of memory.\n");
+		} else {
+			memset((yyval.ipaddr), 0, sizeof(struct ip_addr));
+			(yyval.ipaddr)->af=AF_INET6;
+			(yyval.ipaddr)->len=16;
+			if (inet_pton(AF_INET6, (yyvsp[0].strval), (yyval.ipaddr)->u.addr)<=0) {
+				yyerror("bad ipv6 address");
+			}
+		}
+	}
+#line 7753 "cfg.tab.c"
+    break;
+
+  case 412: /* ipv6: ipv6addr  */
+#line 1741 "cfg.y"
+                 { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 7759 "cfg.tab.c"
+    break;
+
+  case 413: /* ipv6: LBRACK ipv6addr RBRACK  */
+#line 1742 "cfg.y"
+                                 {(yyval.ipaddr)=(yyvsp[-1].ipaddr); }
+#line 7765 "cfg.tab.c"
+    break;
+
+  case 414: /* route_name: NUMBER  */
+#line 1746 "cfg.y"
+                                {
+					tmp=int2str((yyvsp[0].intval), &i_tmp);
+					if (((yyval.strval)=pkg_malloc(i_tmp+1))==0) {
+						yyerror("out of  memory");
+						YYABORT;
+					} else {
+						memcpy((yyval.strval), tmp, i_tmp);
+						(yyval.strval)[i_tmp]=0;
+					}
+						}
+#line 7780 "cfg.tab.c"
+    break;
+
+  case 415: /* route_name: ID  */
+#line 1756 "cfg.y"
+                                                { (yyval.strval)=(yyvsp[0].strval); }
+#line 7786 "cfg.tab.c"
+    break;
+
+  case 416: /* route_name: STRING  */
+#line 1757 "cfg.y"
+                                        { (yyval.strval)=(yyvsp[0].strval); }
+#line 7792 "cfg.tab.c"
+    break;
+
+  case 417: /* route_main: ROUTE  */
+#line 1761 "cfg.y"
+                      { ; }
+#line 7798 "cfg.tab.c"
+    break;
+
+  case 418: /* route_main: ROUTE_REQUEST  */
+#line 1762 "cfg.y"
+                                  { ; }
+#line 7804 "cfg.tab.c"
+    break;
+
+  case 419: /* route_stm: route_main LBRACE actions RBRACE  */
+#line 1766 "cfg.y"
+                                         {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		push((yyvsp[-1].action), &main_rt.rlist[DEFAULT_RT]);
+	}
+#line 7818 "cfg.tab.c"
+    break;
+
+  case 420: /* route_stm: ROUTE LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1775 "cfg.y"
+                                                               {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		i_tmp=route_get(&main_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (main_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &main_rt.rlist[i_tmp]);
+	}
+#line 7841 "cfg.tab.c"
+    break;
+
+  case 421: /* route_stm: ROUTE error  */
+#line 1793 "cfg.y"
+                      { yyerror("invalid  route  statement"); }
+#line 7847 "cfg.tab.c"
+    break;
+
+  case 422: /* route_stm: ROUTE_REQUEST error  */
+#line 1794 "cfg.y"
+                              { yyerror("invalid  request_route  statement"); }
+#line 7853 "cfg.tab.c"
+    break;
+
+  case 423: /* failure_route_stm: ROUTE_FAILURE LBRACE actions RBRACE  */
+#line 1797 "cfg.y"
+                                            {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		push((yyvsp[-1].action), &failure_rt.rlist[DEFAULT_RT]);
+	}
+#line 7867 "cfg.tab.c"
+    break;
+
+  case 424: /* failure_route_stm: ROUTE_FAILURE LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1806 "cfg.y"
+                                                                       {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		i_tmp=route_get(&failure_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (failure_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &failure_rt.rlist[i_tmp]);
+	}
+#line 7890 "cfg.tab.c"
+    break;
+
+  case 425: /* failure_route_stm: ROUTE_FAILURE error  */
+#line 1824 "cfg.y"
+                              { yyerror("invalid failure_route statement"); }
+#line 7896 "cfg.tab.c"
+    break;
+
+  case 426: /* route_reply_main: ROUTE_ONREPLY  */
+#line 1828 "cfg.y"
+                                      { ; }
+#line 7902 "cfg.tab.c"
+    break;
+
+  case 427: /* route_reply_main: ROUTE_REPLY  */
+#line 1829 "cfg.y"
+                                { ; }
+#line 7908 "cfg.tab.c"
+    break;
+
+  case 428: /* $@6: %empty  */
+#line 1834 "cfg.y"
+                                {rt=CORE_ONREPLY_ROUTE;}
+#line 7914 "cfg.tab.c"
+    break;
+
+  case 429: /* onreply_route_stm: route_reply_main LBRACE $@6 actions RBRACE  */
+#line 1834 "cfg.y"
+                                                                        {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		push((yyvsp[-1].action), &onreply_rt.rlist[DEFAULT_RT]);
+	}
+#line 7928 "cfg.tab.c"
+    break;
+
+  case 430: /* onreply_route_stm: ROUTE_ONREPLY error  */
+#line 1843 "cfg.y"
+                              { yyerror("invalid onreply_route statement"); }
+#line 7934 "cfg.tab.c"
+    break;
+
+  case 431: /* onreply_route_stm: ROUTE_REPLY error  */
+#line 1844 "cfg.y"
+                            { yyerror("invalid onreply_route statement"); }
+#line 7940 "cfg.tab.c"
+    break;
+
+  case 432: /* $@7: %empty  */
+#line 1846 "cfg.y"
+                {rt=(*(yyvsp[-1].strval)=='0' && (yyvsp[-1].strval)[1]==0)?CORE_ONREPLY_ROUTE:TM_ONREPLY_ROUTE;}
+#line 7946 "cfg.tab.c"
+    break;
+
+  case 433: /* onreply_route_stm: ROUTE_ONREPLY LBRACK route_name RBRACK $@7 LBRACE actions RBRACE  */
+#line 1847 "cfg.y"
+                                      {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		if (*(yyvsp[-5].strval)=='0' && (yyvsp[-5].strval)[1]==0){
+			/* onreply_route[0] {} is equivalent with onreply_route {}*/
+			push((yyvsp[-1].action), &onreply_rt.rlist[DEFAULT_RT]);
+		}else{
+			i_tmp=route_get(&onreply_rt, (yyvsp[-5].strval));
+			if (i_tmp==-1){
+				yyerror("internal error");
+				YYABORT;
+			}
+			if (onreply_rt.rlist[i_tmp]){
+				yyerror("duplicate route");
+				YYABORT;
+			}
+			push((yyvsp[-1].action), &onreply_rt.rlist[i_tmp]);
+		}
+	}
+#line 7974 "cfg.tab.c"
+    break;
+
+  case 434: /* onreply_route_stm: ROUTE_ONREPLY LBRACK route_name RBRACK error  */
+#line 1870 "cfg.y"
+                                                       {
+		yyerror("invalid onreply_route statement");
+	}
+#line 7982 "cfg.tab.c"
+    break;
+
+  case 435: /* branch_route_stm: ROUTE_BRANCH LBRACE actions RBRACE  */
+#line 1875 "cfg.y"
+                                           {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		push((yyvsp[-1].action), &branch_rt.rlist[DEFAULT_RT]);
+	}
+#line 7996 "cfg.tab.c"
+    break;
+
+  case 436: /* branch_route_stm: ROUTE_BRANCH LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1884 "cfg.y"
+                                                                      {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		i_tmp=route_get(&branch_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (branch_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &branch_rt.rlist[i_tmp]);
+	}
+#line 8019 "cfg.tab.c"
+    break;
+
+  case 437: /* branch_route_stm: ROUTE_BRANCH error  */
+#line 1902 "cfg.y"
+                             { yyerror("invalid branch_route statement"); }
+#line 8025 "cfg.tab.c"
+    break;
+
+  case 438: /* send_route_stm: ROUTE_SEND LBRACE actions RBRACE  */
+#line 1904 "cfg.y"
+                                                 {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		push((yyvsp[-1].action), &onsend_rt.rlist[DEFAULT_RT]);
+	}
+#line 8039 "cfg.tab.c"
+    break;
+
+  case 439: /* send_route_stm: ROUTE_SEND LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 1913 "cfg.y"
+                                                                    {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		i_tmp=route_get(&onsend_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (onsend_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &onsend_rt.rlist[i_tmp]);
+	}
+#line 8062 "cfg.tab.c"
+    break;
+
+  case 440: /* send_route_stm: ROUTE_SEND error  */
+#line 1931 "cfg.y"
+                           { yyerror("invalid onsend_route statement"); }
+#line 8068 "cfg.tab.c"
+    break;
+
+  case 441: /* event_route_stm: ROUTE_EVENT LBRACK EVENT_RT_NAME RBRACK LBRACE actions RBRACE  */
+#line 1933 "cfg.y"
+                                                                               {
+	#ifdef SHM_MEM
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+	#endif /* SHM_MEM */
+		i_tmp=route_get(&event_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (event_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &event_rt.rlist[i_tmp]);
+	}
+#line 8091 "cfg.tab.c"
+    break;
+
+  case 442: /* event_route_stm: ROUTE_EVENT error  */
+#line 1952 "cfg.y"
+                            { yyerror("invalid event_route statement"); }
+#line 8097 "cfg.tab.c"
+    break;
+
+  case 443: /* preprocess_stm: SUBST STRING  */
+#line 1955 "cfg.y"
+                     { if(pp_subst_add((yyvsp[0].strval))<0) YYERROR; }
+#line 8103 "cfg.tab.c"
+    break;
+
+  case 444: /* preprocess_stm: SUBST error  */
+#line 1956 "cfg.y"
+                      { yyerror("invalid subst preprocess statement"); }
+#line 8109 "cfg.tab.c"
+    break;
+
+  case 445: /* preprocess_stm: SUBSTDEF STRING  */
+#line 1957 "cfg.y"
+                          { if(pp_substdef_add((yyvsp[0].strval), 0)<0) YYERROR; }
+#line 8115 "cfg.tab.c"
+    break;
+
+  case 446: /* preprocess_stm: SUBSTDEF error  */
+#line 1958 "cfg.y"
+                         { yyerror("invalid substdef preprocess statement"); }
+#line 8121 "cfg.tab.c"
+    break;
+
+  case 447: /* preprocess_stm: SUBSTDEFS STRING  */
+#line 1959 "cfg.y"
+                           { if(pp_substdef_add((yyvsp[0].strval), 1)<0) YYERROR; }
+#line 8127 "cfg.tab.c"
+    break;
+
+  case 448: /* preprocess_stm: SUBSTDEFS error  */
+#line 1960 "cfg.y"
+                          { yyerror("invalid substdefs preprocess statement"); }
+#line 8133 "cfg.tab.c"
+    break;
+
+  case 449: /* equalop: EQUAL_T  */
+#line 1982 "cfg.y"
+                {(yyval.intval)=EQUAL_OP; }
+#line 8139 "cfg.tab.c"
+    break;
+
+  case 450: /* equalop: DIFF  */
+#line 1983 "cfg.y"
+                {(yyval.intval)=DIFF_OP; }
+#line 8145 "cfg.tab.c"
+    break;
+
+  case 451: /* equalop: STREQ  */
+#line 1984 "cfg.y"
+                {(yyval.intval)=EQUAL_OP; }
+#line 8151 "cfg.tab.c"
+    break;
+
+  case 452: /* equalop: STRDIFF  */
+#line 1985 "cfg.y"
+                  {(yyval.intval)=DIFF_OP; }
+#line 8157 "cfg.tab.c"
+    break;
+
+  case 453: /* cmpop: GT  */
+#line 1988 "cfg.y"
+                {(yyval.intval)=GT_OP; }
+#line 8163 "cfg.tab.c"
+    break;
+
+  case 454: /* cmpop: LT  */
+#line 1989 "cfg.y"
+                {(yyval.intval)=LT_OP; }
+#line 8169 "cfg.tab.c"
+    break;
+
+  case 455: /* cmpop: GTE  */
+#line 1990 "cfg.y"
+                {(yyval.intval)=GTE_OP; }
+#line 8175 "cfg.tab.c"
+    break;
+
+  case 456: /* cmpop: LTE  */
+#line 1991 "cfg.y"
+                {(yyval.intval)=LTE_OP; }
+#line 8181 "cfg.tab.c"
+    break;
+
+  case 457: /* strop: equalop  */
+#line 1994 "cfg.y"
+                {(yyval.intval)=(yyvsp[0].intval); }
+#line 8187 "cfg.tab.c"
+    break;
+
+  case 458: /* strop: MATCH  */
+#line 1995 "cfg.y"
+                {(yyval.intval)=MATCH_OP; }
+#line 8193 "cfg.tab.c"
+    break;
+
+  case 459: /* rve_equalop: EQUAL_T  */
+#line 2001 "cfg.y"
+                {(yyval.intval)=RVE_EQ_OP; }
+#line 8199 "cfg.tab.c"
+    break;
+
+  case 460: /* rve_equalop: DIFF  */
+#line 2002 "cfg.y"
+                {(yyval.intval)=RVE_DIFF_OP; }
+#line 8205 "cfg.tab.c"
+    break;
+
+  case 461: /* rve_equalop: INTEQ  */
+#line 2003 "cfg.y"
+                {(yyval.intval)=RVE_IEQ_OP; }
+#line 8211 "cfg.tab.c"
+    break;
+
+  case 462: /* rve_equalop: INTDIFF  */
+#line 2004 "cfg.y"
+                  {(yyval.intval)=RVE_IDIFF_OP; }
+#line 8217 "cfg.tab.c"
+    break;
+
+  case 463: /* rve_equalop: STREQ  */
+#line 2005 "cfg.y"
+                {(yyval.intval)=RVE_STREQ_OP; }
+#line 8223 "cfg.tab.c"
+    break;
+
+  case 464: /* rve_equalop: STRDIFF  */
+#line 2006 "cfg.y"
+                  {(yyval.intval)=RVE_STRDIFF_OP; }
+#line 8229 "cfg.tab.c"
+    break;
+
+  case 465: /* rve_equalop: MATCH  */
+#line 2007 "cfg.y"
+                {(yyval.intval)=RVE_MATCH_OP; }
+#line 8235 "cfg.tab.c"
+    break;
+
+  case 466: /* rve_cmpop: GT  */
+#line 2010 "cfg.y"
+                {(yyval.intval)=RVE_GT_OP; }
+#line 8241 "cfg.tab.c"
+    break;
+
+  case 467: /* rve_cmpop: LT  */
+#line 2011 "cfg.y"
+                {(yyval.intval)=RVE_LT_OP; }
+#line 8247 "cfg.tab.c"
+    break;
+
+  case 468: /* rve_cmpop: GTE  */
+#line 2012 "cfg.y"
+                {(yyval.intval)=RVE_GTE_OP; }
+#line 8253 "cfg.tab.c"
+    break;
+
+  case 469: /* rve_cmpop: LTE  */
+#line 2013 "cfg.y"
+                {(yyval.intval)=RVE_LTE_OP; }
+#line 8259 "cfg.tab.c"
+    break;
+
+  case 470: /* uri_type: URI  */
+#line 2020 "cfg.y"
+                        {(yyval.intval)=URI_O;}
+#line 8265 "cfg.tab.c"
+    break;
+
+  case 471: /* uri_type: FROM_URI  */
+#line 2021 "cfg.y"
+                        {(yyval.intval)=FROM_URI_O;}
+#line 8271 "cfg.tab.c"
+    break;
+
+  case 472: /* uri_type: TO_URI  */
+#line 2022 "cfg.y"
+                        {(yyval.intval)=TO_URI_O;}
+#line 8277 "cfg.tab.c"
+    break;
+
+  case 473: /* eint_op_onsend: SNDPORT  */
+#line 2029 "cfg.y"
+                                        { (yyval.intval)=SNDPORT_O; }
+#line 8283 "cfg.tab.c"
+    break;
+
+  case 474: /* eint_op_onsend: TOPORT  */
+#line 2030 "cfg.y"
+                                        { (yyval.intval)=TOPORT_O; }
+#line 8289 "cfg.tab.c"
+    break;
+
+  case 475: /* eint_op_onsend: SNDAF  */
+#line 2031 "cfg.y"
+                                        { (yyval.intval)=SNDAF_O; }
+#line 8295 "cfg.tab.c"
+    break;
+
+  case 476: /* eint_op: SRCPORT  */
+#line 2035 "cfg.y"
+                                { (yyval.intval)=SRCPORT_O; }
+#line 8301 "cfg.tab.c"
+    break;
+
+  case 477: /* eint_op: DSTPORT  */
+#line 2036 "cfg.y"
+                                        { (yyval.intval)=DSTPORT_O; }
+#line 8307 "cfg.tab.c"
+    break;
+
+  case 478: /* eint_op: AF  */
+#line 2037 "cfg.y"
+                                                { (yyval.intval)=AF_O; }
+#line 8313 "cfg.tab.c"
+    break;
+
+  case 479: /* eint_op: MSGLEN  */
+#line 2038 "cfg.y"
+                                        { (yyval.intval)=MSGLEN_O; }
+#line 8319 "cfg.tab.c"
+    break;
+
+  case 481: /* eip_op_onsend: SNDIP  */
+#line 2044 "cfg.y"
+                                        { onsend_check("snd_ip"); (yyval.intval)=SNDIP_O; }
+#line 8325 "cfg.tab.c"
+    break;
+
+  case 482: /* eip_op_onsend: TOIP  */
+#line 2045 "cfg.y"
+                                        { onsend_check("to_ip");  (yyval.intval)=TOIP_O; }
+#line 8331 "cfg.tab.c"
+    break;
+
+  case 483: /* eip_op: SRCIP  */
+#line 2048 "cfg.y"
+                                { (yyval.intval)=SRCIP_O; }
+#line 8337 "cfg.tab.c"
+    break;
+
+  case 484: /* eip_op: DSTIP  */
+#line 2049 "cfg.y"
+                                        { (yyval.intval)=DSTIP_O; }
+#line 8343 "cfg.tab.c"
+    break;
+
+  case 486: /* exp_elem: METHOD strop rval_expr  */
+#line 2057 "cfg.y"
+                {(yyval.expr)= mk_elem((yyvsp[-1].intval), METHOD_O, 0, RVE_ST, (yyvsp[0].rv_expr));}
+#line 8349 "cfg.tab.c"
+    break;
+
+  case 487: /* exp_elem: METHOD strop ID  */
+#line 2059 "cfg.y"
+                {(yyval.expr) = mk_elem((yyvsp[-1].intval), METHOD_O, 0, STRING_ST,(yyvsp[0].strval)); }
+#line 8355 "cfg.tab.c"
+    break;
+
+  case 488: /* exp_elem: METHOD strop error  */
+#line 2060 "cfg.y"
+                             { (yyval.expr)=0; yyerror("string expected"); }
+#line 8361 "cfg.tab.c"
+    break;
+
+  case 489: /* exp_elem: METHOD error  */
+#line 2062 "cfg.y"
+                { (yyval.expr)=0; yyerror("invalid operator,== , !=, or =~ expected"); }
+#line 8367 "cfg.tab.c"
+    break;
+
+  case 490: /* exp_elem: uri_type strop rval_expr  */
+#line 2064 "cfg.y"
+                {(yyval.expr) = mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr)); }
+#line 8373 "cfg.tab.c"
+    break;
+
+  case 491: /* exp_elem: uri_type strop MYSELF  */
+#line 2066 "cfg.y"
+                {(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, MYSELF_ST, 0); }
+#line 8379 "cfg.tab.c"
+    break;
+
+  case 492: /* exp_elem: uri_type strop error  */
+#line 2068 "cfg.y"
+                { (yyval.expr)=0; yyerror("string or MYSELF expected"); }
+#line 8385 "cfg.tab.c"
+    break;
+
+  case 493: /* exp_elem: uri_type error  */
+#line 2070 "cfg.y"
+                { (yyval.expr)=0; yyerror("invalid operator, == , != or =~ expected"); }
+#line 8391 "cfg.tab.c"
+    break;
+
+  case 494: /* exp_elem: eint_op cmpop rval_expr  */
+#line 2071 "cfg.y"
+                                           { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 8397 "cfg.tab.c"
+    break;
+
+  case 495: /* exp_elem: eint_op equalop rval_expr  */
+#line 2073 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 8403 "cfg.tab.c"
+    break;
+
+  case 496: /* exp_elem: eint_op cmpop error  */
+#line 2074 "cfg.y"
+                                { (yyval.expr)=0; yyerror("number expected"); }
+#line 8409 "cfg.tab.c"
+    break;
+
+  case 497: /* exp_elem: eint_op equalop error  */
+#line 2075 "cfg.y"
+                                { (yyval.expr)=0; yyerror("number expected"); }
+#line 8415 "cfg.tab.c"
+    break;
+
+  case 498: /* exp_elem: eint_op error  */
+#line 2076 "cfg.y"
+                        { (yyval.expr)=0; yyerror("==, !=, <,>, >= or <=  expected"); }
+#line 8421 "cfg.tab.c"
+    break;
+
+  case 499: /* exp_elem: PROTO equalop eqproto  */
+#line 2078 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), PROTO_O, 0, NUMBER_ST, (void*)(yyvsp[0].intval) ); }
+#line 8427 "cfg.tab.c"
+    break;
+
+  case 500: /* exp_elem: PROTO equalop rval_expr  */
+#line 2080 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), PROTO_O, 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 8433 "cfg.tab.c"
+    break;
+
+  case 501: /* exp_elem: PROTO equalop error  */
+#line 2082 "cfg.y"
+                { (yyval.expr)=0; yyerror("protocol expected (udp, tcp, tls, sctp, ws, or wss)"); }
+#line 8439 "cfg.tab.c"
+    break;
+
+  case 502: /* exp_elem: SNDPROTO equalop eqproto  */
+#line 2084 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), SNDPROTO_O, 0, NUMBER_ST, (void*)(yyvsp[0].intval) ); }
+#line 8445 "cfg.tab.c"
+    break;
+
+  case 503: /* exp_elem: SNDPROTO equalop rval_expr  */
+#line 2086 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), SNDPROTO_O, 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 8451 "cfg.tab.c"
+    break;
+
+  case 504: /* exp_elem: SNDPROTO equalop error  */
+#line 2088 "cfg.y"
+                { (yyval.expr)=0; yyerror("protocol expected (udp, tcp, tls, sctp, ws, or wss)"); }
+#line 8457 "cfg.tab.c"
+    break;
+
+  case 505: /* exp_elem: eip_op strop ipnet  */
+#line 2089 "cfg.y"
+                                           { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, NET_ST, (yyvsp[0].ipnet)); }
+#line 8463 "cfg.tab.c"
+    break;
+
+  case 506: /* exp_elem: eip_op strop rval_expr  */
+#line 2090 "cfg.y"
+                                               {
+			s_tmp.s=0;
+			(yyval.expr)=0;
+			if (rve_is_constant((yyvsp[0].rv_expr))){
+				i_tmp=rve_guess_type((yyvsp[0].rv_expr));
+				if (i_tmp==RV_INT)
+					yyerror("string expected");
+				else if (i_tmp==RV_STR){
+					if (((rval_tmp=rval_expr_eval(0, 0, (yyvsp[0].rv_expr)))==0) ||
+								(rval_get_str(0, 0, &s_tmp, rval_tmp, 0)<0)){
+						rval_destroy(rval_tmp);
+						yyerror("bad rvalue expression");
+					}else{
+						rval_destroy(rval_tmp);
+					}
+				}else{
+					yyerror("BUG: unexpected dynamic type");
+				}
+			}else{
+					/* warn("non constant rvalue in ip comparison") */;
+			}
+			if (s_tmp.s){
+				ip_tmp=str2ip(&s_tmp);
+				if (ip_tmp==0)
+					ip_tmp=str2ip6(&s_tmp);
+				pkg_free(s_tmp.s);
+				if (ip_tmp) {
+					(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, NET_ST, 
+								mk_new_net_bitlen(ip_tmp, ip_tmp->len*8) );
+				} else {
+					(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr));
+				}
+			}else{
+				(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr));
+			}
+		}
+#line 8504 "cfg.tab.c"
+    break;
+
+  case 507: /* exp_elem: eip_op strop host  */
+#line 2127 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, STRING_ST, (yyvsp[0].strval)); }
+#line 8510 "cfg.tab.c"
+    break;
+
+  case 508: /* exp_elem: eip_op strop MYSELF  */
+#line 2129 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, MYSELF_ST, 0); }
+#line 8516 "cfg.tab.c"
+    break;
+
+  case 509: /* exp_elem: eip_op strop error  */
+#line 2131 "cfg.y"
+                { (yyval.expr)=0; yyerror( "ip address or hostname expected" ); }
+#line 8522 "cfg.tab.c"
+    break;
+
+  case 510: /* exp_elem: eip_op error  */
+#line 2133 "cfg.y"
+                { (yyval.expr)=0; yyerror("invalid operator, ==, != or =~ expected");}
+#line 8528 "cfg.tab.c"
+    break;
+
+  case 511: /* exp_elem: MYSELF equalop uri_type  */
+#line 2136 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[0].intval), 0, MYSELF_ST, 0); }
+#line 8534 "cfg.tab.c"
+    break;
+
+  case 512: /* exp_elem: MYSELF equalop eip_op  */
+#line 2138 "cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[0].intval), 0, MYSELF_ST, 0); }
+#line 8540 "cfg.tab.c"
+    break;
+
+  case 513: /* exp_elem: MYSELF equalop error  */
+#line 2140 "cfg.y"
+                { (yyval.expr)=0; yyerror(" URI, SRCIP or DSTIP expected"); }
+#line 8546 "cfg.tab.c"
+    break;
+
+  case 514: /* exp_elem: MYSELF error  */
+#line 2141 "cfg.y"
+                        { (yyval.expr)=0; yyerror ("invalid operator, == or != expected"); }
+#line 8552 "cfg.tab.c"
+    break;
+
+  case 515: /* ipnet: ip SLASH ip  */
+#line 2158 "cfg.y"
+                        { (yyval.ipnet)=mk_new_net((yyvsp[-2].ipaddr), (yyvsp[0].ipaddr)); }
+#line 8558 "cfg.tab.c"
+    break;
+
+  case 516: /* ipnet: ip SLASH NUMBER  */
+#line 2159 "cfg.y"
+                          {
+		if (((yyvsp[0].intval)<0) || ((yyvsp[0].intval)>(yyvsp[-2].ipaddr)->len*8)) {
+			yyerror("invalid bit number in netmask");
+			(yyval.ipnet)=0;
+		} else {
+			(yyval.ipnet)=mk_new_net_bitlen((yyvsp[-2].ipaddr), (yyvsp[0].intval));
+		/*
+			$$=mk_new_net($1, htonl( ($3)?~( (1<<(32-$3))-1 ):0 ) );
+		*/
+		}
+	}
+#line 8574 "cfg.tab.c"
+    break;
+
+  case 517: /* ipnet: ip  */
+#line 2170 "cfg.y"
+                { (yyval.ipnet)=mk_new_net_bitlen((yyvsp[0].ipaddr), (yyvsp[0].ipaddr)->len*8); }
+#line 8580 "cfg.tab.c"
+    break;
+
+  case 518: /* ipnet: ip SLASH error  */
+#line 2171 "cfg.y"
+                         { (yyval.ipnet)=0; yyerror("netmask (eg:255.0.0.0 or 8) expected"); }
+#line 8586 "cfg.tab.c"
+    break;
+
+  case 519: /* host: ID  */
+#line 2175 "cfg.y"
+           { (yyval.strval)=(yyvsp[0].strval); }
+#line 8592 "cfg.tab.c"
+    break;
+
+  case 520: /* host: host DOT ID  */
+#line 2176 "cfg.y"
+                      {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				LOG(L_CRIT, "ERROR: cfg. parser: memory allocation"
+							" failure while parsing host\n");
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='.';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 8613 "cfg.tab.c"
+    break;
+
+  case 521: /* host: host MINUS ID  */
+#line 2192 "cfg.y"
+                        {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				LOG(L_CRIT, "ERROR: cfg. parser: memory allocation"
+							" failure while parsing host\n");
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='-';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 8634 "cfg.tab.c"
+    break;
+
+  case 522: /* host: host DOT error  */
+#line 2208 "cfg.y"
+                         { (yyval.strval)=0; pkg_free((yyvsp[-2].strval)); yyerror("invalid hostname"); }
+#line 8640 "cfg.tab.c"
+    break;
+
+  case 523: /* host: host MINUS error  */
+#line 2209 "cfg.y"
+                           { (yyval.strval)=0; pkg_free((yyvsp[-2].strval)); yyerror("invalid hostname"); }
+#line 8646 "cfg.tab.c"
+    break;
+
+  case 526: /* host_if_id: NUMBER  */
+#line 2214 "cfg.y"
+                         {
+			/* get string version */
+			(yyval.strval)=pkg_malloc(strlen(yy_number_str)+1);
+			if ((yyval.strval))
+				strcpy((yyval.strval), yy_number_str);
+		}
+#line 8657 "cfg.tab.c"
+    break;
+
+  case 527: /* host_or_if: host_if_id  */
+#line 2223 "cfg.y"
+                   { (yyval.strval)=(yyvsp[0].strval); }
+#line 8663 "cfg.tab.c"
+    break;
+
+  case 528: /* host_or_if: host_or_if DOT host_if_id  */
+#line 2224 "cfg.y"
+                                    {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				LOG(L_CRIT, "ERROR: cfg. parser: memory allocation"
+							" failure while parsing host/interface name\n");
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='.';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 8684 "cfg.tab.c"
+    break;
+
+  case 529: /* host_or_if: host_or_if MINUS host_if_id  */
+#line 2240 "cfg.y"
+                                      {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				LOG(L_CRIT, "ERROR: cfg. parser: memory allocation"
+							" failure while parsing host/interface name\n");
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='-';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 8705 "cfg.tab.c"
+    break;
+
+  case 530: /* host_or_if: host_or_if DOT error  */
+#line 2256 "cfg.y"
+                               { (yyval.strval)=0; pkg_free((yyvsp[-2].strval));
+								yyerror("invalid host or interface name"); }
+#line 8712 "cfg.tab.c"
+    break;
+
+  case 531: /* host_or_if: host_or_if MINUS error  */
+#line 2258 "cfg.y"
+                                 { (yyval.strval)=0; pkg_free((yyvsp[-2].strval));
+								yyerror("invalid host or interface name"); }
+#line 8719 "cfg.tab.c"
+    break;
+
+  case 532: /* fcmd: cmd  */
+#line 2265 "cfg.y"
+            {
+		/* check if allowed */
+		if ((yyvsp[0].action) && rt==ONSEND_ROUTE) {
+			switch((yyvsp[0].action)->type) {
+				case DROP_T:
+				case LOG_T:
+				case SETFLAG_T:
+				case RESETFLAG_T:
+				case ISFLAGSET_T:
+				case IF_T:
+				case MODULE0_T:
+				case MODULE1_T:
+				case MODULE2_T:
+				case MODULE3_T:
+				case MODULE4_T:
+				case MODULE5_T:
+				case MODULE6_T:
+				case MODULEX_T:
+				case SET_FWD_NO_CONNECT_T:
+				case SET_RPL_NO_CONNECT_T:
+				case SET_FWD_CLOSE_T:
+				case SET_RPL_CLOSE_T:
+					(yyval.action)=(yyvsp[0].action);
+					break;
+				default:
+					(yyval.action)=0;
+					yyerror("command not allowed in onsend_route\n");
+			}
+		} else {
+			(yyval.action)=(yyvsp[0].action);
+		}
+	}
+#line 8756 "cfg.tab.c"
+    break;
+
+  case 533: /* stm: action  */
+#line 2307 "cfg.y"
+                { (yyval.action)=(yyvsp[0].action); }
+#line 8762 "cfg.tab.c"
+    break;
+
+  case 534: /* stm: LBRACE actions RBRACE  */
+#line 2308 "cfg.y"
+                                { (yyval.action)=(yyvsp[-1].action); }
+#line 8768 "cfg.tab.c"
+    break;
+
+  case 535: /* actions: actions action  */
+#line 2311 "cfg.y"
+                        {(yyval.action)=append_action((yyvsp[-1].action), (yyvsp[0].action)); }
+#line 8774 "cfg.tab.c"
+    break;
+
+  case 536: /* actions: action  */
+#line 2312 "cfg.y"
+                        {(yyval.action)=(yyvsp[0].action);}
+#line 8780 "cfg.tab.c"
+    break;
+
+  case 537: /* actions: actions error  */
+#line 2313 "cfg.y"
+                        { (yyval.action)=0; yyerror("bad command"); }
+#line 8786 "cfg.tab.c"
+    break;
+
+  case 538: /* action: fcmd SEMICOLON  */
+#line 2316 "cfg.y"
+                       {(yyval.action)=(yyvsp[-1].action);}
+#line 8792 "cfg.tab.c"
+    break;
+
+  case 539: /* action: if_cmd  */
+#line 2317 "cfg.y"
+                 {(yyval.action)=(yyvsp[0].action);}
+#line 8798 "cfg.tab.c"
+    break;
+
+  case 540: /* action: switch_cmd  */
+#line 2318 "cfg.y"
+                     {(yyval.action)=(yyvsp[0].action);}
+#line 8804 "cfg.tab.c"
+    break;
+
+  case 541: /* action: while_cmd  */
+#line 2319 "cfg.y"
+                    { (yyval.action)=(yyvsp[0].action); }
+#line 8810 "cfg.tab.c"
+    break;
+
+  case 542: /* action: ret_cmd SEMICOLON  */
+#line 2320 "cfg.y"
+                            { (yyval.action)=(yyvsp[-1].action); }
+#line 8816 "cfg.tab.c"
+    break;
+
+  case 543: /* action: assign_action SEMICOLON  */
+#line 2321 "cfg.y"
+                                  {(yyval.action)=(yyvsp[-1].action);}
+#line 8822 "cfg.tab.c"
+    break;
+
+  case 544: /* action: SEMICOLON  */
+#line 2322 "cfg.y"
+                                      {(yyval.action)=0;}
+#line 8828 "cfg.tab.c"
+    break;
+
+  case 545: /* action: fcmd error  */
+#line 2323 "cfg.y"
+                     { (yyval.action)=0; yyerror("bad command: missing ';'?"); }
+#line 8834 "cfg.tab.c"
+    break;
+
+  case 546: /* if_cmd: IF rval_expr stm  */
+#line 2326 "cfg.y"
+                                {
+		if ((yyvsp[-1].rv_expr) && rval_expr_int_check((yyvsp[-1].rv_expr))>=0){
+			warn_ct_rve((yyvsp[-1].rv_expr), "if");
+			(yyval.action)=mk_action( IF_T, 3, RVE_ST, (yyvsp[-1].rv_expr), ACTIONS_ST, (yyvsp[0].action), NOSUBTYPE, 0);
+			set_cfg_pos((yyval.action));
+		}else
+			YYERROR;
+	}
+#line 8847 "cfg.tab.c"
+    break;
+
+  case 547: /* if_cmd: IF rval_expr stm ELSE stm  */
+#line 2334 "cfg.y"
+                                        { 
+		if ((yyvsp[-3].rv_expr) && rval_expr_int_check((yyvsp[-3].rv_expr))>=0){
+			warn_ct_rve((yyvsp[-3].rv_expr), "if");
+			(yyval.action)=mk_action( IF_T, 3, RVE_ST, (yyvsp[-3].rv_expr), ACTIONS_ST, (yyvsp[-2].action), ACTIONS_ST, (yyvsp[0].action));
+			set_cfg_pos((yyval.action));
+		}else
+			YYERROR;
+	}
+#line 8860 "cfg.tab.c"
+    break;
+
+  case 548: /* ct_rval: rval_expr  */
+#line 2344 "cfg.y"
+                   {
+			(yyval.rv_expr)=0;
+			if ((yyvsp[0].rv_expr) && !rve_is_constant((yyvsp[0].rv_expr))){
+				yyerror("constant expected");
+				YYERROR;
+			/*
+			} else if ($1 &&
+						!rve_check_type((enum rval_type*)&i_tmp, $1, 0, 0 ,0)){
+				yyerror("invalid expression (bad type)");
+			}else if ($1 && i_tmp!=RV_INT){
+				yyerror("invalid expression type, int expected\n");
+			*/
+			}else
+				(yyval.rv_expr)=(yyvsp[0].rv_expr);
+		}
+#line 8880 "cfg.tab.c"
+    break;
+
+  case 549: /* single_case: CASE ct_rval COLON actions  */
+#line 2361 "cfg.y"
+                                   {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-2].rv_expr)==0) { yyerror ("bad case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-2].rv_expr), 0, (yyvsp[0].action), &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 8892 "cfg.tab.c"
+    break;
+
+  case 550: /* single_case: CASE SLASH ct_rval COLON actions  */
+#line 2368 "cfg.y"
+                                   {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-2].rv_expr)==0) { yyerror ("bad case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-2].rv_expr), 1, (yyvsp[0].action), &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 8904 "cfg.tab.c"
+    break;
+
+  case 551: /* single_case: CASE ct_rval COLON  */
+#line 2375 "cfg.y"
+                             {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-1].rv_expr)==0) { yyerror ("bad case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-1].rv_expr), 0, 0, &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 8916 "cfg.tab.c"
+    break;
+
+  case 552: /* single_case: CASE SLASH ct_rval COLON  */
+#line 2382 "cfg.y"
+                                   {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-1].rv_expr)==0) { yyerror ("bad regex case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-1].rv_expr), 1, 0, &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 8928 "cfg.tab.c"
+    break;
+
+  case 553: /* single_case: DEFAULT COLON actions  */
+#line 2389 "cfg.y"
+                                {
+		if ((((yyval.case_stms)=mk_case_stm(0, 0, (yyvsp[0].action), &i_tmp))==0) && (i_tmp=-10)){
+				YYABORT;
+		}
+	}
+#line 8938 "cfg.tab.c"
+    break;
+
+  case 554: /* single_case: DEFAULT COLON  */
+#line 2394 "cfg.y"
+                        {
+		if ((((yyval.case_stms)=mk_case_stm(0, 0, 0, &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 8948 "cfg.tab.c"
+    break;
+
+  case 555: /* single_case: CASE error COLON actions  */
+#line 2399 "cfg.y"
+                                   { (yyval.case_stms)=0; yyerror("bad case label"); }
+#line 8954 "cfg.tab.c"
+    break;
+
+  case 556: /* single_case: CASE SLASH error COLON actions  */
+#line 2400 "cfg.y"
+                                         { (yyval.case_stms)=0; yyerror("bad case regex label"); }
+#line 8960 "cfg.tab.c"
+    break;
+
+  case 557: /* single_case: CASE error COLON  */
+#line 2401 "cfg.y"
+                           { (yyval.case_stms)=0; yyerror("bad case label"); }
+#line 8966 "cfg.tab.c"
+    break;
+
+  case 558: /* single_case: CASE SLASH error COLON  */
+#line 2402 "cfg.y"
+                                 { (yyval.case_stms)=0; yyerror("bad case regex label"); }
+#line 8972 "cfg.tab.c"
+    break;
+
+  case 559: /* single_case: CASE ct_rval COLON error  */
+#line 2403 "cfg.y"
+                                   { (yyval.case_stms)=0; yyerror ("bad case body"); }
+#line 8978 "cfg.tab.c"
+    break;
+
+  case 560: /* case_stms: case_stms single_case  */
+#line 2406 "cfg.y"
+                              {
+		(yyval.case_stms)=(yyvsp[-1].case_stms);
+		if ((yyvsp[0].case_stms)==0) yyerror ("bad case");
+		if ((yyval.case_stms)){
+			*((yyval.case_stms)->append)=(yyvsp[0].case_stms);
+			if (*((yyval.case_stms)->append)!=0)
+				(yyval.case_stms)->append=&((*((yyval.case_stms)->append))->next);
+		}
+	}
+#line 8992 "cfg.tab.c"
+    break;
+
+  case 561: /* case_stms: single_case  */
+#line 2415 "cfg.y"
+                      {
+		(yyval.case_stms)=(yyvsp[0].case_stms);
+		if ((yyvsp[0].case_stms)==0) yyerror ("bad case");
+		else (yyval.case_stms)->append=&((yyval.case_stms)->next);
+	}
+#line 9002 "cfg.tab.c"
+    break;
+
+  case 562: /* switch_cmd: SWITCH rval_expr LBRACE case_stms RBRACE  */
+#line 2422 "cfg.y"
+                                                   { 
+		(yyval.action)=0;
+		if ((yyvsp[-3].rv_expr)==0){
+			yyerror("bad expression in switch(...)");
+			YYERROR;
+		}else if ((yyvsp[-1].case_stms)==0){
+			yyerror ("bad switch body");
+			YYERROR;
+		}else if (case_check_default((yyvsp[-1].case_stms))!=0){
+			yyerror_at(&(yyvsp[-3].rv_expr)->fpos, "bad switch(): too many "
+							"\"default:\" labels\n");
+			YYERROR;
+		}else if (case_check_type((yyvsp[-1].case_stms))!=0){
+			yyerror_at(&(yyvsp[-3].rv_expr)->fpos, "bad switch(): mixed integer and"
+							" string/RE cases not allowed\n");
+			YYERROR;
+		}else{
+			(yyval.action)=mk_action(SWITCH_T, 2, RVE_ST, (yyvsp[-3].rv_expr), CASE_ST, (yyvsp[-1].case_stms));
+			if ((yyval.action)==0) {
+				yyerror("internal error");
+				YYABORT;
+			}
+			set_cfg_pos((yyval.action));
+		}
+	}
+#line 9032 "cfg.tab.c"
+    break;
+
+  case 563: /* switch_cmd: SWITCH rval_expr LBRACE RBRACE  */
+#line 2447 "cfg.y"
+                                         {
+		(yyval.action)=0;
+		warn("empty switch()");
+		if ((yyvsp[-2].rv_expr)==0){
+			yyerror("bad expression in switch(...)");
+			YYERROR;
+		}else{
+			/* it might have sideffects, so leave it for the optimizer */
+			(yyval.action)=mk_action(SWITCH_T, 2, RVE_ST, (yyvsp[-2].rv_expr), CASE_ST, 0);
+			if ((yyval.action)==0) {
+				yyerror("internal error");
+				YYABORT;
+			}
+			set_cfg_pos((yyval.action));
+		}
+	}
+#line 9053 "cfg.tab.c"
+    break;
+
+  case 564: /* switch_cmd: SWITCH error  */
+#line 2463 "cfg.y"
+                       { (yyval.action)=0; yyerror ("bad expression in switch(...)"); }
+#line 9059 "cfg.tab.c"
+    break;
+
+  case 565: /* switch_cmd: SWITCH rval_expr LBRACE error RBRACE  */
+#line 2465 "cfg.y"
+                {(yyval.action)=0; yyerror ("bad switch body"); }
+#line 9065 "cfg.tab.c"
+    break;
+
+  case 566: /* while_cmd: WHILE rval_expr stm  */
+#line 2469 "cfg.y"
+                            {
+		if ((yyvsp[-1].rv_expr) && rval_expr_int_check((yyvsp[-1].rv_expr))>=0){
+			warn_ct_rve((yyvsp[-1].rv_expr), "while");
+			(yyval.action)=mk_action( WHILE_T, 2, RVE_ST, (yyvsp[-1].rv_expr), ACTIONS_ST, (yyvsp[0].action));
+			set_cfg_pos((yyval.action));
+		}else{
+			yyerror_at(&(yyvsp[-1].rv_expr)->fpos, "bad while(...) expression");
+			YYERROR;
+		}
+	}
+#line 9080 "cfg.tab.c"
+    break;
+
+  case 567: /* select_param: ID  */
+#line 2488 "cfg.y"
+           {
+		if (sel.n >= MAX_SELECT_PARAMS-1) {
+			yyerror("Select identifier too long\n");
+		}
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[0].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[0].strval));
+		sel.n++;
+	}
+#line 9094 "cfg.tab.c"
+    break;
+
+  case 568: /* select_param: ID LBRACK intno RBRACK  */
+#line 2497 "cfg.y"
+                                 {
+		if (sel.n >= MAX_SELECT_PARAMS-2) {
+			yyerror("Select identifier too long\n");
+		}
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[-3].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[-3].strval));
+		sel.n++;
+		sel.params[sel.n].type = SEL_PARAM_INT;
+		sel.params[sel.n].v.i = (yyvsp[-1].intval);
+		sel.n++;
+	}
+#line 9111 "cfg.tab.c"
+    break;
+
+  case 569: /* select_param: ID LBRACK STRING RBRACK  */
+#line 2509 "cfg.y"
+                                  {
+		if (sel.n >= MAX_SELECT_PARAMS-2) {
+			yyerror("Select identifier too long\n");
+		}
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[-3].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[-3].strval));
+		sel.n++;
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[-1].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[-1].strval));
+		sel.n++;
+	}
+#line 9129 "cfg.tab.c"
+    break;
+
+  case 572: /* $@8: %empty  */
+#line 2528 "cfg.y"
+                    { sel.n = 0; sel.f[0] = 0; }
+#line 9135 "cfg.tab.c"
+    break;
+
+  case 573: /* select_id: SELECT_MARK $@8 select_params  */
+#line 2528 "cfg.y"
+                                                               {
+		sel_ptr = (select_t*)pkg_malloc(sizeof(select_t));
+		if (!sel_ptr) {
+			yyerror("No memory left to allocate select structure\n");
+		}
+		memcpy(sel_ptr, &sel, sizeof(select_t));
+		(yyval.select) = sel_ptr;
+	}
+#line 9148 "cfg.tab.c"
+    break;
+
+  case 574: /* attr_class_spec: ATTR_FROM  */
+#line 2538 "cfg.y"
+                  { s_attr->type |= AVP_TRACK_FROM; }
+#line 9154 "cfg.tab.c"
+    break;
+
+  case 575: /* attr_class_spec: ATTR_TO  */
+#line 2539 "cfg.y"
+                  { s_attr->type |= AVP_TRACK_TO; }
+#line 9160 "cfg.tab.c"
+    break;
+
+  case 576: /* attr_class_spec: ATTR_FROMURI  */
+#line 2540 "cfg.y"
+                       { s_attr->type |= AVP_TRACK_FROM | AVP_CLASS_URI; }
+#line 9166 "cfg.tab.c"
+    break;
+
+  case 577: /* attr_class_spec: ATTR_TOURI  */
+#line 2541 "cfg.y"
+                     { s_attr->type |= AVP_TRACK_TO | AVP_CLASS_URI; }
+#line 9172 "cfg.tab.c"
+    break;
+
+  case 578: /* attr_class_spec: ATTR_FROMUSER  */
+#line 2542 "cfg.y"
+                        { s_attr->type |= AVP_TRACK_FROM | AVP_CLASS_USER; }
+#line 9178 "cfg.tab.c"
+    break;
+
+  case 579: /* attr_class_spec: ATTR_TOUSER  */
+#line 2543 "cfg.y"
+                      { s_attr->type |= AVP_TRACK_TO | AVP_CLASS_USER; }
+#line 9184 "cfg.tab.c"
+    break;
+
+  case 580: /* attr_class_spec: ATTR_FROMDOMAIN  */
+#line 2544 "cfg.y"
+                          { s_attr->type |= AVP_TRACK_FROM | AVP_CLASS_DOMAIN; }
+#line 9190 "cfg.tab.c"
+    break;
+
+  case 581: /* attr_class_spec: ATTR_TODOMAIN  */
+#line 2545 "cfg.y"
+                        { s_attr->type |= AVP_TRACK_TO | AVP_CLASS_DOMAIN; }
+#line 9196 "cfg.tab.c"
+    break;
+
+  case 582: /* attr_class_spec: ATTR_GLOBAL  */
+#line 2546 "cfg.y"
+                      { s_attr->type |= AVP_TRACK_ALL | AVP_CLASS_GLOBAL; }
+#line 9202 "cfg.tab.c"
+    break;
+
+  case 583: /* attr_name_spec: ID  */
+#line 2549 "cfg.y"
+           { s_attr->type |= AVP_NAME_STR; s_attr->name.s.s = (yyvsp[0].strval); s_attr->name.s.len = strlen ((yyvsp[0].strval)); }
+#line 9208 "cfg.tab.c"
+    break;
+
+  case 586: /* attr_mark: ATTR_MARK  */
+#line 2556 "cfg.y"
+                  {
+		s_attr = (struct avp_spec*)pkg_malloc(sizeof(struct avp_spec));
+		if (!s_attr) { yyerror("No memory left"); YYABORT; }
+		else s_attr->type = 0;
+	}
+#line 9218 "cfg.tab.c"
+    break;
+
+  case 587: /* attr_id: attr_mark attr_spec  */
+#line 2563 "cfg.y"
+                            { (yyval.attr) = s_attr; }
+#line 9224 "cfg.tab.c"
+    break;
+
+  case 588: /* attr_id_num_idx: attr_mark attr_spec LBRACK intno RBRACK  */
+#line 2566 "cfg.y"
+                                                {
+		s_attr->type|= (AVP_NAME_STR | ((yyvsp[-1].intval)<0?AVP_INDEX_BACKWARD:AVP_INDEX_FORWARD));
+		s_attr->index = ((yyvsp[-1].intval)<0?-(yyvsp[-1].intval):(yyvsp[-1].intval));
+		(yyval.attr) = s_attr;
+	}
+#line 9234 "cfg.tab.c"
+    break;
+
+  case 589: /* attr_id_no_idx: attr_mark attr_spec LBRACK RBRACK  */
+#line 2573 "cfg.y"
+                                          {
+		s_attr->type|= AVP_INDEX_ALL;
+		(yyval.attr) = s_attr;
+	}
+#line 9243 "cfg.tab.c"
+    break;
+
+  case 596: /* attr_id_any_str: avp_pvar  */
+#line 2595 "cfg.y"
+                   {
+		if ((yyvsp[0].lval)->type==LV_AVP){
+			s_attr = pkg_malloc(sizeof(struct avp_spec));
+			if (!s_attr) { yyerror("No memory left"); YYABORT; }
+			else{
+				*s_attr=(yyvsp[0].lval)->lv.avps;
+			}
+			(yyval.attr)=s_attr;
+		}else
+			(yyval.attr)=0; /* not an avp, a pvar */
+		pkg_free((yyvsp[0].lval));
+	}
+#line 9260 "cfg.tab.c"
+    break;
+
+  case 597: /* attr_id_any_str: STRING  */
+#line 2607 "cfg.y"
+                 {
+		avp_spec_t *avp_spec;
+		str s;
+		int type, idx;
+		avp_spec = pkg_malloc(sizeof(*avp_spec));
+		if (!avp_spec) {
+			yyerror("Not enough memory");
+			YYABORT;
+		}
+		s.s = (yyvsp[0].strval);
+		if (s.s[0] == '$')
+			s.s++;
+		s.len = strlen(s.s);
+		if (parse_avp_name(&s, &type, &avp_spec->name, &idx)) {
+			yyerror("error when parsing AVP");
+			pkg_free(avp_spec);
+			YYABORT;
+		}
+		avp_spec->type = type;
+		avp_spec->index = idx;
+		(yyval.attr) = avp_spec;
+	}
+#line 9287 "cfg.tab.c"
+    break;
+
+  case 598: /* pvar: PVAR  */
+#line 2631 "cfg.y"
+             {
+			s_tmp.s=(yyvsp[0].strval); s_tmp.len=strlen((yyvsp[0].strval));
+			pv_spec=pv_cache_get(&s_tmp);
+			if (!pv_spec) {
+				yyerror("Can't get from cache: %s", (yyvsp[0].strval));
+				YYABORT;
+			}
+			(yyval.pvar)=pv_spec;
+		}
+#line 9301 "cfg.tab.c"
+    break;
+
+  case 599: /* avp_pvar: AVP_OR_PVAR  */
+#line 2642 "cfg.y"
+                            {
+				lval_tmp=pkg_malloc(sizeof(*lval_tmp));
+				if (!lval_tmp) {
+					yyerror("Not enough memory");
+					YYABORT;
+				}
+				memset(lval_tmp, 0, sizeof(*lval_tmp));
+				s_tmp.s=(yyvsp[0].strval); s_tmp.len=strlen(s_tmp.s);
+				lval_tmp->lv.pvs = pv_cache_get(&s_tmp);
+				if (lval_tmp->lv.pvs==NULL){
+					lval_tmp->lv.avps.type|= AVP_NAME_STR;
+					lval_tmp->lv.avps.name.s.s = s_tmp.s+1;
+					lval_tmp->lv.avps.name.s.len = s_tmp.len-1;
+					lval_tmp->type=LV_AVP;
+				}else{
+					lval_tmp->type=LV_PVAR;
+				}
+				(yyval.lval) = lval_tmp;
+				DBG("parsed ambigous avp/pvar \"%.*s\" to %d\n",
+							s_tmp.len, s_tmp.s, lval_tmp->type);
+			}
+#line 9327 "cfg.tab.c"
+    break;
+
+  case 600: /* assign_op: EQUAL  */
+#line 2673 "cfg.y"
+              { (yyval.intval) = ASSIGN_T; }
+#line 9333 "cfg.tab.c"
+    break;
+
+  case 601: /* lval: attr_id_ass  */
+#line 2677 "cfg.y"
+                  {
+					lval_tmp=pkg_malloc(sizeof(*lval_tmp));
+					if (!lval_tmp) {
+						yyerror("Not enough memory");
+						YYABORT;
+					}
+					lval_tmp->type=LV_AVP; lval_tmp->lv.avps=*(yyvsp[0].attr);
+					pkg_free((yyvsp[0].attr)); /* free the avp spec we just copied */
+					(yyval.lval)=lval_tmp;
+				}
+#line 9348 "cfg.tab.c"
+    break;
+
+  case 602: /* lval: pvar  */
+#line 2687 "cfg.y"
+                      {
+					if (!pv_is_w((yyvsp[0].pvar)))
+						yyerror("read only pvar in assignment left side");
+					if ((yyvsp[0].pvar)->trans!=0)
+						yyerror("pvar with transformations in assignment"
+								" left side");
+					lval_tmp=pkg_malloc(sizeof(*lval_tmp));
+					if (!lval_tmp) {
+						yyerror("Not enough memory");
+						YYABORT;
+					}
+					lval_tmp->type=LV_PVAR; lval_tmp->lv.pvs=(yyvsp[0].pvar);
+					(yyval.lval)=lval_tmp;
+				}
+#line 9367 "cfg.tab.c"
+    break;
+
+  case 603: /* lval: avp_pvar  */
+#line 2701 "cfg.y"
+                      {
+					if (((yyvsp[0].lval))->type==LV_PVAR){
+						if (!pv_is_w((yyvsp[0].lval)->lv.pvs))
+							yyerror("read only pvar in assignment left side");
+						if ((yyvsp[0].lval)->lv.pvs->trans!=0)
+							yyerror("pvar with transformations in assignment"
+									" left side");
+					}
+					(yyval.lval)=(yyvsp[0].lval);
+				}
+#line 9382 "cfg.tab.c"
+    break;
+
+  case 604: /* rval: intno  */
+#line 2713 "cfg.y"
+                                {(yyval.rv_expr)=mk_rve_rval(RV_INT, (void*)(yyvsp[0].intval)); }
+#line 9388 "cfg.tab.c"
+    break;
+
+  case 605: /* rval: STRING  */
+#line 2714 "cfg.y"
+                                        {	s_tmp.s=(yyvsp[0].strval); s_tmp.len=strlen((yyvsp[0].strval));
+							(yyval.rv_expr)=mk_rve_rval(RV_STR, &s_tmp); }
+#line 9395 "cfg.tab.c"
+    break;
+
+  case 606: /* rval: attr_id_any  */
+#line 2716 "cfg.y"
+                                {(yyval.rv_expr)=mk_rve_rval(RV_AVP, (yyvsp[0].attr)); pkg_free((yyvsp[0].attr)); }
+#line 9401 "cfg.tab.c"
+    break;
+
+  case 607: /* rval: pvar  */
+#line 2717 "cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_PVAR, (yyvsp[0].pvar)); }
+#line 9407 "cfg.tab.c"
+    break;
+
+  case 608: /* rval: avp_pvar  */
+#line 2718 "cfg.y"
+                                        {
+							switch((yyvsp[0].lval)->type){
+								case LV_AVP:
+									(yyval.rv_expr)=mk_rve_rval(RV_AVP, &(yyvsp[0].lval)->lv.avps);
+									break;
+								case LV_PVAR:
+									(yyval.rv_expr)=mk_rve_rval(RV_PVAR, (yyvsp[0].lval)->lv.pvs);
+									break;
+								default:
+									yyerror("BUG: invalid lvalue type ");
+									YYABORT;
+							}
+							pkg_free((yyvsp[0].lval)); /* not needed anymore */
+						}
+#line 9426 "cfg.tab.c"
+    break;
+
+  case 609: /* rval: select_id  */
+#line 2732 "cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_SEL, (yyvsp[0].select)); pkg_free((yyvsp[0].select)); }
+#line 9432 "cfg.tab.c"
+    break;
+
+  case 610: /* rval: fcmd  */
+#line 2733 "cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_ACTION_ST, (yyvsp[0].action)); }
+#line 9438 "cfg.tab.c"
+    break;
+
+  case 611: /* rval: exp_elem  */
+#line 2734 "cfg.y"
+                   { (yyval.rv_expr)=mk_rve_rval(RV_BEXPR, (yyvsp[0].expr)); }
+#line 9444 "cfg.tab.c"
+    break;
+
+  case 612: /* rval: LBRACE actions RBRACE  */
+#line 2735 "cfg.y"
+                                {(yyval.rv_expr)=mk_rve_rval(RV_ACTION_ST, (yyvsp[-1].action)); }
+#line 9450 "cfg.tab.c"
+    break;
+
+  case 613: /* rval: LBRACE error RBRACE  */
+#line 2736 "cfg.y"
+                                { (yyval.rv_expr)=0; yyerror("bad command block"); }
+#line 9456 "cfg.tab.c"
+    break;
+
+  case 614: /* rval: LPAREN assign_action RPAREN  */
+#line 2737 "cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_ACTION_ST, (yyvsp[-1].action)); }
+#line 9462 "cfg.tab.c"
+    break;
+
+  case 615: /* rval: LPAREN error RPAREN  */
+#line 2738 "cfg.y"
+                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9468 "cfg.tab.c"
+    break;
+
+  case 616: /* rve_un_op: NOT  */
+#line 2742 "cfg.y"
+                { (yyval.intval)=RVE_LNOT_OP; }
+#line 9474 "cfg.tab.c"
+    break;
+
+  case 617: /* rve_un_op: BIN_NOT  */
+#line 2743 "cfg.y"
+                                { (yyval.intval)=RVE_BNOT_OP; }
+#line 9480 "cfg.tab.c"
+    break;
+
+  case 618: /* rve_un_op: MINUS  */
+#line 2744 "cfg.y"
+                                        { (yyval.intval)=RVE_UMINUS_OP; }
+#line 9486 "cfg.tab.c"
+    break;
+
+  case 619: /* rval_expr: rval  */
+#line 2757 "cfg.y"
+                                                        { (yyval.rv_expr)=(yyvsp[0].rv_expr);
+										if ((yyval.rv_expr)==0){
+											/*yyerror("out of memory\n");*/
+											YYERROR;
+										}
+									}
+#line 9497 "cfg.tab.c"
+    break;
+
+  case 620: /* rval_expr: rve_un_op rval_expr  */
+#line 2763 "cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve1((yyvsp[-1].intval), (yyvsp[0].rv_expr)); }
+#line 9503 "cfg.tab.c"
+    break;
+
+  case 621: /* rval_expr: INTCAST rval_expr  */
+#line 2764 "cfg.y"
+                                                                {(yyval.rv_expr)=mk_rve1(RVE_INT_OP, (yyvsp[0].rv_expr)); }
+#line 9509 "cfg.tab.c"
+    break;
+
+  case 622: /* rval_expr: STRCAST rval_expr  */
+#line 2765 "cfg.y"
+                                                                {(yyval.rv_expr)=mk_rve1(RVE_STR_OP, (yyvsp[0].rv_expr)); }
+#line 9515 "cfg.tab.c"
+    break;
+
+  case 623: /* rval_expr: rval_expr PLUS rval_expr  */
+#line 2766 "cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_PLUS_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 9521 "cfg.tab.c"
+    break;
+
+  case 624: /* rval_expr: rval_expr MINUS rval_expr  */
+#line 2767 "cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_MINUS_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 9527 "cfg.tab.c"
+    break;
+
+  case 625: /* rval_expr: rval_expr STAR rval_expr  */
+#line 2768 "cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_MUL_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 9533 "cfg.tab.c"
+    break;
+
+  case 626: /* rval_expr: rval_expr SLASH rval_expr  */
+#line 2769 "cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_DIV_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 9539 "cfg.tab.c"
+    break;
+
+  case 627: /* rval_expr: rval_expr MODULO rval_expr  */
+#line 2770 "cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_MOD_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 9545 "cfg.tab.c"
+    break;
+
+  case 628: /* rval_expr: rval_expr BIN_OR rval_expr  */
+#line 2771 "cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_BOR_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr)); }
+#line 9551 "cfg.tab.c"
+    break;
+
+  case 629: /* rval_expr: rval_expr BIN_AND rval_expr  */
+#line 2772 "cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_BAND_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 9557 "cfg.tab.c"
+    break;
+
+  case 630: /* rval_expr: rval_expr BIN_XOR rval_expr  */
+#line 2773 "cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_BXOR_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 9563 "cfg.tab.c"
+    break;
+
+  case 631: /* rval_expr: rval_expr BIN_LSHIFT rval_expr  */
+#line 2774 "cfg.y"
+                                                 {(yyval.rv_expr)=mk_rve2(RVE_BLSHIFT_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 9569 "cfg.tab.c"
+    break;
+
+  case 632: /* rval_expr: rval_expr BIN_RSHIFT rval_expr  */
+#line 2775 "cfg.y"
+                                                 {(yyval.rv_expr)=mk_rve2(RVE_BRSHIFT_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 9575 "cfg.tab.c"
+    break;
+
+  case 633: /* rval_expr: rval_expr rve_cmpop rval_expr  */
+#line 2776 "cfg.y"
+                                                         { (yyval.rv_expr)=mk_rve2( (yyvsp[-1].intval), (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));}
+#line 9581 "cfg.tab.c"
+    break;
+
+  case 634: /* rval_expr: rval_expr rve_equalop rval_expr  */
+#line 2777 "cfg.y"
+                                                                {
+			/* comparing with $null => treat as defined or !defined */
+			if((yyvsp[0].rv_expr)->op==RVE_RVAL_OP && (yyvsp[0].rv_expr)->left.rval.type==RV_PVAR
+					&& (yyvsp[0].rv_expr)->left.rval.v.pvs.type==PVT_NULL) {
+				if((yyvsp[-1].intval)==RVE_DIFF_OP || (yyvsp[-1].intval)==RVE_IDIFF_OP
+						|| (yyvsp[-1].intval)==RVE_STRDIFF_OP) {
+					DBG("comparison with $null switched to notdefined operator\n");
+					(yyval.rv_expr)=mk_rve1(RVE_DEFINED_OP, (yyvsp[-2].rv_expr));
+				} else {
+					DBG("comparison with $null switched to defined operator\n");
+					(yyval.rv_expr)=mk_rve1(RVE_NOTDEFINED_OP, (yyvsp[-2].rv_expr));
+				}
+				/* free rve struct for $null */
+				rve_destroy((yyvsp[0].rv_expr));
+			} else {
+				(yyval.rv_expr)=mk_rve2((yyvsp[-1].intval), (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));
+			}
+		}
+#line 9604 "cfg.tab.c"
+    break;
+
+  case 635: /* rval_expr: rval_expr LOG_AND rval_expr  */
+#line 2795 "cfg.y"
+                                                { (yyval.rv_expr)=mk_rve2(RVE_LAND_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));}
+#line 9610 "cfg.tab.c"
+    break;
+
+  case 636: /* rval_expr: rval_expr LOG_OR rval_expr  */
+#line 2796 "cfg.y"
+                                                { (yyval.rv_expr)=mk_rve2(RVE_LOR_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));}
+#line 9616 "cfg.tab.c"
+    break;
+
+  case 637: /* rval_expr: LPAREN rval_expr RPAREN  */
+#line 2797 "cfg.y"
+                                                        { (yyval.rv_expr)=(yyvsp[-1].rv_expr);}
+#line 9622 "cfg.tab.c"
+    break;
+
+  case 638: /* rval_expr: STRLEN LPAREN rval_expr RPAREN  */
+#line 2798 "cfg.y"
+                                                 { (yyval.rv_expr)=mk_rve1(RVE_STRLEN_OP, (yyvsp[-1].rv_expr));}
+#line 9628 "cfg.tab.c"
+    break;
+
+  case 639: /* rval_expr: STREMPTY LPAREN rval_expr RPAREN  */
+#line 2799 "cfg.y"
+                                                   {(yyval.rv_expr)=mk_rve1(RVE_STREMPTY_OP, (yyvsp[-1].rv_expr));}
+#line 9634 "cfg.tab.c"
+    break;
+
+  case 640: /* rval_expr: DEFINED rval_expr  */
+#line 2800 "cfg.y"
+                                                                { (yyval.rv_expr)=mk_rve1(RVE_DEFINED_OP, (yyvsp[0].rv_expr));}
+#line 9640 "cfg.tab.c"
+    break;
+
+  case 641: /* rval_expr: rve_un_op error  */
+#line 2801 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9646 "cfg.tab.c"
+    break;
+
+  case 642: /* rval_expr: INTCAST error  */
+#line 2802 "cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9652 "cfg.tab.c"
+    break;
+
+  case 643: /* rval_expr: STRCAST error  */
+#line 2803 "cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9658 "cfg.tab.c"
+    break;
+
+  case 644: /* rval_expr: rval_expr PLUS error  */
+#line 2804 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9664 "cfg.tab.c"
+    break;
+
+  case 645: /* rval_expr: rval_expr MINUS error  */
+#line 2805 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9670 "cfg.tab.c"
+    break;
+
+  case 646: /* rval_expr: rval_expr STAR error  */
+#line 2806 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9676 "cfg.tab.c"
+    break;
+
+  case 647: /* rval_expr: rval_expr SLASH error  */
+#line 2807 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9682 "cfg.tab.c"
+    break;
+
+  case 648: /* rval_expr: rval_expr MODULO error  */
+#line 2808 "cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9688 "cfg.tab.c"
+    break;
+
+  case 649: /* rval_expr: rval_expr BIN_OR error  */
+#line 2809 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9694 "cfg.tab.c"
+    break;
+
+  case 650: /* rval_expr: rval_expr BIN_AND error  */
+#line 2810 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9700 "cfg.tab.c"
+    break;
+
+  case 651: /* rval_expr: rval_expr rve_cmpop error  */
+#line 2812 "cfg.y"
+                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9706 "cfg.tab.c"
+    break;
+
+  case 652: /* rval_expr: rval_expr rve_equalop error  */
+#line 2814 "cfg.y"
+                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9712 "cfg.tab.c"
+    break;
+
+  case 653: /* rval_expr: rval_expr LOG_AND error  */
+#line 2815 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9718 "cfg.tab.c"
+    break;
+
+  case 654: /* rval_expr: rval_expr LOG_OR error  */
+#line 2816 "cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9724 "cfg.tab.c"
+    break;
+
+  case 655: /* rval_expr: STRLEN LPAREN error RPAREN  */
+#line 2817 "cfg.y"
+                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9730 "cfg.tab.c"
+    break;
+
+  case 656: /* rval_expr: STREMPTY LPAREN error RPAREN  */
+#line 2818 "cfg.y"
+                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9736 "cfg.tab.c"
+    break;
+
+  case 657: /* rval_expr: DEFINED error  */
+#line 2819 "cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 9742 "cfg.tab.c"
+    break;
+
+  case 658: /* assign_action: lval assign_op rval_expr  */
+#line 2822 "cfg.y"
+                                                { (yyval.action)=mk_action((yyvsp[-1].intval), 2, LVAL_ST, (yyvsp[-2].lval), 
+														 	  RVE_ST, (yyvsp[0].rv_expr));
+											set_cfg_pos((yyval.action));
+										}
+#line 9751 "cfg.tab.c"
+    break;
+
+  case 659: /* avpflag_oper: SETAVPFLAG  */
+#line 2840 "cfg.y"
+                   { (yyval.intval) = 1; }
+#line 9757 "cfg.tab.c"
+    break;
+
+  case 660: /* avpflag_oper: RESETAVPFLAG  */
+#line 2841 "cfg.y"
+                       { (yyval.intval) = 0; }
+#line 9763 "cfg.tab.c"
+    break;
+
+  case 661: /* avpflag_oper: ISAVPFLAGSET  */
+#line 2842 "cfg.y"
+                       { (yyval.intval) = -1; }
+#line 9769 "cfg.tab.c"
+    break;
+
+  case 662: /* cmd: FORWARD LPAREN RPAREN  */
+#line 2845 "cfg.y"
+                              { (yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9775 "cfg.tab.c"
+    break;
+
+  case 663: /* cmd: FORWARD LPAREN host RPAREN  */
+#line 2846 "cfg.y"
+                                        { (yyval.action)=mk_action(	FORWARD_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9781 "cfg.tab.c"
+    break;
+
+  case 664: /* cmd: FORWARD LPAREN STRING RPAREN  */
+#line 2847 "cfg.y"
+                                        { (yyval.action)=mk_action(	FORWARD_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9787 "cfg.tab.c"
+    break;
+
+  case 665: /* cmd: FORWARD LPAREN ip RPAREN  */
+#line 2848 "cfg.y"
+                                        { (yyval.action)=mk_action(	FORWARD_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9793 "cfg.tab.c"
+    break;
+
+  case 666: /* cmd: FORWARD LPAREN host COMMA NUMBER RPAREN  */
+#line 2849 "cfg.y"
+                                                  { (yyval.action)=mk_action(FORWARD_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9799 "cfg.tab.c"
+    break;
+
+  case 667: /* cmd: FORWARD LPAREN STRING COMMA NUMBER RPAREN  */
+#line 2850 "cfg.y"
+                                                    {(yyval.action)=mk_action(FORWARD_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9805 "cfg.tab.c"
+    break;
+
+  case 668: /* cmd: FORWARD LPAREN ip COMMA NUMBER RPAREN  */
+#line 2851 "cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9811 "cfg.tab.c"
+    break;
+
+  case 669: /* cmd: FORWARD LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 2852 "cfg.y"
+                                                      { (yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9817 "cfg.tab.c"
+    break;
+
+  case 670: /* cmd: FORWARD LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 2853 "cfg.y"
+                                                     {(yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9823 "cfg.tab.c"
+    break;
+
+  case 671: /* cmd: FORWARD LPAREN URIHOST RPAREN  */
+#line 2854 "cfg.y"
+                                        { (yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9829 "cfg.tab.c"
+    break;
+
+  case 672: /* cmd: FORWARD error  */
+#line 2855 "cfg.y"
+                        { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 9835 "cfg.tab.c"
+    break;
+
+  case 673: /* cmd: FORWARD LPAREN error RPAREN  */
+#line 2856 "cfg.y"
+                                      { (yyval.action)=0; yyerror("bad forward argument"); }
+#line 9841 "cfg.tab.c"
+    break;
+
+  case 674: /* cmd: FORWARD_UDP LPAREN host RPAREN  */
+#line 2857 "cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9847 "cfg.tab.c"
+    break;
+
+  case 675: /* cmd: FORWARD_UDP LPAREN STRING RPAREN  */
+#line 2858 "cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9853 "cfg.tab.c"
+    break;
+
+  case 676: /* cmd: FORWARD_UDP LPAREN ip RPAREN  */
+#line 2859 "cfg.y"
+                                        { (yyval.action)=mk_action(FORWARD_UDP_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9859 "cfg.tab.c"
+    break;
+
+  case 677: /* cmd: FORWARD_UDP LPAREN host COMMA NUMBER RPAREN  */
+#line 2860 "cfg.y"
+                                                      { (yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9865 "cfg.tab.c"
+    break;
+
+  case 678: /* cmd: FORWARD_UDP LPAREN STRING COMMA NUMBER RPAREN  */
+#line 2861 "cfg.y"
+                                                        {(yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9871 "cfg.tab.c"
+    break;
+
+  case 679: /* cmd: FORWARD_UDP LPAREN ip COMMA NUMBER RPAREN  */
+#line 2862 "cfg.y"
+                                                    { (yyval.action)=mk_action(FORWARD_UDP_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9877 "cfg.tab.c"
+    break;
+
+  case 680: /* cmd: FORWARD_UDP LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 2863 "cfg.y"
+                                                          {(yyval.action)=mk_action(FORWARD_UDP_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9883 "cfg.tab.c"
+    break;
+
+  case 681: /* cmd: FORWARD_UDP LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 2864 "cfg.y"
+                                                         { (yyval.action)=mk_action(FORWARD_UDP_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9889 "cfg.tab.c"
+    break;
+
+  case 682: /* cmd: FORWARD_UDP LPAREN URIHOST RPAREN  */
+#line 2865 "cfg.y"
+                                            { (yyval.action)=mk_action(FORWARD_UDP_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9895 "cfg.tab.c"
+    break;
+
+  case 683: /* cmd: FORWARD_UDP error  */
+#line 2866 "cfg.y"
+                            { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 9901 "cfg.tab.c"
+    break;
+
+  case 684: /* cmd: FORWARD_UDP LPAREN error RPAREN  */
+#line 2867 "cfg.y"
+                                          { (yyval.action)=0; yyerror("bad forward_udp argument"); }
+#line 9907 "cfg.tab.c"
+    break;
+
+  case 685: /* cmd: FORWARD_TCP LPAREN host RPAREN  */
+#line 2868 "cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9913 "cfg.tab.c"
+    break;
+
+  case 686: /* cmd: FORWARD_TCP LPAREN STRING RPAREN  */
+#line 2869 "cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9919 "cfg.tab.c"
+    break;
+
+  case 687: /* cmd: FORWARD_TCP LPAREN ip RPAREN  */
+#line 2870 "cfg.y"
+                                        { (yyval.action)=mk_action(FORWARD_TCP_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9925 "cfg.tab.c"
+    break;
+
+  case 688: /* cmd: FORWARD_TCP LPAREN host COMMA NUMBER RPAREN  */
+#line 2871 "cfg.y"
+                                                      { (yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9931 "cfg.tab.c"
+    break;
+
+  case 689: /* cmd: FORWARD_TCP LPAREN STRING COMMA NUMBER RPAREN  */
+#line 2872 "cfg.y"
+                                                        {(yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9937 "cfg.tab.c"
+    break;
+
+  case 690: /* cmd: FORWARD_TCP LPAREN ip COMMA NUMBER RPAREN  */
+#line 2873 "cfg.y"
+                                                    { (yyval.action)=mk_action(FORWARD_TCP_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9943 "cfg.tab.c"
+    break;
+
+  case 691: /* cmd: FORWARD_TCP LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 2874 "cfg.y"
+                                                          {(yyval.action)=mk_action(FORWARD_TCP_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9949 "cfg.tab.c"
+    break;
+
+  case 692: /* cmd: FORWARD_TCP LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 2875 "cfg.y"
+                                                         { (yyval.action)=mk_action(FORWARD_TCP_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 9955 "cfg.tab.c"
+    break;
+
+  case 693: /* cmd: FORWARD_TCP LPAREN URIHOST RPAREN  */
+#line 2876 "cfg.y"
+                                            { (yyval.action)=mk_action(FORWARD_TCP_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 9961 "cfg.tab.c"
+    break;
+
+  case 694: /* cmd: FORWARD_TCP error  */
+#line 2877 "cfg.y"
+                            { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 9967 "cfg.tab.c"
+    break;
+
+  case 695: /* cmd: FORWARD_TCP LPAREN error RPAREN  */
+#line 2878 "cfg.y"
+                                          { (yyval.action)=0; yyerror("bad forward_tcp argument"); }
+#line 9973 "cfg.tab.c"
+    break;
+
+  case 696: /* cmd: FORWARD_TLS LPAREN host RPAREN  */
+#line 2879 "cfg.y"
+                                         {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 9986 "cfg.tab.c"
+    break;
+
+  case 697: /* cmd: FORWARD_TLS LPAREN STRING RPAREN  */
+#line 2887 "cfg.y"
+                                           {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 9999 "cfg.tab.c"
+    break;
+
+  case 698: /* cmd: FORWARD_TLS LPAREN ip RPAREN  */
+#line 2895 "cfg.y"
+                                        {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 10012 "cfg.tab.c"
+    break;
+
+  case 699: /* cmd: FORWARD_TLS LPAREN host COMMA NUMBER RPAREN  */
+#line 2903 "cfg.y"
+                                                      {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 10025 "cfg.tab.c"
+    break;
+
+  case 700: /* cmd: FORWARD_TLS LPAREN STRING COMMA NUMBER RPAREN  */
+#line 2911 "cfg.y"
+                                                        {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 10038 "cfg.tab.c"
+    break;
+
+  case 701: /* cmd: FORWARD_TLS LPAREN ip COMMA NUMBER RPAREN  */
+#line 2919 "cfg.y"
+                                                    {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+					}
+#line 10051 "cfg.tab.c"
+    break;
+
+  case 702: /* cmd: FORWARD_TLS LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 2927 "cfg.y"
+                                                          {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 10064 "cfg.tab.c"
+    break;
+
+  case 703: /* cmd: FORWARD_TLS LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 2935 "cfg.y"
+                                                         {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 10077 "cfg.tab.c"
+    break;
+
+  case 704: /* cmd: FORWARD_TLS LPAREN URIHOST RPAREN  */
+#line 2943 "cfg.y"
+                                            {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 10090 "cfg.tab.c"
+    break;
+
+  case 705: /* cmd: FORWARD_TLS error  */
+#line 2951 "cfg.y"
+                            { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10096 "cfg.tab.c"
+    break;
+
+  case 706: /* cmd: FORWARD_TLS LPAREN error RPAREN  */
+#line 2952 "cfg.y"
+                                          { (yyval.action)=0; 
+									yyerror("bad forward_tls argument"); }
+#line 10103 "cfg.tab.c"
+    break;
+
+  case 707: /* cmd: FORWARD_SCTP LPAREN host RPAREN  */
+#line 2954 "cfg.y"
+                                          {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 10116 "cfg.tab.c"
+    break;
+
+  case 708: /* cmd: FORWARD_SCTP LPAREN STRING RPAREN  */
+#line 2962 "cfg.y"
+                                            {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 10129 "cfg.tab.c"
+    break;
+
+  case 709: /* cmd: FORWARD_SCTP LPAREN ip RPAREN  */
+#line 2970 "cfg.y"
+                                        {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 10142 "cfg.tab.c"
+    break;
+
+  case 710: /* cmd: FORWARD_SCTP LPAREN host COMMA NUMBER RPAREN  */
+#line 2978 "cfg.y"
+                                                       {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST,
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 10156 "cfg.tab.c"
+    break;
+
+  case 711: /* cmd: FORWARD_SCTP LPAREN STRING COMMA NUMBER RPAREN  */
+#line 2987 "cfg.y"
+                                                         {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST,
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 10170 "cfg.tab.c"
+    break;
+
+  case 712: /* cmd: FORWARD_SCTP LPAREN ip COMMA NUMBER RPAREN  */
+#line 2996 "cfg.y"
+                                                     {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, 
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+					}
+#line 10184 "cfg.tab.c"
+    break;
+
+  case 713: /* cmd: FORWARD_SCTP LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 3005 "cfg.y"
+                                                           {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 10197 "cfg.tab.c"
+    break;
+
+  case 714: /* cmd: FORWARD_SCTP LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 3013 "cfg.y"
+                                                          {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, URIHOST_ST, 0, NUMBER_ST,
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 10211 "cfg.tab.c"
+    break;
+
+  case 715: /* cmd: FORWARD_SCTP LPAREN URIHOST RPAREN  */
+#line 3022 "cfg.y"
+                                             {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 10224 "cfg.tab.c"
+    break;
+
+  case 716: /* cmd: FORWARD_SCTP error  */
+#line 3030 "cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10230 "cfg.tab.c"
+    break;
+
+  case 717: /* cmd: FORWARD_SCTP LPAREN error RPAREN  */
+#line 3031 "cfg.y"
+                                           { (yyval.action)=0; 
+									yyerror("bad forward_sctp argument"); }
+#line 10237 "cfg.tab.c"
+    break;
+
+  case 718: /* cmd: LOG_TOK LPAREN STRING RPAREN  */
+#line 3033 "cfg.y"
+                                        {(yyval.action)=mk_action(LOG_T, 2, NUMBER_ST,
+										(void*)(L_DBG+1), STRING_ST, (yyvsp[-1].strval));
+									set_cfg_pos((yyval.action)); }
+#line 10245 "cfg.tab.c"
+    break;
+
+  case 719: /* cmd: LOG_TOK LPAREN NUMBER COMMA STRING RPAREN  */
+#line 3036 "cfg.y"
+                                                        {(yyval.action)=mk_action(LOG_T, 2, NUMBER_ST, (void*)(yyvsp[-3].intval), STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10251 "cfg.tab.c"
+    break;
+
+  case 720: /* cmd: LOG_TOK error  */
+#line 3037 "cfg.y"
+                                        { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10257 "cfg.tab.c"
+    break;
+
+  case 721: /* cmd: LOG_TOK LPAREN error RPAREN  */
+#line 3038 "cfg.y"
+                                        { (yyval.action)=0; yyerror("bad log argument"); }
+#line 10263 "cfg.tab.c"
+    break;
+
+  case 722: /* cmd: SETFLAG LPAREN NUMBER RPAREN  */
+#line 3039 "cfg.y"
+                                        {
+							if (check_flag((yyvsp[-1].intval))==-1)
+								yyerror("bad flag value");
+							(yyval.action)=mk_action(SETFLAG_T, 1, NUMBER_ST,
+													(void*)(yyvsp[-1].intval));
+							set_cfg_pos((yyval.action));
+									}
+#line 10275 "cfg.tab.c"
+    break;
+
+  case 723: /* cmd: SETFLAG LPAREN flag_name RPAREN  */
+#line 3046 "cfg.y"
+                                                {
+							i_tmp=get_flag_no((yyvsp[-1].strval), strlen((yyvsp[-1].strval)));
+							if (i_tmp<0) yyerror("flag not declared");
+							(yyval.action)=mk_action(SETFLAG_T, 1, NUMBER_ST,
+										(void*)(long)i_tmp);
+							set_cfg_pos((yyval.action));
+									}
+#line 10287 "cfg.tab.c"
+    break;
+
+  case 724: /* cmd: SETFLAG error  */
+#line 3053 "cfg.y"
+                                        { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 10293 "cfg.tab.c"
+    break;
+
+  case 725: /* cmd: RESETFLAG LPAREN NUMBER RPAREN  */
+#line 3054 "cfg.y"
+                                         {
+							if (check_flag((yyvsp[-1].intval))==-1)
+								yyerror("bad flag value");
+							(yyval.action)=mk_action(RESETFLAG_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+							set_cfg_pos((yyval.action));
+									}
+#line 10304 "cfg.tab.c"
+    break;
+
+  case 726: /* cmd: RESETFLAG LPAREN flag_name RPAREN  */
+#line 3060 "cfg.y"
+                                                {
+							i_tmp=get_flag_no((yyvsp[-1].strval), strlen((yyvsp[-1].strval)));
+							if (i_tmp<0) yyerror("flag not declared");
+							(yyval.action)=mk_action(RESETFLAG_T, 1, NUMBER_ST,
+										(void*)(long)i_tmp);
+							set_cfg_pos((yyval.action));
+									}
+#line 10316 "cfg.tab.c"
+    break;
+
+  case 727: /* cmd: RESETFLAG error  */
+#line 3067 "cfg.y"
+                                        { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 10322 "cfg.tab.c"
+    break;
+
+  case 728: /* cmd: ISFLAGSET LPAREN NUMBER RPAREN  */
+#line 3068 "cfg.y"
+                                         {
+							if (check_flag((yyvsp[-1].intval))==-1)
+								yyerror("bad flag value");
+							(yyval.action)=mk_action(ISFLAGSET_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+							set_cfg_pos((yyval.action));
+									}
+#line 10333 "cfg.tab.c"
+    break;
+
+  case 729: /* cmd: ISFLAGSET LPAREN flag_name RPAREN  */
+#line 3074 "cfg.y"
+                                                {
+							i_tmp=get_flag_no((yyvsp[-1].strval), strlen((yyvsp[-1].strval)));
+							if (i_tmp<0) yyerror("flag not declared");
+							(yyval.action)=mk_action(ISFLAGSET_T, 1, NUMBER_ST,
+										(void*)(long)i_tmp);
+							set_cfg_pos((yyval.action));
+									}
+#line 10345 "cfg.tab.c"
+    break;
+
+  case 730: /* cmd: ISFLAGSET error  */
+#line 3081 "cfg.y"
+                          { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 10351 "cfg.tab.c"
+    break;
+
+  case 731: /* cmd: avpflag_oper LPAREN attr_id_any_str COMMA flag_name RPAREN  */
+#line 3082 "cfg.y"
+                                                                     {
+		i_tmp=get_avpflag_no((yyvsp[-1].strval));
+		if (i_tmp==0) yyerror("avpflag not declared");
+		(yyval.action)=mk_action(AVPFLAG_OPER_T, 3, AVP_ST, (yyvsp[-3].attr), NUMBER_ST, (void*)(long)i_tmp, NUMBER_ST, (void*)(yyvsp[-5].intval));
+		set_cfg_pos((yyval.action));
+	}
+#line 10362 "cfg.tab.c"
+    break;
+
+  case 732: /* cmd: avpflag_oper LPAREN attr_id_any_str COMMA error RPAREN  */
+#line 3088 "cfg.y"
+                                                                 {
+		(yyval.action)=0; yyerror("error parsing flag name");
+	}
+#line 10370 "cfg.tab.c"
+    break;
+
+  case 733: /* cmd: avpflag_oper LPAREN error COMMA flag_name RPAREN  */
+#line 3091 "cfg.y"
+                                                           {
+		(yyval.action)=0; yyerror("error parsing first parameter (avp or string)");
+	}
+#line 10378 "cfg.tab.c"
+    break;
+
+  case 734: /* cmd: avpflag_oper LPAREN error RPAREN  */
+#line 3094 "cfg.y"
+                                           { (yyval.action)=0; yyerror("bad parameters"); }
+#line 10384 "cfg.tab.c"
+    break;
+
+  case 735: /* cmd: avpflag_oper error  */
+#line 3095 "cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 10390 "cfg.tab.c"
+    break;
+
+  case 736: /* cmd: ERROR LPAREN STRING COMMA STRING RPAREN  */
+#line 3096 "cfg.y"
+                                                  {(yyval.action)=mk_action(ERROR_T, 2, STRING_ST, (yyvsp[-3].strval), STRING_ST, (yyvsp[-1].strval));
+			set_cfg_pos((yyval.action));
+	}
+#line 10398 "cfg.tab.c"
+    break;
+
+  case 737: /* cmd: ERROR error  */
+#line 3099 "cfg.y"
+                      { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10404 "cfg.tab.c"
+    break;
+
+  case 738: /* cmd: ERROR LPAREN error RPAREN  */
+#line 3100 "cfg.y"
+                                    { (yyval.action)=0; yyerror("bad error argument"); }
+#line 10410 "cfg.tab.c"
+    break;
+
+  case 739: /* cmd: ROUTE LPAREN rval_expr RPAREN  */
+#line 3101 "cfg.y"
+                                        {
+		if ((yyvsp[-1].rv_expr)) {
+			(yyval.action) = mk_action(ROUTE_T, 1, RVE_ST, (void*)(yyvsp[-1].rv_expr));
+			set_cfg_pos((yyval.action));
+		} else {
+			(yyval.action) = 0;
+			YYERROR;
+		}
+	}
+#line 10424 "cfg.tab.c"
+    break;
+
+  case 740: /* cmd: ROUTE LPAREN ID RPAREN  */
+#line 3110 "cfg.y"
+                                        {
+		if ((yyvsp[-1].strval)) {
+			(yyval.action) = mk_action(ROUTE_T, 1, STRING_ST, (void*)(yyvsp[-1].strval));
+			set_cfg_pos((yyval.action));
+		} else {
+			(yyval.action) = 0;
+			YYERROR;
+		}
+	}
+#line 10438 "cfg.tab.c"
+    break;
+
+  case 741: /* cmd: ROUTE error  */
+#line 3119 "cfg.y"
+                      { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10444 "cfg.tab.c"
+    break;
+
+  case 742: /* cmd: ROUTE LPAREN error RPAREN  */
+#line 3120 "cfg.y"
+                                    { (yyval.action)=0; yyerror("bad route argument"); }
+#line 10450 "cfg.tab.c"
+    break;
+
+  case 743: /* cmd: EXEC LPAREN STRING RPAREN  */
+#line 3121 "cfg.y"
+                                        { (yyval.action)=mk_action(EXEC_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10456 "cfg.tab.c"
+    break;
+
+  case 744: /* cmd: SET_HOST LPAREN STRING RPAREN  */
+#line 3122 "cfg.y"
+                                        { (yyval.action)=mk_action(SET_HOST_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10462 "cfg.tab.c"
+    break;
+
+  case 745: /* cmd: SET_HOST error  */
+#line 3123 "cfg.y"
+                         { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10468 "cfg.tab.c"
+    break;
+
+  case 746: /* cmd: SET_HOST LPAREN error RPAREN  */
+#line 3124 "cfg.y"
+                                       { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10474 "cfg.tab.c"
+    break;
+
+  case 747: /* cmd: PREFIX LPAREN STRING RPAREN  */
+#line 3125 "cfg.y"
+                                      { (yyval.action)=mk_action(PREFIX_T, 1, STRING_ST,  (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10480 "cfg.tab.c"
+    break;
+
+  case 748: /* cmd: PREFIX error  */
+#line 3126 "cfg.y"
+                       { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10486 "cfg.tab.c"
+    break;
+
+  case 749: /* cmd: PREFIX LPAREN error RPAREN  */
+#line 3127 "cfg.y"
+                                     { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10492 "cfg.tab.c"
+    break;
+
+  case 750: /* cmd: STRIP_TAIL LPAREN NUMBER RPAREN  */
+#line 3128 "cfg.y"
+                                          { (yyval.action)=mk_action(STRIP_TAIL_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10498 "cfg.tab.c"
+    break;
+
+  case 751: /* cmd: STRIP_TAIL error  */
+#line 3129 "cfg.y"
+                           { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10504 "cfg.tab.c"
+    break;
+
+  case 752: /* cmd: STRIP_TAIL LPAREN error RPAREN  */
+#line 3130 "cfg.y"
+                                         { (yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 10510 "cfg.tab.c"
+    break;
+
+  case 753: /* cmd: STRIP LPAREN NUMBER RPAREN  */
+#line 3131 "cfg.y"
+                                     { (yyval.action)=mk_action(STRIP_T, 1, NUMBER_ST, (void*) (yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10516 "cfg.tab.c"
+    break;
+
+  case 754: /* cmd: STRIP error  */
+#line 3132 "cfg.y"
+                      { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10522 "cfg.tab.c"
+    break;
+
+  case 755: /* cmd: STRIP LPAREN error RPAREN  */
+#line 3133 "cfg.y"
+                                    { (yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 10528 "cfg.tab.c"
+    break;
+
+  case 756: /* cmd: SET_USERPHONE LPAREN RPAREN  */
+#line 3134 "cfg.y"
+                                      { (yyval.action)=mk_action(SET_USERPHONE_T, 0); set_cfg_pos((yyval.action)); }
+#line 10534 "cfg.tab.c"
+    break;
+
+  case 757: /* cmd: SET_USERPHONE error  */
+#line 3135 "cfg.y"
+                              { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10540 "cfg.tab.c"
+    break;
+
+  case 758: /* cmd: REMOVE_BRANCH LPAREN intno RPAREN  */
+#line 3136 "cfg.y"
+                                            {
+			(yyval.action)=mk_action(REMOVE_BRANCH_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+			set_cfg_pos((yyval.action));
+	}
+#line 10549 "cfg.tab.c"
+    break;
+
+  case 759: /* cmd: REMOVE_BRANCH LPAREN RPAREN  */
+#line 3140 "cfg.y"
+                                      {
+			(yyval.action)=mk_action(REMOVE_BRANCH_T, 0);
+			set_cfg_pos((yyval.action));
+	}
+#line 10558 "cfg.tab.c"
+    break;
+
+  case 760: /* cmd: REMOVE_BRANCH error  */
+#line 3144 "cfg.y"
+                              { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10564 "cfg.tab.c"
+    break;
+
+  case 761: /* cmd: REMOVE_BRANCH LPAREN error RPAREN  */
+#line 3145 "cfg.y"
+                                            { (yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 10570 "cfg.tab.c"
+    break;
+
+  case 762: /* cmd: CLEAR_BRANCHES LPAREN RPAREN  */
+#line 3146 "cfg.y"
+                                       { (yyval.action)=mk_action(CLEAR_BRANCHES_T, 0); set_cfg_pos((yyval.action)); }
+#line 10576 "cfg.tab.c"
+    break;
+
+  case 763: /* cmd: SET_HOSTPORT LPAREN STRING RPAREN  */
+#line 3147 "cfg.y"
+                                            { (yyval.action)=mk_action(SET_HOSTPORT_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10582 "cfg.tab.c"
+    break;
+
+  case 764: /* cmd: SET_HOSTPORT error  */
+#line 3148 "cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10588 "cfg.tab.c"
+    break;
+
+  case 765: /* cmd: SET_HOSTPORT LPAREN error RPAREN  */
+#line 3149 "cfg.y"
+                                           { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10594 "cfg.tab.c"
+    break;
+
+  case 766: /* cmd: SET_HOSTPORTTRANS LPAREN STRING RPAREN  */
+#line 3150 "cfg.y"
+                                                 { (yyval.action)=mk_action(SET_HOSTPORTTRANS_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10600 "cfg.tab.c"
+    break;
+
+  case 767: /* cmd: SET_HOSTPORTTRANS error  */
+#line 3151 "cfg.y"
+                                  { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10606 "cfg.tab.c"
+    break;
+
+  case 768: /* cmd: SET_HOSTPORTTRANS LPAREN error RPAREN  */
+#line 3152 "cfg.y"
+                                                { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10612 "cfg.tab.c"
+    break;
+
+  case 769: /* cmd: SET_PORT LPAREN STRING RPAREN  */
+#line 3153 "cfg.y"
+                                        { (yyval.action)=mk_action(SET_PORT_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10618 "cfg.tab.c"
+    break;
+
+  case 770: /* cmd: SET_PORT error  */
+#line 3154 "cfg.y"
+                         { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10624 "cfg.tab.c"
+    break;
+
+  case 771: /* cmd: SET_PORT LPAREN error RPAREN  */
+#line 3155 "cfg.y"
+                                       { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10630 "cfg.tab.c"
+    break;
+
+  case 772: /* cmd: SET_USER LPAREN STRING RPAREN  */
+#line 3156 "cfg.y"
+                                        { (yyval.action)=mk_action(SET_USER_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10636 "cfg.tab.c"
+    break;
+
+  case 773: /* cmd: SET_USER error  */
+#line 3157 "cfg.y"
+                         { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10642 "cfg.tab.c"
+    break;
+
+  case 774: /* cmd: SET_USER LPAREN error RPAREN  */
+#line 3158 "cfg.y"
+                                       { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10648 "cfg.tab.c"
+    break;
+
+  case 775: /* cmd: SET_USERPASS LPAREN STRING RPAREN  */
+#line 3159 "cfg.y"
+                                            { (yyval.action)=mk_action(SET_USERPASS_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10654 "cfg.tab.c"
+    break;
+
+  case 776: /* cmd: SET_USERPASS error  */
+#line 3160 "cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10660 "cfg.tab.c"
+    break;
+
+  case 777: /* cmd: SET_USERPASS LPAREN error RPAREN  */
+#line 3161 "cfg.y"
+                                           { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10666 "cfg.tab.c"
+    break;
+
+  case 778: /* cmd: SET_URI LPAREN STRING RPAREN  */
+#line 3162 "cfg.y"
+                                       { (yyval.action)=mk_action(SET_URI_T, 1, STRING_ST,(yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 10672 "cfg.tab.c"
+    break;
+
+  case 779: /* cmd: SET_URI error  */
+#line 3163 "cfg.y"
+                        { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10678 "cfg.tab.c"
+    break;
+
+  case 780: /* cmd: SET_URI LPAREN error RPAREN  */
+#line 3164 "cfg.y"
+                                      { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10684 "cfg.tab.c"
+    break;
+
+  case 781: /* cmd: REVERT_URI LPAREN RPAREN  */
+#line 3165 "cfg.y"
+                                   { (yyval.action)=mk_action(REVERT_URI_T, 0); set_cfg_pos((yyval.action)); }
+#line 10690 "cfg.tab.c"
+    break;
+
+  case 782: /* cmd: REVERT_URI  */
+#line 3166 "cfg.y"
+                     { (yyval.action)=mk_action(REVERT_URI_T, 0); set_cfg_pos((yyval.action)); }
+#line 10696 "cfg.tab.c"
+    break;
+
+  case 783: /* cmd: FORCE_RPORT LPAREN RPAREN  */
+#line 3167 "cfg.y"
+                                        { (yyval.action)=mk_action(FORCE_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 10702 "cfg.tab.c"
+    break;
+
+  case 784: /* cmd: FORCE_RPORT  */
+#line 3168 "cfg.y"
+                        {(yyval.action)=mk_action(FORCE_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 10708 "cfg.tab.c"
+    break;
+
+  case 785: /* cmd: ADD_LOCAL_RPORT LPAREN RPAREN  */
+#line 3169 "cfg.y"
+                                        { (yyval.action)=mk_action(ADD_LOCAL_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 10714 "cfg.tab.c"
+    break;
+
+  case 786: /* cmd: ADD_LOCAL_RPORT  */
+#line 3170 "cfg.y"
+                                {(yyval.action)=mk_action(ADD_LOCAL_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 10720 "cfg.tab.c"
+    break;
+
+  case 787: /* cmd: FORCE_TCP_ALIAS LPAREN NUMBER RPAREN  */
+#line 3171 "cfg.y"
+                                                {
+		#ifdef USE_TCP
+			(yyval.action)=mk_action(FORCE_TCP_ALIAS_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+			set_cfg_pos((yyval.action));
+		#else
+			yyerror("tcp support not compiled in");
+		#endif
+	}
+#line 10733 "cfg.tab.c"
+    break;
+
+  case 788: /* cmd: FORCE_TCP_ALIAS LPAREN RPAREN  */
+#line 3179 "cfg.y"
+                                        {
+		#ifdef USE_TCP
+			(yyval.action)=mk_action(FORCE_TCP_ALIAS_T, 0);
+			set_cfg_pos((yyval.action));
+		#else
+			yyerror("tcp support not compiled in");
+		#endif
+	}
+#line 10746 "cfg.tab.c"
+    break;
+
+  case 789: /* cmd: FORCE_TCP_ALIAS  */
+#line 3187 "cfg.y"
+                                                        {
+		#ifdef USE_TCP
+			(yyval.action)=mk_action(FORCE_TCP_ALIAS_T, 0);
+			set_cfg_pos((yyval.action));
+		#else
+			yyerror("tcp support not compiled in");
+		#endif
+	}
+#line 10759 "cfg.tab.c"
+    break;
+
+  case 790: /* cmd: FORCE_TCP_ALIAS LPAREN error RPAREN  */
+#line 3195 "cfg.y"
+                                                {(yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 10765 "cfg.tab.c"
+    break;
+
+  case 791: /* cmd: UDP_MTU_TRY_PROTO LPAREN proto RPAREN  */
+#line 3197 "cfg.y"
+                { (yyval.action)=mk_action(UDP_MTU_TRY_PROTO_T, 1, NUMBER_ST, (yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10771 "cfg.tab.c"
+    break;
+
+  case 792: /* cmd: UDP_MTU_TRY_PROTO LPAREN error RPAREN  */
+#line 3199 "cfg.y"
+                { (yyval.action)=0; yyerror("bad argument, UDP, TCP, TLS or SCTP expected"); }
+#line 10777 "cfg.tab.c"
+    break;
+
+  case 793: /* cmd: SET_ADV_ADDRESS LPAREN listen_id RPAREN  */
+#line 3200 "cfg.y"
+                                                  {
+		(yyval.action)=0;
+		if ((str_tmp=pkg_malloc(sizeof(str)))==0) {
+			LOG(L_CRIT, "ERROR: cfg. parser: out of memory.\n");
+		} else {
+			str_tmp->s=(yyvsp[-1].strval);
+			str_tmp->len=(yyvsp[-1].strval)?strlen((yyvsp[-1].strval)):0;
+			(yyval.action)=mk_action(SET_ADV_ADDR_T, 1, STR_ST, str_tmp);
+			set_cfg_pos((yyval.action));
+		}
+	}
+#line 10793 "cfg.tab.c"
+    break;
+
+  case 794: /* cmd: SET_ADV_ADDRESS LPAREN error RPAREN  */
+#line 3211 "cfg.y"
+                                              { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10799 "cfg.tab.c"
+    break;
+
+  case 795: /* cmd: SET_ADV_ADDRESS error  */
+#line 3212 "cfg.y"
+                                {(yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10805 "cfg.tab.c"
+    break;
+
+  case 796: /* cmd: SET_ADV_PORT LPAREN NUMBER RPAREN  */
+#line 3213 "cfg.y"
+                                            {
+		(yyval.action)=0;
+		tmp=int2str((yyvsp[-1].intval), &i_tmp);
+		if ((str_tmp=pkg_malloc(sizeof(str)))==0) {
+			LOG(L_CRIT, "ERROR: cfg. parser: out of memory.\n");
+		} else {
+			if ((str_tmp->s=pkg_malloc(i_tmp))==0) {
+				LOG(L_CRIT, "ERROR: cfg. parser: out of memory.\n");
+			} else {
+				memcpy(str_tmp->s, tmp, i_tmp);
+				str_tmp->len=i_tmp;
+				(yyval.action)=mk_action(SET_ADV_PORT_T, 1, STR_ST, str_tmp);
+				set_cfg_pos((yyval.action));
+			}
+		}
+	}
+#line 10826 "cfg.tab.c"
+    break;
+
+  case 797: /* cmd: SET_ADV_PORT LPAREN error RPAREN  */
+#line 3229 "cfg.y"
+                                           { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 10832 "cfg.tab.c"
+    break;
+
+  case 798: /* cmd: SET_ADV_PORT error  */
+#line 3230 "cfg.y"
+                              {(yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10838 "cfg.tab.c"
+    break;
+
+  case 799: /* cmd: FORCE_SEND_SOCKET LPAREN phostport RPAREN  */
+#line 3231 "cfg.y"
+                                                    { 
+		(yyval.action)=mk_action(FORCE_SEND_SOCKET_T, 1, SOCKID_ST, (yyvsp[-1].sockid));
+		set_cfg_pos((yyval.action));
+	}
+#line 10847 "cfg.tab.c"
+    break;
+
+  case 800: /* cmd: FORCE_SEND_SOCKET LPAREN error RPAREN  */
+#line 3235 "cfg.y"
+                                                {
+		(yyval.action)=0; yyerror("bad argument, [proto:]host[:port] expected");
+	}
+#line 10855 "cfg.tab.c"
+    break;
+
+  case 801: /* cmd: FORCE_SEND_SOCKET error  */
+#line 3238 "cfg.y"
+                                  {(yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10861 "cfg.tab.c"
+    break;
+
+  case 802: /* cmd: SET_FWD_NO_CONNECT LPAREN RPAREN  */
+#line 3239 "cfg.y"
+                                                {
+		(yyval.action)=mk_action(SET_FWD_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10869 "cfg.tab.c"
+    break;
+
+  case 803: /* cmd: SET_FWD_NO_CONNECT  */
+#line 3242 "cfg.y"
+                                {
+		(yyval.action)=mk_action(SET_FWD_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10877 "cfg.tab.c"
+    break;
+
+  case 804: /* cmd: SET_RPL_NO_CONNECT LPAREN RPAREN  */
+#line 3245 "cfg.y"
+                                                {
+		(yyval.action)=mk_action(SET_RPL_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10885 "cfg.tab.c"
+    break;
+
+  case 805: /* cmd: SET_RPL_NO_CONNECT  */
+#line 3248 "cfg.y"
+                                {
+		(yyval.action)=mk_action(SET_RPL_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10893 "cfg.tab.c"
+    break;
+
+  case 806: /* cmd: SET_FWD_CLOSE LPAREN RPAREN  */
+#line 3251 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(SET_FWD_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10901 "cfg.tab.c"
+    break;
+
+  case 807: /* cmd: SET_FWD_CLOSE  */
+#line 3254 "cfg.y"
+                        {
+		(yyval.action)=mk_action(SET_FWD_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10909 "cfg.tab.c"
+    break;
+
+  case 808: /* cmd: SET_RPL_CLOSE LPAREN RPAREN  */
+#line 3257 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(SET_RPL_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10917 "cfg.tab.c"
+    break;
+
+  case 809: /* cmd: SET_RPL_CLOSE  */
+#line 3260 "cfg.y"
+                        {
+		(yyval.action)=mk_action(SET_RPL_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 10925 "cfg.tab.c"
+    break;
+
+  case 810: /* cmd: CFG_SELECT LPAREN STRING COMMA NUMBER RPAREN  */
+#line 3263 "cfg.y"
+                                                       {
+		(yyval.action)=mk_action(CFG_SELECT_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+	}
+#line 10933 "cfg.tab.c"
+    break;
+
+  case 811: /* cmd: CFG_SELECT LPAREN STRING COMMA rval_expr RPAREN  */
+#line 3266 "cfg.y"
+                                                          {
+		(yyval.action)=mk_action(CFG_SELECT_T, 2, STRING_ST, (yyvsp[-3].strval), RVE_ST, (yyvsp[-1].rv_expr)); set_cfg_pos((yyval.action));
+	}
+#line 10941 "cfg.tab.c"
+    break;
+
+  case 812: /* cmd: CFG_SELECT error  */
+#line 3269 "cfg.y"
+                           { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10947 "cfg.tab.c"
+    break;
+
+  case 813: /* cmd: CFG_SELECT LPAREN error RPAREN  */
+#line 3270 "cfg.y"
+                                         { (yyval.action)=0; yyerror("bad arguments, string and number expected"); }
+#line 10953 "cfg.tab.c"
+    break;
+
+  case 814: /* cmd: CFG_RESET LPAREN STRING RPAREN  */
+#line 3271 "cfg.y"
+                                         {
+		(yyval.action)=mk_action(CFG_RESET_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action));
+	}
+#line 10961 "cfg.tab.c"
+    break;
+
+  case 815: /* cmd: CFG_RESET error  */
+#line 3274 "cfg.y"
+                          { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10967 "cfg.tab.c"
+    break;
+
+  case 816: /* cmd: CFG_RESET LPAREN error RPAREN  */
+#line 3275 "cfg.y"
+                                        { (yyval.action)=0; yyerror("bad arguments, string expected"); }
+#line 10973 "cfg.tab.c"
+    break;
+
+  case 817: /* $@9: %empty  */
+#line 3276 "cfg.y"
+             {mod_func_action = mk_action(MODULE0_T, 2, MODEXP_ST, NULL, NUMBER_ST,
+			0); }
+#line 10980 "cfg.tab.c"
+    break;
+
+  case 818: /* cmd: ID $@9 LPAREN func_params RPAREN  */
+#line 3277 "cfg.y"
+                                                        {
+		mod_func_action->val[0].u.data =
+			find_export_record((yyvsp[-4].strval), mod_func_action->val[1].u.number, rt,
+								&u_tmp);
+		if (mod_func_action->val[0].u.data == 0) {
+			if (find_export_record((yyvsp[-4].strval), mod_func_action->val[1].u.number, 0,
+									&u_tmp) ) {
+					LOG(L_ERR, "misused command %s\n", (yyvsp[-4].strval));
+					yyerror("Command cannot be used in the block\n");
+			} else {
+				LOG(L_ERR, "cfg. parser: failed to find command %s (params %ld)\n",
+						(yyvsp[-4].strval), mod_func_action->val[1].u.number);
+				yyerror("unknown command, missing loadmodule?\n");
+			}
+			free_mod_func_action(mod_func_action);
+			mod_func_action=0;
+		}else{
+			if (mod_func_action && mod_f_params_pre_fixup(mod_func_action)<0) {
+				/* error messages are printed inside the function */
+				free_mod_func_action(mod_func_action);
+				mod_func_action = 0;
+				YYERROR;
+			}
+		}
+		(yyval.action) = mod_func_action;
+		set_cfg_pos((yyval.action));
+	}
+#line 11012 "cfg.tab.c"
+    break;
+
+  case 819: /* cmd: ID error  */
+#line 3304 "cfg.y"
+                                                        { yyerror("'('')' expected (function call)");}
+#line 11018 "cfg.tab.c"
+    break;
+
+  case 821: /* func_params: func_params COMMA func_param  */
+#line 3308 "cfg.y"
+                                       { }
+#line 11024 "cfg.tab.c"
+    break;
+
+  case 822: /* func_params: func_param  */
+#line 3309 "cfg.y"
+                     {}
+#line 11030 "cfg.tab.c"
+    break;
+
+  case 823: /* func_param: rval_expr  */
+#line 3312 "cfg.y"
+                  {
+		if ((yyvsp[0].rv_expr) && mod_func_action->val[1].u.number < MAX_ACTIONS-2) {
+			mod_func_action->val[mod_func_action->val[1].u.number+2].type =
+				RVE_ST;
+			mod_func_action->val[mod_func_action->val[1].u.number+2].u.data =
+				(yyvsp[0].rv_expr);
+			mod_func_action->val[1].u.number++;
+		} else if ((yyvsp[0].rv_expr)) {
+			yyerror("Too many arguments\n");
+			YYERROR;
+		} else {
+			YYERROR;
+		}
+	}
+#line 11049 "cfg.tab.c"
+    break;
+
+  case 824: /* ret_cmd: DROP LPAREN RPAREN  */
+#line 3329 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, 0, NUMBER_ST,
+						(void*)(DROP_R_F|EXIT_R_F)); set_cfg_pos((yyval.action));
+	}
+#line 11058 "cfg.tab.c"
+    break;
+
+  case 825: /* ret_cmd: DROP rval_expr  */
+#line 3333 "cfg.y"
+                                {
+		(yyval.action)=mk_action(DROP_T, 2, RVE_ST, (yyvsp[0].rv_expr), NUMBER_ST,
+						(void*)(DROP_R_F|EXIT_R_F)); set_cfg_pos((yyval.action));
+	}
+#line 11067 "cfg.tab.c"
+    break;
+
+  case 826: /* ret_cmd: DROP  */
+#line 3337 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, 0, NUMBER_ST, 
+						(void*)(DROP_R_F|EXIT_R_F)); set_cfg_pos((yyval.action));
+	}
+#line 11076 "cfg.tab.c"
+    break;
+
+  case 827: /* ret_cmd: EXIT LPAREN RPAREN  */
+#line 3341 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)EXIT_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 11086 "cfg.tab.c"
+    break;
+
+  case 828: /* ret_cmd: EXIT rval_expr  */
+#line 3346 "cfg.y"
+                                {
+		(yyval.action)=mk_action(DROP_T, 2, RVE_ST, (yyvsp[0].rv_expr), NUMBER_ST, (void*)EXIT_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 11095 "cfg.tab.c"
+    break;
+
+  case 829: /* ret_cmd: EXIT  */
+#line 3350 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)EXIT_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 11105 "cfg.tab.c"
+    break;
+
+  case 830: /* ret_cmd: RETURN  */
+#line 3355 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)RETURN_R_F); set_cfg_pos((yyval.action));
+	}
+#line 11114 "cfg.tab.c"
+    break;
+
+  case 831: /* ret_cmd: RETURN LPAREN RPAREN  */
+#line 3359 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)RETURN_R_F); set_cfg_pos((yyval.action));
+	}
+#line 11123 "cfg.tab.c"
+    break;
+
+  case 832: /* ret_cmd: RETURN rval_expr  */
+#line 3363 "cfg.y"
+                                {
+		(yyval.action)=mk_action(DROP_T, 2, RVE_ST, (yyvsp[0].rv_expr), NUMBER_ST, (void*)RETURN_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 11132 "cfg.tab.c"
+    break;
+
+  case 833: /* ret_cmd: BREAK  */
+#line 3367 "cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, 0, NUMBER_ST, (void*)BREAK_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 11141 "cfg.tab.c"
+    break;
+
+
+#line 11145 "cfg.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 3373 "cfg.y"
+
+
+static void get_cpos(struct cfg_pos* pos)
+{
+	pos->s_line=startline;
+	pos->e_line=line;
+	pos->s_col=startcolumn;
+	pos->e_col=column-1;
+	if(finame==0)
+		finame = (cfg_file!=0)?cfg_file:"default";
+	pos->fname=finame;
+}
+
+
+static void warn_at(struct cfg_pos* p, char* format, ...)
+{
+	va_list ap;
+	char s[256];
+	
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	if (p->e_line!=p->s_line)
+		LOG(L_WARN, "warning in config file %s, from line %d, column %d to"
+					" line %d, column %d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_line, p->e_col, s);
+	else if (p->s_col!=p->e_col)
+		LOG(L_WARN, "warning in config file %s, line %d, column %d-%d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_col, s);
+	else
+		LOG(L_WARN, "warning in config file %s, line %d, column %d: %s\n",
+				p->fname, p->s_line, p->s_col, s);
+	cfg_warnings++;
+}
+
+
+
+static void yyerror_at(struct cfg_pos* p, char* format, ...)
+{
+	va_list ap;
+	char s[256];
+	
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	if (p->e_line!=p->s_line)
+		LOG(L_CRIT, "parse error in config file %s, from line %d, column %d"
+					" to line %d, column %d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_line, p->e_col, s);
+	else if (p->s_col!=p->e_col)
+		LOG(L_CRIT,"parse error in config file %s, line %d, column %d-%d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_col, s);
+	else
+		LOG(L_CRIT, "parse error in config file %s, line %d, column %d: %s\n",
+					p->fname, p->s_line, p->s_col, s);
+	cfg_errors++;
+}
+
+
+
+static void warn(char* format, ...)
+{
+	va_list ap;
+	char s[256];
+	struct cfg_pos pos;
+	
+	get_cpos(&pos);
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	warn_at(&pos, s);
+}
+
+
+
+static void yyerror(char* format, ...)
+{
+	va_list ap;
+	char s[256];
+	struct cfg_pos pos;
+	
+	get_cpos(&pos);
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	yyerror_at(&pos, s);
+}
+
+
+
+/** mk_rval_expr_v wrapper.
+ *  checks mk_rval_expr_v return value and sets the cfg. pos
+ *  (line and column numbers)
+ *  @return rval_expr* on success, 0 on error (@see mk_rval_expr_v)
+ */
+static struct rval_expr* mk_rve_rval(enum rval_type type, void* v)
+{
+	struct rval_expr* ret;
+	struct cfg_pos pos;
+
+	get_cpos(&pos);
+	ret=mk_rval_expr_v(type, v, &pos);
+	if (ret==0){
+		yyerror("internal error: failed to create rval expr");
+		/* YYABORT; */
+	}
+	return ret;
+}
+
+
+/** mk_rval_expr1 wrapper.
+ *  checks mk_rval_expr1 return value (!=0 and type checking)
+ *  @return rval_expr* on success, 0 on error (@see mk_rval_expr1)
+ */
+static struct rval_expr* mk_rve1(enum rval_expr_op op, struct rval_expr* rve1)
+{
+	struct rval_expr* ret;
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+	
+	if (rve1==0)
+		return 0;
+	ret=mk_rval_expr1(op, rve1, &rve1->fpos);
+	if (ret && (rve_check_type(&type, ret, &bad_rve, &bad_t, &exp_t)!=1)){
+		yyerror_at(&rve1->fpos, "bad expression: type mismatch"
+					" (%s instead of %s)", rval_type_name(bad_t),
+					rval_type_name(exp_t));
+		rve_destroy(ret);
+		ret=0;
+	}
+	return ret;
+}
+
+
+/** mk_rval_expr2 wrapper.
+ *  checks mk_rval_expr2 return value (!=0 and type checking)
+ *  @return rval_expr* on success, 0 on error (@see mk_rval_expr2)
+ */
+static struct rval_expr* mk_rve2(enum rval_expr_op op, struct rval_expr* rve1,
+									struct rval_expr* rve2)
+{
+	struct rval_expr* ret;
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+	struct cfg_pos pos;
+	
+	if ((rve1==0) || (rve2==0))
+		return 0;
+	bad_rve=0;
+	bad_t=0;
+	exp_t=0;
+	cfg_pos_join(&pos, &rve1->fpos, &rve2->fpos);
+	ret=mk_rval_expr2(op, rve1, rve2, &pos);
+	if (ret && (rve_check_type(&type, ret, &bad_rve, &bad_t, &exp_t)!=1)){
+		if (bad_rve)
+			yyerror_at(&pos, "bad expression: type mismatch:"
+						" %s instead of %s at (%d,%d)",
+						rval_type_name(bad_t), rval_type_name(exp_t),
+						bad_rve->fpos.s_line, bad_rve->fpos.s_col);
+		else
+			yyerror("BUG: unexpected null \"bad\" expression\n");
+		rve_destroy(ret);
+		ret=0;
+	}
+	return ret;
+}
+
+
+/** check if the expression is an int.
+ * if the expression does not evaluate to an int return -1 and
+ * log an error.
+ * @return 0 success, no warnings; 1 success but warnings; -1 on error */
+static int rval_expr_int_check(struct rval_expr *rve)
+{
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+	
+	if (rve==0){
+		yyerror("invalid expression");
+		return -1;
+	}else if (!rve_check_type(&type, rve, &bad_rve, &bad_t ,&exp_t)){
+		if (bad_rve)
+			yyerror_at(&rve->fpos, "bad expression: type mismatch:"
+						" %s instead of %s at (%d,%d)",
+						rval_type_name(bad_t), rval_type_name(exp_t),
+						bad_rve->fpos.s_line, bad_rve->fpos.s_col);
+		else
+			yyerror("BUG: unexpected null \"bad\" expression\n");
+		return -1;
+	}else if (type!=RV_INT && type!=RV_NONE){
+		warn_at(&rve->fpos, "non-int expression (you might want to use"
+				" casts)\n");
+		return 1;
+	}
+	return 0;
+}
+
+
+/** warn if the expression is constant.
+ * @return 0 on success (no warning), 1 when warning */
+static int warn_ct_rve(struct rval_expr *rve, char* name)
+{
+	if (rve && rve_is_constant(rve)){
+		warn_at(&rve->fpos, "constant value in %s%s",
+				name?name:"expression", name?"(...)":"");
+		return 1;
+	}
+	return 0;
+}
+
+
+static struct name_lst* mk_name_lst(char* host, int flags)
+{
+	struct name_lst* l;
+	if (host==0) return 0;
+	l=pkg_malloc(sizeof(struct name_lst));
+	if (l==0) {
+		LOG(L_CRIT,"ERROR: cfg. parser: out of memory.\n");
+	} else {
+		l->name=host;
+		l->flags=flags;
+		l->next=0;
+	}
+	return l;
+}
+
+
+static struct socket_id* mk_listen_id(char* host, int proto, int port)
+{
+	struct socket_id* l;
+	if (host==0) return 0;
+	l=pkg_malloc(sizeof(struct socket_id));
+	if (l==0) {
+		LOG(L_CRIT,"ERROR: cfg. parser: out of memory.\n");
+	} else {
+		l->addr_lst=mk_name_lst(host, 0);
+		if (l->addr_lst==0){
+			pkg_free(l);
+			return 0;
+		}
+		l->flags=0;
+		l->port=port;
+		l->proto=proto;
+		l->next=0;
+	}
+	return l;
+}
+
+
+static void free_name_lst(struct name_lst* lst)
+{
+	struct name_lst* tmp;
+	
+	while(lst){
+		tmp=lst;
+		lst=lst->next;
+		pkg_free(tmp);
+	}
+}
+
+
+static struct socket_id* mk_listen_id2(struct name_lst* addr_l, int proto,
+										int port)
+{
+	struct socket_id* l;
+	if (addr_l==0) return 0;
+	l=pkg_malloc(sizeof(struct socket_id));
+	if (l==0) {
+		LOG(L_CRIT,"ERROR: cfg. parser: out of memory.\n");
+	} else {
+		l->flags=addr_l->flags;
+		l->port=port;
+		l->proto=proto;
+		l->addr_lst=addr_l;
+		l->next=0;
+	}
+	return l;
+}
+
+
+static void free_socket_id(struct socket_id* i)
+{
+	free_name_lst(i->addr_lst);
+	pkg_free(i);
+}
+
+
+static void free_socket_id_lst(struct socket_id* lst)
+{
+	struct socket_id* tmp;
+	
+	while(lst){
+		tmp=lst;
+		lst=lst->next;
+		free_socket_id(tmp);
+	}
+}
+
+
+/** create a temporary case statmenet structure.
+ *  *err will be filled in case of error (return == 0):
+ *   -1 - non constant expression
+ *   -2 - expression error (bad type)
+ *   -10 - memory allocation error
+ */
+static struct case_stms* mk_case_stm(struct rval_expr* ct, int is_re,
+											struct action* a, int* err)
+{
+	struct case_stms* s;
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+	enum match_str_type t;
+	
+	t=MATCH_UNKNOWN;
+	if (ct){
+		/* if ct!=0 => case, else if ct==0 is a default */
+		if (!rve_is_constant(ct)){
+			yyerror_at(&ct->fpos, "non constant expression in case");
+			*err=-1;
+			return 0;
+		}
+		if (rve_check_type(&type, ct, &bad_rve, &bad_t, &exp_t)!=1){
+			yyerror_at(&ct->fpos, "bad expression: type mismatch:"
+							" %s instead of %s at (%d,%d)",
+							rval_type_name(bad_t), rval_type_name(exp_t),
+							bad_rve->fpos.s_line, bad_rve->fpos.s_col);
+			*err=-2;
+			return 0;
+		}
+		if (is_re)
+			t=MATCH_RE;
+		else if (type==RV_STR)
+			t=MATCH_STR;
+		else
+			t=MATCH_INT;
+	}
+
+	s=pkg_malloc(sizeof(*s));
+	if (s==0) {
+		yyerror("internal error: memory allocation failure");
+		*err=-10;
+	} else {
+		memset(s, 0, sizeof(*s));
+		s->ct_rve=ct;
+		s->type=t;
+		s->actions=a;
+		s->next=0;
+		s->append=0;
+	}
+	return s;
+}
+
+
+/*
+ * @return 0 on success, -1 on error.
+ */
+static int case_check_type(struct case_stms* stms)
+{
+	struct case_stms* c;
+	struct case_stms* s;
+	
+	for(c=stms; c ; c=c->next){
+		if (!c->ct_rve) continue;
+		for (s=c->next; s; s=s->next){
+			if (!s->ct_rve) continue;
+			if ((s->type!=c->type) &&
+				!(	(c->type==MATCH_STR || c->type==MATCH_RE) &&
+					(s->type==MATCH_STR || s->type==MATCH_RE) ) ){
+					yyerror_at(&s->ct_rve->fpos, "type mismatch in case");
+					return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+
+/*
+ * @return 0 on success, -1 on error.
+ */
+static int case_check_default(struct case_stms* stms)
+{
+	struct case_stms* c;
+	int default_no;
+	
+	default_no=0;
+	for(c=stms; c ; c=c->next)
+		if (c->ct_rve==0) default_no++;
+	return (default_no<=1)?0:-1;
+}
+
+
+
+/** fixes the parameters and the type of a module function call.
+ * It is done here instead of fix action, to have quicker feedback
+ * on error cases (e.g. passing a non constant to a function with a 
+ * declared fixup) 
+ * The rest of the fixup is done inside do_action().
+ * @param a - filled module function call (MODULE*_T) action structure
+ *            complete with parameters, starting at val[2] and parameter
+ *            number at val[1].
+ * @return 0 on success, -1 on error (it will also print the error msg.).
+ *
+ */
+static int mod_f_params_pre_fixup(struct action* a)
+{
+	sr31_cmd_export_t* cmd_exp;
+	action_u_t* params;
+	int param_no;
+	struct rval_expr* rve;
+	struct rvalue* rv;
+	int r;
+	str s;
+	
+	cmd_exp = a->val[0].u.data;
+	param_no = a->val[1].u.number;
+	params = &a->val[2];
+	
+	switch(cmd_exp->param_no) {
+		case 0:
+			a->type = MODULE0_T;
+			break;
+		case 1:
+			a->type = MODULE1_T;
+			break;
+		case 2:
+			a->type = MODULE2_T;
+			break;
+		case 3:
+			a->type = MODULE3_T;
+			break;
+		case 4:
+			a->type = MODULE4_T;
+			break;
+		case 5:
+			a->type = MODULE5_T;
+			break;
+		case 6:
+			a->type = MODULE6_T;
+			break;
+		case VAR_PARAM_NO:
+			a->type = MODULEX_T;
+			break;
+		default:
+			yyerror("function %s: bad definition"
+					" (invalid number of parameters)", cmd_exp->name);
+			return -1;
+	}
+	
+	if ( cmd_exp->fixup) {
+		if (is_fparam_rve_fixup(cmd_exp->fixup))
+			/* mark known fparam rve safe fixups */
+			cmd_exp->fixup_flags  |= FIXUP_F_FPARAM_RVE;
+		else if (!(cmd_exp->fixup_flags & FIXUP_F_FPARAM_RVE) &&
+				 cmd_exp->free_fixup == 0) {
+			/* v0 or v1 functions that have fixups and no coresp. fixup_free
+			   functions, need constant, string params.*/
+			for (r=0; r < param_no; r++) {
+				rve=params[r].u.data;
+				if (!rve_is_constant(rve)) {
+					yyerror_at(&rve->fpos, "function %s: parameter %d is not"
+								" constant\n", cmd_exp->name, r+1);
+					return -1;
+				}
+				if ((rv = rval_expr_eval(0, 0, rve)) == 0 ||
+						rval_get_str(0, 0, &s, rv, 0) < 0 ) {
+					/* out of mem or bug ? */
+					rval_destroy(rv);
+					yyerror_at(&rve->fpos, "function %s: bad parameter %d"
+									" expression\n", cmd_exp->name, r+1);
+					return -1;
+				}
+				rval_destroy(rv);
+				rve_destroy(rve);
+				params[r].type = STRING_ST; /* asciiz */
+				params[r].u.string = s.s;
+				params[r].u.str.len = s.len; /* not used right now */
+			}
+		}
+	}/* else
+		if no fixups are present, the RVEs can be transformed
+		into strings at runtime, allowing seamless var. use
+		even with old functions.
+		Further optimizations -> in fix_actions()
+		*/
+	return 0;
+}
+
+
+
+/** frees a filled module function call action structure.
+ * @param a - filled module function call action structure
+ *            complete with parameters, starting at val[2] and parameter
+ *            number at val[1].
+ */
+static void free_mod_func_action(struct action* a)
+{
+	action_u_t* params;
+	int param_no;
+	int r;
+	
+	param_no = a->val[1].u.number;
+	params = &a->val[2];
+	
+	for (r=0; r < param_no; r++)
+		if (params[r].u.data)
+			rve_destroy(params[r].u.data);
+	pkg_free(a);
+}
+
+
+
+/*
+int main(int argc, char ** argv)
+{
+	if (yyparse()!=0)
+		fprintf(stderr, "parsing error\n");
+}
+*/
@@ -0,0 +1,415 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_CFG_TAB_H_INCLUDED
+# define YY_YY_CFG_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    FORWARD = 258,                 /* FORWARD  */
+    FORWARD_TCP = 259,             /* FORWARD_TCP  */
+    FORWARD_TLS = 260,             /* FORWARD_TLS  */
+    FORWARD_SCTP = 261,            /* FORWARD_SCTP  */
+    FORWARD_UDP = 262,             /* FORWARD_UDP  */
+    EXIT = 263,                    /* EXIT  */
+    DROP = 264,                    /* DROP  */
+    RETURN = 265,                  /* RETURN  */
+    BREAK = 266,                   /* BREAK  */
+    LOG_TOK = 267,                 /* LOG_TOK  */
+    ERROR = 268,                   /* ERROR  */
+    ROUTE = 269,                   /* ROUTE  */
+    ROUTE_REQUEST = 270,           /* ROUTE_REQUEST  */
+    ROUTE_FAILURE = 271,           /* ROUTE_FAILURE  */
+    ROUTE_ONREPLY = 272,           /* ROUTE_ONREPLY  */
+    ROUTE_REPLY = 273,             /* ROUTE_REPLY  */
+    ROUTE_BRANCH = 274,            /* ROUTE_BRANCH  */
+    ROUTE_SEND = 275,              /* ROUTE_SEND  */
+    ROUTE_EVENT = 276,             /* ROUTE_EVENT  */
+    EXEC = 277,                    /* EXEC  */
+    SET_HOST = 278,                /* SET_HOST  */
+    SET_HOSTPORT = 279,            /* SET_HOSTPORT  */
+    SET_HOSTPORTTRANS = 280,       /* SET_HOSTPORTTRANS  */
+    PREFIX = 281,                  /* PREFIX  */
+    STRIP = 282,                   /* STRIP  */
+    STRIP_TAIL = 283,              /* STRIP_TAIL  */
+    SET_USERPHONE = 284,           /* SET_USERPHONE  */
+    APPEND_BRANCH = 285,           /* APPEND_BRANCH  */
+    REMOVE_BRANCH = 286,           /* REMOVE_BRANCH  */
+    CLEAR_BRANCHES = 287,          /* CLEAR_BRANCHES  */
+    SET_USER = 288,                /* SET_USER  */
+    SET_USERPASS = 289,            /* SET_USERPASS  */
+    SET_PORT = 290,                /* SET_PORT  */
+    SET_URI = 291,                 /* SET_URI  */
+    REVERT_URI = 292,              /* REVERT_URI  */
+    FORCE_RPORT = 293,             /* FORCE_RPORT  */
+    ADD_LOCAL_RPORT = 294,         /* ADD_LOCAL_RPORT  */
+    FORCE_TCP_ALIAS = 295,         /* FORCE_TCP_ALIAS  */
+    UDP_MTU = 296,                 /* UDP_MTU  */
+    UDP_MTU_TRY_PROTO = 297,       /* UDP_MTU_TRY_PROTO  */
+    UDP4_RAW = 298,                /* UDP4_RAW  */
+    UDP4_RAW_MTU = 299,            /* UDP4_RAW_MTU  */
+    UDP4_RAW_TTL = 300,            /* UDP4_RAW_TTL  */
+    IF = 301,                      /* IF  */
+    ELSE = 302,                    /* ELSE  */
+    SET_ADV_ADDRESS = 303,         /* SET_ADV_ADDRESS  */
+    SET_ADV_PORT = 304,            /* SET_ADV_PORT  */
+    FORCE_SEND_SOCKET = 305,       /* FORCE_SEND_SOCKET  */
+    SET_FWD_NO_CONNECT = 306,      /* SET_FWD_NO_CONNECT  */
+    SET_RPL_NO_CONNECT = 307,      /* SET_RPL_NO_CONNECT  */
+    SET_FWD_CLOSE = 308,           /* SET_FWD_CLOSE  */
+    SET_RPL_CLOSE = 309,           /* SET_RPL_CLOSE  */
+    SWITCH = 310,                  /* SWITCH  */
+    CASE = 311,                    /* CASE  */
+    DEFAULT = 312,                 /* DEFAULT  */
+    WHILE = 313,                   /* WHILE  */
+    CFG_SELECT = 314,              /* CFG_SELECT  */
+    CFG_RESET = 315,               /* CFG_RESET  */
+    URIHOST = 316,                 /* URIHOST  */
+    URIPORT = 317,                 /* URIPORT  */
+    MAX_LEN = 318,                 /* MAX_LEN  */
+    SETFLAG = 319,                 /* SETFLAG  */
+    RESETFLAG = 320,               /* RESETFLAG  */
+    ISFLAGSET = 321,               /* ISFLAGSET  */
+    SETAVPFLAG = 322,              /* SETAVPFLAG  */
+    RESETAVPFLAG = 323,            /* RESETAVPFLAG  */
+    ISAVPFLAGSET = 324,            /* ISAVPFLAGSET  */
+    METHOD = 325,                  /* METHOD  */
+    URI = 326,                     /* URI  */
+    FROM_URI = 327,                /* FROM_URI  */
+    TO_URI = 328,                  /* TO_URI  */
+    SRCIP = 329,                   /* SRCIP  */
+    SRCPORT = 330,                 /* SRCPORT  */
+    DSTIP = 331,                   /* DSTIP  */
+    DSTPORT = 332,                 /* DSTPORT  */
+    TOIP = 333,                    /* TOIP  */
+    TOPORT = 334,                  /* TOPORT  */
+    SNDIP = 335,                   /* SNDIP  */
+    SNDPORT = 336,                 /* SNDPORT  */
+    SNDPROTO = 337,                /* SNDPROTO  */
+    SNDAF = 338,                   /* SNDAF  */
+    PROTO = 339,                   /* PROTO  */
+    AF = 340,                      /* AF  */
+    MYSELF = 341,                  /* MYSELF  */
+    MSGLEN = 342,                  /* MSGLEN  */
+    UDP = 343,                     /* UDP  */
+    TCP = 344,                     /* TCP  */
+    TLS = 345,                     /* TLS  */
+    SCTP = 346,                    /* SCTP  */
+    WS = 347,                      /* WS  */
+    WSS = 348,                     /* WSS  */
+    DEBUG_V = 349,                 /* DEBUG_V  */
+    FORK = 350,                    /* FORK  */
+    FORK_DELAY = 351,              /* FORK_DELAY  */
+    MODINIT_DELAY = 352,           /* MODINIT_DELAY  */
+    LOGSTDERROR = 353,             /* LOGSTDERROR  */
+    LOGFACILITY = 354,             /* LOGFACILITY  */
+    LOGNAME = 355,                 /* LOGNAME  */
+    LOGCOLOR = 356,                /* LOGCOLOR  */
+    LISTEN = 357,                  /* LISTEN  */
+    ADVERTISE = 358,               /* ADVERTISE  */
+    ALIAS = 359,                   /* ALIAS  */
+    SR_AUTO_ALIASES = 360,         /* SR_AUTO_ALIASES  */
+    DNS = 361,                     /* DNS  */
+    REV_DNS = 362,                 /* REV_DNS  */
+    DNS_TRY_IPV6 = 363,            /* DNS_TRY_IPV6  */
+    DNS_TRY_NAPTR = 364,           /* DNS_TRY_NAPTR  */
+    DNS_SRV_LB = 365,              /* DNS_SRV_LB  */
+    DNS_UDP_PREF = 366,            /* DNS_UDP_PREF  */
+    DNS_TCP_PREF = 367,            /* DNS_TCP_PREF  */
+    DNS_TLS_PREF = 368,            /* DNS_TLS_PREF  */
+    DNS_SCTP_PREF = 369,           /* DNS_SCTP_PREF  */
+    DNS_RETR_TIME = 370,           /* DNS_RETR_TIME  */
+    DNS_RETR_NO = 371,             /* DNS_RETR_NO  */
+    DNS_SERVERS_NO = 372,          /* DNS_SERVERS_NO  */
+    DNS_USE_SEARCH = 373,          /* DNS_USE_SEARCH  */
+    DNS_SEARCH_FMATCH = 374,       /* DNS_SEARCH_FMATCH  */
+    DNS_NAPTR_IGNORE_RFC = 375,    /* DNS_NAPTR_IGNORE_RFC  */
+    DNS_CACHE_INIT = 376,          /* DNS_CACHE_INIT  */
+    DNS_USE_CACHE = 377,           /* DNS_USE_CACHE  */
+    DNS_USE_FAILOVER = 378,        /* DNS_USE_FAILOVER  */
+    DNS_CACHE_FLAGS = 379,         /* DNS_CACHE_FLAGS  */
+    DNS_CACHE_NEG_TTL = 380,       /* DNS_CACHE_NEG_TTL  */
+    DNS_CACHE_MIN_TTL = 381,       /* DNS_CACHE_MIN_TTL  */
+    DNS_CACHE_MAX_TTL = 382,       /* DNS_CACHE_MAX_TTL  */
+    DNS_CACHE_MEM = 383,           /* DNS_CACHE_MEM  */
+    DNS_CACHE_GC_INT = 384,        /* DNS_CACHE_GC_INT  */
+    DNS_CACHE_DEL_NONEXP = 385,    /* DNS_CACHE_DEL_NONEXP  */
+    AUTO_BIND_IPV6 = 386,          /* AUTO_BIND_IPV6  */
+    DST_BLST_INIT = 387,           /* DST_BLST_INIT  */
+    USE_DST_BLST = 388,            /* USE_DST_BLST  */
+    DST_BLST_MEM = 389,            /* DST_BLST_MEM  */
+    DST_BLST_TTL = 390,            /* DST_BLST_TTL  */
+    DST_BLST_GC_INT = 391,         /* DST_BLST_GC_INT  */
+    DST_BLST_UDP_IMASK = 392,      /* DST_BLST_UDP_IMASK  */
+    DST_BLST_TCP_IMASK = 393,      /* DST_BLST_TCP_IMASK  */
+    DST_BLST_TLS_IMASK = 394,      /* DST_BLST_TLS_IMASK  */
+    DST_BLST_SCTP_IMASK = 395,     /* DST_BLST_SCTP_IMASK  */
+    PORT = 396,                    /* PORT  */
+    STAT = 397,                    /* STAT  */
+    CHILDREN = 398,                /* CHILDREN  */
+    SOCKET_WORKERS = 399,          /* SOCKET_WORKERS  */
+    FOLD_CONST_COND = 400,         /* FOLD_CONST_COND  */
+    UDP_RCV_BATCH = 401,           /* UDP_RCV_BATCH  */
+    UDP_SND_BATCH = 402,           /* UDP_SND_BATCH  */
+    UDP_REUSE_PORT = 403,          /* UDP_REUSE_PORT  */
+    SOCKET_CPU_AFFINITY = 404,     /* SOCKET_CPU_AFFINITY  */
+    CHECK_VIA = 405,               /* CHECK_VIA  */
+    PHONE2TEL = 406,               /* PHONE2TEL  */
+    MEMLOG = 407,                  /* MEMLOG  */
+    MEMDBG = 408,                  /* MEMDBG  */
+    MEMSUM = 409,                  /* MEMSUM  */
+    MEMSAFETY = 410,               /* MEMSAFETY  */
+    MEMJOIN = 411,                 /* MEMJOIN  */
+    CORELOG = 412,                 /* CORELOG  */
+    SIP_WARNING = 413,             /* SIP_WARNING  */
+    SERVER_SIGNATURE = 414,        /* SERVER_SIGNATURE  */
+    SERVER_HEADER = 415,           /* SERVER_HEADER  */
+    USER_AGENT_HEADER = 416,       /* USER_AGENT_HEADER  */
+    REPLY_TO_VIA = 417,            /* REPLY_TO_VIA  */
+    LOADMODULE = 418,              /* LOADMODULE  */
+    LOADPATH = 419,                /* LOADPATH  */
+    MODPARAM = 420,                /* MODPARAM  */
+    MAXBUFFER = 421,               /* MAXBUFFER  */
+    SQL_BUFFER_SIZE = 422,         /* SQL_BUFFER_SIZE  */
+    USER = 423,                    /* USER  */
+    GROUP = 424,                   /* GROUP  */
+    CHROOT = 425,                  /* CHROOT  */
+    WDIR = 426,                    /* WDIR  */
+    MHOMED = 427,                  /* MHOMED  */
+    DISABLE_TCP = 428,             /* DISABLE_TCP  */
+    TCP_ACCEPT_ALIASES = 429,      /* TCP_ACCEPT_ALIASES  */
+    TCP_CHILDREN = 430,            /* TCP_CHILDREN  */
+    TCP_CONNECT_TIMEOUT = 431,     /* TCP_CONNECT_TIMEOUT  */
+    TCP_SEND_TIMEOUT = 432,        /* TCP_SEND_TIMEOUT  */
+    TCP_CON_LIFETIME = 433,        /* TCP_CON_LIFETIME  */
+    TCP_POLL_METHOD = 434,         /* TCP_POLL_METHOD  */
+    TCP_MAX_CONNECTIONS = 435,     /* TCP_MAX_CONNECTIONS  */
+    TLS_MAX_CONNECTIONS = 436,     /* TLS_MAX_CONNECTIONS  */
+    TCP_NO_CONNECT = 437,          /* TCP_NO_CONNECT  */
+    TCP_SOURCE_IPV4 = 438,         /* TCP_SOURCE_IPV4  */
+    TCP_SOURCE_IPV6 = 439,         /* TCP_SOURCE_IPV6  */
+    TCP_OPT_FD_CACHE = 440,        /* TCP_OPT_FD_CACHE  */
+    TCP_OPT_BUF_WRITE = 441,       /* TCP_OPT_BUF_WRITE  */
+    TCP_OPT_CONN_WQ_MAX = 442,     /* TCP_OPT_CONN_WQ_MAX  */
+    TCP_OPT_WQ_MAX = 443,          /* TCP_OPT_WQ_MAX  */
+    TCP_OPT_RD_BUF = 444,          /* TCP_OPT_RD_BUF  */
+    TCP_OPT_WQ_BLK = 445,          /* TCP_OPT_WQ_BLK  */
+    TCP_OPT_DEFER_ACCEPT = 446,    /* TCP_OPT_DEFER_ACCEPT  */
+    TCP_OPT_DELAYED_ACK = 447,     /* TCP_OPT_DELAYED_ACK  */
+    TCP_OPT_SYNCNT = 448,          /* TCP_OPT_SYNCNT  */
+    TCP_OPT_LINGER2 = 449,         /* TCP_OPT_LINGER2  */
+    TCP_OPT_KEEPALIVE = 450,       /* TCP_OPT_KEEPALIVE  */
+    TCP_OPT_KEEPIDLE = 451,        /* TCP_OPT_KEEPIDLE  */
+    TCP_OPT_KEEPINTVL = 452,       /* TCP_OPT_KEEPINTVL  */
+    TCP_OPT_KEEPCNT = 453,         /* TCP_OPT_KEEPCNT  */
+    TCP_OPT_CRLF_PING = 454,       /* TCP_OPT_CRLF_PING  */
+    TCP_OPT_ACCEPT_NO_CL = 455,    /* TCP_OPT_ACCEPT_NO_CL  */
+    TCP_CLONE_RCVBUF = 456,        /* TCP_CLONE_RCVBUF  */
+    DISABLE_TLS = 457,             /* DISABLE_TLS  */
+    ENABLE_TLS = 458,              /* ENABLE_TLS  */
+    TLSLOG = 459,                  /* TLSLOG  */
+    TLS_PORT_NO = 460,             /* TLS_PORT_NO  */
+    TLS_METHOD = 461,              /* TLS_METHOD  */
+    TLS_HANDSHAKE_TIMEOUT = 462,   /* TLS_HANDSHAKE_TIMEOUT  */
+    TLS_SEND_TIMEOUT = 463,        /* TLS_SEND_TIMEOUT  */
+    SSLv23 = 464,                  /* SSLv23  */
+    SSLv2 = 465,                   /* SSLv2  */
+    SSLv3 = 466,                   /* SSLv3  */
+    TLSv1 = 467,                   /* TLSv1  */
+    TLS_VERIFY = 468,              /* TLS_VERIFY  */
+    TLS_REQUIRE_CERTIFICATE = 469, /* TLS_REQUIRE_CERTIFICATE  */
+    TLS_CERTIFICATE = 470,         /* TLS_CERTIFICATE  */
+    TLS_PRIVATE_KEY = 471,         /* TLS_PRIVATE_KEY  */
+    TLS_CA_LIST = 472,             /* TLS_CA_LIST  */
+    DISABLE_SCTP = 473,            /* DISABLE_SCTP  */
+    ENABLE_SCTP = 474,             /* ENABLE_SCTP  */
+    SCTP_CHILDREN = 475,           /* SCTP_CHILDREN  */
+    ADVERTISED_ADDRESS = 476,      /* ADVERTISED_ADDRESS  */
+    ADVERTISED_PORT = 477,         /* ADVERTISED_PORT  */
+    DISABLE_CORE = 478,            /* DISABLE_CORE  */
+    OPEN_FD_LIMIT = 479,           /* OPEN_FD_LIMIT  */
+    SHM_MEM_SZ = 480,              /* SHM_MEM_SZ  */
+    SHM_FORCE_ALLOC = 481,         /* SHM_FORCE_ALLOC  */
+    MLOCK_PAGES = 482,             /* MLOCK_PAGES  */
+    REAL_TIME = 483,               /* REAL_TIME  */
+    RT_PRIO = 484,                 /* RT_PRIO  */
+    RT_POLICY = 485,               /* RT_POLICY  */
+    RT_TIMER1_PRIO = 486,          /* RT_TIMER1_PRIO  */
+    RT_TIMER1_POLICY = 487,        /* RT_TIMER1_POLICY  */
+    RT_TIMER2_PRIO = 488,          /* RT_TIMER2_PRIO  */
+    RT_TIMER2_POLICY = 489,        /* RT_TIMER2_POLICY  */
+    MCAST_LOOPBACK = 490,          /* MCAST_LOOPBACK  */
+    MCAST_TTL = 491,               /* MCAST_TTL  */
+    TOS = 492,                     /* TOS  */
+    PMTU_DISCOVERY = 493,          /* PMTU_DISCOVERY  */
+    KILL_TIMEOUT = 494,            /* KILL_TIMEOUT  */
+    MAX_WLOOPS = 495,              /* MAX_WLOOPS  */
+    PVBUFSIZE = 496,               /* PVBUFSIZE  */
+    PVBUFSLOTS = 497,              /* PVBUFSLOTS  */
+    HTTP_REPLY_PARSE = 498,        /* HTTP_REPLY_PARSE  */
+    VERSION_TABLE_CFG = 499,       /* VERSION_TABLE_CFG  */
+    CFG_DESCRIPTION = 500,         /* CFG_DESCRIPTION  */
+    SERVER_ID = 501,               /* SERVER_ID  */
+    LATENCY_LOG = 502,             /* LATENCY_LOG  */
+    LATENCY_LIMIT_DB = 503,        /* LATENCY_LIMIT_DB  */
+    LATENCY_LIMIT_ACTION = 504,    /* LATENCY_LIMIT_ACTION  */
+    MSG_TIME = 505,                /* MSG_TIME  */
+    FLAGS_DECL = 506,              /* FLAGS_DECL  */
+    AVPFLAGS_DECL = 507,           /* AVPFLAGS_DECL  */
+    ATTR_MARK = 508,               /* ATTR_MARK  */
+    SELECT_MARK = 509,             /* SELECT_MARK  */
+    ATTR_FROM = 510,               /* ATTR_FROM  */
+    ATTR_TO = 511,                 /* ATTR_TO  */
+    ATTR_FROMURI = 512,            /* ATTR_FROMURI  */
+    ATTR_TOURI = 513,              /* ATTR_TOURI  */
+    ATTR_FROMUSER = 514,           /* ATTR_FROMUSER  */
+    ATTR_TOUSER = 515,             /* ATTR_TOUSER  */
+    ATTR_FROMDOMAIN = 516,         /* ATTR_FROMDOMAIN  */
+    ATTR_TODOMAIN = 517,           /* ATTR_TODOMAIN  */
+    ATTR_GLOBAL = 518,             /* ATTR_GLOBAL  */
+    ADDEQ = 519,                   /* ADDEQ  */
+    SUBST = 520,                   /* SUBST  */
+    SUBSTDEF = 521,                /* SUBSTDEF  */
+    SUBSTDEFS = 522,               /* SUBSTDEFS  */
+    EQUAL = 523,                   /* EQUAL  */
+    LOG_OR = 524,                  /* LOG_OR  */
+    LOG_AND = 525,                 /* LOG_AND  */
+    BIN_OR = 526,                  /* BIN_OR  */
+    BIN_AND = 527,                 /* BIN_AND  */
+    BIN_XOR = 528,                 /* BIN_XOR  */
+    BIN_LSHIFT = 529,              /* BIN_LSHIFT  */
+    BIN_RSHIFT = 530,              /* BIN_RSHIFT  */
+    EQUAL_T = 531,                 /* EQUAL_T  */
+    DIFF = 532,                    /* DIFF  */
+    MATCH = 533,                   /* MATCH  */
+    INTEQ = 534,                   /* INTEQ  */
+    INTDIFF = 535,                 /* INTDIFF  */
+    STREQ = 536,                   /* STREQ  */
+    STRDIFF = 537,                 /* STRDIFF  */
+    GT = 538,                      /* GT  */
+    LT = 539,                      /* LT  */
+    GTE = 540,                     /* GTE  */
+    LTE = 541,                     /* LTE  */
+    PLUS = 542,                    /* PLUS  */
+    MINUS = 543,                   /* MINUS  */
+    STAR = 544,                    /* STAR  */
+    SLASH = 545,                   /* SLASH  */
+    MODULO = 546,                  /* MODULO  */
+    NOT = 547,                     /* NOT  */
+    UNARY = 548,                   /* UNARY  */
+    BIN_NOT = 549,                 /* BIN_NOT  */
+    DEFINED = 550,                 /* DEFINED  */
+    INTCAST = 551,                 /* INTCAST  */
+    STRCAST = 552,                 /* STRCAST  */
+    DOT = 553,                     /* DOT  */
+    STRLEN = 554,                  /* STRLEN  */
+    STREMPTY = 555,                /* STREMPTY  */
+    NUMBER = 556,                  /* NUMBER  */
+    ID = 557,                      /* ID  */
+    NUM_ID = 558,                  /* NUM_ID  */
+    STRING = 559,                  /* STRING  */
+    IPV6ADDR = 560,                /* IPV6ADDR  */
+    PVAR = 561,                    /* PVAR  */
+    AVP_OR_PVAR = 562,             /* AVP_OR_PVAR  */
+    EVENT_RT_NAME = 563,           /* EVENT_RT_NAME  */
+    COMMA = 564,                   /* COMMA  */
+    SEMICOLON = 565,               /* SEMICOLON  */
+    RPAREN = 566,                  /* RPAREN  */
+    LPAREN = 567,                  /* LPAREN  */
+    LBRACE = 568,                  /* LBRACE  */
+    RBRACE = 569,                  /* RBRACE  */
+    LBRACK = 570,                  /* LBRACK  */
+    RBRACK = 571,                  /* RBRACK  */
+    CR = 572,                      /* CR  */
+    COLON = 573                    /* COLON  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 270 "cfg.y"
+
+	long intval;
+	unsigned long uval;
+	char* strval;
+	struct expr* expr;
+	struct action* action;
+	struct case_stms* case_stms;
+	struct net* ipnet;
+	struct ip_addr* ipaddr;
+	struct socket_id* sockid;
+	struct name_lst* name_l;
+	struct avp_spec* attr;
+	struct _pv_spec* pvar;
+	struct lvalue* lval;
+	struct rvalue* rval;
+	struct rval_expr* rv_expr;
+	select_t* select;
+
+#line 401 "cfg.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_CFG_TAB_H_INCLUDED  */
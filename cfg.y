@@ -439,6 +439,11 @@ extern char *finame;
 %token STAT
 %token CHILDREN
 %token SOCKET_WORKERS
+%token FOLD_CONST_COND
+%token UDP_RCV_BATCH
+%token UDP_SND_BATCH
+%token UDP_REUSE_PORT
+%token SOCKET_CPU_AFFINITY
 %token CHECK_VIA
 %token PHONE2TEL
 %token MEMLOG
@@ -937,6 +942,16 @@ assign_stm:
 	| CHILDREN EQUAL error { yyerror("number expected"); }
 	| SOCKET_WORKERS EQUAL NUMBER { socket_workers=$3; }
 	| SOCKET_WORKERS EQUAL error { yyerror("number expected"); }
+	| FOLD_CONST_COND EQUAL NUMBER { fold_const_cond=$3; }
+	| FOLD_CONST_COND EQUAL error { yyerror("boolean value expected"); }
+	| UDP_RCV_BATCH EQUAL NUMBER { udp_rcv_batch=$3; }
+	| UDP_RCV_BATCH EQUAL error { yyerror("number expected"); }
+	| UDP_SND_BATCH EQUAL NUMBER { udp_snd_batch=$3; }
+	| UDP_SND_BATCH EQUAL error { yyerror("number expected"); }
+	| UDP_REUSE_PORT EQUAL NUMBER { udp_reuse_port=$3; }
+	| UDP_REUSE_PORT EQUAL error { yyerror("boolean value expected"); }
+	| SOCKET_CPU_AFFINITY EQUAL NUMBER { socket_cpu_affinity=$3; }
+	| SOCKET_CPU_AFFINITY EQUAL error { yyerror("number expected"); }
 	| CHECK_VIA EQUAL NUMBER { check_via=$3; }
 	| CHECK_VIA EQUAL error { yyerror("boolean value expected"); }
 	| PHONE2TEL EQUAL NUMBER { phone2tel=$3; }
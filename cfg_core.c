@@ -101,6 +101,9 @@ struct cfg_group_core default_core_cfg = {
 	DEFAULT_DNS_MAX_MEM, /*!< dns_cache_max_mem */
 	0, /*!< dns_cache_del_nonexp -- delete only expired entries by default */
 	0, /*!< dns_cache_rec_pref -- 0 by default, do not check the existing entries. */
+	0, /*!< dns_cache_prefetch -- off by default */
+	2, /*!< dns_cache_prefetch_hits */
+	0, /*!< dns_cache_stale_ttl -- off by default */
 #endif
 #ifdef PKG_MALLOC
 	0, /*!< mem_dump_pkg */
@@ -275,6 +278,14 @@ cfg_def_t core_cfg_def[] = {
 		" 1 - prefer old records"
 		" 2 - prefer new records"
 		" 3 - prefer records with longer lifetime"},
+	{"dns_cache_prefetch",	CFG_VAR_INT,	0, 0, 0, 0,
+		"refresh the most used entries this many seconds before they"
+		" expire, from the dns timer. Use 0 to disable"},
+	{"dns_cache_prefetch_hits",	CFG_VAR_INT,	0, 0, 0, 0,
+		"minimum number of hits an entry must have to be prefetched"},
+	{"dns_cache_stale_ttl",	CFG_VAR_INT,	0, 0, 0, 0,
+		"serve expired entries for up to this many seconds while they"
+		" are refreshed by the dns timer. Use 0 to disable"},
 #endif
 #ifdef PKG_MALLOC
 	{"mem_dump_pkg",	CFG_VAR_INT,	0, 0, 0, mem_dump_pkg_cb,
@@ -93,6 +93,9 @@ struct cfg_group_core {
 	unsigned int dns_cache_max_mem;
 	int dns_cache_del_nonexp;
 	int dns_cache_rec_pref;
+	unsigned int dns_cache_prefetch;
+	unsigned int dns_cache_prefetch_hits;
+	unsigned int dns_cache_stale_ttl;
 #endif
 #ifdef PKG_MALLOC
 	int mem_dump_pkg;
@@ -93,6 +93,13 @@ static const char* dns_cache_rpc_lookup_doc[] = {
 	0
 };
 
+void dns_cache_prefetch_stats(rpc_t* rpc, void* ctx);
+
+static const char* dns_cache_prefetch_stats_doc[] = {
+	"dns cache prefetch and stale entries counters",
+	0
+};
+
 static const char* dns_cache_delete_all_doc[] = {
 	"deletes all the non-permanent entries from the DNS cache",
 	0
@@ -995,6 +1002,8 @@ static rpc_export_t core_rpc_methods[] = {
 		0	},
 	{"dns.lookup",             dns_cache_rpc_lookup,  dns_cache_rpc_lookup_doc,
 		0	},
+	{"dns.prefetch_stats",     dns_cache_prefetch_stats,
+		dns_cache_prefetch_stats_doc, 0	},
 	{"dns.delete_all",         dns_cache_delete_all,  dns_cache_delete_all_doc,
 		0	},
 	{"dns.delete_all_force",   dns_cache_delete_all_force, dns_cache_delete_all_force_doc,
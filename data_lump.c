@@ -43,6 +43,7 @@
 #include "mem/mem.h"
 #include "globals.h"
 #include "error.h"
+#include "pvar.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -73,6 +74,7 @@ struct lump* append_new_lump(struct lump** list, char* new_hdr,
 	}
 		
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->type=type;
 	tmp->op=LUMP_ADD;
 	tmp->u.value=new_hdr;
@@ -99,6 +101,7 @@ struct lump* add_new_lump(struct lump** list, char* new_hdr,
 	}
 		
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->type=type;
 	tmp->op=LUMP_ADD;
 	tmp->u.value=new_hdr;
@@ -123,6 +126,7 @@ struct lump* insert_new_lump(struct lump** list, char* new_hdr,
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->next=*list;
 	tmp->type=type;
 	tmp->op=LUMP_ADD;
@@ -148,6 +152,7 @@ struct lump* insert_new_lump_after( struct lump* after, char* new_hdr,
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->after=after->after;
 	tmp->type=type;
 	tmp->op=LUMP_ADD;
@@ -173,6 +178,7 @@ struct lump* insert_new_lump_before( struct lump* before, char* new_hdr,
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->before=before->before;
 	tmp->type=type;
 	tmp->op=LUMP_ADD;
@@ -198,6 +204,7 @@ struct lump* insert_subst_lump_after( struct lump* after, enum lump_subst subst,
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->after=after->after;
 	tmp->type=type;
 	tmp->op=LUMP_ADD_SUBST;
@@ -224,6 +231,7 @@ struct lump* insert_subst_lump_before(	struct lump* before,
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->before=before->before;
 	tmp->type=type;
 	tmp->op=LUMP_ADD_SUBST;
@@ -249,6 +257,7 @@ struct lump* insert_cond_lump_after( struct lump* after, enum lump_conditions c,
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->after=after->after;
 	tmp->type=type;
 	tmp->op=LUMP_ADD_OPT;
@@ -275,6 +284,7 @@ struct lump* insert_cond_lump_before(	struct lump* before,
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->before=before->before;
 	tmp->type=type;
 	tmp->op=LUMP_ADD_OPT;
@@ -319,6 +329,7 @@ struct lump* del_lump(struct sip_msg* msg, int offset, int len, enum _hdr_types_
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->op=LUMP_DEL;
 	tmp->type=type;
 	tmp->u.offset=offset;
@@ -374,6 +385,7 @@ struct lump* anchor_lump(struct sip_msg* msg, int offset, int len, enum _hdr_typ
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->op=LUMP_NOP;
 	tmp->type=type;
 	tmp->u.offset=offset;
@@ -452,6 +464,7 @@ struct lump* anchor_lump2(struct sip_msg* msg, int offset, int len, enum _hdr_ty
 		return 0;
 	}
 	memset(tmp,0,sizeof(struct lump));
+	pv_vcache_invalidate();
 	tmp->op=LUMP_NOP;
 	tmp->type=type;
 	tmp->u.offset=offset;
@@ -737,6 +750,7 @@ int remove_lump(sip_msg_t *msg, struct lump *l)
 			prev->next = t->next;
 		}
 		free_lump(t);
+		pv_vcache_invalidate();
 		return 1;
 	}
 	return 0;
@@ -97,6 +97,9 @@
 
 #define DNS_HASH_SIZE	1024 /* must be <= 65535 */
 #define DEFAULT_DNS_TIMER_INTERVAL 120  /* 2 min. */
+#define DNS_PREFETCH_INTERVAL 1 /* s, dns timer interval when prefetching or
+								   serving stale entries */
+#define DNS_PREFETCH_MAX 16 /* max. entries refreshed per timer run */
 #define DNS_HE_MAX_ADDR 10  /* maxium addresses returne in a hostent struct */
 #define MAX_CNAME_CHAIN  10
 #define SPACE_FORMAT "    " /* format of view output */
@@ -113,6 +116,8 @@ int dns_flags=0; /* default flags used for the  dns_*resolvehost
 #ifdef USE_DNS_CACHE_STATS
 struct t_dns_cache_stats* dns_cache_stats=0;
 #endif
+static struct dns_prefetch_stats* dns_prefetch_st=0;
+static ticks_t dns_next_clean=0; /* when the dns timer cleans the cache */
 
 #define LOCK_DNS_HASH()		lock_get(dns_hash_lock)
 #define UNLOCK_DNS_HASH()	lock_release(dns_hash_lock)
@@ -220,21 +225,44 @@ void dns_hash_put_shm_unsafe(struct dns_hash_entry* e)
 
 inline static int dns_cache_clean(unsigned int no, int expired_only);
 inline static int dns_cache_free_mem(unsigned int target, int expired_only);
+static void dns_cache_prefetch(ticks_t now);
+
+#define dns_prefetch_on() \
+	(cfg_get(core, core_cfg, dns_cache_prefetch) || \
+		cfg_get(core, core_cfg, dns_cache_stale_ttl))
+
+/* returns the dns timer timeout (ticks until the next run) */
+static ticks_t dns_timer_next(ticks_t ticks)
+{
+	ticks_t next;
+
+	next=dns_next_clean-ticks;
+	if ((s_ticks_t)next<=0)
+		next=1;
+	if (dns_prefetch_on() && next>S_TO_TICKS(DNS_PREFETCH_INTERVAL))
+		next=S_TO_TICKS(DNS_PREFETCH_INTERVAL);
+	return next;
+}
 
 static ticks_t dns_timer(ticks_t ticks, struct timer_ln* tl, void* data)
 {
 #ifdef DNS_WATCHDOG_SUPPORT
 	/* do not clean the hash table if the servers are down */
 	if (atomic_get(dns_servers_up) == 0)
-		return (ticks_t)(-1);
+		return dns_timer_next(ticks);
 #endif
+	if (dns_prefetch_on())
+		dns_cache_prefetch(ticks);
+	if ((s_ticks_t)(ticks-dns_next_clean)<0)
+		return dns_timer_next(ticks);
+	dns_next_clean=ticks+S_TO_TICKS(dns_timer_interval);
 	if (*dns_cache_mem_used>12*(cfg_get(core, core_cfg, dns_cache_max_mem)/16)){ /* ~ 75% used */
 		dns_cache_free_mem(cfg_get(core, core_cfg, dns_cache_max_mem)/2, 1);
 	}else{
 		dns_cache_clean(-1, 1); /* all the table, only expired entries */
 		/* TODO: better strategy? */
 	}
-	return (ticks_t)(-1);
+	return dns_timer_next(ticks);
 }
 
 
@@ -271,6 +299,10 @@ void destroy_dns_cache()
 	if (dns_cache_stats)
 		shm_free(dns_cache_stats);
 #endif
+	if (dns_prefetch_st){
+		shm_free(dns_prefetch_st);
+		dns_prefetch_st=0;
+	}
 	if (dns_cache_mem_used){
 		shm_free((void*)dns_cache_mem_used);
 		dns_cache_mem_used=0;
@@ -378,6 +410,12 @@ int init_dns_cache()
 		ret=E_OUT_OF_MEM;
 		goto error;
 	}
+	dns_prefetch_st=shm_malloc(sizeof(*dns_prefetch_st));
+	if (dns_prefetch_st==0){
+		ret=E_OUT_OF_MEM;
+		goto error;
+	}
+	memset(dns_prefetch_st, 0, sizeof(*dns_prefetch_st));
 #ifdef DNS_LU_LST
 	dns_last_used_lst=shm_malloc(sizeof(*dns_last_used_lst));
 	if (dns_last_used_lst==0){
@@ -429,7 +467,8 @@ int init_dns_cache()
 	}
 	if (dns_timer_interval){
 		timer_init(dns_timer_h, dns_timer, 0, 0); /* "slow" timer */
-		if (timer_add(dns_timer_h, S_TO_TICKS(dns_timer_interval))<0){
+		dns_next_clean=get_ticks_raw()+S_TO_TICKS(dns_timer_interval);
+		if (timer_add(dns_timer_h, dns_timer_next(get_ticks_raw()))<0){
 			LOG(L_CRIT, "BUG: dns_cache_init: failed to add the timer\n");
 			timer_free(dns_timer_h);
 			dns_timer_h=0;
@@ -576,12 +615,30 @@ again:
 #endif
 			/* automatically remove expired elements */
 			((e->ent_flags & DNS_FLAG_PERMANENT) == 0) &&
-			((s_ticks_t)(now-e->expire)>=0)
+			((s_ticks_t)(now-e->expire)>=0) &&
+			/* unless they can still be served while refreshed */
+			!(((e->ent_flags & DNS_FLAG_BAD_NAME) == 0) && e->rr_lst &&
+				((s_ticks_t)(now-e->expire)<
+					(s_ticks_t)S_TO_TICKS(cfg_get(core, core_cfg,
+													dns_cache_stale_ttl))) &&
+				(e->type==type) && (e->name_len==name->len) &&
+				(strncasecmp(e->name, name->s, e->name_len)==0))
 		) {
 				_dns_hash_remove(e);
 		}else if ((e->type==type) && (e->name_len==name->len) &&
 			(strncasecmp(e->name, name->s, e->name_len)==0)){
 			e->last_used=now;
+			e->hits++;
+			if (unlikely(e->ent_flags & DNS_FLAG_PREFETCHED)){
+				e->ent_flags&=~DNS_FLAG_PREFETCHED;
+				dns_prefetch_st->used++;
+			}
+			if (unlikely(((e->ent_flags & DNS_FLAG_PERMANENT) == 0) &&
+						((s_ticks_t)(now-e->expire)>=0))){
+				/* served stale, dns_timer will refresh it */
+				e->ent_flags|=DNS_FLAG_STALE;
+				dns_prefetch_st->stale_hits++;
+			}
 #ifdef DNS_LU_LST
 			/* add it at the end */
 #ifdef DEBUG_LU_LST
@@ -2180,6 +2237,96 @@ error:
 
 
 
+/* refreshes with blocking dns requests the entries that were served stale
+ * and, if dns_cache_prefetch is set, the most used entries (at least
+ * dns_cache_prefetch_hits hits) that will expire in less than
+ * dns_cache_prefetch s. At most DNS_PREFETCH_MAX entries are refreshed per
+ * call, the most used first.
+ * The refreshed entry replaces the old one only on success, if the
+ * request fails the old one is kept until it expires (or until
+ * dns_cache_stale_ttl after that).
+ * Each entry is refreshed at most once.
+ * This should be called from a timer process */
+static void dns_cache_prefetch(ticks_t now)
+{
+	struct dns_hash_entry* lst[DNS_PREFETCH_MAX];
+	struct dns_hash_entry* e;
+	struct dns_hash_entry* n;
+	struct dns_hash_entry* t;
+	ticks_t window;
+	unsigned int min_hits;
+	int cnt, i, h;
+	str name;
+
+	window=S_TO_TICKS(cfg_get(core, core_cfg, dns_cache_prefetch));
+	min_hits=cfg_get(core, core_cfg, dns_cache_prefetch_hits);
+	cnt=0;
+	LOCK_DNS_HASH();
+	for (h=0; h<DNS_HASH_SIZE; h++){
+		clist_foreach(&dns_hash[h], e, next){
+			if ((e->ent_flags & (DNS_FLAG_PERMANENT|DNS_FLAG_BAD_NAME|
+									DNS_FLAG_REFRESHED)) ||
+					(e->rr_lst==0) || (e->type==T_CNAME))
+				continue;
+			if (((e->ent_flags & DNS_FLAG_STALE)==0) &&
+					((window==0) || (e->hits<min_hits) ||
+						((s_ticks_t)(e->expire-now)<=0) ||
+						((s_ticks_t)(e->expire-now)>=(s_ticks_t)window)))
+				continue;
+			/* keep the most used ones, sorted by hits */
+			if (cnt==DNS_PREFETCH_MAX){
+				if (lst[cnt-1]->hits>=e->hits)
+					continue;
+				cnt--;
+			}
+			for (i=cnt; (i>0) && (lst[i-1]->hits<e->hits); i--)
+				lst[i]=lst[i-1];
+			lst[i]=e;
+			cnt++;
+		}
+	}
+	for (i=0; i<cnt; i++){
+		lst[i]->ent_flags|=DNS_FLAG_REFRESHED;
+		atomic_inc(&lst[i]->refcnt);
+	}
+	UNLOCK_DNS_HASH();
+
+	for (i=0; i<cnt; i++){
+		e=lst[i];
+		name.s=e->name;
+		name.len=e->name_len;
+		n=dns_cache_do_request(&name, e->type);
+		LOCK_DNS_HASH();
+		if (n && (n!=e) && (n->type==e->type) && n->rr_lst &&
+				((n->ent_flags & DNS_FLAG_BAD_NAME)==0) &&
+				(n->name_len==e->name_len) &&
+				(strncasecmp(n->name, e->name, e->name_len)==0)){
+			/* the new entry was appended, remove the old one (if still
+			 * in the hash) so that lookups find the new one */
+			h=dns_hash_no(e->name, e->name_len, e->type);
+			clist_foreach(&dns_hash[h], t, next){
+				if (t==e){
+					_dns_hash_remove(e);
+					break;
+				}
+			}
+			n->ent_flags|=DNS_FLAG_PREFETCHED;
+			if (e->ent_flags & DNS_FLAG_STALE)
+				dns_prefetch_st->refreshed_stale++;
+			else
+				dns_prefetch_st->prefetched++;
+		}else{
+			dns_prefetch_st->failed++;
+		}
+		UNLOCK_DNS_HASH();
+		if (n)
+			dns_hash_put(n);
+		dns_hash_put(e);
+	}
+}
+
+
+
 /* gets the first non-expired record starting with record no
  * from the dns_hash_entry struct e
  * params:       e   - dns_hash_entry struct
@@ -2571,6 +2718,8 @@ struct hostent* dns_srv_get_he(str* name, unsigned short* port, int flags)
 	now=get_ticks_raw();
 	if ((e=dns_get_entry(name, T_SRV))==0)
 			goto error;
+	/* if the entry has already expired use the time at the end of lifetime */
+	if (unlikely((s_ticks_t)(now-e->expire)>=0)) now=e->expire-1;
 	/* look inside the RRs for a good one (not expired or marked bad)  */
 	rr_no=0;
 	while( (rr=dns_entry_get_rr(e, &rr_no, now))!=0){
@@ -3545,6 +3694,34 @@ void dns_cache_mem_info(rpc_t* rpc, void* ctx)
 }
 
 
+/* dns.prefetch_stats rpc: prefetch/stale-while-revalidate counters */
+void dns_cache_prefetch_stats(rpc_t* rpc, void* ctx)
+{
+	void* th;
+	struct dns_prefetch_stats st;
+
+	if (!cfg_get(core, core_cfg, use_dns_cache)){
+		rpc->fault(ctx, 500, "dns cache support disabled (see use_dns_cache)");
+		return;
+	}
+	LOCK_DNS_HASH();
+		memcpy(&st, dns_prefetch_st, sizeof(st));
+	UNLOCK_DNS_HASH();
+	if (rpc->add(ctx, "{", &th) < 0){
+		rpc->fault(ctx, 500, "Internal error creating top rpc");
+		return;
+	}
+	rpc->struct_add(th, "ddddddd",
+			"prefetch", cfg_get(core, core_cfg, dns_cache_prefetch),
+			"stale_ttl", cfg_get(core, core_cfg, dns_cache_stale_ttl),
+			"prefetched", (int)st.prefetched,
+			"refreshed_stale", (int)st.refreshed_stale,
+			"failed", (int)st.failed,
+			"used", (int)st.used,
+			"stale_hits", (int)st.stale_hits);
+}
+
+
 void dns_cache_debug(rpc_t* rpc, void* ctx)
 {
 	int h;
@@ -3828,6 +4005,7 @@ void dns_cache_print_entry(rpc_t* rpc, void* ctx, struct dns_hash_entry* e)
 	}
 	rpc->printf(ctx, "%slast used (s): %d", SPACE_FORMAT,
 						TICKS_TO_S(now-e->last_used));
+	rpc->printf(ctx, "%shits: %u", SPACE_FORMAT, e->hits);
 	rpc->printf(ctx, "%snegative entry: %s", SPACE_FORMAT,
 						(e->ent_flags & DNS_FLAG_BAD_NAME) ? "yes" : "no");
 	
@@ -3940,6 +4118,34 @@ void dns_cache_view(rpc_t* rpc, void* ctx)
 }
 
 
+/* checks if name of the given type can be resolved only from the cache,
+ * without sending any dns request
+ * returns 1 if a valid entry is cached, 0 if a negative entry is cached
+ *  (the name is known not to resolve) and -1 if nothing usable is cached
+ *  (not found or unfinished CNAME chain) */
+int dns_cache_check(str* name, int type)
+{
+	struct dns_hash_entry* e;
+	int h, err, ret;
+
+	if (dns_hash==0)
+		return -1;
+	err=0;
+	e=dns_hash_get(name, type, &h, &err);
+	if (e==0)
+		return -1;
+	if (e->type!=type)
+		ret=-1; /* CNAME, the target is not cached */
+	else if ((e->rr_lst==0) || (e->ent_flags & DNS_FLAG_BAD_NAME))
+		ret=0;
+	else
+		ret=1;
+	dns_hash_put(e);
+	return ret;
+}
+
+
+
 /* Delete all the entries from the cache.
  * If del_permanent is 0, then only the
  * non-permanent entries are deleted.
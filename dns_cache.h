@@ -107,6 +107,9 @@ const char* dns_strerror(int err);
 #define DNS_FLAG_PERMANENT	2 /**< permanent record, never times out,
 					never deleted, never overwritten
 					unless explicitely requested */
+#define DNS_FLAG_STALE		4 /**< expired, but served while refreshing */
+#define DNS_FLAG_REFRESHED	8 /**< prefetch/refresh already attempted */
+#define DNS_FLAG_PREFETCHED	16 /**< added by prefetch, not used yet */
 /*@} */
 
 /** @name dns requests flags */
@@ -157,6 +160,7 @@ struct dns_hash_entry{
 	atomic_t refcnt;
 	ticks_t last_used;
 	ticks_t expire; /* when the whole entry will expire */
+	unsigned int hits; /* lookups answered by this entry */
 	int total_size;
 	unsigned short type;
 	unsigned char ent_flags; /* entry flags: unresolvable/permanent */
@@ -196,6 +200,14 @@ int use_dns_failover_fixup(void *handle, str *gname, str *name, void **val);
 int use_dns_cache_fixup(void *handle, str *gname, str *name, void **val);
 int dns_cache_max_mem_fixup(void *handle, str *gname, str *name, void **val);
 int init_dns_cache(void);
+/** @brief dns cache prefetch counters (shared, see dns.prefetch_stats) */
+struct dns_prefetch_stats{
+	unsigned long prefetched; /**< entries refreshed before expiring */
+	unsigned long refreshed_stale; /**< stale entries refreshed */
+	unsigned long failed; /**< refresh attempts that did not succeed */
+	unsigned long used; /**< refreshed entries used at least once */
+	unsigned long stale_hits; /**< lookups answered with stale records */
+};
 #ifdef USE_DNS_CACHE_STATS
 int init_dns_cache_stats(int iproc_num);
 #define DNS_CACHE_ALL_STATS "dc_all_stats"
@@ -340,6 +352,12 @@ inline static int dns_sip_resolve2su(struct dns_srv_handle* h,
 	return ret;
 }
 
+/** @brief checks if a name can be resolved from the cache only.
+ * @return 1 if a valid entry is cached, 0 if a negative entry is cached,
+ *  -1 if a dns request would be needed
+ */
+int dns_cache_check(str* name, int type);
+
 /** @brief Delete all the entries from the cache.
  * If del_permanent is 0, then only the
  * non-permanent entries are deleted.
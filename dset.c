@@ -43,6 +43,7 @@
 #include "hash_func.h"
 #include "error.h"
 #include "dset.h"
+#include "pvar.h"
 #include "mem/mem.h"
 #include "ip_addr.h"
 
@@ -602,6 +603,7 @@ int rewrite_uri(struct sip_msg* _m, str* _s)
 	_m->new_uri.len = _s->len;
 	/* mark ruri as new and available for forking */
 	ruri_mark_new();
+	pv_vcache_invalidate();
 
 	return 1;
 }
@@ -89,6 +89,10 @@ extern unsigned int maxbuffer;
 extern unsigned int sql_buffer_size;
 extern int children_no;
 extern int socket_workers;
+extern int udp_rcv_batch;
+extern int udp_snd_batch;
+extern int udp_reuse_port;
+extern int socket_cpu_affinity;
 #ifdef USE_TCP
 extern int tcp_main_pid;
 extern int tcp_cfg_children_no;
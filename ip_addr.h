@@ -126,6 +126,10 @@ struct socket_info{
 	int workers; /* number of worker processes for this socket */
 	int workers_tcpidx; /* index of workers in tcp children array */
 	struct advertise_info useinfo; /* details to be used in SIP msg */
+	struct udp_batch_cnts* udp_cnts; /* recvmmsg/sendmmsg counters (udp) */
+	int* rcv_socks; /* per worker SO_REUSEPORT sockets (udp), [0]==socket */
+	int rcv_socks_no;
+	int cpu_affinity; /* cpu for the first worker of this socket, -1 if none */
 };
 
 
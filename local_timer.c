@@ -247,6 +247,51 @@ static inline void local_timer_expire(struct local_timer* h, ticks_t t)
 
 
 
+/* moves the timers that expire at t on the expired list, without running
+ * them */
+static inline void local_timer_mv_expire(struct local_timer* h, ticks_t t)
+{
+	struct timer_head* thp;
+
+	if (unlikely((t & H0_MASK)==0)){              /*r1*/
+		if (unlikely((t & H1_H0_MASK)==0)){        /*r2*/
+			local_timer_redist(h, t, &h->timer_lst.h2[t>>(H0_BITS+H1_BITS)]);
+		}
+		
+		local_timer_redist(h, t, &h->timer_lst.h1[(t & H1_H0_MASK)>>H0_BITS]);
+															/*r2 >> H0*/
+	}
+	thp=&h->timer_lst.h0[t & H0_MASK];
+	if (thp->next!=(struct timer_ln*)thp){
+		clist_append_sublist(&h->timer_lst.expired, thp->next, thp->prev,
+								next, prev);
+		_timer_init_list(thp);
+	}
+}
+
+
+
+/* moves all the timers that expire until crt_ticks (included) on the
+ * expired list (lt->timer_lst.expired), but doesn't run them.
+ * Intended for local timers shared between processes, where the handlers
+ * must be run with the protecting lock released (the caller must take
+ * them off lt->timer_lst.expired one by one).
+ * Unlike local_timer_run() it can be called several times for the same
+ * ticks value.
+ * returns 1 if the time advanced since the last call, 0 otherwise */
+int local_timer_mv_expired(struct local_timer* lt, ticks_t crt_ticks)
+{
+	if ((s_ticks_t)(crt_ticks-lt->prev_ticks)<=0)
+		return 0;
+	for (lt->prev_ticks=lt->prev_ticks+1; lt->prev_ticks!=crt_ticks;
+														lt->prev_ticks++)
+		local_timer_mv_expire(lt, lt->prev_ticks);
+	local_timer_mv_expire(lt, lt->prev_ticks); /* do it for crt_ticks too */
+	return 1;
+}
+
+
+
 /* "main" local timer routine, should be called with a proper ticks value
  * WARNING: it should never be called twice for the same ticks value
  * (it could cause too fast expires for long timers), ticks must be also
@@ -60,5 +60,6 @@ int local_timer_add(struct local_timer* h, struct timer_ln* tl, ticks_t delta,
 
 void local_timer_del(struct local_timer* h, struct timer_ln* tl);
 void local_timer_run(struct local_timer* lt, ticks_t crt_ticks);
+int local_timer_mv_expired(struct local_timer* lt, ticks_t crt_ticks);
 
 #endif /* _local_timer_h */
@@ -347,6 +347,14 @@ unsigned int sql_buffer_size = 65535; /* Size for the SQL buffer. Defaults to 64
 int socket_workers = 0;		/* number of workers processing requests for a socket
 							   - it's reset everytime with a new listen socket */
 int children_no = 0;		/* number of children processing requests */
+int udp_rcv_batch = 0;		/* max. datagrams read with one recvmmsg()
+							   - 0 or 1 for one recvfrom() per datagram */
+int udp_snd_batch = 0;		/* max. datagrams sent with one sendmmsg()
+							   - 0 or 1 for one sendto() per datagram */
+int udp_reuse_port = 0;		/* one SO_REUSEPORT socket per udp worker */
+int socket_cpu_affinity = -1;	/* first cpu for the workers of the next
+								   listen socket (-1 = not set) - it's reset
+								   everytime with a new listen socket */
 #ifdef USE_TCP
 int tcp_cfg_children_no = 0; /* set via config or command line option */
 int tcp_children_no = 0; /* based on socket_workers and tcp_cfg_children_no */
@@ -1613,6 +1621,7 @@ int main_loop(void)
 				}else if (pid==0){
 					/* child */
 					bind_address=si; /* shortcut */
+					udp_child_init(si, i);
 #ifdef STATS
 					setstats( i+r*children_no );
 #endif
@@ -1913,6 +1922,10 @@ int main(int argc, char** argv)
 	/* init counters / stats */
 	if (init_counters() == -1)
 		goto error;
+#if defined(SHM_MEM) && defined(SHM_MAG_MALLOC)
+	if (shm_mag_init_counters() == -1)
+		goto error;
+#endif
 #ifdef USE_TCP
 	init_tcp_options(); /* set the defaults before the config */
 #endif
@@ -150,3 +150,107 @@ void memtest()
 
 
 #endif
+
+
+#ifdef SHM_MEM
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "../dprint.h"
+#include "mem.h"
+#include "shm_mem.h"
+
+/**
+ * \brief Multi-process shm allocator contention benchmark
+ *
+ * Forks procs processes that each do loops random small shm_malloc/shm_free
+ * operations on a private working set (half of the chunks are freed by a
+ * different process than the one that allocated them, to exercise the
+ * cross-process path). Logs the aggregated throughput and the shm status.
+ * Must be called after shm_mem_init().
+ * \param procs number of concurrent processes
+ * \param loops number of malloc+free pairs per process
+ * \return 0 on success, -1 on error
+ */
+int shm_mem_bench(int procs, int loops)
+{
+#define BENCH_SET 256
+	void** shared;
+	void* set[BENCH_SET];
+	pid_t* pids;
+	struct timeval start, end;
+	unsigned long usecs;
+	int i, j, k, status, ret;
+
+	if (procs<=0 || loops<=0)
+		return -1;
+	pids=pkg_malloc(procs*sizeof(pid_t));
+	if (pids==0)
+		return -1;
+	shared=shm_malloc(procs*BENCH_SET*sizeof(void*));
+	if (shared==0) {
+		pkg_free(pids);
+		return -1;
+	}
+	memset(shared, 0, procs*BENCH_SET*sizeof(void*));
+	ret=0;
+	gettimeofday(&start, 0);
+	for (i=0; i<procs; i++) {
+		pids[i]=fork();
+		if (pids[i]<0) {
+			LOG(L_ERR, "fork failed\n");
+			ret=-1;
+			procs=i;
+			break;
+		}
+		if (pids[i]==0) {
+			shm_malloc_on_fork();
+			srandom(getpid());
+			memset(set, 0, sizeof(set));
+			for (j=0; j<loops; j++) {
+				k=random()%BENCH_SET;
+				if (set[k])
+					shm_free(set[k]);
+				set[k]=shm_malloc(8+(random()&511));
+			}
+			/* hand over half of the set, freed by the parent */
+			for (k=0; k<BENCH_SET; k+=2) {
+				shared[i*BENCH_SET+k]=set[k];
+				set[k]=0;
+			}
+			for (k=0; k<BENCH_SET; k++)
+				if (set[k])
+					shm_free(set[k]);
+#ifdef SHM_MAG_MALLOC
+			shm_mag_flush();
+#endif
+			_exit(0);
+		}
+	}
+	for (i=0; i<procs; i++)
+		if (waitpid(pids[i], &status, 0)<0 || !WIFEXITED(status)
+				|| WEXITSTATUS(status))
+			ret=-1;
+	gettimeofday(&end, 0);
+	for (i=0; i<procs*BENCH_SET; i++)
+		if (shared[i])
+			shm_free(shared[i]);
+	shm_free(shared);
+	pkg_free(pids);
+#ifdef SHM_MAG_MALLOC
+	shm_mag_flush();
+#endif
+	usecs=(end.tv_sec-start.tv_sec)*1000000UL+end.tv_usec-start.tv_usec;
+	LOG(L_INFO, "%d processes x %d malloc/free:"
+			" %lu us (%lu ops/s)\n", procs, loops, usecs,
+			usecs?(unsigned long)((double)procs*loops*2*1000000/usecs):0UL);
+	shm_status();
+	return ret;
+}
+
+#endif /* SHM_MEM */
@@ -0,0 +1,268 @@
+/*
+ * per-process shared memory magazines
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of sip-router, a free SIP server.
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * \file
+ * \brief Per-process cache ("magazines") in front of the shm f_malloc
+ * \ingroup mem
+ */
+
+#if defined(SHM_MEM) && defined(SHM_MAG_MALLOC)
+
+#include <string.h>
+
+#include "shm_mem.h"
+#include "shm_mag.h"
+#include "../compiler_opt.h"
+#include "../counters.h"
+
+struct shm_mag {
+	unsigned int no;
+	void* chunks[SHM_MAG_SIZE];
+};
+
+/* process local, never shared (each child resets it after fork) */
+static struct shm_mag shm_mags[SHM_MAG_CLASSES];
+static struct shm_mag_stats shm_mag_st;
+/* part of shm_mag_st already added to the counters */
+static struct shm_mag_stats shm_mag_pub;
+
+static struct shm_mag_cnts_h {
+	counter_handle_t hits;
+	counter_handle_t misses;
+	counter_handle_t refills;
+	counter_handle_t flushes;
+	counter_handle_t cached;
+	counter_handle_t cached_bytes;
+} shm_mag_cnts_h;
+static int shm_mag_cnts_on=0;
+
+static counter_def_t shm_mag_cnt_defs[] = {
+	{&shm_mag_cnts_h.hits, "hits", 0, 0, 0,
+		"small shm allocations served from the local magazines."},
+	{&shm_mag_cnts_h.misses, "misses", 0, 0, 0,
+		"shm allocations that needed a refill or were too big."},
+	{&shm_mag_cnts_h.refills, "refills", 0, 0, 0,
+		"magazine refills from the global shm heap (under mem_lock)."},
+	{&shm_mag_cnts_h.flushes, "flushes", 0, 0, 0,
+		"batch returns of magazine chunks to the global shm heap."},
+	{&shm_mag_cnts_h.cached, "cached", 0, 0, 0,
+		"free shm chunks currently held in the magazines."},
+	{&shm_mag_cnts_h.cached_bytes, "cached_bytes", 0, 0, 0,
+		"bytes currently held in the magazines."},
+	{0, 0, 0, 0, 0, 0 }
+};
+
+/* publish hits every SHM_MAG_PUB_HITS hits, misses are published with the
+ * refills */
+#define SHM_MAG_PUB_HITS	1024
+
+
+/* usable size of an f_malloc shm chunk */
+#define SHM_MAG_CHUNK_SIZE(p) \
+	(((struct fm_frag*)((char*)(p)-sizeof(struct fm_frag)))->size)
+
+/* class used for allocating: smallest class that fits size */
+#define SHM_MAG_ALLOC_CLASS(s) (((s)+SHM_MAG_ROUNDTO-1)/SHM_MAG_ROUNDTO)
+/* class used for caching: biggest class fully covered by the chunk */
+#define SHM_MAG_FREE_CLASS(s)  ((s)/SHM_MAG_ROUNDTO)
+
+#ifdef DBG_F_MALLOC
+#define _SHM_MAG_LOC_PARAMS	, const char* file, const char* func, \
+									unsigned int line
+#define _SHM_MAG_LOC		, file, func, line
+#else
+#define _SHM_MAG_LOC_PARAMS
+#define _SHM_MAG_LOC
+#endif
+
+
+#define SHM_MAG_PUB(f) \
+	do { \
+		counter_add(shm_mag_cnts_h.f, (int)(shm_mag_st.f-shm_mag_pub.f)); \
+		shm_mag_pub.f=shm_mag_st.f; \
+	} while(0)
+
+/* adds the local statistics changes since the last call to the counters
+ * (the counters are per process, so no locking is needed) */
+static void shm_mag_publish(void)
+{
+	/* not registered yet or already destroyed (on exit) */
+	if (unlikely(!shm_mag_cnts_on || !counters_initialized()))
+		return;
+	SHM_MAG_PUB(hits);
+	SHM_MAG_PUB(misses);
+	SHM_MAG_PUB(refills);
+	SHM_MAG_PUB(flushes);
+	SHM_MAG_PUB(cached);
+	SHM_MAG_PUB(cached_bytes);
+}
+
+
+/* moves up to SHM_MAG_BATCH chunks of class c from the global heap,
+ * under a single lock
+ * returns the number of chunks added */
+static int shm_mag_refill(struct shm_mag* m, unsigned long c
+							_SHM_MAG_LOC_PARAMS)
+{
+	int i;
+	void* p;
+
+	shm_lock();
+	for (i=0; i<SHM_MAG_BATCH && m->no<SHM_MAG_SIZE; i++) {
+		p=MY_MALLOC(shm_block, c*SHM_MAG_ROUNDTO _SHM_MAG_LOC);
+		if (unlikely(p==0))
+			break;
+		m->chunks[m->no++]=p;
+		shm_mag_st.cached_bytes+=SHM_MAG_CHUNK_SIZE(p);
+	}
+	shm_unlock();
+	shm_mag_st.refills++;
+	shm_mag_st.cached+=i;
+	shm_mag_publish();
+	return i;
+}
+
+
+/* returns the SHM_MAG_BATCH coldest (bottom) chunks to the global heap,
+ * under a single lock */
+static void shm_mag_drain(struct shm_mag* m, unsigned int n
+							_SHM_MAG_LOC_PARAMS)
+{
+	unsigned int i;
+	unsigned long bytes;
+
+	if (n>m->no)
+		n=m->no;
+	bytes=0;
+	shm_lock();
+	for (i=0; i<n; i++) {
+		bytes+=SHM_MAG_CHUNK_SIZE(m->chunks[i]);
+		MY_FREE(shm_block, m->chunks[i] _SHM_MAG_LOC);
+	}
+	shm_unlock();
+	m->no-=n;
+	if (m->no)
+		memmove(&m->chunks[0], &m->chunks[n], m->no*sizeof(void*));
+	shm_mag_st.flushes++;
+	shm_mag_st.cached-=n;
+	shm_mag_st.cached_bytes-=bytes;
+	shm_mag_publish();
+}
+
+
+#ifdef DBG_F_MALLOC
+void* shm_mag_malloc(unsigned long size,
+		const char* file, const char* func, unsigned int line)
+#else
+void* shm_mag_malloc(unsigned long size)
+#endif
+{
+	struct shm_mag* m;
+	unsigned long c;
+	void* p;
+
+	if (likely(size && size<=SHM_MAG_MAX_SIZE)) {
+		c=SHM_MAG_ALLOC_CLASS(size);
+		m=&shm_mags[c];
+		if (likely(m->no)) {
+			if (unlikely((++shm_mag_st.hits % SHM_MAG_PUB_HITS)==0))
+				shm_mag_publish();
+		} else
+			shm_mag_st.misses++;
+		if (likely(m->no || shm_mag_refill(m, c _SHM_MAG_LOC))) {
+			p=m->chunks[--m->no];
+			shm_mag_st.cached--;
+			shm_mag_st.cached_bytes-=SHM_MAG_CHUNK_SIZE(p);
+			return p;
+		}
+		/* out of memory for a whole batch, try a single chunk */
+	} else
+		shm_mag_st.misses++;
+	shm_lock();
+	p=MY_MALLOC(shm_block, size _SHM_MAG_LOC);
+	shm_unlock();
+	return p;
+}
+
+
+#ifdef DBG_F_MALLOC
+void shm_mag_free(void* p, const char* file, const char* func,
+		unsigned int line)
+#else
+void shm_mag_free(void* p)
+#endif
+{
+	struct shm_mag* m;
+	unsigned long s;
+
+	if (unlikely(p==0))
+		return;
+	s=SHM_MAG_CHUNK_SIZE(p);
+	if (likely(s>=SHM_MAG_ROUNDTO && s<=SHM_MAG_MAX_SIZE)) {
+		m=&shm_mags[SHM_MAG_FREE_CLASS(s)];
+		if (unlikely(m->no==SHM_MAG_SIZE))
+			shm_mag_drain(m, SHM_MAG_BATCH _SHM_MAG_LOC);
+		m->chunks[m->no++]=p;
+		shm_mag_st.cached++;
+		shm_mag_st.cached_bytes+=s;
+		return;
+	}
+	shm_lock();
+	MY_FREE(shm_block, p _SHM_MAG_LOC);
+	shm_unlock();
+}
+
+
+void shm_mag_flush(void)
+{
+	int c;
+
+	for (c=0; c<SHM_MAG_CLASSES; c++)
+		if (shm_mags[c].no)
+#ifdef DBG_F_MALLOC
+			shm_mag_drain(&shm_mags[c], SHM_MAG_SIZE,
+							__FILE__, __FUNCTION__, __LINE__);
+#else
+			shm_mag_drain(&shm_mags[c], SHM_MAG_SIZE);
+#endif
+}
+
+
+void shm_mag_on_fork(void)
+{
+	/* the cached chunks are still owned by the parent, just forget them */
+	memset(shm_mags, 0, sizeof(shm_mags));
+	memset(&shm_mag_st, 0, sizeof(shm_mag_st));
+	memset(&shm_mag_pub, 0, sizeof(shm_mag_pub));
+}
+
+
+int shm_mag_init_counters(void)
+{
+	if (counter_register_array("shm_mag", shm_mag_cnt_defs) < 0)
+		return -1;
+	shm_mag_cnts_on=1;
+	/* start from the current values */
+	shm_mag_publish();
+	return 0;
+}
+
+#endif /* SHM_MEM && SHM_MAG_MALLOC */
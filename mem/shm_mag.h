@@ -0,0 +1,86 @@
+/*
+ * per-process shared memory magazines
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of sip-router, a free SIP server.
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * \file
+ * \brief Per-process cache ("magazines") in front of the shm f_malloc
+ *
+ * Each process keeps a small stack of free shm chunks for every size class
+ * up to SHM_MAG_MAX_SIZE. shm_malloc()/shm_free() of small chunks are served
+ * from the local stack without touching mem_lock; the global heap is only
+ * locked when a stack must be refilled or flushed, and then a whole batch of
+ * chunks is moved under a single lock.
+ *
+ * Enabled by compiling with -DSHM_MAG_MALLOC (make MEMMNG=2), requires
+ * F_MALLOC.
+ * \ingroup mem
+ */
+
+#ifndef _shm_mag_h
+#define _shm_mag_h
+
+#ifdef SHM_MAG_MALLOC
+
+#ifndef F_MALLOC
+#error "SHM_MAG_MALLOC requires F_MALLOC"
+#endif
+
+/** size class granularity, must be 2^k and a multiple of f_malloc ROUNDTO */
+#define SHM_MAG_ROUNDTO		16UL
+/** chunks bigger than this go directly to the global heap */
+#define SHM_MAG_MAX_SIZE	1024UL
+#define SHM_MAG_CLASSES		(SHM_MAG_MAX_SIZE/SHM_MAG_ROUNDTO + 1)
+/** max. number of cached chunks per size class and process */
+#define SHM_MAG_SIZE		32
+/** number of chunks moved to/from the global heap under one lock */
+#define SHM_MAG_BATCH		16
+
+/** per-process magazine statistics (exported as "shm_mag" counters) */
+struct shm_mag_stats {
+	unsigned long hits;      /**< mallocs served from the local magazine */
+	unsigned long misses;    /**< mallocs that needed a refill or were big */
+	unsigned long refills;   /**< refills from the global heap (locked) */
+	unsigned long flushes;   /**< batch returns to the global heap (locked) */
+	unsigned long cached;    /**< chunks currently held by this process */
+	unsigned long cached_bytes; /**< bytes currently held by this process */
+};
+
+#ifdef DBG_F_MALLOC
+void* shm_mag_malloc(unsigned long size,
+		const char* file, const char* func, unsigned int line);
+void shm_mag_free(void* p, const char* file, const char* func,
+		unsigned int line);
+#else
+void* shm_mag_malloc(unsigned long size);
+void shm_mag_free(void* p);
+#endif
+
+/** returns all the chunks cached by the current process to the heap */
+void shm_mag_flush(void);
+/** drops the magazines inherited from the parent (they belong to it) */
+void shm_mag_on_fork(void);
+/** registers the "shm_mag" counters group, must be called before forking
+ * (after init_counters()); each process updates its own values when it
+ * refills or flushes a magazine and every 1024 hits */
+int shm_mag_init_counters(void);
+
+#endif /* SHM_MAG_MALLOC */
+
+#endif /* _shm_mag_h */
@@ -27,6 +27,8 @@
  *  2005-03-02   added shm_info() & re-eneabled locking on shm_status (andrei)
  *  2007-02-23   added shm_available() (andrei)
  *  2007-06-10   support for sf_malloc (andrei)
+ *  2026-10-18   per-process shm magazines in front of f_malloc
+ *               (SHM_MAG_MALLOC)
  */
 
 /**
@@ -140,7 +142,12 @@
 #	define  shm_malloc_init fm_malloc_init
 #	define shm_malloc_destroy(b) do{}while(0)
 #	define shm_available() fm_available(shm_block)
+#ifdef SHM_MAG_MALLOC
+#	include "shm_mag.h"
+#	define shm_malloc_on_fork() shm_mag_on_fork()
+#else
 #	define shm_malloc_on_fork() do{}while(0)
+#endif
 #elif defined DL_MALLOC
 #	include "dl_malloc.h"
 	extern mspace shm_block;
@@ -179,6 +186,7 @@ int shm_mem_init_mallocs(void* mempool, unsigned long size); /* initialize
 																the mallocs
 																& the lock */
 void shm_mem_destroy(void);
+int shm_mem_bench(int procs, int loops); /* memtest.c */
 
 
 
@@ -199,6 +207,10 @@ void shm_mem_destroy(void);
 	MY_MALLOC(shm_block, (_size), _SRC_LOC_, _SRC_FUNCTION_, _SRC_LINE_ )
 
 
+#ifdef SHM_MAG_MALLOC
+#define _shm_malloc(_size, _file, _function, _line) \
+	shm_mag_malloc((_size), (_file), (_function), (_line))
+#else
 inline static void* _shm_malloc(unsigned int size, 
 	const char *file, const char *function, int line )
 {
@@ -209,6 +221,7 @@ inline static void* _shm_malloc(unsigned int size,
 	shm_unlock();
 	return p; 
 }
+#endif /* SHM_MAG_MALLOC */
 
 
 inline static void* _shm_realloc(void *ptr, unsigned int size, 
@@ -232,12 +245,17 @@ inline static void* _shm_realloc(void *ptr, unsigned int size,
 #define shm_free_unsafe( _p  ) \
 	MY_FREE( shm_block, (_p), _SRC_LOC_, _SRC_FUNCTION_, _SRC_LINE_ )
 
+#ifdef SHM_MAG_MALLOC
+#define shm_free(_p) \
+	shm_mag_free((_p), _SRC_LOC_, _SRC_FUNCTION_, _SRC_LINE_)
+#else
 #define shm_free(_p) \
 do { \
 		shm_lock(); \
 		shm_free_unsafe( (_p)); \
 		shm_unlock(); \
 }while(0)
+#endif /* SHM_MAG_MALLOC */
 
 
 
@@ -254,6 +272,9 @@ void* _shm_resize(void* ptr, unsigned int size, const char* f, const char* fn,
 
 #define shm_malloc_unsafe(_size) MY_MALLOC(shm_block, (_size))
 
+#ifdef SHM_MAG_MALLOC
+#define shm_malloc(_size) shm_mag_malloc((_size))
+#else
 inline static void* shm_malloc(unsigned int size)
 {
 	void *p;
@@ -263,6 +284,7 @@ inline static void* shm_malloc(unsigned int size)
 	shm_unlock();
 	 return p; 
 }
+#endif /* SHM_MAG_MALLOC */
 
 
 inline static void* shm_realloc(void *ptr, unsigned int size)
@@ -278,12 +300,16 @@ inline static void* shm_realloc(void *ptr, unsigned int size)
 
 #define shm_free_unsafe( _p ) MY_FREE(shm_block, (_p))
 
+#ifdef SHM_MAG_MALLOC
+#define shm_free(_p) shm_mag_free((_p))
+#else
 #define shm_free(_p) \
 do { \
 		shm_lock(); \
 		shm_free_unsafe( _p ); \
 		shm_unlock(); \
 }while(0)
+#endif /* SHM_MAG_MALLOC */
 
 
 
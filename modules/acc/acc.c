@@ -61,6 +61,7 @@
 #include "acc_extra.h"
 #include "acc_logic.h"
 #include "acc_api.h"
+#include "acc_async.h"
 
 #ifdef RAD_ACC
 #include "../../lib/kcore/radius.h"
@@ -407,6 +408,11 @@ int acc_db_init(const str* db_url)
 
 	acc_db_init_keys();
 
+	if (acc_db_insert_mode==2 && acc_async_init(&acc_dbf, db_keys)<0) {
+		LM_ERR("failed to init the async db writer\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -432,6 +438,29 @@ void acc_db_close(void)
 }
 
 
+/* insert one row, according to acc_db_insert_mode */
+static int acc_db_insert_row(int n)
+{
+	if(acc_db_insert_mode==2) {
+		if (acc_async_push(&acc_env.text, db_vals, n) < 0) {
+			LM_ERR("failed to queue for database insert\n");
+			return -1;
+		}
+	} else if(acc_db_insert_mode==1 && acc_dbf.insert_delayed!=NULL) {
+		if (acc_dbf.insert_delayed(db_handle, db_keys, db_vals, n) < 0) {
+			LM_ERR("failed to insert delayed into database\n");
+			return -1;
+		}
+	} else {
+		if (acc_dbf.insert(db_handle, db_keys, db_vals, n) < 0) {
+			LM_ERR("failed to insert into database\n");
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
 int acc_db_request( struct sip_msg *rq)
 {
 	int m;
@@ -476,40 +505,23 @@ int acc_db_request( struct sip_msg *rq)
 	for( i++ ; i<m; i++)
 		VAL_STR(db_vals+i) = val_arr[i];
 
-	if (acc_dbf.use_table(db_handle, &acc_env.text/*table*/) < 0) {
+	if (acc_db_insert_mode!=2 &&
+			acc_dbf.use_table(db_handle, &acc_env.text/*table*/) < 0) {
 		LM_ERR("error in use_table\n");
 		return -1;
 	}
 
 	/* multi-leg columns */
 	if ( !leg_info ) {
-		if(acc_db_insert_mode==1 && acc_dbf.insert_delayed!=NULL) {
-			if (acc_dbf.insert_delayed(db_handle, db_keys, db_vals, m) < 0) {
-				LM_ERR("failed to insert delayed into database\n");
-				return -1;
-			}
-		} else {
-			if (acc_dbf.insert(db_handle, db_keys, db_vals, m) < 0) {
-				LM_ERR("failed to insert into database\n");
-				return -1;
-			}
-		}
+		if (acc_db_insert_row(m) < 0)
+			return -1;
 	} else {
   	        n = legs2strar(leg_info,rq,val_arr+m,int_arr+m,type_arr+m,1);
 		do {
 			for (i=m; i<m+n; i++)
 				VAL_STR(db_vals+i)=val_arr[i];
-			if(acc_db_insert_mode==1 && acc_dbf.insert_delayed!=NULL) {
-				if(acc_dbf.insert_delayed(db_handle,db_keys,db_vals,m+n)<0) {
-					LM_ERR("failed to insert delayed into database\n");
-					return -1;
-				}
-			} else {
-				if (acc_dbf.insert(db_handle, db_keys, db_vals, m+n) < 0) {
-					LM_ERR("failed to insert into database\n");
-					return -1;
-				}
-			}
+			if (acc_db_insert_row(m+n) < 0)
+				return -1;
 		}while ( (n=legs2strar(leg_info,rq,val_arr+m,int_arr+m,
 				       type_arr+m,0))!=0 );
 	}
@@ -0,0 +1,780 @@
+/*
+ * Accounting module
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ * \ingroup acc
+ * \brief Acc:: Asynchronous database writer
+ *
+ * - Module: \ref acc
+ */
+
+#ifdef SQL_ACC
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "../../dprint.h"
+#include "../../ut.h"
+#include "../../pt.h"
+#include "../../sr_module.h"
+#include "../../cfg/cfg_struct.h"
+#include "../../locking.h"
+#include "../../mem/mem.h"
+#include "../../mem/shm_mem.h"
+#include "acc_api.h"
+#include "acc_async.h"
+
+int acc_async_workers = 1;               /*!< writer processes */
+int acc_async_queue_size = 1048576;      /*!< ring buffer size (bytes) */
+int acc_async_batch_size = 100;          /*!< max rows per transaction */
+int acc_async_flush_interval = 500;      /*!< max wait for a batch (ms) */
+char *acc_async_spill_file = 0;          /*!< rows not written to db */
+
+/* seconds to keep spilling after a database error */
+#define ACC_ASYNC_RETRY_INTERVAL 5
+/* initial size of the per writer batch buffer */
+#define ACC_ASYNC_BATCH_BUF 65536
+
+/* serialized row: header, table name, then for each column the type,
+ * the null flag and the value (strings as length + bytes + '\0') */
+typedef struct acc_async_rec {
+	unsigned int len;       /* whole record length */
+	unsigned short ncols;
+	unsigned short tlen;
+} acc_async_rec_t;
+
+typedef struct acc_async_queue {
+	gen_lock_t lock;
+	unsigned int size;      /* ring size */
+	unsigned int head;      /* first queued byte */
+	unsigned int used;      /* queued bytes */
+	unsigned int records;   /* queued records */
+	gen_lock_t spill_lock;
+	int spill_pending;      /* the spill file has rows */
+	int replaying;          /* a writer replays the spill file */
+	char *buf;
+} acc_async_queue_t;
+
+static acc_async_queue_t *acc_queue = 0;
+static db_func_t *acc_async_dbf = 0;
+static db_key_t *acc_async_keys = 0;
+static str acc_async_replay_file = {0, 0};
+
+static stat_var *acc_async_written = 0;
+static stat_var *acc_async_spilled = 0;
+static stat_var *acc_async_replayed = 0;
+static stat_var *acc_async_dropped = 0;
+static stat_var *acc_async_failed = 0;
+
+static unsigned long acc_async_get_records(void);
+static unsigned long acc_async_get_bytes(void);
+
+stat_export_t acc_async_stats[] = {
+	{"async_queue_records", STAT_IS_FUNC,
+		(stat_var**)acc_async_get_records},
+	{"async_queue_bytes",   STAT_IS_FUNC,
+		(stat_var**)acc_async_get_bytes},
+	{"async_written",       0, &acc_async_written},
+	{"async_spilled",       0, &acc_async_spilled},
+	{"async_replayed",      0, &acc_async_replayed},
+	{"async_dropped",       0, &acc_async_dropped},
+	{"async_failed",        0, &acc_async_failed},
+	{0, 0, 0}
+};
+
+static unsigned long acc_async_get_records(void)
+{
+	return acc_queue ? acc_queue->records : 0;
+}
+
+static unsigned long acc_async_get_bytes(void)
+{
+	return acc_queue ? acc_queue->used : 0;
+}
+
+
+/********************************************
+ *        rows serialization
+ ********************************************/
+
+static int acc_async_rec_size(str *table, db_val_t *vals, int n)
+{
+	int len;
+	int i;
+
+	len = sizeof(acc_async_rec_t) + table->len;
+	for (i = 0; i < n; i++) {
+		len += 2;
+		if (VAL_NULL(vals + i))
+			continue;
+		switch (VAL_TYPE(vals + i)) {
+			case DB1_INT:
+				len += sizeof(int);
+				break;
+			case DB1_DOUBLE:
+				len += sizeof(double);
+				break;
+			case DB1_DATETIME:
+				len += sizeof(time_t);
+				break;
+			case DB1_STR:
+				len += sizeof(int) + VAL_STR(vals + i).len + 1;
+				break;
+			case DB1_STRING:
+				len += sizeof(int) + strlen(VAL_STRING(vals + i)) + 1;
+				break;
+			default:
+				LM_ERR("unsupported value type %d\n", VAL_TYPE(vals + i));
+				return -1;
+		}
+	}
+	return len;
+}
+
+static void acc_async_rec_write(char *p, int len, str *table,
+		db_val_t *vals, int n)
+{
+	acc_async_rec_t rec;
+	str s;
+	int i;
+
+	rec.len = len;
+	rec.ncols = n;
+	rec.tlen = table->len;
+	memcpy(p, &rec, sizeof(rec));
+	p += sizeof(rec);
+	memcpy(p, table->s, table->len);
+	p += table->len;
+	for (i = 0; i < n; i++) {
+		*(p++) = (char)VAL_TYPE(vals + i);
+		*(p++) = (char)VAL_NULL(vals + i);
+		if (VAL_NULL(vals + i))
+			continue;
+		switch (VAL_TYPE(vals + i)) {
+			case DB1_INT:
+				memcpy(p, &VAL_INT(vals + i), sizeof(int));
+				p += sizeof(int);
+				break;
+			case DB1_DOUBLE:
+				memcpy(p, &VAL_DOUBLE(vals + i), sizeof(double));
+				p += sizeof(double);
+				break;
+			case DB1_DATETIME:
+				memcpy(p, &VAL_TIME(vals + i), sizeof(time_t));
+				p += sizeof(time_t);
+				break;
+			default:
+				/* DB1_STR, DB1_STRING */
+				if (VAL_TYPE(vals + i) == DB1_STR) {
+					s = VAL_STR(vals + i);
+				} else {
+					s.s = (char*)VAL_STRING(vals + i);
+					s.len = strlen(s.s);
+				}
+				memcpy(p, &s.len, sizeof(int));
+				p += sizeof(int);
+				memcpy(p, s.s, s.len);
+				p += s.len;
+				*(p++) = '\0';
+				break;
+		}
+	}
+}
+
+/* the values point inside the record, which must be kept */
+static int acc_async_rec_read(char *p, str *table, db_val_t *vals)
+{
+	acc_async_rec_t rec;
+	char *end;
+	int len;
+	int i;
+
+	memcpy(&rec, p, sizeof(rec));
+	end = p + rec.len;
+	p += sizeof(rec);
+	table->s = p;
+	table->len = rec.tlen;
+	p += rec.tlen;
+	for (i = 0; i < rec.ncols; i++) {
+		if (p + 2 > end)
+			goto error;
+		VAL_TYPE(vals + i) = (db_type_t)*(p++);
+		VAL_NULL(vals + i) = *(p++);
+		if (VAL_NULL(vals + i))
+			continue;
+		switch (VAL_TYPE(vals + i)) {
+			case DB1_INT:
+				memcpy(&VAL_INT(vals + i), p, sizeof(int));
+				p += sizeof(int);
+				break;
+			case DB1_DOUBLE:
+				memcpy(&VAL_DOUBLE(vals + i), p, sizeof(double));
+				p += sizeof(double);
+				break;
+			case DB1_DATETIME:
+				memcpy(&VAL_TIME(vals + i), p, sizeof(time_t));
+				p += sizeof(time_t);
+				break;
+			case DB1_STR:
+			case DB1_STRING:
+				memcpy(&len, p, sizeof(int));
+				p += sizeof(int);
+				if (VAL_TYPE(vals + i) == DB1_STR) {
+					VAL_STR(vals + i).s = p;
+					VAL_STR(vals + i).len = len;
+				} else {
+					VAL_STRING(vals + i) = p;
+				}
+				p += len + 1;
+				break;
+			default:
+				goto error;
+		}
+		if (p > end)
+			goto error;
+	}
+	return rec.ncols;
+error:
+	LM_ERR("corrupted accounting record\n");
+	return -1;
+}
+
+
+/********************************************
+ *        spill file
+ ********************************************/
+
+/* append records to the spill file, must be called with spill_lock */
+static int acc_async_spill_write_unsafe(char *buf, int len)
+{
+	int fd;
+	int n;
+
+	fd = open(acc_async_spill_file, O_WRONLY | O_APPEND | O_CREAT, 0640);
+	if (fd < 0) {
+		LM_ERR("cannot open spill file %s: %s\n", acc_async_spill_file,
+				strerror(errno));
+		return -1;
+	}
+	while (len > 0) {
+		n = write(fd, buf, len);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			LM_ERR("cannot write to spill file %s: %s\n",
+					acc_async_spill_file, strerror(errno));
+			close(fd);
+			return -1;
+		}
+		buf += n;
+		len -= n;
+	}
+	close(fd);
+	acc_queue->spill_pending = 1;
+	return 0;
+}
+
+/* save records (n rows) which could not be written to the database */
+static int acc_async_spill(char *buf, int len, int n)
+{
+	int ret;
+
+	if (acc_async_spill_file == 0) {
+		update_stat(acc_async_failed, n);
+		return -1;
+	}
+	lock_get(&acc_queue->spill_lock);
+	ret = acc_async_spill_write_unsafe(buf, len);
+	lock_release(&acc_queue->spill_lock);
+	if (ret < 0) {
+		update_stat(acc_async_failed, n);
+		return -1;
+	}
+	update_stat(acc_async_spilled, n);
+	return 0;
+}
+
+/* move the content of the replay file back in the spill file, from
+ * offset (leftover from a failed replay or from a previous run) */
+static void acc_async_replay_restore(int fd, off_t offset)
+{
+	char buf[4096];
+	int n;
+
+	if (lseek(fd, offset, SEEK_SET) == (off_t)-1)
+		return;
+	lock_get(&acc_queue->spill_lock);
+	while ((n = read(fd, buf, sizeof(buf))) > 0) {
+		if (acc_async_spill_write_unsafe(buf, n) < 0)
+			break;
+	}
+	lock_release(&acc_queue->spill_lock);
+}
+
+
+/********************************************
+ *        shared queue
+ ********************************************/
+
+int acc_async_init(db_func_t *dbf, db_key_t *keys)
+{
+	struct stat st;
+	int fd;
+
+	if (acc_async_workers <= 0) {
+		LM_ERR("db_insert_mode 2 needs at least one async writer\n");
+		return -1;
+	}
+	if (acc_async_queue_size < 4096)
+		acc_async_queue_size = 4096;
+	if (acc_async_batch_size <= 0)
+		acc_async_batch_size = 1;
+	if (acc_async_flush_interval <= 0)
+		acc_async_flush_interval = 1;
+	if (acc_async_spill_file && acc_async_spill_file[0] == '\0')
+		acc_async_spill_file = 0;
+
+	acc_queue = (acc_async_queue_t*)shm_malloc(sizeof(acc_async_queue_t)
+			+ acc_async_queue_size);
+	if (acc_queue == 0) {
+		LM_ERR("no more shm memory\n");
+		return -1;
+	}
+	memset(acc_queue, 0, sizeof(acc_async_queue_t));
+	acc_queue->buf = (char*)(acc_queue + 1);
+	acc_queue->size = acc_async_queue_size;
+	if (lock_init(&acc_queue->lock) == 0
+			|| lock_init(&acc_queue->spill_lock) == 0) {
+		LM_ERR("cannot init the queue locks\n");
+		shm_free(acc_queue);
+		acc_queue = 0;
+		return -1;
+	}
+
+	if (acc_async_spill_file) {
+		acc_async_replay_file.len = strlen(acc_async_spill_file)
+			+ sizeof(".replay") - 1;
+		acc_async_replay_file.s = (char*)pkg_malloc(
+				acc_async_replay_file.len + 1);
+		if (acc_async_replay_file.s == 0) {
+			LM_ERR("no more pkg memory\n");
+			return -1;
+		}
+		sprintf(acc_async_replay_file.s, "%s.replay", acc_async_spill_file);
+		/* replay interrupted by a restart */
+		fd = open(acc_async_replay_file.s, O_RDONLY);
+		if (fd >= 0) {
+			acc_async_replay_restore(fd, 0);
+			close(fd);
+			unlink(acc_async_replay_file.s);
+		}
+		if (stat(acc_async_spill_file, &st) == 0 && st.st_size > 0) {
+			LM_INFO("spill file %s has %ld bytes to replay\n",
+					acc_async_spill_file, (long)st.st_size);
+			acc_queue->spill_pending = 1;
+		}
+	}
+
+	acc_async_dbf = dbf;
+	acc_async_keys = keys;
+	register_procs(acc_async_workers);
+	cfg_register_child(acc_async_workers);
+	return 0;
+}
+
+void acc_async_destroy(void)
+{
+	if (acc_queue) {
+		lock_destroy(&acc_queue->lock);
+		lock_destroy(&acc_queue->spill_lock);
+		shm_free(acc_queue);
+		acc_queue = 0;
+	}
+}
+
+/* copy to/from the ring, wrapping around its end */
+static void acc_async_ring_put(unsigned int pos, char *src, int len)
+{
+	unsigned int n;
+
+	pos %= acc_queue->size;
+	n = acc_queue->size - pos;
+	if (n >= (unsigned int)len) {
+		memcpy(acc_queue->buf + pos, src, len);
+	} else {
+		memcpy(acc_queue->buf + pos, src, n);
+		memcpy(acc_queue->buf, src + n, len - n);
+	}
+}
+
+static void acc_async_ring_get(unsigned int pos, char *dst, int len)
+{
+	unsigned int n;
+
+	pos %= acc_queue->size;
+	n = acc_queue->size - pos;
+	if (n >= (unsigned int)len) {
+		memcpy(dst, acc_queue->buf + pos, len);
+	} else {
+		memcpy(dst, acc_queue->buf + pos, n);
+		memcpy(dst + n, acc_queue->buf, len - n);
+	}
+}
+
+int acc_async_push(str *table, db_val_t *vals, int n)
+{
+	static char *rec = 0;
+	static int rec_size = 0;
+	char *p;
+	int len;
+
+	len = acc_async_rec_size(table, vals, n);
+	if (len < 0)
+		return -1;
+	if (len > rec_size) {
+		p = (char*)pkg_realloc(rec, len);
+		if (p == 0) {
+			LM_ERR("no more pkg memory\n");
+			return -1;
+		}
+		rec = p;
+		rec_size = len;
+	}
+	acc_async_rec_write(rec, len, table, vals, n);
+
+	lock_get(&acc_queue->lock);
+	if (acc_queue->size - acc_queue->used >= len) {
+		acc_async_ring_put(acc_queue->head + acc_queue->used, rec, len);
+		acc_queue->used += len;
+		acc_queue->records++;
+		lock_release(&acc_queue->lock);
+		return 1;
+	}
+	lock_release(&acc_queue->lock);
+
+	/* queue full, the writers can't keep up (no disk i/o here, the
+	 * SIP workers must not wait for the spill file) */
+	update_stat(acc_async_dropped, 1);
+	LM_ERR("accounting queue full, row dropped\n");
+	return -1;
+}
+
+/* take up to acc_async_batch_size records, at most bsize bytes (but at
+ * least one record), returns the number of records */
+static int acc_async_pop(char **buf, int *bsize, int *blen)
+{
+	acc_async_rec_t rec;
+	unsigned int pos;
+	unsigned int len;
+	char *p;
+	int n;
+
+	n = 0;
+	len = 0;
+	lock_get(&acc_queue->lock);
+	pos = acc_queue->head;
+	while (n < acc_queue->records && n < acc_async_batch_size) {
+		acc_async_ring_get(pos, (char*)&rec, sizeof(rec));
+		if (len + rec.len > *bsize) {
+			if (n > 0)
+				break;
+			p = (char*)pkg_realloc(*buf, rec.len);
+			if (p == 0) {
+				lock_release(&acc_queue->lock);
+				LM_ERR("no more pkg memory\n");
+				return -1;
+			}
+			*buf = p;
+			*bsize = rec.len;
+		}
+		acc_async_ring_get(pos, *buf + len, rec.len);
+		pos = (pos + rec.len) % acc_queue->size;
+		len += rec.len;
+		n++;
+	}
+	acc_queue->head = pos;
+	acc_queue->used -= len;
+	acc_queue->records -= n;
+	lock_release(&acc_queue->lock);
+	*blen = len;
+	return n;
+}
+
+
+/********************************************
+ *        writer processes
+ ********************************************/
+
+/* write n records to the database, one transaction for all of them if
+ * supported, returns 0 if written, -1 if spilled or lost */
+static int acc_async_flush(db1_con_t *h, char *buf, int len, int n)
+{
+	db_val_t vals[ACC_CORE_LEN+3+MAX_ACC_EXTRA+MAX_ACC_LEG];
+	acc_async_rec_t rec;
+	str table;
+	char *p;
+	int ncols;
+	int tx;
+	int i;
+
+	tx = (n > 1 && acc_async_dbf->start_transaction
+			&& acc_async_dbf->end_transaction
+			&& acc_async_dbf->start_transaction(h, DB_LOCKING_NONE) == 0);
+	p = buf;
+	for (i = 0; i < n; i++) {
+		memcpy(&rec, p, sizeof(rec));
+		if (rec.ncols > ACC_CORE_LEN+3+MAX_ACC_EXTRA+MAX_ACC_LEG
+				|| (ncols = acc_async_rec_read(p, &table, vals)) < 0) {
+			LM_ERR("dropping invalid accounting record\n");
+			update_stat(acc_async_failed, 1);
+			p += rec.len;
+			continue;
+		}
+		if (acc_async_dbf->use_table(h, &table) < 0
+				|| acc_async_dbf->insert(h, acc_async_keys, vals, ncols) < 0) {
+			LM_ERR("failed to insert into database\n");
+			goto error;
+		}
+		p += rec.len;
+	}
+	if (tx && acc_async_dbf->end_transaction(h) < 0) {
+		LM_ERR("failed to commit the accounting rows\n");
+		p = buf;
+		i = 0;
+		goto error_tx;
+	}
+	update_stat(acc_async_written, n);
+	return 0;
+
+error:
+	if (tx) {
+		if (acc_async_dbf->abort_transaction)
+			acc_async_dbf->abort_transaction(h);
+		/* nothing was written */
+		p = buf;
+		i = 0;
+	} else {
+		update_stat(acc_async_written, i);
+	}
+error_tx:
+	acc_async_spill(p, len - (int)(p - buf), n - i);
+	return -1;
+}
+
+/* write the spilled rows to the database, only one writer at a time
+ * returns 1 if the spill file was replayed, 0 if there was nothing to do
+ * (or another writer replays it), -1 on error */
+static int acc_async_replay(db1_con_t *h, char **buf, int *bsize)
+{
+	acc_async_rec_t rec;
+	off_t offset;
+	char *p;
+	int len;
+	int fd;
+	int n;
+	int ret;
+
+	lock_get(&acc_queue->spill_lock);
+	if (!acc_queue->spill_pending || acc_queue->replaying) {
+		lock_release(&acc_queue->spill_lock);
+		return 0;
+	}
+	if (rename(acc_async_spill_file, acc_async_replay_file.s) < 0) {
+		ret = 0;
+		if (errno == ENOENT) {
+			acc_queue->spill_pending = 0;
+		} else {
+			LM_ERR("cannot rename spill file %s: %s\n",
+					acc_async_spill_file, strerror(errno));
+			ret = -1;
+		}
+		lock_release(&acc_queue->spill_lock);
+		return ret;
+	}
+	acc_queue->spill_pending = 0;
+	acc_queue->replaying = 1;
+	lock_release(&acc_queue->spill_lock);
+
+	fd = open(acc_async_replay_file.s, O_RDONLY);
+	if (fd < 0) {
+		LM_ERR("cannot open %s: %s\n", acc_async_replay_file.s,
+				strerror(errno));
+		ret = -1;
+		goto end;
+	}
+	LM_INFO("replaying the spilled accounting rows\n");
+	ret = 0;
+	offset = 0;
+	while (ret == 0) {
+		/* read a batch */
+		len = 0;
+		for (n = 0; n < acc_async_batch_size; n++) {
+			if (read(fd, &rec, sizeof(rec)) != sizeof(rec))
+				break;
+			if (rec.len < sizeof(rec)) {
+				LM_ERR("corrupted spill file, rest dropped\n");
+				ret = 1;
+				break;
+			}
+			if (len + rec.len > *bsize) {
+				p = (char*)pkg_realloc(*buf, len + rec.len);
+				if (p == 0) {
+					LM_ERR("no more pkg memory\n");
+					ret = -1;
+					break;
+				}
+				*buf = p;
+				*bsize = len + rec.len;
+			}
+			memcpy(*buf + len, &rec, sizeof(rec));
+			if (read(fd, *buf + len + sizeof(rec), rec.len - sizeof(rec))
+					!= rec.len - sizeof(rec)) {
+				LM_ERR("truncated spill file\n");
+				ret = 1;
+				break;
+			}
+			len += rec.len;
+		}
+		if (ret < 0) {
+			acc_async_replay_restore(fd, offset);
+			break;
+		}
+		if (n == 0)
+			break;
+		/* on error, the batch is spilled again, stop and keep the rest */
+		if (acc_async_flush(h, *buf, len, n) < 0) {
+			acc_async_replay_restore(fd, offset + len);
+			ret = -1;
+			break;
+		}
+		update_stat(acc_async_replayed, n);
+		offset += len;
+	}
+	close(fd);
+	unlink(acc_async_replay_file.s);
+end:
+	lock_get(&acc_queue->spill_lock);
+	acc_queue->replaying = 0;
+	lock_release(&acc_queue->spill_lock);
+	return (ret < 0) ? -1 : 1;
+}
+
+static void acc_async_writer(int rank, const str *db_url)
+{
+	db1_con_t *h;
+	char *buf;
+	int bsize;
+	int blen;
+	int poll;
+	int waited;
+	int n;
+	time_t retry;
+
+	h = 0;
+	bsize = ACC_ASYNC_BATCH_BUF;
+	buf = (char*)pkg_malloc(bsize);
+	if (buf == 0) {
+		LM_ERR("no more pkg memory\n");
+		return;
+	}
+	/* wake up a few times per flush interval */
+	poll = acc_async_flush_interval * 1000 / 4;
+	if (poll < 1000)
+		poll = 1000;
+	waited = 0;
+	retry = 0;
+
+	for (;;) {
+		cfg_update();
+		if (retry && time(0) >= retry)
+			retry = 0;
+		if (h == 0 && retry == 0) {
+			h = acc_async_dbf->init(db_url);
+			if (h == 0) {
+				LM_ERR("writer %d unable to connect to the database\n", rank);
+				retry = time(0) + ACC_ASYNC_RETRY_INTERVAL;
+			}
+		}
+		if (acc_queue->records == 0
+				|| (acc_queue->records < acc_async_batch_size
+					&& waited < acc_async_flush_interval)) {
+			if (h && retry == 0 && acc_queue->spill_pending) {
+				n = acc_async_replay(h, &buf, &bsize);
+				if (n < 0)
+					retry = time(0) + ACC_ASYNC_RETRY_INTERVAL;
+				else if (n > 0)
+					continue;
+			}
+			sleep_us(poll);
+			if (acc_queue->records)
+				waited += poll / 1000;
+			continue;
+		}
+		if ((h == 0 || retry) && acc_async_spill_file == 0) {
+			/* database down and nowhere to spill: keep the rows queued
+			 * until the next try */
+			sleep_us(poll);
+			continue;
+		}
+		waited = 0;
+		n = acc_async_pop(&buf, &bsize, &blen);
+		if (n <= 0)
+			continue;
+		if (h == 0 || retry) {
+			/* database down, don't wait for it */
+			acc_async_spill(buf, blen, n);
+			continue;
+		}
+		if (acc_async_flush(h, buf, blen, n) < 0)
+			retry = time(0) + ACC_ASYNC_RETRY_INTERVAL;
+	}
+}
+
+int acc_async_start(const str *db_url)
+{
+	int pid;
+	int i;
+
+	for (i = 0; i < acc_async_workers; i++) {
+		pid = fork_process(PROC_NOCHLDINIT, "ACC DB WRITER", 1);
+		if (pid < 0) {
+			LM_ERR("failed to fork acc writer %d\n", i);
+			return -1;
+		}
+		if (pid == 0) {
+			/* child */
+			if (cfg_child_init())
+				return -1;
+			acc_async_writer(i, db_url);
+			exit(-1);
+		}
+	}
+	return 0;
+}
+
+#endif /* SQL_ACC */
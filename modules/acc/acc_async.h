@@ -0,0 +1,67 @@
+/*
+ * Accounting module
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ * \ingroup acc
+ * \brief Acc:: Asynchronous database writer
+ *
+ * With db_insert_mode 2 the SIP workers only serialize the accounting
+ * rows into a shared memory ring buffer. Dedicated writer processes
+ * take them in batches and insert them into the database, one
+ * transaction per batch. If the database fails, the rows are appended
+ * to a spill file, replayed once the database works again.
+ *
+ * - Module: \ref acc
+ */
+
+#ifndef _ACC_ASYNC_H_
+#define _ACC_ASYNC_H_
+
+#ifdef SQL_ACC
+
+#include "../../str.h"
+#include "../../lib/srdb1/db.h"
+#include "../../lib/kcore/statistics.h"
+
+extern int acc_async_workers;
+extern int acc_async_queue_size;
+extern int acc_async_batch_size;
+extern int acc_async_flush_interval;
+extern char *acc_async_spill_file;
+
+extern stat_export_t acc_async_stats[];
+
+/*! init the shared queue and register the writer processes (mod_init) */
+int acc_async_init(db_func_t *dbf, db_key_t *keys);
+
+/*! start the writer processes (child_init, PROC_MAIN) */
+int acc_async_start(const str *db_url);
+
+/*! free the shared queue */
+void acc_async_destroy(void);
+
+/*! queue an accounting row for the writers */
+int acc_async_push(str *table, db_val_t *vals, int n);
+
+#endif /* SQL_ACC */
+
+#endif
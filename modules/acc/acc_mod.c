@@ -74,6 +74,7 @@
 #include "acc_extra.h"
 #include "acc_logic.h"
 #include "acc_cdr.h"
+#include "acc_async.h"
 
 #ifdef RAD_ACC
 #include "../../lib/kcore/radius.h"
@@ -304,6 +305,11 @@ static param_export_t params[] = {
 	{"acc_sip_reason_column",STR_PARAM, &acc_sipreason_col.s  },
 	{"acc_time_column",      STR_PARAM, &acc_time_col.s       },
 	{"db_insert_mode",       INT_PARAM, &acc_db_insert_mode   },
+	{"db_async_workers",     INT_PARAM, &acc_async_workers    },
+	{"db_async_queue_size",  INT_PARAM, &acc_async_queue_size },
+	{"db_async_batch_size",  INT_PARAM, &acc_async_batch_size },
+	{"db_async_flush_interval", INT_PARAM, &acc_async_flush_interval },
+	{"db_async_spill_file",  STR_PARAM, &acc_async_spill_file },
 #endif
 	/* time-mode-specific */
 	{"time_mode",            INT_PARAM, &acc_time_mode        },
@@ -320,7 +326,11 @@ struct module_exports exports= {
 	DEFAULT_DLFLAGS, /* dlopen flags */
 	cmds,       /* exported functions */
 	params,     /* exported params */
+#ifdef SQL_ACC
+	acc_async_stats, /* exported statistics */
+#else
 	0,          /* exported statistics */
+#endif
 	0,          /* exported MI functions */
 	0,          /* exported pseudo-variables */
 	0,          /* extra processes */
@@ -701,6 +711,15 @@ static int mod_init( void )
 
 static int child_init(int rank)
 {
+#ifdef SQL_ACC
+	if (rank==PROC_MAIN && db_url.s && acc_db_insert_mode==2) {
+		if (acc_async_start(&db_url)<0) {
+			LM_ERR("failed to start the async db writers\n");
+			return -1;
+		}
+		return 0;
+	}
+#endif
 	if (rank==PROC_INIT || rank==PROC_MAIN || rank==PROC_TCP_MAIN)
 		return 0; /* do nothing for the main process */
 
@@ -746,6 +765,7 @@ static void destroy(void)
 		destroy_extras( log_extra);
 #ifdef SQL_ACC
 	acc_db_close();
+	acc_async_destroy();
 	if (db_extra)
 		destroy_extras( db_extra);
 #endif
@@ -0,0 +1,399 @@
+/**
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+ * Non-blocking next hop resolution: when the next hop host of a request
+ * cannot be resolved from the dns cache, the transaction is suspended and
+ * the name is passed to a pool of resolver processes. They do the
+ * (blocking) lookup, which fills the dns cache, and then resume all the
+ * transactions waiting for that name, so the SIP workers never block in
+ * the resolver. Concurrent misses for the same name are coalesced into a
+ * single lookup.
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+
+#include "../../dprint.h"
+#include "../../ut.h"
+#include "../../locking.h"
+#include "../../hashes.h"
+#include "../../resolve.h"
+#include "../../dns_cache.h"
+#include "../../cfg_core.h"
+#include "../../pt.h"
+#include "../../sr_module.h"
+#include "../../timer_proc.h"
+#include "../../cfg/cfg_struct.h"
+#include "../../parser/parse_uri.h"
+#include "../../modules/tm/tm_load.h"
+
+#include "async_dns.h"
+
+/* tm */
+extern struct tm_binds tmb;
+
+int async_dns_workers = 0;
+
+typedef struct async_dns_waiter {
+	unsigned int tindex;
+	unsigned int tlabel;
+	cfg_action_t *act;
+	struct async_dns_waiter *next;
+} async_dns_waiter_t;
+
+typedef struct async_dns_query {
+	str name;
+	unsigned short port;
+	char proto;
+	unsigned int hashid;
+	async_dns_waiter_t *waiters;
+	struct async_dns_query *next;  /* in-flight hash slot */
+	struct async_dns_query *qnext; /* pending queue */
+} async_dns_query_t;
+
+#define ASYNC_DNS_HASH_SIZE	64
+
+static struct async_dns_head {
+	gen_lock_t lock;
+	async_dns_query_t *slots[ASYNC_DNS_HASH_SIZE];
+	async_dns_query_t *qstart;
+	async_dns_query_t *qend;
+} *_async_dns_head = NULL;
+
+/* wakes up the resolver processes, one byte per queued lookup */
+static int _async_dns_pipe[2] = {-1, -1};
+
+int async_dns_init(void)
+{
+	if(async_dns_workers<=0)
+		return 0;
+	if(dont_fork) {
+		LM_WARN("dns workers ignored in no-fork mode\n");
+		async_dns_workers = 0;
+		return 0;
+	}
+	_async_dns_head = (struct async_dns_head*)
+						shm_malloc(sizeof(struct async_dns_head));
+	if(_async_dns_head==NULL)
+	{
+		LM_ERR("no more shm\n");
+		return -1;
+	}
+	memset(_async_dns_head, 0, sizeof(struct async_dns_head));
+	if(lock_init(&_async_dns_head->lock)==0)
+	{
+		LM_ERR("cannot init the lock\n");
+		goto error;
+	}
+	if(pipe(_async_dns_pipe)<0)
+	{
+		LM_ERR("cannot create the pipe: %s\n", strerror(errno));
+		goto error;
+	}
+	/* a full pipe means the resolvers have enough work already */
+	if(fcntl(_async_dns_pipe[1], F_SETFL,
+				fcntl(_async_dns_pipe[1], F_GETFL)|O_NONBLOCK)<0)
+	{
+		LM_ERR("cannot set the pipe non-blocking: %s\n", strerror(errno));
+		goto error;
+	}
+	if(register_basic_timers(async_dns_workers)<0)
+	{
+		LM_ERR("cannot register the dns processes\n");
+		goto error;
+	}
+	return 0;
+
+error:
+	async_dns_destroy();
+	return -1;
+}
+
+int async_dns_destroy(void)
+{
+	if(_async_dns_pipe[0]>=0)
+	{
+		close(_async_dns_pipe[0]);
+		close(_async_dns_pipe[1]);
+		_async_dns_pipe[0] = _async_dns_pipe[1] = -1;
+	}
+	if(_async_dns_head==NULL)
+		return 0;
+	lock_destroy(&_async_dns_head->lock);
+	shm_free(_async_dns_head);
+	_async_dns_head = NULL;
+	return 0;
+}
+
+/**
+ * returns 1 if host can be resolved from the dns cache only, 0 if not
+ */
+static int async_dns_cached(str *host, unsigned short port, char proto)
+{
+	char srv[MAX_DNS_NAME];
+	str sname;
+	int rs;
+
+	rs = -1;
+	if(port==0 && host->len+SRV_MAX_PREFIX_LEN+1<MAX_DNS_NAME)
+	{
+		if(proto==PROTO_NONE)
+			proto = PROTO_UDP;
+		if(proto==PROTO_UDP || proto==PROTO_TCP || proto==PROTO_TLS
+				|| proto==PROTO_SCTP)
+		{
+			create_srv_name(proto, host, srv);
+			sname.s = srv;
+			sname.len = strlen(srv);
+			rs = dns_cache_check(&sname, T_SRV);
+			if(rs==1)
+				return 1;
+		}
+	} else {
+		/* no srv lookup done for this target */
+		rs = 0;
+	}
+	if(rs<0)
+		return 0;
+	return (dns_cache_check(host, T_A)>=0)?1:0;
+}
+
+/**
+ * the resolver process: lookup the queued names and resume the waiting
+ * transactions
+ */
+static void async_dns_exec(void)
+{
+	async_dns_query_t *q;
+	async_dns_query_t **p;
+	async_dns_waiter_t *w;
+	union sockaddr_union su;
+	char proto;
+	char c;
+
+	for(;;) {
+		if(read(_async_dns_pipe[0], &c, 1)<0)
+		{
+			if(errno==EINTR || errno==EAGAIN)
+				continue;
+			LM_ERR("error reading from the pipe: %s\n", strerror(errno));
+			return;
+		}
+		cfg_update();
+
+		while(1) {
+			lock_get(&_async_dns_head->lock);
+			q = _async_dns_head->qstart;
+			if(q!=NULL) {
+				_async_dns_head->qstart = q->qnext;
+				if(_async_dns_head->qstart==NULL)
+					_async_dns_head->qend = NULL;
+			}
+			lock_release(&_async_dns_head->lock);
+			if(q==NULL)
+				break;
+
+			/* fills the dns cache, the result itself is not needed */
+			proto = q->proto;
+			if(sip_hostport2su(&su, &q->name, q->port, &proto)<0)
+				LM_DBG("failed to resolve [%.*s]\n", q->name.len, q->name.s);
+
+			/* no more waiters can be added once it is out of the table */
+			lock_get(&_async_dns_head->lock);
+			for(p=&_async_dns_head->slots[q->hashid%ASYNC_DNS_HASH_SIZE];
+					*p!=NULL; p=&(*p)->next) {
+				if(*p==q) {
+					*p = q->next;
+					break;
+				}
+			}
+			lock_release(&_async_dns_head->lock);
+
+			while(q->waiters!=NULL) {
+				w = q->waiters;
+				q->waiters = w->next;
+				tmb.t_continue(w->tindex, w->tlabel, w->act);
+				shm_free(w);
+			}
+			shm_free(q);
+			/* reset the configuration group handles */
+			cfg_reset_all();
+		}
+	}
+}
+
+int async_dns_fork(void)
+{
+	char desc[32];
+	int pid;
+	int i;
+
+	for(i=0; i<async_dns_workers; i++) {
+		snprintf(desc, sizeof(desc), "ASYNC MOD DNS %d", i);
+		pid = fork_process(PROC_TIMER, desc, 1);
+		if(pid<0) {
+			LM_ERR("failed to fork dns process %d\n", i);
+			return -1;
+		}
+		if(pid==0) {
+			/* child */
+			if(cfg_child_init())
+				return -1;
+			close(_async_dns_pipe[1]);
+			async_dns_exec();
+			exit(-1);
+		}
+	}
+	return 0;
+}
+
+/**
+ * returns 1 if the next hop can be resolved without blocking (continue
+ * the script), 0 if the processing was suspended (the script must exit),
+ * -1 on error
+ */
+int async_resolve(struct sip_msg* msg, cfg_action_t *act)
+{
+	struct sip_uri puri;
+	str *uri;
+	str host;
+	unsigned short port;
+	char proto;
+	int slot;
+	async_dns_query_t *q;
+	async_dns_query_t *nq = NULL;
+	async_dns_waiter_t *w = NULL;
+	tm_cell_t *t = 0;
+	char c;
+
+	if(_async_dns_head==NULL || !cfg_get(core, core_cfg, use_dns_cache))
+		return 1;
+
+	if(msg->dst_uri.s!=NULL && msg->dst_uri.len>0)
+		uri = &msg->dst_uri;
+	else
+		uri = GET_RURI(msg);
+	if(parse_uri(uri->s, uri->len, &puri)<0)
+	{
+		LM_ERR("failed to parse next hop uri [%.*s]\n", uri->len, uri->s);
+		return -1;
+	}
+	host = puri.host;
+	port = puri.port_no;
+	proto = puri.proto;
+	if(puri.type==SIPS_URI_T && proto!=PROTO_WSS)
+		proto = PROTO_TLS;
+	if(host.len<=0 || host.len>=MAX_DNS_NAME
+			|| str2ip(&host)!=NULL || str2ip6(&host)!=NULL)
+		return 1;
+	if(async_dns_cached(&host, port, proto))
+		return 1;
+
+	t = tmb.t_gett();
+	if (t==NULL || t==T_UNDEFINED)
+	{
+		if(tmb.t_newtran(msg)<0)
+		{
+			LM_ERR("cannot create the transaction\n");
+			return -1;
+		}
+		t = tmb.t_gett();
+		if (t==NULL || t==T_UNDEFINED)
+		{
+			LM_ERR("cannot lookup the transaction\n");
+			return -1;
+		}
+	}
+
+	/* allocate everything before suspending, the lookup entry is dropped
+	 * if another one is already in progress for the same target */
+	w = (async_dns_waiter_t*)shm_malloc(sizeof(async_dns_waiter_t));
+	nq = (async_dns_query_t*)shm_malloc(sizeof(async_dns_query_t)
+				+ host.len + 1);
+	if(w==NULL || nq==NULL)
+	{
+		LM_ERR("no more shm\n");
+		goto error;
+	}
+	memset(w, 0, sizeof(async_dns_waiter_t));
+	w->act = act;
+	memset(nq, 0, sizeof(async_dns_query_t));
+	nq->name.s = (char*)nq + sizeof(async_dns_query_t);
+	memcpy(nq->name.s, host.s, host.len);
+	nq->name.s[host.len] = '\0';
+	nq->name.len = host.len;
+	nq->port = port;
+	nq->proto = proto;
+	nq->hashid = get_hash1_case_raw(host.s, host.len) + port + proto;
+	slot = nq->hashid % ASYNC_DNS_HASH_SIZE;
+
+	if(tmb.t_suspend(msg, &w->tindex, &w->tlabel)<0)
+	{
+		LM_ERR("failed to suppend the processing\n");
+		goto error;
+	}
+
+	lock_get(&_async_dns_head->lock);
+	for(q=_async_dns_head->slots[slot]; q!=NULL; q=q->next) {
+		if(q->hashid==nq->hashid && q->port==port && q->proto==proto
+				&& q->name.len==host.len
+				&& strncasecmp(q->name.s, host.s, host.len)==0)
+			break;
+	}
+	if(q==NULL)
+	{
+		q = nq;
+		nq = NULL;
+		q->next = _async_dns_head->slots[slot];
+		_async_dns_head->slots[slot] = q;
+		if(_async_dns_head->qend!=NULL)
+			_async_dns_head->qend->qnext = q;
+		else
+			_async_dns_head->qstart = q;
+		_async_dns_head->qend = q;
+		c = 0;
+		if(write(_async_dns_pipe[1], &c, 1)<0 && errno!=EAGAIN)
+			LM_ERR("failed to wake up the dns processes: %s\n",
+					strerror(errno));
+	} else {
+		LM_DBG("lookup for [%.*s] already in progress\n", host.len, host.s);
+	}
+	w->next = q->waiters;
+	q->waiters = w;
+	lock_release(&_async_dns_head->lock);
+	if(nq!=NULL)
+		shm_free(nq);
+
+	return 0;
+
+error:
+	if(w!=NULL)
+		shm_free(w);
+	if(nq!=NULL)
+		shm_free(nq);
+	return -1;
+}
@@ -0,0 +1,39 @@
+/**
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef _ASYNC_DNS_H_
+#define _ASYNC_DNS_H_
+
+#include "../../parser/msg_parser.h"
+#include "../../route_struct.h"
+
+extern int async_dns_workers;
+
+int async_dns_init(void);
+
+int async_dns_fork(void);
+
+int async_dns_destroy(void);
+
+int async_resolve(struct sip_msg* msg, cfg_action_t *act);
+
+#endif
@@ -36,6 +36,7 @@
 #include "../../modules/tm/tm_load.h"
 
 #include "async_sleep.h"
+#include "async_dns.h"
 
 MODULE_VERSION
 
@@ -49,6 +50,7 @@ static int w_async_sleep(struct sip_msg* msg, char* sec, char* str2);
 static int fixup_async_sleep(void** param, int param_no);
 static int w_async_route(struct sip_msg* msg, char* rt, char* sec);
 static int fixup_async_route(void** param, int param_no);
+static int w_async_resolve(struct sip_msg* msg, char* rt, char* str2);
 
 /* tm */
 struct tm_binds tmb;
@@ -59,11 +61,14 @@ static cmd_export_t cmds[]={
 		0, REQUEST_ROUTE|FAILURE_ROUTE},
 	{"async_sleep", (cmd_function)w_async_sleep, 1, fixup_async_sleep,
 		0, REQUEST_ROUTE|FAILURE_ROUTE},
+	{"async_resolve", (cmd_function)w_async_resolve, 1, fixup_spve_null,
+		0, REQUEST_ROUTE|FAILURE_ROUTE},
 	{0, 0, 0, 0, 0, 0}
 };
 
 static param_export_t params[]={
 	{"workers",     INT_PARAM,   &async_workers},
+	{"dns_workers", INT_PARAM,   &async_dns_workers},
 	{0, 0, 0}
 };
 
@@ -102,6 +107,11 @@ static int mod_init(void)
 
 	register_dummy_timers(async_workers);
 
+	if(async_dns_init()<0) {
+		LM_ERR("cannot initialize the dns resolver processes\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -119,6 +129,11 @@ static int child_init(int rank)
 		return -1; /* error */
 	}
 
+	if(async_dns_fork()<0) {
+		LM_ERR("failed to fork the dns resolver processes\n");
+		return -1;
+	}
+
 	return 0;
 }
 /**
@@ -127,6 +142,7 @@ static int child_init(int rank)
 static void mod_destroy(void)
 {
 	async_destroy_timer_list();
+	async_dns_destroy();
 }
 
 static int w_async_sleep(struct sip_msg* msg, char* sec, char* str2)
@@ -233,3 +249,39 @@ static int fixup_async_route(void** param, int param_no)
 	}
 	return 0;
 }
+
+static int w_async_resolve(struct sip_msg* msg, char* rt, char* str2)
+{
+	cfg_action_t *act;
+	str rn;
+	int ri;
+	int ret;
+
+	if(msg==NULL)
+		return -1;
+
+	if(fixup_get_svalue(msg, (gparam_t*)rt, &rn)!=0)
+	{
+		LM_ERR("no async route block name\n");
+		return -1;
+	}
+
+	ri = route_get(&main_rt, rn.s);
+	if(ri<0)
+	{
+		LM_ERR("unable to find route block [%.*s]\n", rn.len, rn.s);
+		return -1;
+	}
+	act = main_rt.rlist[ri];
+	if(act==NULL)
+	{
+		LM_ERR("empty action lists in route block [%.*s]\n", rn.len, rn.s);
+		return -1;
+	}
+
+	ret = async_resolve(msg, act);
+	if(ret<0)
+		return -1;
+	/* 1 - resolvable from the cache, continue; 0 - suspended, exit */
+	return ret;
+}
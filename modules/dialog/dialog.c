@@ -1614,6 +1614,54 @@ static void internal_rpc_profile_print_dlgs(rpc_t *rpc, void *c, str *profile_na
 	}
 }
 
+/*!
+ * \brief Helper function that outputs the values of a profile with the
+ * most dialogs via the RPC interface
+ * \see rpc_profile_top
+ * \param rpc RPC node that should be filled
+ * \param c RPC void pointer
+ * \param profile_name the given profile
+ * \param n maximum number of values to output
+ */
+static void internal_rpc_profile_top(rpc_t *rpc, void *c, str *profile_name,
+		int n) {
+	dlg_profile_table_t *profile;
+	dlg_profile_value_count_t *top;
+	void *h;
+	int cnt;
+	int i;
+
+	profile = search_dlg_profile( profile_name );
+	if (!profile) {
+		rpc->fault(c, 404, "Non existing profile");
+		return;
+	}
+	if (!profile->has_value) {
+		rpc->fault(c, 400, "Profile without value");
+		return;
+	}
+	top = (dlg_profile_value_count_t*)pkg_malloc(
+			n*sizeof(dlg_profile_value_count_t));
+	if (top==NULL) {
+		rpc->fault(c, 500, "No more memory");
+		return;
+	}
+	cnt = get_profile_top_values(profile, top, n);
+	if (cnt<0) {
+		pkg_free(top);
+		rpc->fault(c, 500, "Internal error");
+		return;
+	}
+	for (i=0 ; i<cnt ; i++) {
+		if (rpc->add(c, "{", &h)<0)
+			break;
+		rpc->struct_add(h, "Sd", "value", &top[i].value,
+				"count", (int)top[i].count);
+	}
+	free_profile_top_values(top, cnt);
+	pkg_free(top);
+}
+
 /*
  * Wrapper around is_known_dlg().
  */
@@ -1643,6 +1691,9 @@ static const char *rpc_profile_get_size_doc[2] = {
 static const char *rpc_profile_print_dlgs_doc[2] = {
 	"Lists all the dialogs belonging to a profile", 0
 };
+static const char *rpc_profile_top_doc[2] = {
+	"Lists the values of a profile with the most dialogs: profile, [n]", 0
+};
 static const char *rpc_dlg_bridge_doc[2] = {
 	"Bridge two SIP addresses in a call using INVITE(hold)-REFER-BYE mechanism:\
  to, from, [outbound SIP proxy]", 0
@@ -1712,6 +1763,16 @@ static void rpc_profile_print_dlgs(rpc_t *rpc, void *c) {
 	}
 	return;
 }
+static void rpc_profile_top(rpc_t *rpc, void *c) {
+	str profile_name = {NULL,0};
+	int n = 10;
+
+	if (rpc->scan(c, ".S", &profile_name) < 1) return;
+	if (rpc->scan(c, "*d", &n) < 1 || n <= 0)
+		n = 10;
+	internal_rpc_profile_top(rpc, c, &profile_name, n);
+	return;
+}
 static void rpc_dlg_bridge(rpc_t *rpc, void *c) {
 	str from = {NULL,0};
 	str to = {NULL,0};
@@ -1750,6 +1811,7 @@ static rpc_export_t rpc_methods[] = {
 	{"dlg.end_dlg", rpc_end_dlg_entry_id, rpc_end_dlg_entry_id_doc, 0},
 	{"dlg.profile_get_size", rpc_profile_get_size, rpc_profile_get_size_doc, 0},
 	{"dlg.profile_list", rpc_profile_print_dlgs, rpc_profile_print_dlgs_doc, 0},
+	{"dlg.profile_top", rpc_profile_top, rpc_profile_top_doc, RET_ARRAY},
 	{"dlg.bridge_dlg", rpc_dlg_bridge, rpc_dlg_bridge_doc, 0},
 	{0, 0, 0, 0}
 };
@@ -33,6 +33,7 @@
 
 
 #include "../../mem/shm_mem.h"
+#include "../../mem/mem.h"
 #include "../../hashes.h"
 #include "../../trim.h"
 #include "../../dprint.h"
@@ -48,6 +49,9 @@
 /*! size of dialog profile hash */
 #define PROFILE_HASH_SIZE 16
 
+/*! size of the per value counters hash (profiles with value) */
+#define PROFILE_COUNTER_HASH_SIZE 256
+
 /*! tm bindings */
 extern struct tm_binds d_tmb;
 
@@ -201,6 +205,32 @@ static struct dlg_profile_table* new_dlg_profile( str *name, unsigned int size,
 		shm_free(profile);
 		return NULL;
 	}
+	atomic_set(&profile->count, 0);
+
+	if (profile->has_value) {
+		/* per value counters */
+		profile->counters = (struct dlg_profile_counter**)shm_malloc(
+			PROFILE_COUNTER_HASH_SIZE*sizeof(struct dlg_profile_counter*));
+		if (profile->counters==NULL) {
+			LM_ERR("no more shm mem\n");
+			lock_destroy( &profile->lock );
+			shm_free(profile);
+			return NULL;
+		}
+		memset(profile->counters, 0,
+			PROFILE_COUNTER_HASH_SIZE*sizeof(struct dlg_profile_counter*));
+		profile->counter_locks = lock_set_alloc(PROFILE_COUNTER_HASH_SIZE);
+		if (profile->counter_locks==NULL
+				|| lock_set_init(profile->counter_locks)==NULL) {
+			LM_ERR("failed to init the counter locks\n");
+			if (profile->counter_locks)
+				lock_set_dealloc(profile->counter_locks);
+			shm_free(profile->counters);
+			lock_destroy( &profile->lock );
+			shm_free(profile);
+			return NULL;
+		}
+	}
 
 	/* set inner pointers */
 	profile->entries = (struct dlg_profile_entry*)(profile + 1);
@@ -229,9 +259,24 @@ static struct dlg_profile_table* new_dlg_profile( str *name, unsigned int size,
  */
 static void destroy_dlg_profile(struct dlg_profile_table *profile)
 {
+	struct dlg_profile_counter *c;
+	unsigned int i;
+
 	if (profile==NULL)
 		return;
 
+	if (profile->counters) {
+		for (i=0 ; i<PROFILE_COUNTER_HASH_SIZE ; i++) {
+			while (profile->counters[i]) {
+				c = profile->counters[i];
+				profile->counters[i] = c->next;
+				shm_free(c);
+			}
+		}
+		shm_free(profile->counters);
+		lock_set_destroy(profile->counter_locks);
+		lock_set_dealloc(profile->counter_locks);
+	}
 	lock_destroy( &profile->lock );
 	shm_free( profile );
 	return;
@@ -254,6 +299,78 @@ void destroy_dlg_profiles(void)
 }
 
 
+/*!
+ * \brief Increment the counter of a profile value, creating it if needed
+ * \param profile dialog profile table (with value)
+ * \param value profile value
+ * \return the counter on success, NULL on failure
+ */
+static struct dlg_profile_counter* profile_counter_inc(
+		struct dlg_profile_table *profile, str *value)
+{
+	struct dlg_profile_counter *c;
+	unsigned int hash;
+
+	hash = core_hash(value, NULL, PROFILE_COUNTER_HASH_SIZE);
+	lock_set_get(profile->counter_locks, hash);
+	for (c=profile->counters[hash] ; c ; c=c->next) {
+		if (value->len==c->value.len &&
+		memcmp(value->s,c->value.s,value->len)==0 ) {
+			c->count++;
+			lock_set_release(profile->counter_locks, hash);
+			return c;
+		}
+	}
+	c = (struct dlg_profile_counter*)shm_malloc(
+		sizeof(struct dlg_profile_counter) + value->len);
+	if (c==NULL) {
+		lock_set_release(profile->counter_locks, hash);
+		LM_ERR("no more shm memory\n");
+		return NULL;
+	}
+	memset(c, 0, sizeof(struct dlg_profile_counter));
+	c->value.s = (char*)(c+1);
+	memcpy(c->value.s, value->s, value->len);
+	c->value.len = value->len;
+	c->count = 1;
+	c->hash = hash;
+	c->next = profile->counters[hash];
+	if (c->next)
+		c->next->prev = c;
+	profile->counters[hash] = c;
+	lock_set_release(profile->counter_locks, hash);
+	return c;
+}
+
+
+/*!
+ * \brief Decrement the counter of a profile value, destroying it at 0
+ * \param profile dialog profile table (with value)
+ * \param c value counter
+ */
+static void profile_counter_dec(struct dlg_profile_table *profile,
+		struct dlg_profile_counter *c)
+{
+	unsigned int hash;
+
+	hash = c->hash;
+	lock_set_get(profile->counter_locks, hash);
+	c->count--;
+	if (c->count==0) {
+		if (c->prev)
+			c->prev->next = c->next;
+		else
+			profile->counters[hash] = c->next;
+		if (c->next)
+			c->next->prev = c->prev;
+		lock_set_release(profile->counter_locks, hash);
+		shm_free(c);
+		return;
+	}
+	lock_set_release(profile->counter_locks, hash);
+}
+
+
 /*!
  * \brief Destroy dialog linkers
  * \param linker dialog linker
@@ -283,7 +400,12 @@ void destroy_linkers(struct dlg_profile_link *linker)
 			}
 			lh->next = lh->prev = NULL;
 			p_entry->content --;
+			atomic_dec(&l->profile->count);
 			lock_release( &l->profile->lock );
+			if (l->counter) {
+				profile_counter_dec(l->profile, l->counter);
+				l->counter = NULL;
+			}
 		}
 		/* free memory */
 		shm_free(l);
@@ -389,7 +511,16 @@ static void link_dlg_profile(struct dlg_profile_link *linker, struct dlg_cell *d
 			= linker->hash_linker.prev = &linker->hash_linker;
 	}
 	p_entry->content ++;
+	atomic_inc(&linker->profile->count);
 	lock_release( &linker->profile->lock );
+
+	/* update the value counter */
+	if (linker->profile->has_value) {
+		linker->counter = profile_counter_inc(linker->profile,
+				&linker->hash_linker.value);
+		if (linker->counter==NULL)
+			linker->profile->counters_failed = 1;
+	}
 }
 
 
@@ -661,12 +792,24 @@ unsigned int get_profile_size(struct dlg_profile_table *profile, str *value)
 	unsigned int n,i;
 	struct dlg_profile_hash *ph;
 
+	struct dlg_profile_counter *c;
+
 	if (profile->has_value==0 || value==NULL) {
-		/* iterate through the hash and count all records */
-		lock_get( &profile->lock );
-		for( i=0,n=0 ; i<profile->size ; i++ )
-			n += profile->entries[i].content;
-		lock_release( &profile->lock );
+		/* maintained on link/unlink */
+		return (unsigned int)atomic_get(&profile->count);
+	} else if (likely(profile->counters_failed==0)) {
+		/* look up the value counter */
+		i = core_hash(value, NULL, PROFILE_COUNTER_HASH_SIZE);
+		n = 0;
+		lock_set_get(profile->counter_locks, i);
+		for (c=profile->counters[i] ; c ; c=c->next) {
+			if (value->len==c->value.len &&
+			memcmp(value->s,c->value.s,value->len)==0 ) {
+				n = c->count;
+				break;
+			}
+		}
+		lock_set_release(profile->counter_locks, i);
 		return n;
 	} else {
 		/* iterate through the hash entry and count only matching */
@@ -692,6 +835,75 @@ unsigned int get_profile_size(struct dlg_profile_table *profile, str *value)
 	}
 }
 
+
+/*!
+ * \brief Get the values of a profile with the most dialogs
+ * \param profile evaluated profile (with value)
+ * \param top array of n elements, filled sorted by count; the values are
+ * pkg allocated and must be freed with free_profile_top_values
+ * \param n size of top
+ * \return number of values filled in top, -1 on error
+ */
+int get_profile_top_values(struct dlg_profile_table *profile,
+		dlg_profile_value_count_t *top, int n)
+{
+	struct dlg_profile_counter *c;
+	unsigned int i;
+	int cnt;
+	int k;
+	char *s;
+
+	if (profile->has_value==0 || profile->counters==NULL || n<=0)
+		return -1;
+	memset(top, 0, n*sizeof(dlg_profile_value_count_t));
+	cnt = 0;
+	for (i=0 ; i<PROFILE_COUNTER_HASH_SIZE ; i++) {
+		lock_set_get(profile->counter_locks, i);
+		for (c=profile->counters[i] ; c ; c=c->next) {
+			if (cnt==n && top[n-1].count>=c->count)
+				continue;
+			s = (char*)pkg_malloc(c->value.len + 1);
+			if (s==NULL) {
+				lock_set_release(profile->counter_locks, i);
+				LM_ERR("no more pkg memory\n");
+				free_profile_top_values(top, cnt);
+				return -1;
+			}
+			memcpy(s, c->value.s, c->value.len);
+			s[c->value.len] = '\0';
+			if (cnt==n) {
+				/* drop the smallest one */
+				pkg_free(top[n-1].value.s);
+				cnt--;
+			}
+			for (k=cnt ; k>0 && top[k-1].count<c->count ; k--)
+				top[k] = top[k-1];
+			top[k].value.s = s;
+			top[k].value.len = c->value.len;
+			top[k].count = c->count;
+			cnt++;
+		}
+		lock_set_release(profile->counter_locks, i);
+	}
+	return cnt;
+}
+
+
+/*!
+ * \brief Free the values returned by get_profile_top_values
+ */
+void free_profile_top_values(dlg_profile_value_count_t *top, int n)
+{
+	int i;
+
+	for (i=0 ; i<n ; i++) {
+		if (top[i].value.s) {
+			pkg_free(top[i].value.s);
+			top[i].value.s = NULL;
+		}
+	}
+}
+
 /*
  * Determine if message is in a dialog currently being tracked
  */
@@ -31,6 +31,7 @@
 #include "../../parser/msg_parser.h"
 #include "../../lib/srutils/srjson.h"
 #include "../../locking.h"
+#include "../../atomic_ops.h"
 #include "../../str.h"
 #include "../../modules/tm/h_table.h"
 
@@ -54,11 +55,22 @@ typedef struct dlg_profile_hash {
 } dlg_profile_hash_t;
 
 
+/*! number of dialogs with the same value in a profile */
+typedef struct dlg_profile_counter {
+	str value; /*!< profile value */
+	unsigned int count; /*!< number of linked dialogs */
+	unsigned int hash; /*!< position in the counters table */
+	struct dlg_profile_counter *next;
+	struct dlg_profile_counter *prev;
+} dlg_profile_counter_t;
+
+
 /*! list with links to dialog profiles */
 typedef struct dlg_profile_link {
 	struct dlg_profile_hash hash_linker;
 	struct dlg_profile_link  *next;
 	struct dlg_profile_table *profile;
+	struct dlg_profile_counter *counter; /*!< value counter, if any */
 } dlg_profile_link_t;
 
 
@@ -76,10 +88,23 @@ typedef struct dlg_profile_table {
 	unsigned int has_value; /*!< 0 for profiles without value, otherwise it has a value */
 	gen_lock_t lock; /*! lock for concurrent access */
 	struct dlg_profile_entry *entries;
+	atomic_t count; /*!< number of linked dialogs */
+	/*! per value counters (profiles with value), one lock per slot */
+	struct dlg_profile_counter **counters;
+	gen_lock_set_t *counter_locks;
+	int counters_failed; /*!< a counter could not be created, count by
+						   walking the profile hash */
 	struct dlg_profile_table *next;
 } dlg_profile_table_t;
 
 
+/*! value and count, as returned by get_profile_top_values */
+typedef struct dlg_profile_value_count {
+	str value; /*!< pkg allocated */
+	unsigned int count;
+} dlg_profile_value_count_t;
+
+
 /*!
  * \brief Add profile definitions to the global list
  * \see new_dlg_profile
@@ -172,6 +197,24 @@ int is_dlg_in_profile(sip_msg_t *msg, dlg_profile_table_t *profile,
 unsigned int get_profile_size(dlg_profile_table_t *profile, str *value);
 
 
+/*!
+ * \brief Get the values of a profile with the most dialogs
+ * \param profile evaluated profile (with value)
+ * \param top array of n elements, filled sorted by count; the values are
+ * pkg allocated and must be freed with free_profile_top_values
+ * \param n size of top
+ * \return number of values filled in top, -1 on error
+ */
+int get_profile_top_values(dlg_profile_table_t *profile,
+		dlg_profile_value_count_t *top, int n);
+
+
+/*!
+ * \brief Free the values returned by get_profile_top_values
+ */
+void free_profile_top_values(dlg_profile_value_count_t *top, int n);
+
+
 /*!
  * \brief Output a profile via MI interface
  * \param cmd_tree MI command tree
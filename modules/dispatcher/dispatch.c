@@ -38,6 +38,8 @@
  * 2007-07-18  removed index stuff
  * 			   added DB support to load/reload data(ancuta)
  * 2007-09-17  added list-file support for reload data (carstenbock)
+ * 2026-10-18  sets indexed by id (sorted array, binary search) for
+ *		ds_get_index()
  */
 
 /*! \file
@@ -100,6 +102,10 @@ int *ds_list_nr = NULL;
 int *crt_idx    = NULL;
 int *next_idx   = NULL;
 
+/* per list index: sets sorted by id, for binary search */
+ds_set_t ***ds_index = NULL;
+int *ds_index_nr = NULL;
+
 #define _ds_list 	(ds_lists[*crt_idx])
 #define _ds_list_nr (*ds_list_nr)
 
@@ -177,8 +183,15 @@ int init_data(void)
 	}
 	ds_lists[0] = ds_lists[1] = 0;
 
+	ds_index = (ds_set_t***)shm_malloc(2*sizeof(ds_set_t**));
+	if(!ds_index)
+	{
+		LM_ERR("Out of memory\n");
+		return -1;
+	}
+	ds_index[0] = ds_index[1] = 0;
 
-	p = (int*)shm_malloc(3*sizeof(int));
+	p = (int*)shm_malloc(5*sizeof(int));
 	if(!p)
 	{
 		LM_ERR("Out of memory\n");
@@ -188,7 +201,9 @@ int init_data(void)
 	crt_idx = p;
 	next_idx = p+1;
 	ds_list_nr = p+2;
+	ds_index_nr = p+3;
 	*crt_idx= *next_idx = 0;
+	ds_index_nr[0] = ds_index_nr[1] = 0;
 
 	return 0;
 }
@@ -427,6 +442,54 @@ randomize:
 	return 0;
 }
 
+/**
+ *
+ */
+static int ds_set_id_cmp(const void *a, const void *b)
+{
+	int ida = (*(ds_set_t**)a)->id;
+	int idb = (*(ds_set_t**)b)->id;
+
+	return (ida>idb) - (ida<idb);
+}
+
+/*! \brief build the array of sets sorted by id, used by ds_get_index()
+ * - it is published together with the list, by switching crt_idx */
+static int ds_build_index(int list_idx)
+{
+	ds_set_t **sets = NULL;
+	ds_set_t *sp = NULL;
+	int n;
+
+	if(ds_index[list_idx]!=NULL)
+	{
+		shm_free(ds_index[list_idx]);
+		ds_index[list_idx] = NULL;
+	}
+	ds_index_nr[list_idx] = 0;
+
+	n = 0;
+	for(sp = ds_lists[list_idx]; sp!= NULL; sp = sp->next)
+		n++;
+	if(n==0)
+		return 0;
+
+	sets = (ds_set_t**)shm_malloc(n*sizeof(ds_set_t*));
+	if(sets==NULL)
+	{
+		LM_ERR("no more memory!\n");
+		return -1;
+	}
+	n = 0;
+	for(sp = ds_lists[list_idx]; sp!= NULL; sp = sp->next)
+		sets[n++] = sp;
+	qsort(sets, n, sizeof(ds_set_t*), ds_set_id_cmp);
+
+	ds_index[list_idx] = sets;
+	ds_index_nr[list_idx] = n;
+	return 0;
+}
+
 /*! \brief  compact destinations from sets for fast access */
 int reindex_dests(int list_idx, int setn)
 {
@@ -464,6 +527,9 @@ int reindex_dests(int list_idx, int setn)
 		dp_init_weights(sp);
 	}
 
+	if(ds_build_index(list_idx)!=0)
+		goto err1;
+
 	LM_DBG("found [%d] dest sets\n", setn);
 	return 0;
 
@@ -832,6 +898,9 @@ int ds_destroy_list(void)
 		shm_free(ds_lists);
 	}
 
+	if (ds_index)
+		shm_free(ds_index);
+
 	if (crt_idx)
 		shm_free(crt_idx);
 
@@ -867,6 +936,13 @@ void destroy_list(int list_id)
 	}
 
 	ds_lists[list_id]  = NULL;
+
+	if(ds_index!=NULL && ds_index[list_id]!=NULL)
+	{
+		shm_free(ds_index[list_id]);
+		ds_index[list_id] = NULL;
+		ds_index_nr[list_id] = 0;
+	}
 }
 
 /**
@@ -1218,30 +1294,34 @@ int ds_hash_pvar(struct sip_msg *msg, unsigned int *hash)
  */
 static inline int ds_get_index(int group, ds_set_t **index)
 {
-	ds_set_t *si = NULL;
+	ds_set_t **sets = NULL;
+	int idx;
+	int lo, hi, mid;
 
 	if(index==NULL || group<0 || _ds_list==NULL)
 		return -1;
 
-	/* get the index of the set */
-	si = _ds_list;
-	while(si)
+	/* binary search in the sorted index of the current list */
+	idx = *crt_idx;
+	sets = ds_index[idx];
+	lo = 0;
+	hi = ds_index_nr[idx] - 1;
+	while(lo<=hi)
 	{
-		if(si->id == group)
+		mid = (lo+hi)>>1;
+		if(sets[mid]->id == group)
 		{
-			*index = si;
-			break;
+			*index = sets[mid];
+			return 0;
 		}
-		si = si->next;
-	}
-
-	if(si==NULL)
-	{
-		LM_ERR("destination set [%d] not found\n", group);
-		return -1;
+		if(sets[mid]->id < group)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
 	}
 
-	return 0;
+	LM_ERR("destination set [%d] not found\n", group);
+	return -1;
 }
 
 
@@ -128,6 +128,18 @@ int ht_api_count_cells_re(str *hname, str *sre, int mode)
 	return 0;
 }
 
+/**
+ * init an incremental scan, that can be done in steps with scan_next
+ */
+int ht_api_scan_init(str *hname, ht_scan_t *sc, str *sre, int mode)
+{
+	ht_t* ht;
+	ht = ht_get_table(hname);
+	if(ht==NULL || sre==NULL || sre->len<=0)
+		return -1;
+	return ht_scan_init(sc, ht, sre, mode /* 0 - name; 1 - value */, 1);
+}
+
 /**
  *
  */
@@ -143,6 +155,9 @@ int bind_htable(htable_api_t* api)
 	api->get_expire = ht_api_get_cell_expire;
 	api->rm_re    = ht_api_rm_cell_re;
 	api->count_re = ht_api_count_cells_re;
+	api->scan_init    = ht_api_scan_init;
+	api->scan_next    = ht_scan_next;
+	api->scan_destroy = ht_scan_destroy;
 	return 0;
 }
 
@@ -25,6 +25,7 @@
 
 #include "../../sr_module.h"
 #include "../../usr_avp.h"
+#include "ht_api.h"
 
 typedef int (*ht_api_set_cell_f)(str *hname, str *name, int type,
 		int_str *val, int mode);
@@ -38,6 +39,12 @@ typedef int (*ht_api_get_cell_expire_f)(str *hname, str *name,
 typedef int (*ht_api_rm_cell_re_f)(str *hname, str *sre, int mode);
 typedef int (*ht_api_count_cells_re_f)(str *hname, str *sre, int mode);
 
+typedef int (*ht_api_scan_init_f)(str *hname, ht_scan_t *sc, str *sre,
+		int mode);
+typedef int (*ht_api_scan_next_f)(ht_scan_t *sc, unsigned int nslots,
+		int rm);
+typedef void (*ht_api_scan_destroy_f)(ht_scan_t *sc);
+
 typedef struct htable_api {
 	ht_api_set_cell_f set;
 	ht_api_del_cell_f rm;
@@ -45,6 +52,9 @@ typedef struct htable_api {
 	ht_api_get_cell_expire_f get_expire;
 	ht_api_rm_cell_re_f rm_re;
 	ht_api_count_cells_re_f count_re;
+	ht_api_scan_init_f scan_init;
+	ht_api_scan_next_f scan_next;
+	ht_api_scan_destroy_f scan_destroy;
 } htable_api_t;
 
 typedef int (*bind_htable_f)(htable_api_t* api);
@@ -31,6 +31,7 @@
 #include "../../hashes.h"
 #include "../../ut.h"
 #include "../../re.h"
+#include "../../atomic_ops.h"
 
 #include "ht_api.h"
 #include "ht_db.h"
@@ -303,6 +304,23 @@ int ht_init_tables(void)
 
 			}
 		}
+		if(ht->htexpire>0)
+		{
+			ht->expstep = ht_timer_interval;
+			ht->expwords = (ht->htsize+31)/32;
+			ht->expwheel = (unsigned int*)shm_malloc(HT_EXP_WHEEL_SIZE
+					* ht->expwords * sizeof(unsigned int));
+			if(ht->expwheel==NULL)
+			{
+				LM_ERR("no more shm for expiry index of [%.*s]\n",
+						ht->name.len, ht->name.s);
+				return -1;
+			}
+			memset(ht->expwheel, 0, HT_EXP_WHEEL_SIZE * ht->expwords
+					* sizeof(unsigned int));
+			ht->expnext = time(NULL);
+			ht->expnext -= ht->expnext % ht->expstep;
+		}
 		ht = ht->next;
 	}
 
@@ -340,6 +358,8 @@ int ht_destroy(void)
 			}
 			shm_free(ht->entries);
 		}
+		if(ht->expwheel!=NULL)
+			shm_free(ht->expwheel);
 		shm_free(ht);
 		ht = ht0;
 	}
@@ -348,6 +368,29 @@ int ht_destroy(void)
 }
 
 
+/**
+ * add the slot to the expiry index, in the time bucket of expire
+ * - cells expiring before the oldest bucket not checked yet go there
+ * - the buckets are reused round robin, a slot indexed too early is
+ *   indexed again by the timer with the closest expire of its cells
+ */
+static inline void ht_expire_index(ht_t *ht, unsigned int idx, time_t expire)
+{
+	volatile int *w;
+	int m;
+
+	if(ht->expwheel==NULL || expire==0)
+		return;
+	if(expire < ht->expnext)
+		expire = ht->expnext;
+	w = (volatile int*)&ht->expwheel[
+		((expire / ht->expstep) % HT_EXP_WHEEL_SIZE) * ht->expwords
+		+ (idx>>5)];
+	m = (int)(1U<<(idx&31));
+	if(!(*w & m))
+		atomic_or_int(w, m);
+}
+
 int ht_set_cell(ht_t *ht, str *name, int type, int_str *val, int mode)
 {
 	unsigned int idx;
@@ -390,8 +433,10 @@ int ht_set_cell(ht_t *ht, str *name, int type, int_str *val, int mode)
 						memcpy(it->value.s.s, val->s.s, val->s.len);
 						it->value.s.s[it->value.s.len] = '\0';
 						
-						if(ht->updateexpire)
+						if(ht->updateexpire) {
 							it->expire = now + ht->htexpire;
+							ht_expire_index(ht, idx, it->expire);
+						}
 					} else {
 						/* new */
 						cell = ht_cell_new(name, type, val, hid);
@@ -404,6 +449,7 @@ int ht_set_cell(ht_t *ht, str *name, int type, int_str *val, int mode)
 						cell->next = it->next;
 						cell->prev = it->prev;
 						cell->expire = now + ht->htexpire;
+						ht_expire_index(ht, idx, cell->expire);
 						if(it->prev)
 							it->prev->next = cell;
 						else
@@ -416,8 +462,10 @@ int ht_set_cell(ht_t *ht, str *name, int type, int_str *val, int mode)
 					it->flags &= ~AVP_VAL_STR;
 					it->value.n = val->n;
 
-					if(ht->updateexpire)
+					if(ht->updateexpire) {
 						it->expire = now + ht->htexpire;
+						ht_expire_index(ht, idx, it->expire);
+					}
 				}
 				if(mode) lock_release(&ht->entries[idx].lock);
 				return 0;
@@ -433,6 +481,7 @@ int ht_set_cell(ht_t *ht, str *name, int type, int_str *val, int mode)
 						return -1;
 					}
 					cell->expire = now + ht->htexpire;
+					ht_expire_index(ht, idx, cell->expire);
 					cell->next = it->next;
 					cell->prev = it->prev;
 					if(it->prev)
@@ -445,8 +494,10 @@ int ht_set_cell(ht_t *ht, str *name, int type, int_str *val, int mode)
 				} else {
 					it->value.n = val->n;
 
-					if(ht->updateexpire)
+					if(ht->updateexpire) {
 						it->expire = now + ht->htexpire;
+						ht_expire_index(ht, idx, it->expire);
+					}
 				}
 				if(mode) lock_release(&ht->entries[idx].lock);
 				return 0;
@@ -464,6 +515,7 @@ int ht_set_cell(ht_t *ht, str *name, int type, int_str *val, int mode)
 		return -1;
 	}
 	cell->expire = now + ht->htexpire;
+	ht_expire_index(ht, idx, cell->expire);
 	if(prev==NULL)
 	{
 		if(ht->entries[idx].first!=NULL)
@@ -591,6 +643,7 @@ ht_cell_t* ht_cell_value_add(ht_t *ht, str *name, int val, int mode,
 			} else {
 				it->value.n += val;
 				it->expire = now + ht->htexpire;
+				ht_expire_index(ht, idx, it->expire);
 				if(old!=NULL)
 				{
 					if(old->msize>=it->msize)
@@ -623,6 +676,7 @@ ht_cell_t* ht_cell_value_add(ht_t *ht, str *name, int val, int mode,
 		return NULL;
 	}
 	it->expire = now + ht->htexpire;
+	ht_expire_index(ht, idx, it->expire);
 	if(prev==NULL)
 	{
 		if(ht->entries[idx].first!=NULL)
@@ -893,13 +947,59 @@ int ht_has_autoexpire(void)
 	return 0;
 }
 
-void ht_timer(unsigned int ticks, void *param)
+/**
+ * remove the expired cells of a slot and index it again with the closest
+ * expire of the remaining cells
+ */
+static void ht_expire_slot(ht_t *ht, unsigned int idx, time_t now)
 {
-	ht_t *ht;
 	ht_cell_t *it;
 	ht_cell_t *it0;
+	time_t next;
+
+	next = 0;
+	lock_get(&ht->entries[idx].lock);
+	it = ht->entries[idx].first;
+	while(it)
+	{
+		it0 = it->next;
+		if(it->expire!=0)
+		{
+			if(it->expire<now)
+			{
+				/* expired */
+				if(it->prev==NULL)
+					ht->entries[idx].first = it->next;
+				else
+					it->prev->next = it->next;
+				if(it->next)
+					it->next->prev = it->prev;
+				ht->entries[idx].esize--;
+				ht_cell_free(it);
+			} else if(next==0 || it->expire<next) {
+				next = it->expire;
+			}
+		}
+		it = it0;
+	}
+	ht_expire_index(ht, idx, next);
+	lock_release(&ht->entries[idx].lock);
+}
+
+/**
+ * walk the time buckets of the expiry index up to now and check only
+ * the slots indexed in them
+ * - the bucket of the current time is kept, being checked again on next run
+ */
+void ht_timer(unsigned int ticks, void *param)
+{
+	ht_t *ht;
 	time_t now;
-	int i;
+	time_t t;
+	unsigned int b;
+	unsigned int i;
+	unsigned int bits;
+	int j;
 
 	if(_ht_root==NULL)
 		return;
@@ -909,32 +1009,32 @@ void ht_timer(unsigned int ticks, void *param)
 	ht = _ht_root;
 	while(ht)
 	{
-		if(ht->htexpire>0)
+		if(ht->htexpire>0 && ht->expwheel!=NULL)
 		{
-			for(i=0; i<ht->htsize; i++)
+			t = ht->expnext;
+			/* each bucket is checked once per run */
+			if(now - t >= (time_t)(HT_EXP_WHEEL_SIZE * ht->expstep))
+				t = now - (HT_EXP_WHEEL_SIZE - 1) * ht->expstep;
+			for(; t<=now; t+=ht->expstep)
 			{
-				/* free entries */
-				lock_get(&ht->entries[i].lock);
-				it = ht->entries[i].first;
-				while(it)
+				b = (t / ht->expstep) % HT_EXP_WHEEL_SIZE;
+				for(i=0; i<ht->expwords; i++)
 				{
-					it0 = it->next;
-					if(it->expire!=0 && it->expire<now)
+					if(ht->expwheel[b*ht->expwords + i]==0)
+						continue;
+					bits = (unsigned int)atomic_get_and_set_int(
+							(volatile int*)&ht->expwheel[b*ht->expwords + i], 0);
+					for(j=0; bits!=0 && j<32; j++)
 					{
-						/* expired */
-						if(it->prev==NULL)
-							ht->entries[i].first = it->next;
-						else
-							it->prev->next = it->next;
-						if(it->next)
-							it->next->prev = it->prev;
-						ht->entries[i].esize--;
-						ht_cell_free(it);
+						if(bits & (1U<<j))
+						{
+							bits &= ~(1U<<j);
+							ht_expire_slot(ht, i*32 + j, now);
+						}
 					}
-					it = it0;
 				}
-				lock_release(&ht->entries[i].lock);
 			}
+			ht->expnext = now - now % ht->expstep;
 		}
 		ht = ht->next;
 	}
@@ -979,6 +1079,7 @@ int ht_set_cell_expire(ht_t *ht, str *name, int type, int_str *val)
 		{
 			/* update value */
 			it->expire = now;
+			ht_expire_index(ht, idx, now);
 			lock_release(&ht->entries[idx].lock);
 			return 0;
 		}
@@ -1028,210 +1129,229 @@ int ht_get_cell_expire(ht_t *ht, str *name, unsigned int *val)
 	return 0;
 }
 
-int ht_rm_cell_re(str *sre, ht_t *ht, int mode)
-{
-	ht_cell_t *it;
-	ht_cell_t *it0;
-	int i;
-	regex_t re;
-	int match;
-	regmatch_t pmatch;
-
-	if(sre==NULL || sre->len<=0 || ht==NULL)
-		return -1;
-
-	if (regcomp(&re, sre->s, REG_EXTENDED|REG_ICASE|REG_NEWLINE))
-	{
-		LM_ERR("bad re %s\n", sre->s);
-		return -1;
-	}
-
-	for(i=0; i<ht->htsize; i++)
-	{
-		/* free entries */
-		lock_get(&ht->entries[i].lock);
-		it = ht->entries[i].first;
-		while(it)
-		{
-			it0 = it->next;
-			match = 0;
-			if(mode==0)
-			{
-				if (regexec(&re, it->name.s, 1, &pmatch, 0)==0)
-					match = 1;
-			} else {
-				if(it->flags&AVP_VAL_STR)
-					if (regexec(&re, it->value.s.s, 1, &pmatch, 0)==0)
-						match = 1;
-			}
-			if(match==1)
-			{
-				if(it->prev==NULL)
-					ht->entries[i].first = it->next;
-				else
-					it->prev->next = it->next;
-				if(it->next)
-					it->next->prev = it->prev;
-				ht->entries[i].esize--;
-				ht_cell_free(it);
-			}
-			it = it0;
-		}
-		lock_release(&ht->entries[i].lock);
-	}
-	regfree(&re);
-	return 0;
-}
-
-int ht_count_cells_re(str *sre, ht_t *ht, int mode)
+/**
+ * init the cursor of an incremental scan of the table
+ * - mode: 0 - match the name; 1 - match the string value
+ * - ops: 0 - sre is a regexp; 1 - sre can start with a match operator
+ *   (~~ regexp, ~% rlike, %~ llike, == str eq, eq int eq, ** all)
+ * return: 0 - ok; -1 - error
+ */
+int ht_scan_init(ht_scan_t *sc, ht_t *ht, str *sre, int mode, int ops)
 {
-	ht_cell_t *it;
-	ht_cell_t *it0;
-	int i;
-	regex_t re;
-	regmatch_t pmatch;
-	int cnt = 0;
-	int op = 0;
-	str sval;
-	str tval;
-	int ival = 0;
+	memset(sc, 0, sizeof(ht_scan_t));
+	sc->ht = ht;
+	sc->mode = mode;
 
-	if(sre==NULL || sre->len<=0 || ht==NULL)
-		return 0;
-
-	if(sre->len>=2)
+	if(ops!=0 && sre->len>=2)
 	{
 		switch(sre->s[0]) {
 			case '~':
 				switch(sre->s[1]) {
 					case '~':
-						op = 1; /* regexp */
+						sc->op = 1; /* regexp */
 					break;
 					case '%':
-						op = 2; /* rlike */
+						sc->op = 2; /* rlike */
 					break;
 				}
 			break;
 			case '%':
 				switch(sre->s[1]) {
 					case '~':
-						op = 3; /* llike */
+						sc->op = 3; /* llike */
 					break;
 				}
 			break;
 			case '=':
 				switch(sre->s[1]) {
 					case '=':
-						op = 4; /* str eq */
+						sc->op = 4; /* str eq */
 					break;
 				}
 			break;
 			case 'e':
 				switch(sre->s[1]) {
 					case 'q':
-						op = 5; /* int eq */
+						sc->op = 5; /* int eq */
 					break;
 				}
 			break;
 			case '*':
 				switch(sre->s[1]) {
 					case '*':
-						op = 6; /* int eq */
+						sc->op = 6; /* all */
 					break;
 				}
 			break;
 		}
 	}
 
-	if(op==6) {
-		/* count all */
-		for(i=0; i<ht->htsize; i++)
-			cnt += ht->entries[i].esize;
-		return cnt;
-	}
+	if(sc->op==6)
+		return 0;
 
-	if(op > 0) {
-		if(sre->len<=2)
+	if(sc->op > 0) {
+		if(sre->len<=2) {
+			/* nothing to match */
+			sc->op = 0;
 			return 0;
-		sval = *sre;
-		sval.s += 2;
-		sval.len -= 2;
-		if(op==5) {
+		}
+		sc->sval = *sre;
+		sc->sval.s += 2;
+		sc->sval.len -= 2;
+		if(sc->op==5) {
 			if(mode==0)
 			{
 				/* match by name */
+				sc->op = 0;
 				return 0;
 			}
-			str2sint(&sval, &ival);
+			str2sint(&sc->sval, &sc->ival);
 		}
 	} else {
-		sval = *sre;
-		op = 1;
+		sc->sval = *sre;
+		sc->op = 1;
 	}
 
-	if(op==1)
+	if(sc->op==1)
 	{
-		if (regcomp(&re, sval.s, REG_EXTENDED|REG_ICASE|REG_NEWLINE))
+		if (regcomp(&sc->re, sc->sval.s, REG_EXTENDED|REG_ICASE|REG_NEWLINE))
 		{
 			LM_ERR("bad re %s\n", sre->s);
-			return 0;
+			sc->op = 0;
+			return -1;
 		}
 	}
+	return 0;
+}
 
-	for(i=0; i<ht->htsize; i++)
+static int ht_scan_match(ht_scan_t *sc, ht_cell_t *it)
+{
+	regmatch_t pmatch;
+	str tval;
+
+	switch(sc->op) {
+		case 5: /* int eq */
+			return (!(it->flags&AVP_VAL_STR) && it->value.n==sc->ival);
+		case 6: /* all */
+			return 1;
+	}
+	if(sc->mode==0)
 	{
-		/* free entries */
-		lock_get(&ht->entries[i].lock);
-		it = ht->entries[i].first;
+		/* match by name */
+		tval = it->name;
+	} else {
+		if(!(it->flags&AVP_VAL_STR))
+			return 0;
+		tval = it->value.s;
+	}
+	switch(sc->op) {
+		case 1: /* regexp */
+			return (regexec(&sc->re, tval.s, 1, &pmatch, 0)==0);
+		case 2: /* rlike */
+			return (sc->sval.len<=tval.len
+					&& strncmp(sc->sval.s,
+						tval.s+tval.len-sc->sval.len, sc->sval.len)==0);
+		case 3: /* llike */
+			return (sc->sval.len<=tval.len
+					&& strncmp(sc->sval.s, tval.s, sc->sval.len)==0);
+		case 4: /* str eq */
+			return (sc->sval.len==tval.len
+					&& strncmp(sc->sval.s, tval.s, sc->sval.len)==0);
+	}
+	return 0;
+}
+
+/**
+ * scan the next nslots slots (0 - all remaining), counting the matching
+ * cells in sc->cnt and removing them if rm is set
+ * - no lock is held between two calls, the slots are locked one by one
+ * - removed cells are not replicated over dmq
+ * return: 1 - more slots to scan; 0 - scan completed
+ */
+int ht_scan_next(ht_scan_t *sc, unsigned int nslots, int rm)
+{
+	ht_t *ht;
+	ht_cell_t *it;
+	ht_cell_t *it0;
+	unsigned int end;
+
+	ht = sc->ht;
+	if(sc->op==0 || sc->slot>=ht->htsize)
+		return 0;
+
+	end = sc->slot + nslots;
+	if(nslots==0 || end>ht->htsize)
+		end = ht->htsize;
+
+	for(; sc->slot<end; sc->slot++)
+	{
+		if(sc->op==6 && rm==0)
+		{
+			/* count all */
+			sc->cnt += ht->entries[sc->slot].esize;
+			continue;
+		}
+		if(ht->entries[sc->slot].first==NULL)
+			continue;
+		lock_get(&ht->entries[sc->slot].lock);
+		it = ht->entries[sc->slot].first;
 		while(it)
 		{
 			it0 = it->next;
-			if(op==5)
+			if(ht_scan_match(sc, it))
 			{
-				if(!(it->flags&AVP_VAL_STR))
-					if( it->value.n==ival)
-						cnt++;
-			} else {
-				tval.len = -1;
-				if(mode==0)
+				sc->cnt++;
+				if(rm)
 				{
-					/* match by name */
-					tval = it->name;
-				} else {
-					if(it->flags&AVP_VAL_STR)
-						tval = it->value.s;
-				}
-				if(tval.len>-1) {
-					switch(op) {
-						case 1: /* regexp */
-							if (regexec(&re, tval.s, 1, &pmatch, 0)==0)
-								cnt++;
-						break;
-						case 2: /* rlike */
-							if(sval.len<=tval.len 
-									&& strncmp(sval.s,
-										tval.s+tval.len-sval.len, sval.len)==0)
-								cnt++;
-						break;
-						case 3: /* llike */
-							if(sval.len<=tval.len 
-									&& strncmp(sval.s, tval.s, sval.len)==0)
-								cnt++;
-						break;
-						case 4: /* str eq */
-							if(sval.len==tval.len 
-									&& strncmp(sval.s, tval.s, sval.len)==0)
-								cnt++;
-						break;
-					}
+					if(it->prev==NULL)
+						ht->entries[sc->slot].first = it->next;
+					else
+						it->prev->next = it->next;
+					if(it->next)
+						it->next->prev = it->prev;
+					ht->entries[sc->slot].esize--;
+					ht_cell_free(it);
 				}
 			}
 			it = it0;
 		}
-		lock_release(&ht->entries[i].lock);
+		lock_release(&ht->entries[sc->slot].lock);
 	}
-	if(op==1)
-		regfree(&re);
-	return cnt;
+	return (sc->slot<ht->htsize)?1:0;
+}
+
+void ht_scan_destroy(ht_scan_t *sc)
+{
+	if(sc->op==1)
+		regfree(&sc->re);
+	sc->op = 0;
+}
+
+int ht_rm_cell_re(str *sre, ht_t *ht, int mode)
+{
+	ht_scan_t sc;
+
+	if(sre==NULL || sre->len<=0 || ht==NULL)
+		return -1;
+
+	if(ht_scan_init(&sc, ht, sre, mode, 0)<0)
+		return -1;
+	while(ht_scan_next(&sc, HT_SCAN_BATCH, 1)>0);
+	ht_scan_destroy(&sc);
+	return 0;
+}
+
+int ht_count_cells_re(str *sre, ht_t *ht, int mode)
+{
+	ht_scan_t sc;
+
+	if(sre==NULL || sre->len<=0 || ht==NULL)
+		return 0;
+
+	if(ht_scan_init(&sc, ht, sre, mode, 1)<0)
+		return 0;
+	while(ht_scan_next(&sc, HT_SCAN_BATCH, 0)>0);
+	ht_scan_destroy(&sc);
+	return sc.cnt;
 }
 
@@ -24,6 +24,7 @@
 #define _HT_API_H_
 
 #include <time.h>
+#include <regex.h>
 
 #include "../../usr_avp.h"
 #include "../../locking.h"
@@ -32,6 +33,12 @@
 #define ht_compute_hash(_s)        core_case_hash(_s,0,0)
 #define ht_get_entry(_h,_size)    (_h)&((_size)-1)
 
+/* number of time buckets of the expiry index */
+#define HT_EXP_WHEEL_SIZE	128
+/* number of slots walked by a scan step in ht_rm_cell_re() and
+ * ht_count_cells_re() */
+#define HT_SCAN_BATCH		256
+
 typedef struct _ht_cell
 {
     unsigned int cellid;
@@ -64,15 +71,35 @@ typedef struct _ht
 	unsigned int htsize;
 	int dmqreplicate;
 	ht_entry_t *entries;
+	/* expiry index - for each time bucket, the bitmap of the slots
+	 * having cells that expire in that interval */
+	unsigned int expstep;
+	unsigned int expwords;
+	volatile time_t expnext;
+	unsigned int *expwheel;
 	struct _ht *next;
 } ht_t;
 
+/* cursor of an incremental scan, matching cells by name or value */
+typedef struct _ht_scan {
+	ht_t *ht;
+	int mode;
+	int op;
+	str sval;
+	int ival;
+	regex_t re;
+	unsigned int slot;
+	int cnt;
+} ht_scan_t;
+
 typedef struct _ht_pv {
 	str htname;
 	ht_t *ht;
 	pv_elem_t *pve;
 } ht_pv_t, *ht_pv_p;
 
+extern int ht_timer_interval;
+
 int ht_add_table(str *name, int autoexp, str *dbtable, int size, int dbmode,
 		int itype, int_str *ival, int updateexpire, int dmqreplicate);
 int ht_init_tables(void);
@@ -97,6 +124,10 @@ void ht_timer(unsigned int ticks, void *param);
 int ht_set_cell_expire(ht_t *ht, str *name, int type, int_str *val);
 int ht_get_cell_expire(ht_t *ht, str *name, unsigned int *val);
 
+int ht_scan_init(ht_scan_t *sc, ht_t *ht, str *sre, int mode, int ops);
+int ht_scan_next(ht_scan_t *sc, unsigned int nslots, int rm);
+void ht_scan_destroy(ht_scan_t *sc);
+
 int ht_rm_cell_re(str *sre, ht_t *ht, int mode);
 int ht_count_cells_re(str *sre, ht_t *ht, int mode);
 ht_t *ht_get_root(void);
@@ -163,6 +163,8 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if(ht_timer_interval<=0)
+		ht_timer_interval = 20;
 	if(ht_init_tables()!=0)
 		return -1;
 	ht_db_init_params();
@@ -183,8 +185,6 @@ static int mod_init(void)
 	if(ht_has_autoexpire())
 	{
 		LM_DBG("starting auto-expire timer\n");
-		if(ht_timer_interval<=0)
-			ht_timer_interval = 20;
 		if(register_timer(ht_timer, 0, ht_timer_interval)<0)
 		{
 			LM_ERR("failed to register timer function\n");
@@ -25,6 +25,7 @@
 
 #include "../../sr_module.h"
 #include "../../mem/mem.h"
+#include "../../mem/shm_mem.h"
 #include "../../str.h"
 #include "../../dprint.h"
 #include "../../locking.h"
@@ -1013,6 +1014,32 @@ static void rpc_mt_test_list(rpc_t* rpc, void* c)
 }
 
 
+static const char* rpc_mt_shm_bench_doc[2] = {
+	"Runs a shm malloc/free contention benchmark: takes the number of"
+	" processes to fork and the number of malloc/free pairs per process."
+	" The result is logged (L_INFO) together with the shm status.",
+	0
+};
+
+
+static void rpc_mt_shm_bench(rpc_t* rpc, void* c)
+{
+	int procs;
+	int loops;
+
+	if (rpc->scan(c, "dd", &procs, &loops) < 2) {
+		return;
+	}
+	if (procs <= 0 || loops <= 0) {
+		rpc->fault(c, 400, "invalid parameters");
+		return;
+	}
+	if (shm_mem_bench(procs, loops) < 0)
+		rpc->fault(c, 500, "benchmark failed");
+	return;
+}
+
+
 static rpc_export_t mt_rpc[] = {
 	{"mt.mem_alloc", rpc_mt_alloc, rpc_mt_alloc_doc, 0},
 	{"mt.mem_free", rpc_mt_free, rpc_mt_free_doc, 0},
@@ -1025,6 +1052,7 @@ static rpc_export_t mt_rpc[] = {
 	{"mt.mem_test_destroy_all", rpc_mt_test_destroy_all,
 								rpc_mt_test_destroy_all_doc, 0},
 	{"mt.mem_test_list", rpc_mt_test_list, rpc_mt_test_list_doc, 0},
+	{"mt.shm_bench", rpc_mt_shm_bench, rpc_mt_shm_bench_doc, 0},
 	{0, 0, 0, 0}
 };
 
@@ -50,9 +50,9 @@ struct addr_list ***addr_hash_table; /* Ptr to current hash table ptr */
 struct addr_list **addr_hash_table_1;     /* Pointer to hash table 1 */
 struct addr_list **addr_hash_table_2;     /* Pointer to hash table 2 */
 
-struct subnet **subnet_table;        /* Ptr to current subnet table */
-struct subnet *subnet_table_1;       /* Ptr to subnet table 1 */
-struct subnet *subnet_table_2;       /* Ptr to subnet table 2 */
+struct subnet_table **subnet_table;  /* Ptr to current subnet table */
+struct subnet_table *subnet_table_1; /* Ptr to subnet table 1 */
+struct subnet_table *subnet_table_2; /* Ptr to subnet table 2 */
 
 struct domain_name_list ***domain_list_table;        /* Ptr to current domain name table */
 static struct domain_name_list **domain_list_table_1;       /* Ptr to domain name table 1 */
@@ -87,7 +87,7 @@ int reload_address_table(void)
 	db_val_t* val;
 
 	struct addr_list **new_hash_table;
-	struct subnet *new_subnet_table;
+	struct subnet_table *new_subnet_table;
 	struct domain_name_list **new_domain_name_table;
 	int i;
 	unsigned int gid;
@@ -336,7 +336,8 @@ int init_addresses(void)
 	subnet_table_2 = new_subnet_table();
 	if (!subnet_table_2) goto error;
 
-	subnet_table = (struct subnet **)shm_malloc(sizeof(struct subnet *));
+	subnet_table = (struct subnet_table **)shm_malloc(
+			sizeof(struct subnet_table *));
 	if (!subnet_table) {
 		LM_ERR("no more shm memory for subnet_table\n");
 		goto error;
@@ -31,7 +31,7 @@ extern struct addr_list ***addr_hash_table;
 
 
 /* Pointer to current subnet table */
-extern struct subnet **subnet_table; 
+extern struct subnet_table **subnet_table; 
 
 
 /* Pointer to current domain name table */
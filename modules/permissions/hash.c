@@ -22,6 +22,7 @@
 
 #include <sys/types.h>
 #include <regex.h>
+#include <time.h>
 #include "../../mem/shm_mem.h"
 #include "../../parser/parse_from.h"
 #include "../../ut.h"
@@ -29,6 +30,7 @@
 #include "../../usr_avp.h"
 #include "../../ip_addr.h"
 #include "../../pvar.h"
+#include "../../counters.h"
 #include "hash.h"
 #include "trusted.h"
 #include "address.h"
@@ -600,76 +602,311 @@ void empty_addr_hash_table(struct addr_list **table)
 }
 
 
+/* subnet lookup counters */
+static counter_handle_t subnet_lookups;
+static counter_handle_t subnet_lookup_ns;
+
+static counter_def_t subnet_cnt_defs[] = {
+	{&subnet_lookups, "subnet_lookups", 0, 0, 0,
+		"number of subnet table lookups"},
+	{&subnet_lookup_ns, "subnet_lookup_ns", 0, 0, 0,
+		"total time spent in subnet table lookups (ns)"},
+	{0, 0, 0, 0, 0, 0 }
+};
+
+/*
+ * Register the subnet lookup counters
+ */
+int subnet_stats_init(void)
+{
+	if (counter_register_array("permissions", subnet_cnt_defs) < 0) {
+		LM_ERR("failed to register the subnet counters\n");
+		return -1;
+	}
+	return 0;
+}
+
+
+static inline unsigned long long subnet_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#define subnet_stats_update(start) \
+	do { \
+		counter_inc(subnet_lookups); \
+		counter_add(subnet_lookup_ns, (int)(subnet_now_ns() - (start))); \
+	} while(0)
+
+
+/* bit b of the address, 0 is the most significant bit of the first byte */
+#define SUBNET_BIT(a, b) (((a)->u.addr[(b)>>3] >> (7 - ((b)&7))) & 1)
+
+
+/*
+ * Number of leading bits (up to max) that are equal in a and b
+ */
+static unsigned int subnet_common_bits(ip_addr_t *a, ip_addr_t *b,
+		unsigned int max)
+{
+	unsigned int i;
+	unsigned char x;
+
+	for (i = 0; i < max; i += 8) {
+		x = a->u.addr[i>>3] ^ b->u.addr[i>>3];
+		if (x) {
+			while (!(x & 0x80)) {
+				x <<= 1;
+				i++;
+			}
+			return (i < max) ? i : max;
+		}
+	}
+	return max;
+}
+
+
+/*
+ * Copy the first plen bits of addr into prefix, zeroing the rest
+ */
+static void subnet_set_prefix(ip_addr_t *prefix, ip_addr_t *addr,
+		unsigned int plen)
+{
+	unsigned int i;
+
+	memset(prefix, 0, sizeof(ip_addr_t));
+	prefix->af = addr->af;
+	prefix->len = addr->len;
+	for (i = 0; i < plen / 8; i++)
+		prefix->u.addr[i] = addr->u.addr[i];
+	if (plen % 8)
+		prefix->u.addr[i] = addr->u.addr[i] & (0xff << (8 - plen % 8));
+}
+
+
+static struct subnet_node* subnet_new_node(struct subnet_table* table,
+		ip_addr_t *addr, unsigned int plen)
+{
+	struct subnet_node* n;
+
+	n = (struct subnet_node*)shm_malloc(sizeof(struct subnet_node));
+	if (!n) {
+		LM_ERR("no shm memory for subnet trie node\n");
+		return 0;
+	}
+	memset(n, 0, sizeof(struct subnet_node));
+	subnet_set_prefix(&n->prefix, addr, plen);
+	n->plen = plen;
+	table->nodes++;
+	return n;
+}
+
+
+/*
+ * Find or create the trie node for prefix addr/plen
+ */
+static struct subnet_node* subnet_trie_get(struct subnet_table* table,
+		struct subnet_node** root, ip_addr_t *addr, unsigned int plen)
+{
+	struct subnet_node **np;
+	struct subnet_node *n, *in, *leaf;
+	unsigned int common;
+
+	np = root;
+	while ((n = *np) != 0) {
+		common = subnet_common_bits(&n->prefix, addr,
+				(n->plen < plen) ? n->plen : plen);
+		if (common < n->plen) {
+			/* split n: the new prefix diverges from it or is shorter */
+			if (common == plen) {
+				leaf = subnet_new_node(table, addr, plen);
+				if (!leaf) return 0;
+				leaf->child[SUBNET_BIT(&n->prefix, plen)] = n;
+				*np = leaf;
+				return leaf;
+			}
+			in = subnet_new_node(table, addr, common);
+			if (!in) return 0;
+			leaf = subnet_new_node(table, addr, plen);
+			if (!leaf) {
+				shm_free(in);
+				table->nodes--;
+				return 0;
+			}
+			in->child[SUBNET_BIT(&n->prefix, common)] = n;
+			in->child[SUBNET_BIT(addr, common)] = leaf;
+			*np = in;
+			return leaf;
+		}
+		if (n->plen == plen)
+			return n;
+		np = &n->child[SUBNET_BIT(addr, n->plen)];
+	}
+	*np = subnet_new_node(table, addr, plen);
+	return *np;
+}
+
+
+static void subnet_trie_free(struct subnet_node* n)
+{
+	struct subnet* sn;
+	struct subnet* next;
+
+	if (!n)
+		return;
+	subnet_trie_free(n->child[0]);
+	subnet_trie_free(n->child[1]);
+	for (sn = n->subnets; sn; sn = next) {
+		next = sn->next;
+		if (sn->tag.s)
+			shm_free(sn->tag.s);
+		shm_free(sn);
+	}
+	shm_free(n);
+}
+
+
 /*
  * Create and initialize a subnet table
  */
-struct subnet* new_subnet_table(void)
+struct subnet_table* new_subnet_table(void)
 {
-	struct subnet* ptr;
+	struct subnet_table* ptr;
 
-	/* subnet record [PERM_MAX_SUBNETS] contains in its grp field 
-	   the number of subnet records in the subnet table */
-	ptr = (struct subnet *)shm_malloc
-		(sizeof(struct subnet) * (PERM_MAX_SUBNETS + 1));
+	ptr = (struct subnet_table *)shm_malloc(sizeof(struct subnet_table));
 	if (!ptr) {
 		LM_ERR("no shm memory for subnet table\n");
 		return 0;
 	}
-	memset(ptr, 0, sizeof(struct subnet) * (PERM_MAX_SUBNETS + 1));
+	memset(ptr, 0, sizeof(struct subnet_table));
 	return ptr;
 }
 
 
 /* 
- * Add <grp, subnet, mask, port, tag> into subnet table so that table is
- * kept in increasing ordered according to grp.
+ * Add <grp, subnet, mask, port, tag> into subnet table
  */
-int subnet_table_insert(struct subnet* table, unsigned int grp,
+int subnet_table_insert(struct subnet_table* table, unsigned int grp,
 		ip_addr_t *subnet, unsigned int mask,
 		unsigned int port, char *tagv)
 {
-	int i;
-	unsigned int count;
-	str tags;
-
-	count = table[PERM_MAX_SUBNETS].grp;
+	struct subnet_node* n;
+	struct subnet* sn;
+	struct subnet** sp;
 
-	if (count == PERM_MAX_SUBNETS) {
-		LM_CRIT("subnet table is full\n");
-		return 0;
+	if ((subnet->af == AF_INET && mask > 32) || mask > 128) {
+		LM_ERR("invalid mask %u\n", mask);
+		return -1;
 	}
 
-	if(tagv==NULL)
-	{
-		tags.s = NULL;
-		tags.len = 0;
-	} else {
-		tags.len = strlen(tagv);
-		tags.s = (char*)shm_malloc(tags.len+1);
-		if(tags.s==NULL)
-		{
+	sn = (struct subnet*)shm_malloc(sizeof(struct subnet));
+	if (!sn) {
+		LM_ERR("No more shared memory\n");
+		return -1;
+	}
+	memset(sn, 0, sizeof(struct subnet));
+	if (tagv) {
+		sn->tag.len = strlen(tagv);
+		sn->tag.s = (char*)shm_malloc(sn->tag.len+1);
+		if (sn->tag.s == NULL) {
 			LM_ERR("No more shared memory\n");
-			return 0;
+			shm_free(sn);
+			return -1;
 		}
-		strcpy(tags.s, tagv);
+		strcpy(sn->tag.s, tagv);
 	}
+	sn->grp = grp;
+	memcpy(&sn->subnet, subnet, sizeof(ip_addr_t));
+	sn->port = port;
+	sn->mask = mask;
+
+	n = subnet_trie_get(table, (subnet->af == AF_INET6) ?
+			&table->root6 : &table->root4, subnet, mask);
+	if (!n) {
+		if (sn->tag.s) shm_free(sn->tag.s);
+		shm_free(sn);
+		return -1;
+	}
+	/* keep the subnets of a node ordered by grp */
+	for (sp = &n->subnets; *sp && (*sp)->grp <= grp; sp = &(*sp)->next);
+	sn->next = *sp;
+	*sp = sn;
+
+	if (table->last)
+		table->last->lnext = sn;
+	else
+		table->first = sn;
+	table->last = sn;
+	table->count++;
+
+	return 1;
+}
 
-	i = count - 1;
 
-	while ((i >= 0) && (table[i].grp > grp)) {
-		table[i + 1] = table[i];
-		i--;
+/*
+ * Walk the trie along addr. Returns the longest prefix subnet that matches
+ * port and group grp or, if any_grp is set, the subnet with the lowest group
+ */
+static struct subnet* subnet_trie_lookup(struct subnet_table* table,
+		unsigned int grp, int any_grp, ip_addr_t *addr, unsigned int port)
+{
+	struct subnet_node* n;
+	struct subnet* sn;
+	struct subnet* found;
+	unsigned int bits;
+
+	if (addr->af == AF_INET) {
+		n = table->root4;
+		bits = 32;
+	} else if (addr->af == AF_INET6) {
+		n = table->root6;
+		bits = 128;
+	} else {
+		return 0;
 	}
 
-	table[i + 1].grp = grp;
-	memcpy(&table[i + 1].subnet, subnet, sizeof(ip_addr_t));
-	table[i + 1].port = port;
-	table[i + 1].mask = mask;
-	table[i + 1].tag = tags;
+	found = 0;
+	while (n) {
+		if (n->plen && subnet_common_bits(&n->prefix, addr, n->plen)
+				< n->plen)
+			break;
+		for (sn = n->subnets; sn; sn = sn->next) {
+			if (!any_grp && sn->grp != grp)
+				continue;
+			if (sn->port != port && sn->port != 0)
+				continue;
+			/* for any_grp keep the lowest group, the longest prefix
+			 * breaking ties (subnets are ordered by grp in a node) */
+			if (!found || !any_grp || sn->grp <= found->grp)
+				found = sn;
+			break;
+		}
+		if (n->plen >= bits)
+			break;
+		n = n->child[SUBNET_BIT(addr, n->plen)];
+	}
+	return found;
+}
 
-	table[PERM_MAX_SUBNETS].grp = count + 1;
 
-	return 1;
+/*
+ * Add the tag of the matched subnet to tag_avp
+ */
+static int subnet_set_tag(struct subnet* sn)
+{
+	avp_value_t val;
+
+	if (tag_avp.n && sn->tag.s) {
+		val.s = sn->tag;
+		if (add_avp(tag_avp_type|AVP_VAL_STR, tag_avp, val) != 0) {
+			LM_ERR("setting of tag_avp failed\n");
+			return -1;
+		}
+	}
+	return 0;
 }
 
 
@@ -677,89 +914,57 @@ int subnet_table_insert(struct subnet* table, unsigned int grp,
  * Check if an entry exists in subnet table that matches given group, ip_addr,
  * and port.  Port 0 in subnet table matches any port.
  */
-int match_subnet_table(struct subnet* table, unsigned int grp,
+int match_subnet_table(struct subnet_table* table, unsigned int grp,
 		ip_addr_t *addr, unsigned int port)
 {
-	unsigned int count, i;
-	avp_value_t val;
-
-	count = table[PERM_MAX_SUBNETS].grp;
-
-	i = 0;
-	while ((i < count) && (table[i].grp < grp))
-		i++;
+	struct subnet* sn;
+	unsigned long long start;
 
-	if (i == count) return -1;
+	start = subnet_now_ns();
+	sn = subnet_trie_lookup(table, grp, 0, addr, port);
+	subnet_stats_update(start);
 
-	while ((i < count) && (table[i].grp == grp)) {
-		if (((table[i].port == port) || (table[i].port == 0))
-			&& (ip_addr_match_net(addr, &table[i].subnet, table[i].mask)==0))
-		{
-			if (tag_avp.n && table[i].tag.s) {
-				val.s = table[i].tag;
-				if (add_avp(tag_avp_type|AVP_VAL_STR, tag_avp, val) != 0) {
-					LM_ERR("setting of tag_avp failed\n");
-					return -1;
-				}
-			}
-			return 1;
-		}
-		i++;
-	}
-
-	return -1;
+	if (!sn) return -1;
+	if (subnet_set_tag(sn) < 0) return -1;
+	return 1;
 }
 
 
 /* 
  * Check if an entry exists in subnet table that matches given ip_addr,
- * and port.  Port 0 in subnet table matches any port.  Return group of
- * first match or -1 if no match is found.
+ * and port.  Port 0 in subnet table matches any port.  Return the lowest
+ * matching group or -1 if no match is found.
  */
-int find_group_in_subnet_table(struct subnet* table,
+int find_group_in_subnet_table(struct subnet_table* table,
 		ip_addr_t *addr, unsigned int port)
 {
-	unsigned int count, i;
-	avp_value_t val;
-
-	count = table[PERM_MAX_SUBNETS].grp;
+	struct subnet* sn;
+	unsigned long long start;
 
-	i = 0;
-	while (i < count) {
-		if ( ((table[i].port == port) || (table[i].port == 0))
-			&& (ip_addr_match_net(addr, &table[i].subnet, table[i].mask)==0))
-		{
-			if (tag_avp.n && table[i].tag.s) {
-				val.s = table[i].tag;
-				if (add_avp(tag_avp_type|AVP_VAL_STR, tag_avp, val) != 0) {
-					LM_ERR("setting of tag_avp failed\n");
-					return -1;
-				}
-			}
-			return table[i].grp;
-		}
-		i++;
-	}
+	start = subnet_now_ns();
+	sn = subnet_trie_lookup(table, 0, 1, addr, port);
+	subnet_stats_update(start);
 
-	return -1;
+	if (!sn) return -1;
+	if (subnet_set_tag(sn) < 0) return -1;
+	return sn->grp;
 }
 
 
 /* 
  * Print subnets stored in subnet table 
  */
-int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl)
+int subnet_table_mi_print(struct subnet_table* table, struct mi_node* rpl)
 {
-	unsigned int count, i;
-
-	count = table[PERM_MAX_SUBNETS].grp;
+	struct subnet* sn;
+	unsigned int i;
 
-	for (i = 0; i < count; i++) {
+	for (sn = table->first, i = 0; sn; sn = sn->lnext, i++) {
 		if (addf_mi_node_child(rpl, 0, 0, 0,
 					"%4d <%u, %s, %u, %u> [%s]",
-					i, table[i].grp, ip_addr2a(&table[i].subnet),
-					table[i].mask, table[i].port,
-					(table[i].tag.s==NULL)?"":table[i].tag.s) == 0) {
+					i, sn->grp, ip_addr2a(&sn->subnet),
+					sn->mask, sn->port,
+					(sn->tag.s==NULL)?"":sn->tag.s) == 0) {
 			return -1;
 		}
 	}
@@ -769,39 +974,37 @@ int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl)
 /*! \brief
  * RPC interface :: Print subnet entries stored in hash table 
  */
-int subnet_table_rpc_print(struct subnet* table, rpc_t* rpc, void* c)
+int subnet_table_rpc_print(struct subnet_table* table, rpc_t* rpc, void* c)
 {
+	struct subnet* sn;
 	int i;
-	int count;
 	void* th;
 	void* ih;
 
-	count = table[PERM_MAX_SUBNETS].grp;
-
 	if (rpc->add(c, "{", &th) < 0)
 	{
 		rpc->fault(c, 500, "Internal error creating rpc");
 		return -1;
 	}
 
-	for (i = 0; i < count; i++) {
+	for (sn = table->first, i = 0; sn; sn = sn->lnext, i++) {
 		if(rpc->struct_add(th, "dd{", 
 				"id", i,
-				"group", table[i].grp,
+				"group", sn->grp,
 				"item", &ih) < 0)
                 {
                         rpc->fault(c, 500, "Internal error creating rpc ih");
                         return -1;
                 }
 
-		if(rpc->struct_add(ih, "s", "ip", ip_addr2a(&table[i].subnet)) < 0)
+		if(rpc->struct_add(ih, "s", "ip", ip_addr2a(&sn->subnet)) < 0)
 		{
 			rpc->fault(c, 500, "Internal error creating rpc data (subnet)");
 			return -1;
 		}
-		if(rpc->struct_add(ih, "dds", "mask", table[i].mask,
-					"port", table[i].port,
-					"tag",  (table[i].tag.s==NULL)?"":table[i].tag.s) < 0)
+		if(rpc->struct_add(ih, "dds", "mask", sn->mask,
+					"port", sn->port,
+					"tag",  (sn->tag.s==NULL)?"":sn->tag.s) < 0)
 		{
 			rpc->fault(c, 500, "Internal error creating rpc data");
 			return -1;
@@ -814,40 +1017,22 @@ int subnet_table_rpc_print(struct subnet* table, rpc_t* rpc, void* c)
 /* 
  * Empty contents of subnet table
  */
-void empty_subnet_table(struct subnet *table)
+void empty_subnet_table(struct subnet_table *table)
 {
-	int i;
-	table[PERM_MAX_SUBNETS].grp = 0;
-	for(i=0; i<PERM_MAX_SUBNETS; i++)
-	{
-		if(table[i].tag.s!=NULL)
-		{
-			shm_free(table[i].tag.s);
-			table[i].tag.s = NULL;
-			table[i].tag.len =0;
-		}
-	}
+	subnet_trie_free(table->root4);
+	subnet_trie_free(table->root6);
+	memset(table, 0, sizeof(struct subnet_table));
 }
 
 
 /*
  * Release memory allocated for a subnet table
  */
-void free_subnet_table(struct subnet* table)
+void free_subnet_table(struct subnet_table* table)
 {
-	int i;
 	if (!table)
 		return;
-	for(i=0; i<PERM_MAX_SUBNETS; i++)
-	{
-		if(table[i].tag.s!=NULL)
-		{
-			shm_free(table[i].tag.s);
-			table[i].tag.s = NULL;
-			table[i].tag.len =0;
-		}
-	}
-
+	empty_subnet_table(table);
 	shm_free(table);
 }
 
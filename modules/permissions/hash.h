@@ -174,60 +174,84 @@ int addr_hash_table_rpc_print(struct addr_list** table, rpc_t* rpc, void* c);
 void empty_addr_hash_table(struct addr_list** hash_table);
 
 
-#define PERM_MAX_SUBNETS 128 
-
-
 /*
  * Structure used to store a subnet
  */
 struct subnet {
-    unsigned int grp;        /* address group, subnet count in last record */
-    ip_addr_t  subnet;       /* IP subnet in host byte order with host bits shifted out */
+    unsigned int grp;        /* address group */
+    ip_addr_t  subnet;       /* IP subnet */
     unsigned int port;       /* port or 0 */
     unsigned int mask;       /* how many bits belong to network part */
 	str tag;
+	struct subnet* next;     /* next subnet with the same prefix */
+	struct subnet* lnext;    /* next subnet in the table, in insertion order */
+};
+
+
+/*
+ * Node of the path compressed binary trie indexing the subnets by prefix
+ */
+struct subnet_node {
+	ip_addr_t prefix;        /* first plen bits are significant */
+	unsigned int plen;       /* prefix length */
+	struct subnet_node* child[2];
+	struct subnet* subnets;  /* subnets with exactly this prefix */
+};
+
+
+/*
+ * Subnet table: one trie per address family, lookups are O(address bits)
+ * independent of the number of subnets
+ */
+struct subnet_table {
+	unsigned int count;      /* number of subnets */
+	unsigned int nodes;      /* number of trie nodes */
+	struct subnet* first;    /* all subnets, in insertion order */
+	struct subnet* last;
+	struct subnet_node* root4;
+	struct subnet_node* root6;
 };
 
 
 /*
  * Create a subnet table
  */
-struct subnet* new_subnet_table(void);
+struct subnet_table* new_subnet_table(void);
 
 
 /* 
  * Check if an entry exists in subnet table that matches given group, ip_addr,
- * and port.  Port 0 in subnet table matches any port.
+ * and port.  Port 0 in subnet table matches any port. The longest matching
+ * prefix wins (its tag is added to tag_avp).
  */
-int match_subnet_table(struct subnet* table, unsigned int group,
+int match_subnet_table(struct subnet_table* table, unsigned int group,
 		       ip_addr_t *addr, unsigned int port);
 
 
 /* 
  * Checks if an entry exists in subnet table that matches given ip_addr,
- * and port.  Port 0 in subnet table matches any port.  Returns group of
- * the first match or -1 if no match is found.
+ * and port.  Port 0 in subnet table matches any port.  Returns the lowest
+ * matching group or -1 if no match is found.
  */
-int find_group_in_subnet_table(struct subnet* table,
+int find_group_in_subnet_table(struct subnet_table* table,
 			       ip_addr_t *addr, unsigned int port);
 
 /* 
  * Empty contents of subnet table
  */
-void empty_subnet_table(struct subnet *table);
+void empty_subnet_table(struct subnet_table *table);
 
 
 /*
  * Release memory allocated for a subnet table
  */
-void free_subnet_table(struct subnet* table);
+void free_subnet_table(struct subnet_table* table);
 
 
 /* 
- * Add <grp, subnet, mask, port> into subnet table so that table is
- * kept ordered according to subnet, port, grp.
+ * Add <grp, subnet, mask, port> into subnet table
  */
-int subnet_table_insert(struct subnet* table, unsigned int grp,
+int subnet_table_insert(struct subnet_table* table, unsigned int grp,
 			ip_addr_t *subnet, unsigned int mask,
 			unsigned int port, char *tagv);
 
@@ -235,9 +259,14 @@ int subnet_table_insert(struct subnet* table, unsigned int grp,
 /* 
  * Print subnets stored in subnet table
  */
-void subnet_table_print(struct subnet* table, FILE* reply_file);
-int subnet_table_mi_print(struct subnet* table, struct mi_node* rpl);
-int subnet_table_rpc_print(struct subnet* table, rpc_t* rpc, void* c);
+void subnet_table_print(struct subnet_table* table, FILE* reply_file);
+int subnet_table_mi_print(struct subnet_table* table, struct mi_node* rpl);
+int subnet_table_rpc_print(struct subnet_table* table, rpc_t* rpc, void* c);
+
+/*
+ * Register the subnet lookup counters (must be called before forking)
+ */
+int subnet_stats_init(void);
 
 
 /*
@@ -290,7 +319,7 @@ int find_group_in_domain_name_table(struct domain_name_list** table,
 /*! \brief
  * RPC: Print addresses stored in hash table 
  */
-void domain_name_table_print(struct subnet* table, FILE* reply_file);
+void domain_name_table_print(struct subnet_table* table, FILE* reply_file);
 int domain_name_table_rpc_print(struct domain_name_list** table, rpc_t* rpc, void* c);
 int domain_name_table_mi_print(struct domain_name_list** table, struct mi_node* rpl);
 
@@ -599,6 +599,12 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if(subnet_stats_init()!=0)
+	{
+		LM_ERR("failed to register the counters\n");
+		return -1;
+	}
+
 	if (db_url.s)
 		db_url.len = strlen(db_url.s);
 	trusted_table.len = strlen(trusted_table.s);
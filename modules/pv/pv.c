@@ -442,10 +442,13 @@ static pv_export_t mod_pvs[] = {
 
 static int add_avp_aliases(modparam_t type, void* val);
 
+static int pv_vcache_param = 0;
+
 static param_export_t params[]={ 
 	{"shvset",              STR_PARAM|USE_FUNC_PARAM, (void*)param_set_shvar },
 	{"varset",              STR_PARAM|USE_FUNC_PARAM, (void*)param_set_var },
 	{"avp_aliases",         STR_PARAM|USE_FUNC_PARAM, (void*)add_avp_aliases },
+	{"vcache",              INT_PARAM, &pv_vcache_param },
 	{0,0,0}
 };
 
@@ -457,6 +460,7 @@ static mi_export_t mi_cmds[] = {
 
 static int mod_init(void);
 static void mod_destroy(void);
+static int pv_init_vcache(void);
 static int pv_isset(struct sip_msg* msg, char* pvid, char *foo);
 static int pv_unset(struct sip_msg* msg, char* pvid, char *foo);
 static int is_int(struct sip_msg* msg, char* pvar, char* s2);
@@ -515,7 +519,33 @@ static int mod_init(void)
                 LM_ERR("failed to register RPC commands\n");
                 return -1;
         }
+	if(pv_vcache_param!=0 && pv_init_vcache()!=0)
+	{
+		LM_ERR("failed to init the values cache\n");
+		return -1;
+	}
+
+	return 0;
+}
 
+/**
+ * enable the per message cache for the values taken from the headers
+ * and the R-URI
+ */
+static int pv_init_vcache(void)
+{
+	if(pv_vcache_init()!=0)
+		return -1;
+	if(pv_vcache_register_getf(pv_get_ruri)!=0
+			|| pv_vcache_register_getf(pv_get_ruri_attr)!=0
+			|| pv_vcache_register_getf(pv_get_ouri)!=0
+			|| pv_vcache_register_getf(pv_get_ouri_attr)!=0
+			|| pv_vcache_register_getf(pv_get_from_attr)!=0
+			|| pv_vcache_register_getf(pv_get_to_attr)!=0
+			|| pv_vcache_register_getf(pv_get_callid)!=0
+			|| pv_vcache_register_getf(pv_get_cseq)!=0
+			|| pv_vcache_register_getf(pv_get_hdr)!=0)
+		return -1;
 	return 0;
 }
 
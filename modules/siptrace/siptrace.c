@@ -52,6 +52,9 @@
 #include "../../modules/sl/sl.h"
 #include "../../str.h"
 #include "../../onsend.h"
+#include "../../pt.h"
+#include "../../udp_server.h"
+#include "../../cfg/cfg_struct.h"
 
 #include "../../modules/sipcapture/hep.h"
 
@@ -59,6 +62,8 @@
 #include "../../lib/kcore/statistics.h"
 #endif
 
+#include "siptrace_ring.h"
+
 MODULE_VERSION
 
 struct _siptrace_data {
@@ -94,7 +99,7 @@ static void destroy(void);
 static int sip_trace(struct sip_msg*, char*, char*);
 
 static int sip_trace_store_db(struct _siptrace_data* sto);
-static int trace_send_duplicate(char *buf, int len);
+static int trace_send_duplicate(char *buf, int len, struct dest_info *dst);
 
 static void trace_onreq_in(struct cell* t, int type, struct tmcb_params *ps);
 static void trace_onreq_out(struct cell* t, int type, struct tmcb_params *ps);
@@ -103,7 +108,10 @@ static void trace_onreply_out(struct cell* t, int type, struct tmcb_params *ps);
 static void trace_sl_onreply_out(sl_cbp_t *slcb);
 static void trace_sl_ack_in(sl_cbp_t *slcb);
 
-static int trace_send_hep_duplicate(str *body, str *from, str *to);
+static int trace_send_hep_duplicate(str *body, str *from, str *to,
+		struct timeval *tv, struct dest_info *dst);
+static int trace_async_queue(struct _siptrace_data *sto);
+static void trace_async_sender(void);
 static int pipport2su (char *pipport, union sockaddr_union *tmp_su, unsigned int *proto);
 
 
@@ -127,6 +135,9 @@ static str time_us_column     = str_init("time_us");     /* 10 */
 
 #define XHEADERS_BUFSIZE 512
 
+/* room for the HEP headers in front of the traced message */
+#define TRACE_HEP_HDR_MAX 256
+
 int trace_flag = 0;
 int trace_on   = 0;
 int trace_sl_acks = 1;
@@ -149,6 +160,29 @@ int *trace_to_database_flag = NULL;
 int *xheaders_write_flag = NULL;
 int *xheaders_read_flag = NULL;
 
+int trace_async_ring_size = 0;
+int trace_async_batch_size = 32;
+int trace_async_flush_interval = 10;
+
+/*! messages queued for the sender process */
+typedef struct trace_cap_hdr {
+	unsigned int tv_sec;
+	unsigned int tv_usec;
+	unsigned short from_len;
+	unsigned short to_len;
+} trace_cap_hdr_t;
+
+/*! sender process counters */
+typedef struct trace_async_cnt {
+	unsigned long sent;
+	unsigned long failed;
+} trace_async_cnt_t;
+
+static st_ring_t *trace_ring = NULL;
+static trace_async_cnt_t *trace_async_cnt = NULL;
+
+static char trace_hep_buf[BUF_SIZE + TRACE_HEP_HDR_MAX + 1];
+
 static unsigned short traced_user_avp_type = 0;
 static int_str traced_user_avp;
 static str traced_user_avp_str = {NULL, 0};
@@ -204,6 +238,9 @@ static param_export_t params[] = {
 	{"hep_version",        INT_PARAM, &hep_version          },
 	{"hep_capture_id",     INT_PARAM, &hep_capture_id       },	        
 	{"trace_delayed",      INT_PARAM, &trace_delayed        },
+	{"async_ring_size",    INT_PARAM, &trace_async_ring_size},
+	{"async_batch_size",   INT_PARAM, &trace_async_batch_size},
+	{"async_flush_interval", INT_PARAM, &trace_async_flush_interval},
 	{0, 0, 0}
 };
 
@@ -220,11 +257,47 @@ static mi_export_t mi_cmds[] = {
 stat_var* siptrace_req;
 stat_var* siptrace_rpl;
 
+static unsigned long trace_async_get_queued(void);
+static unsigned long trace_async_get_dropped(void);
+static unsigned long trace_async_get_used(void);
+static unsigned long trace_async_get_sent(void);
+static unsigned long trace_async_get_failed(void);
+
 stat_export_t siptrace_stats[] = {
 	{"traced_requests" ,  0,  &siptrace_req  },
 	{"traced_replies"  ,  0,  &siptrace_rpl  },
+	{"async_queued",      STAT_IS_FUNC, (stat_var**)trace_async_get_queued },
+	{"async_dropped",     STAT_IS_FUNC, (stat_var**)trace_async_get_dropped},
+	{"async_ring_bytes",  STAT_IS_FUNC, (stat_var**)trace_async_get_used   },
+	{"async_sent",        STAT_IS_FUNC, (stat_var**)trace_async_get_sent   },
+	{"async_failed",      STAT_IS_FUNC, (stat_var**)trace_async_get_failed },
 	{0,0,0}
 };
+
+static unsigned long trace_async_get_queued(void)
+{
+	return trace_ring ? (unsigned long)atomic_get(&trace_ring->queued) : 0;
+}
+
+static unsigned long trace_async_get_dropped(void)
+{
+	return trace_ring ? (unsigned long)atomic_get(&trace_ring->dropped) : 0;
+}
+
+static unsigned long trace_async_get_used(void)
+{
+	return trace_ring ? st_ring_used(trace_ring) : 0;
+}
+
+static unsigned long trace_async_get_sent(void)
+{
+	return trace_async_cnt ? trace_async_cnt->sent : 0;
+}
+
+static unsigned long trace_async_get_failed(void)
+{
+	return trace_async_cnt ? trace_async_cnt->failed : 0;
+}
 #endif
 
 /*! \brief module exports */
@@ -325,7 +398,7 @@ static int mod_init(void)
 		}
 	}
 
-        if(hep_version != 1 && hep_version != 2) {
+        if(hep_version != 1 && hep_version != 2 && hep_version != 3) {
   
                   LM_ERR("unsupported version of HEP");
                   return -1;
@@ -397,6 +470,26 @@ static int mod_init(void)
 			LM_ERR("bad dup uri\n");
 			return -1;
 		}
+
+		if(trace_async_ring_size>0)
+		{
+			if(trace_async_batch_size<=0)
+				trace_async_batch_size = 1;
+			if(trace_async_flush_interval<=0)
+				trace_async_flush_interval = 1;
+			trace_ring = st_ring_new(trace_async_ring_size);
+			trace_async_cnt = (trace_async_cnt_t*)shm_malloc(
+					sizeof(trace_async_cnt_t));
+			if(trace_ring==NULL || trace_async_cnt==NULL)
+			{
+				LM_ERR("no more shm memory left\n");
+				return -1;
+			}
+			memset(trace_async_cnt, 0, sizeof(trace_async_cnt_t));
+			/* the sender process */
+			register_procs(1);
+			cfg_register_child(1);
+		}
 	}
 
 	if(traced_user_avp_str.s && traced_user_avp_str.len > 0)
@@ -448,6 +541,23 @@ static int mod_init(void)
 
 static int child_init(int rank)
 {
+	int pid;
+
+	if (rank==PROC_MAIN && trace_ring!=NULL) {
+		pid = fork_process(PROC_NOCHLDINIT, "SIPTRACE SENDER", 1);
+		if (pid<0) {
+			LM_ERR("failed to fork the siptrace sender\n");
+			return -1;
+		}
+		if (pid==0) {
+			/* child */
+			if (cfg_child_init())
+				return -1;
+			trace_async_sender();
+			exit(-1);
+		}
+	}
+
 	if (rank==PROC_INIT || rank==PROC_MAIN || rank==PROC_TCP_MAIN)
 		return 0; /* do nothing for the main process */
 
@@ -474,6 +584,14 @@ static void destroy(void)
 	if (trace_on_flag)
 		shm_free(trace_on_flag);
 
+	if (trace_ring) {
+		st_ring_destroy(trace_ring);
+		trace_ring = NULL;
+	}
+	if (trace_async_cnt) {
+		shm_free(trace_async_cnt);
+		trace_async_cnt = NULL;
+	}
 }
 
 static inline int siptrace_copy_proto(int proto, char *buf)
@@ -726,8 +844,10 @@ static int sip_trace_store(struct _siptrace_data *sto)
 	if (sip_trace_xheaders_write(sto) != 0)
 		return -1;
 
-	if(hep_mode_on) trace_send_hep_duplicate(&sto->body, &sto->fromip, &sto->toip);
-	else trace_send_duplicate(sto->body.s, sto->body.len);
+	if(trace_ring) trace_async_queue(sto);
+	else if(hep_mode_on) trace_send_hep_duplicate(&sto->body, &sto->fromip,
+			&sto->toip, &sto->tv, NULL);
+	else trace_send_duplicate(sto->body.s, sto->body.len, NULL);
 
 	if (sip_trace_xheaders_free(sto) != 0)
 		return -1;
@@ -1456,68 +1576,91 @@ static struct mi_root* sip_trace_mi(struct mi_root* cmd_tree, void* param )
 	}
 }
 
-static int trace_send_duplicate(char *buf, int len)
+/*! \brief resolve the duplicate_uri destination */
+static int trace_dup_dst(struct dest_info *dst)
 {
-	struct dest_info dst;
 	struct proxy_l * p;
 
-	if(buf==NULL || len <= 0)
-		return -1;
-
-	if(dup_uri_str.s==0 || dup_uri==NULL)
-		return 0;
-
-	init_dest_info(&dst);
+	init_dest_info(dst);
 	/* create a temporary proxy*/
-	dst.proto = PROTO_UDP;
+	dst->proto = PROTO_UDP;
 	p=mk_proxy(&dup_uri->host, (dup_uri->port_no)?dup_uri->port_no:SIP_PORT,
-			dst.proto);
+			dst->proto);
 	if (p==0)
 	{
 		LM_ERR("bad host name in uri\n");
 		return -1;
 	}
 
-	hostent2su(&dst.to, &p->host, p->addr_idx, (p->port)?p->port:SIP_PORT);
+	hostent2su(&dst->to, &p->host, p->addr_idx, (p->port)?p->port:SIP_PORT);
+	free_proxy(p); /* frees only p content, not p itself */
+	pkg_free(p);
 
-	dst.send_sock=get_send_socket(0, &dst.to, dst.proto);
-	if (dst.send_sock==0)
+	dst->send_sock=get_send_socket(0, &dst->to, dst->proto);
+	if (dst->send_sock==0)
 	{
 		LM_ERR("can't forward to af %d, proto %d no corresponding"
-				" listening socket\n", dst.to.s.sa_family, dst.proto);
-		goto error;
+				" listening socket\n", dst->to.s.sa_family, dst->proto);
+		return -1;
+	}
+	return 0;
+}
+
+static int trace_send_duplicate(char *buf, int len, struct dest_info *dst)
+{
+	struct dest_info ldst;
+
+	if(buf==NULL || len <= 0)
+		return -1;
+
+	if(dup_uri_str.s==0 || dup_uri==NULL)
+		return 0;
+
+	if(dst==NULL)
+	{
+		if(trace_dup_dst(&ldst)<0)
+			return -1;
+		dst = &ldst;
 	}
 
-	if (msg_send(&dst, buf, len)<0)
+	if (msg_send(dst, buf, len)<0)
 	{
 		LM_ERR("cannot send duplicate message\n");
-		goto error;
+		return -1;
 	}
 
-	free_proxy(p); /* frees only p content, not p itself */
-	pkg_free(p);
 	return 0;
-error:
-	free_proxy(p); /* frees only p content, not p itself */
-	pkg_free(p);
-	return -1;
 }
 
-static int trace_send_hep_duplicate(str *body, str *from, str *to)
+/*! \brief append a HEPv3 chunk */
+static inline char* hep3_add_chunk(char *p, int type, void *data, int len)
 {
-	struct dest_info dst;
-	struct proxy_l * p=NULL /* make gcc happy */;
-	void* buffer = NULL;
+	hep_chunk_t chunk;
+
+	chunk.vendor_id = 0;
+	chunk.type_id = htons(type);
+	chunk.length = htons(sizeof(hep_chunk_t) + len);
+	memcpy(p, &chunk, sizeof(hep_chunk_t));
+	memcpy(p + sizeof(hep_chunk_t), data, len);
+	return p + sizeof(hep_chunk_t) + len;
+}
+
+static int trace_send_hep_duplicate(str *body, str *from, str *to,
+		struct timeval *tv, struct dest_info *dst)
+{
+	struct dest_info ldst;
 	union sockaddr_union from_su;
 	union sockaddr_union to_su;
 	unsigned int len, buflen, proto;
 	struct hep_hdr hdr;
 	struct hep_iphdr hep_ipheader;
 	struct hep_timehdr hep_time;
-	struct timeval tvb;
-	struct timezone tz;
-	                 
 	struct hep_ip6hdr hep_ip6header;
+	hep_ctrl_t hep_ctrl;
+	u_int8_t u8;
+	u_int16_t u16;
+	u_int32_t u32;
+	char *p;
 
 	if(body->s==NULL || body->len <= 0)
 		return -1;
@@ -1525,18 +1668,12 @@ static int trace_send_hep_duplicate(str *body, str *from, str *to)
 	if(dup_uri_str.s==0 || dup_uri==NULL)
 		return 0;
 
-
-        gettimeofday( &tvb, &tz );
-        
-
 	/* message length */
-	len = body->len 
-		+ sizeof(struct hep_ip6hdr)
-		+ sizeof(struct hep_hdr) + sizeof(struct hep_timehdr);;
-
+	len = body->len + TRACE_HEP_HDR_MAX;
 
 	/* The packet is too big for us */
-	if (unlikely(len>BUF_SIZE)){
+	if (unlikely(len>BUF_SIZE + TRACE_HEP_HDR_MAX
+				|| (hep_version==3 && len>65535))){
 		goto error;
 	}
 
@@ -1550,25 +1687,11 @@ static int trace_send_hep_duplicate(str *body, str *from, str *to)
 		goto error;
 	}
 
-	init_dest_info(&dst);
-	/* create a temporary proxy*/
-	dst.proto = PROTO_UDP;
-	p=mk_proxy(&dup_uri->host, (dup_uri->port_no)?dup_uri->port_no:SIP_PORT,
-			dst.proto);
-	if (p==0)
-	{
-		LM_ERR("bad host name in uri\n");
-		goto error;
-	}
-
-	hostent2su(&dst.to, &p->host, p->addr_idx, (p->port)?p->port:SIP_PORT);
-
-	dst.send_sock=get_send_socket(0, &dst.to, dst.proto);
-	if (dst.send_sock==0)
+	if(dst==NULL)
 	{
-		LM_ERR("can't forward to af %d, proto %d no corresponding"
-				" listening socket\n", dst.to.s.sa_family, dst.proto);
-		goto error;
+		if(trace_dup_dst(&ldst)<0)
+			goto error;
+		dst = &ldst;
 	}
 
 	/* Version && proto && length */
@@ -1607,66 +1730,178 @@ static int trace_send_hep_duplicate(str *body, str *from, str *to)
 		goto error;;
 	}
 
-	hdr.hp_l +=len;
-	if (hep_version == 2){
-		len += sizeof(struct hep_timehdr);
-	}
-	len += sizeof(struct hep_hdr) + body->len;
-	buffer = (void *)pkg_malloc(len+1);
-	if (buffer==0){
-		LOG(L_ERR, "ERROR: trace_send_hep_duplicate: out of memory\n");
-		goto error;
+	if(hep_version == 3) {
+		/* HEPv3: control header followed by the generic chunks */
+		p = trace_hep_buf + sizeof(hep_ctrl_t);
+		u8 = hdr.hp_f;
+		p = hep3_add_chunk(p, 1, &u8, 1);
+		u8 = hdr.hp_p;
+		p = hep3_add_chunk(p, 2, &u8, 1);
+		if(from_su.s.sa_family==AF_INET) {
+			p = hep3_add_chunk(p, 3, &hep_ipheader.hp_src, 4);
+			p = hep3_add_chunk(p, 4, &hep_ipheader.hp_dst, 4);
+		} else {
+			p = hep3_add_chunk(p, 5, &hep_ip6header.hp6_src, 16);
+			p = hep3_add_chunk(p, 6, &hep_ip6header.hp6_dst, 16);
+		}
+		p = hep3_add_chunk(p, 7, &hdr.hp_sport, 2);
+		p = hep3_add_chunk(p, 8, &hdr.hp_dport, 2);
+		u32 = htonl(tv->tv_sec);
+		p = hep3_add_chunk(p, 9, &u32, 4);
+		u32 = htonl(tv->tv_usec);
+		p = hep3_add_chunk(p, 10, &u32, 4);
+		u8 = 1; /* SIP */
+		p = hep3_add_chunk(p, 11, &u8, 1);
+		u32 = htonl(hep_capture_id);
+		p = hep3_add_chunk(p, 12, &u32, 4);
+		p = hep3_add_chunk(p, 15, body->s, body->len);
+		buflen = p - trace_hep_buf;
+
+		memcpy(hep_ctrl.id, "HEP3", 4);
+		u16 = htons(buflen);
+		hep_ctrl.length = u16;
+		memcpy(trace_hep_buf, &hep_ctrl, sizeof(hep_ctrl_t));
+		goto send;
 	}
 
-	/* Copy job */
-	memset(buffer, '\0', len+1);
+	hdr.hp_l +=len;
 
 	/* copy hep_hdr */
-	memcpy((void*)buffer, &hdr, sizeof(struct hep_hdr));
+	memcpy(trace_hep_buf, &hdr, sizeof(struct hep_hdr));
 	buflen = sizeof(struct hep_hdr);
 
 	/* hep_ip_hdr */
 	if(from_su.s.sa_family==AF_INET) {
-		memcpy((void*)buffer + buflen, &hep_ipheader, sizeof(struct hep_iphdr));
+		memcpy(trace_hep_buf + buflen, &hep_ipheader, sizeof(struct hep_iphdr));
 		buflen += sizeof(struct hep_iphdr);
 	}
 	else {
-		memcpy((void*)buffer+buflen, &hep_ip6header, sizeof(struct hep_ip6hdr));
+		memcpy(trace_hep_buf + buflen, &hep_ip6header, sizeof(struct hep_ip6hdr));
 		buflen += sizeof(struct hep_ip6hdr);
 	}
 
 	if(hep_version == 2) {
+		memset(&hep_time, 0, sizeof(struct hep_timehdr));
+		hep_time.tv_sec = tv->tv_sec;
+		hep_time.tv_usec = tv->tv_usec;
+		hep_time.captid = hep_capture_id;
 
-                hep_time.tv_sec = tvb.tv_sec;
-                hep_time.tv_usec = tvb.tv_usec;
-                hep_time.captid = hep_capture_id;
-
-                memcpy((void*)buffer+buflen, &hep_time, sizeof(struct hep_timehdr));
-                buflen += sizeof(struct hep_timehdr);
-        }
+		memcpy(trace_hep_buf + buflen, &hep_time, sizeof(struct hep_timehdr));
+		buflen += sizeof(struct hep_timehdr);
+	}
 
 	/* PAYLOAD */
-	memcpy((void*)(buffer + buflen) , (void*)body->s, body->len);
+	memcpy(trace_hep_buf + buflen, body->s, body->len);
 	buflen +=body->len;
 
-	if (msg_send(&dst, buffer, buflen)<0)
+send:
+	if (msg_send(dst, trace_hep_buf, buflen)<0)
 	{
 		LM_ERR("cannot send hep duplicate message\n");
 		goto error;
 	}
 
-	free_proxy(p); /* frees only p content, not p itself */
-	pkg_free(p);
-	pkg_free(buffer);
 	return 0;
 error:
-	if(p)
+	return -1;
+}
+
+/*! \brief copy a traced message to the ring of the sender process */
+static int trace_async_queue(struct _siptrace_data *sto)
+{
+	trace_cap_hdr_t hdr;
+	str parts[4];
+
+	if(sto->body.s==NULL || sto->body.len<=0 || sto->body.len>BUF_SIZE)
+		return -1;
+
+	memset(&hdr, 0, sizeof(trace_cap_hdr_t));
+	hdr.tv_sec = sto->tv.tv_sec;
+	hdr.tv_usec = sto->tv.tv_usec;
+	parts[0].s = (char*)&hdr;
+	parts[0].len = sizeof(trace_cap_hdr_t);
+	parts[1].len = 0;
+	parts[2].len = 0;
+	if(hep_mode_on)
 	{
-		free_proxy(p); /* frees only p content, not p itself */
-		pkg_free(p);
+		/* the addresses are needed only for the HEP headers */
+		if(sto->fromip.len>=IP_ADDR_MAX_STR_SIZE+12
+				|| sto->toip.len>=IP_ADDR_MAX_STR_SIZE+12)
+			return -1;
+		parts[1] = sto->fromip;
+		parts[2] = sto->toip;
+		hdr.from_len = sto->fromip.len;
+		hdr.to_len = sto->toip.len;
+	}
+	parts[3] = sto->body;
+
+	return st_ring_push(trace_ring, parts, 4);
+}
+
+/*! \brief send a message taken from the ring */
+static int trace_async_send(str *rec, struct dest_info *dst)
+{
+	trace_cap_hdr_t hdr;
+	char from_buf[IP_ADDR_MAX_STR_SIZE+12];
+	char to_buf[IP_ADDR_MAX_STR_SIZE+12];
+	struct timeval tv;
+	str from, to, body;
+
+	memcpy(&hdr, rec->s, sizeof(trace_cap_hdr_t));
+	body.s = rec->s + sizeof(trace_cap_hdr_t);
+	body.len = rec->len - sizeof(trace_cap_hdr_t);
+	if(!hep_mode_on)
+		return trace_send_duplicate(body.s, body.len, dst);
+
+	/* pipport2su() wants zero terminated addresses */
+	from.s = from_buf;
+	from.len = hdr.from_len;
+	memcpy(from_buf, body.s, from.len);
+	from_buf[from.len] = '\0';
+	body.s += from.len;
+	to.s = to_buf;
+	to.len = hdr.to_len;
+	memcpy(to_buf, body.s, to.len);
+	to_buf[to.len] = '\0';
+	body.s += to.len;
+	body.len -= from.len + to.len;
+	tv.tv_sec = hdr.tv_sec;
+	tv.tv_usec = hdr.tv_usec;
+
+	return trace_send_hep_duplicate(&body, &from, &to, &tv, dst);
+}
+
+/*! \brief sender process: takes the messages queued by the workers and
+ * sends them in batches of up to async_batch_size datagrams (with one
+ * sendmmsg() per batch if the core udp_snd_batch is set) */
+static void trace_async_sender(void)
+{
+	struct dest_info dst;
+	str rec;
+	int ok;
+	int n;
+
+	for(;;)
+	{
+		cfg_update();
+		if(!st_ring_peek(trace_ring, &rec))
+		{
+			sleep_us(trace_async_flush_interval*1000);
+			continue;
+		}
+		/* one destination lookup per batch */
+		ok = (trace_dup_dst(&dst)==0);
+		udp_send_batch_begin();
+		n = 0;
+		do {
+			if(ok && trace_async_send(&rec, &dst)==0)
+				trace_async_cnt->sent++;
+			else
+				trace_async_cnt->failed++;
+			st_ring_pop(trace_ring);
+		} while(++n<trace_async_batch_size && st_ring_peek(trace_ring, &rec));
+		udp_send_batch_flush();
 	}
-	if(buffer) pkg_free(buffer);
-	return -1;
 }
 
 /*!
@@ -1800,8 +2035,39 @@ static const char* siptrace_status_doc[2] = {
         0
 };
 
+static void siptrace_rpc_ring(rpc_t* rpc, void* c) {
+	void *th;
+
+	if(trace_ring==NULL) {
+		rpc->fault(c, 500, "Asynchronous sending not enabled");
+		return;
+	}
+	if (rpc->add(c, "{", &th) < 0) {
+		rpc->fault(c, 500, "Internal error creating rpc");
+		return;
+	}
+	if(rpc->struct_add(th, "ddddddd",
+				"size", (int)trace_ring->size,
+				"used", (int)st_ring_used(trace_ring),
+				"queued", atomic_get(&trace_ring->queued),
+				"pending", atomic_get(&trace_ring->queued)
+					- (int)trace_ring->taken,
+				"dropped", atomic_get(&trace_ring->dropped),
+				"sent", (int)trace_async_cnt->sent,
+				"failed", (int)trace_async_cnt->failed) < 0) {
+		rpc->fault(c, 500, "Internal error adding ring counters");
+		return;
+	}
+}
+
+static const char* siptrace_ring_doc[2] = {
+	"Counters of the asynchronous sending ring.",
+	0
+};
+
 rpc_export_t siptrace_rpc[] = {
 	{"siptrace.status", siptrace_rpc_status, siptrace_status_doc, 0},
+	{"siptrace.ring",   siptrace_rpc_ring,   siptrace_ring_doc,   0},
 	{0, 0, 0, 0}
 };
 
@@ -0,0 +1,146 @@
+/*
+ * siptrace module - helper module to trace sip messages
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ * siptrace module - shared memory capture ring
+ */
+
+#include <string.h>
+
+#include "../../dprint.h"
+#include "../../mem/shm_mem.h"
+#include "siptrace_ring.h"
+
+/* records are aligned to the header size, so that the space left before
+ * the end of the buffer can always hold a padding record */
+#define ST_REC_ALIGN   sizeof(st_ring_rec_t)
+#define ST_REC_SIZE(l) \
+	((sizeof(st_ring_rec_t) + (l) + ST_REC_ALIGN - 1) & ~(ST_REC_ALIGN - 1))
+
+st_ring_t* st_ring_new(unsigned int size)
+{
+	st_ring_t *r;
+	unsigned long s;
+
+	for (s = 4096; s < size; s <<= 1);
+	r = (st_ring_t*)shm_malloc(sizeof(st_ring_t) + s);
+	if (r == NULL) {
+		LM_ERR("no more shm memory for a %lu bytes ring\n", s);
+		return NULL;
+	}
+	memset(r, 0, sizeof(st_ring_t) + s);
+	r->size = s;
+	r->buf = (char*)(r + 1);
+	atomic_set(&r->queued, 0);
+	atomic_set(&r->dropped, 0);
+	return r;
+}
+
+void st_ring_destroy(st_ring_t *r)
+{
+	if (r)
+		shm_free(r);
+}
+
+int st_ring_push(st_ring_t *r, str *parts, int n)
+{
+	st_ring_rec_t *rec;
+	unsigned long h, t, off, need, pad;
+	unsigned int len;
+	char *p;
+	int i;
+
+	len = 0;
+	for (i = 0; i < n; i++)
+		len += parts[i].len;
+	need = ST_REC_SIZE(len);
+
+	/* reserve the space: the record, preceded by a padding record if
+	 * it does not fit before the end of the buffer */
+	do {
+		h = (unsigned long)atomic_get_long(&r->head);
+		membar_read();
+		t = (unsigned long)atomic_get_long(&r->tail);
+		off = h & (r->size - 1);
+		pad = (off + need > r->size) ? r->size - off : 0;
+		if (unlikely(h + pad + need - t > r->size)) {
+			atomic_inc(&r->dropped);
+			return -1;
+		}
+	} while (atomic_cmpxchg_long(&r->head, (long)h, (long)(h + pad + need))
+			!= (long)h);
+
+	if (pad) {
+		rec = (st_ring_rec_t*)(r->buf + off);
+		rec->len = 0;
+		membar_write();
+		rec->size = pad;
+		off = 0;
+	}
+
+	rec = (st_ring_rec_t*)(r->buf + off);
+	rec->len = len;
+	p = (char*)(rec + 1);
+	for (i = 0; i < n; i++) {
+		memcpy(p, parts[i].s, parts[i].len);
+		p += parts[i].len;
+	}
+	membar_write();
+	rec->size = need;
+	atomic_inc(&r->queued);
+	return 0;
+}
+
+int st_ring_peek(st_ring_t *r, str *rec)
+{
+	st_ring_rec_t *h;
+
+	for (;;) {
+		if (r->tail == atomic_get_long(&r->head))
+			return 0;
+		h = (st_ring_rec_t*)(r->buf + ((unsigned long)r->tail & (r->size - 1)));
+		if (h->size == 0)
+			return 0; /* reserved, but still being written */
+		membar_read();
+		if (h->len) {
+			rec->s = (char*)(h + 1);
+			rec->len = h->len;
+			return 1;
+		}
+		st_ring_pop(r);
+	}
+}
+
+void st_ring_pop(st_ring_t *r)
+{
+	st_ring_rec_t *h;
+	unsigned int size;
+
+	h = (st_ring_rec_t*)(r->buf + ((unsigned long)r->tail & (r->size - 1)));
+	size = h->size;
+	if (h->len)
+		r->taken++;
+	/* the producers find zeroed headers wherever they reserve space */
+	memset(h, 0, size);
+	membar_write();
+	r->tail = (long)((unsigned long)r->tail + size);
+}
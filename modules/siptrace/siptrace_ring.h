@@ -0,0 +1,81 @@
+/*
+ * siptrace module - helper module to trace sip messages
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ * siptrace module - shared memory capture ring
+ *
+ * Lock-free multiple producers / single consumer ring of variable size
+ * records. The SIP workers reserve space by moving the head with a
+ * compare-and-swap, copy their record and mark it as committed by
+ * setting its size. The sender process reads the committed records in
+ * order, zeroes their space and moves the tail. A record that does not
+ * fit before the end of the buffer is preceded by a padding record. When
+ * the ring is full the record is dropped and counted, the workers never
+ * wait for the sender.
+ */
+
+#ifndef _SIPTRACE_RING_H_
+#define _SIPTRACE_RING_H_
+
+#include "../../str.h"
+#include "../../atomic_ops.h"
+
+typedef struct st_ring_rec {
+	volatile unsigned int size;  /*!< record size, 0 until committed */
+	unsigned int len;            /*!< data length, 0 for padding */
+} st_ring_rec_t;
+
+typedef struct st_ring {
+	volatile long head;          /*!< reserved bytes (producers) */
+	unsigned long size;          /*!< buffer size, power of 2 */
+	char *buf;
+	atomic_t queued;             /*!< records queued */
+	atomic_t dropped;            /*!< records dropped, ring full */
+	/* keep the consumer fields off the producers cache line */
+	char pad[64];
+	volatile long tail;          /*!< released bytes (consumer) */
+	unsigned long taken;         /*!< records taken (consumer) */
+} st_ring_t;
+
+/*! create a ring of at least size bytes in shared memory */
+st_ring_t* st_ring_new(unsigned int size);
+
+/*! free the ring */
+void st_ring_destroy(st_ring_t *r);
+
+/*! queue the concatenation of the n parts as one record
+ * \return 0 on success, -1 if the ring is full (the record is dropped) */
+int st_ring_push(st_ring_t *r, str *parts, int n);
+
+/*! get the oldest committed record (consumer only)
+ * \return 1 and the record data in rec, 0 if none */
+int st_ring_peek(st_ring_t *r, str *rec);
+
+/*! release the record returned by st_ring_peek() (consumer only) */
+void st_ring_pop(st_ring_t *r);
+
+/*! bytes in use */
+#define st_ring_used(r) \
+	((unsigned long)atomic_get_long(&(r)->head) \
+		- (unsigned long)atomic_get_long(&(r)->tail))
+
+#endif
@@ -120,6 +120,7 @@ static param_export_t params[] = {
 	{"default_code",   PARAM_INT, &default_code},
 	{"default_reason", PARAM_STR, &default_reason},
 	{"bind_tm",        PARAM_INT, &sl_bind_tm},
+	{"fast_reply",     PARAM_INT, &sl_fast_reply},
 
     {0, 0, 0}
 };
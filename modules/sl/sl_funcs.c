@@ -79,6 +79,27 @@ static int _sl_filtered_ack_route = -1; /* default disabled */
 
 static int _sl_evrt_local_response = -1; /* default disabled */
 
+/* build the replies without reply lumps from templates (see sl_fast_build) */
+int sl_fast_reply = 1;
+
+#define SL_TMPL_MIN_CODE  100
+#define SL_TMPL_MAX_CODE  699
+#define SL_FAST_SEGS      64
+
+/* cached first line of the reply for a code, re-built if the version
+ * or the reason differ */
+typedef struct sl_rpl_tmpl {
+	str line;  /* version SP code SP reason CRLF */
+	int vlen;  /* version length */
+	int size;  /* allocated size */
+} sl_rpl_tmpl_t;
+
+static sl_rpl_tmpl_t sl_tmpl[SL_TMPL_MAX_CODE - SL_TMPL_MIN_CODE + 1];
+/* constant reply end: server header, content length, empty line */
+static str sl_tmpl_tail = {0, 0};
+/* reply buffer, the fast path replies are not allocated */
+static char sl_fast_buf[BUF_SIZE + 1];
+
 /*!
  * lookup sl event routes
  */
@@ -138,6 +159,239 @@ int sl_get_reply_totag(struct sip_msg *msg, str *totag)
 }
 
 
+/*!
+ * get the cached first line of a reply, building it if needed
+ */
+static str* sl_tmpl_line(struct sip_msg *msg, int code, str *text)
+{
+	sl_rpl_tmpl_t *t;
+	str *ver;
+	char *p;
+	int len;
+
+	if (code < SL_TMPL_MIN_CODE || code > SL_TMPL_MAX_CODE)
+		return 0;
+	t = &sl_tmpl[code - SL_TMPL_MIN_CODE];
+	ver = &msg->first_line.u.request.version;
+	if (t->line.s && t->vlen == ver->len
+			&& t->line.len == ver->len + 5 + text->len + CRLF_LEN
+			&& memcmp(t->line.s, ver->s, ver->len) == 0
+			&& memcmp(t->line.s + ver->len + 5, text->s, text->len) == 0)
+		return &t->line;
+	len = ver->len + 5 /* SP code SP */ + text->len + CRLF_LEN;
+	if (len > t->size) {
+		if (t->line.s)
+			pkg_free(t->line.s);
+		t->line.s = 0;
+		t->size = 0;
+		t->line.s = (char*)pkg_malloc(len);
+		if (t->line.s == 0) {
+			LOG(L_ERR, "ERROR: sl_tmpl_line: no more pkg memory\n");
+			return 0;
+		}
+		t->size = len;
+	}
+	p = t->line.s;
+	memcpy(p, ver->s, ver->len);
+	p += ver->len;
+	*(p++) = ' ';
+	*(p++) = '0' + code / 100;
+	*(p++) = '0' + (code / 10) % 10;
+	*(p++) = '0' + code % 10;
+	*(p++) = ' ';
+	memcpy(p, text->s, text->len);
+	p += text->len;
+	memcpy(p, CRLF, CRLF_LEN);
+	t->line.len = len;
+	t->vlen = ver->len;
+	return &t->line;
+}
+
+/*!
+ * get the constant end of the replies (built on first use, after the
+ * core config is final)
+ */
+static str* sl_tmpl_end(void)
+{
+	char *p;
+	int len;
+
+	if (likely(sl_tmpl_tail.s))
+		return &sl_tmpl_tail;
+	len = CONTENT_LENGTH_LEN + 1 + 2 * CRLF_LEN;
+	if (server_signature)
+		len += server_hdr.len + CRLF_LEN;
+	sl_tmpl_tail.s = (char*)pkg_malloc(len);
+	if (sl_tmpl_tail.s == 0) {
+		LOG(L_ERR, "ERROR: sl_tmpl_end: no more pkg memory\n");
+		return 0;
+	}
+	p = sl_tmpl_tail.s;
+	if (server_signature) {
+		memcpy(p, server_hdr.s, server_hdr.len);
+		p += server_hdr.len;
+		memcpy(p, CRLF, CRLF_LEN);
+		p += CRLF_LEN;
+	}
+	memcpy(p, CONTENT_LENGTH "0" CRLF CRLF, CONTENT_LENGTH_LEN + 1
+			+ 2 * CRLF_LEN);
+	sl_tmpl_tail.len = len;
+	return &sl_tmpl_tail;
+}
+
+/* add a segment to the reply, merging it with the previous one if they
+ * are adjacent in the request buffer (returns 0 if there are too many) */
+#define sl_seg_add(_segs, _n, _s, _len) \
+	do { \
+		if ((_n) > 0 && (_segs)[(_n) - 1].s + (_segs)[(_n) - 1].len == (_s)) { \
+			(_segs)[(_n) - 1].len += (_len); \
+		} else { \
+			if (unlikely((_n) == SL_FAST_SEGS)) \
+				return 0; \
+			(_segs)[(_n)].s = (_s); \
+			(_segs)[(_n)].len = (_len); \
+			(_n)++; \
+		} \
+	} while(0)
+
+/*!
+ * build a reply without lumps, same content as build_res_buf_from_sip_req()
+ *
+ * The reply is a list of segments pointing to the cached first line, to
+ * the request headers that are copied and to the constant end, gathered
+ * in a static buffer. It returns 0 if the reply can't be built this way.
+ */
+static char* sl_fast_build(struct sip_msg *msg, int code, str *text,
+		str *new_tag, unsigned int *returned_len)
+{
+	str segs[SL_FAST_SEGS];
+	char received_buf[MAX_RECEIVED_SIZE];
+	char rport_buf[RPORT_LEN + INT2STR_MAX_LEN];
+	struct hdr_field *hdr;
+	struct via_param *rport;
+	str received = {0, 0};
+	str rport_val = {0, 0};
+	str to_tag;
+	str *s;
+	char *after_body;
+	char *tmp;
+	char *p;
+	int tmp_len;
+	int len;
+	int n;
+	int i;
+
+	if (msg->reply_lump || sip_warning)
+		return 0;
+	if (parse_headers(msg, HDR_EOH_F, 0) == -1 || msg->via1 == 0)
+		return 0;
+	n = 0;
+	if ((s = sl_tmpl_line(msg, code, text)) == 0)
+		return 0;
+	sl_seg_add(segs, n, s->s, s->len);
+
+	if (received_test(msg)) {
+		if ((tmp = ip_addr2a(&msg->rcv.src_ip)) == 0)
+			return 0;
+		tmp_len = strlen(tmp);
+		if (RECEIVED_LEN + tmp_len > MAX_RECEIVED_SIZE)
+			return 0;
+		memcpy(received_buf, RECEIVED, RECEIVED_LEN);
+		memcpy(received_buf + RECEIVED_LEN, tmp, tmp_len);
+		received.s = received_buf;
+		received.len = RECEIVED_LEN + tmp_len;
+	}
+	rport = msg->via1->rport;
+	if (((msg->msg_flags|global_req_flags) & FL_FORCE_RPORT) || rport) {
+		tmp = int2str(msg->rcv.src_port, &tmp_len);
+		memcpy(rport_buf, RPORT, RPORT_LEN);
+		memcpy(rport_buf + RPORT_LEN, tmp, tmp_len);
+		rport_val.s = rport_buf;
+		rport_val.len = RPORT_LEN + tmp_len;
+	}
+
+	for (hdr = msg->headers; hdr; hdr = hdr->next) {
+		switch (hdr->type) {
+			case HDR_VIA_T:
+				after_body = hdr->body.s + hdr->body.len;
+				if (hdr == msg->h_via1) {
+					if (rport_val.s && rport) {
+						/* replace the old rport */
+						sl_seg_add(segs, n, hdr->name.s,
+								rport->start - hdr->name.s - 1);
+						sl_seg_add(segs, n, rport_val.s, rport_val.len);
+						sl_seg_add(segs, n, rport->start + rport->size,
+								after_body - rport->start - rport->size);
+					} else {
+						sl_seg_add(segs, n, hdr->name.s,
+								after_body - hdr->name.s);
+						if (rport_val.s)
+							sl_seg_add(segs, n, rport_val.s, rport_val.len);
+					}
+					if (received.s)
+						sl_seg_add(segs, n, received.s, received.len);
+				} else {
+					sl_seg_add(segs, n, hdr->name.s, after_body - hdr->name.s);
+				}
+				sl_seg_add(segs, n, CRLF, CRLF_LEN);
+				break;
+			case HDR_RECORDROUTE_T:
+				/* RR only for 1xx and 2xx replies */
+				if (code < 180 || code >= 300)
+					break;
+				sl_seg_add(segs, n, hdr->name.s, hdr->len);
+				break;
+			case HDR_TO_T:
+				if (new_tag && new_tag->len) {
+					to_tag = get_to(msg)->tag_value;
+					if (to_tag.s) {
+						/* replace the to-tag */
+						sl_seg_add(segs, n, hdr->name.s,
+								to_tag.s - hdr->name.s);
+						sl_seg_add(segs, n, new_tag->s, new_tag->len);
+						sl_seg_add(segs, n, to_tag.s + to_tag.len,
+								hdr->name.s + hdr->len
+									- (to_tag.s + to_tag.len));
+					} else {
+						after_body = hdr->body.s + hdr->body.len;
+						sl_seg_add(segs, n, hdr->name.s,
+								after_body - hdr->name.s);
+						sl_seg_add(segs, n, TOTAG_TOKEN, TOTAG_TOKEN_LEN);
+						sl_seg_add(segs, n, new_tag->s, new_tag->len);
+						sl_seg_add(segs, n, after_body,
+								hdr->name.s + hdr->len - after_body);
+					}
+					break;
+				}
+				/* no break */
+			case HDR_FROM_T:
+			case HDR_CALLID_T:
+			case HDR_CSEQ_T:
+				sl_seg_add(segs, n, hdr->name.s, hdr->len);
+				break;
+			default:
+				;
+		}
+	}
+	if ((s = sl_tmpl_end()) == 0)
+		return 0;
+	sl_seg_add(segs, n, s->s, s->len);
+
+	len = 0;
+	for (i = 0; i < n; i++)
+		len += segs[i].len;
+	if (len > BUF_SIZE)
+		return 0;
+	p = sl_fast_buf;
+	for (i = 0; i < n; i++) {
+		memcpy(p, segs[i].s, segs[i].len);
+		p += segs[i].len;
+	}
+	*p = 0;
+	*returned_len = len;
+	return sl_fast_buf;
+}
+
 /*!
  * helper function for stateless reply
  */
@@ -149,6 +403,8 @@ int sl_reply_helper(struct sip_msg *msg, int code, char *reason, str *tag)
 	struct bookmark dummy_bm;
 	int backup_mhomed, ret;
 	str text;
+	str *totag;
+	int fast;
 
 	int backup_rt;
 	struct run_act_ctx ctx;
@@ -179,6 +435,7 @@ int sl_reply_helper(struct sip_msg *msg, int code, char *reason, str *tag)
 	text.len = strlen(reason);
 
 	/* add a to-tag if there is a To header field without it */
+	totag = 0;
 	if ( 	/* since RFC3261, we append to-tags anywhere we can, except
 		 * 100 replies */
        		/* msg->first_line.u.request.method_value==METHOD_INVITE && */
@@ -187,17 +444,23 @@ int sl_reply_helper(struct sip_msg *msg, int code, char *reason, str *tag)
 		&& (get_to(msg)->tag_value.s==0 || get_to(msg)->tag_value.len==0) ) 
 	{
 		if(tag!=NULL && tag->s!=NULL) {
-			buf.s = build_res_buf_from_sip_req(code, &text, tag,
-						msg, (unsigned int*)&buf.len, &dummy_bm);
+			totag = tag;
 		} else {
 			calc_crc_suffix( msg, tag_suffix );
-			buf.s = build_res_buf_from_sip_req(code, &text, &sl_tag, msg,
-					(unsigned int*)&buf.len, &dummy_bm);
+			totag = &sl_tag;
 		}
-	} else {
-		buf.s = build_res_buf_from_sip_req(code, &text, 0, msg,
-				(unsigned int*)&buf.len, &dummy_bm);
 	}
+	/* the local-response event route parses the reply buffer, keep it
+	 * private to this call */
+	fast = 0;
+	if (sl_fast_reply && _sl_evrt_local_response < 0) {
+		buf.s = sl_fast_build(msg, code, &text, totag,
+				(unsigned int*)&buf.len);
+		fast = (buf.s != 0);
+	}
+	if (!fast)
+		buf.s = build_res_buf_from_sip_req(code, &text, totag, msg,
+				(unsigned int*)&buf.len, &dummy_bm);
 	if (!buf.s)
 	{
 		DBG("DEBUG: sl_reply_helper: response building failed\n");
@@ -305,7 +568,8 @@ event_route_error:
 		}
 	}
 
-	pkg_free(buf.s);
+	if (!fast)
+		pkg_free(buf.s);
 
 	if (ret<0) {
 		goto error;
@@ -36,6 +36,8 @@
 
 #define SL_TOTAG_SEPARATOR '.'
 
+extern int sl_fast_reply;
+
 int sl_startup();
 int sl_shutdown();
 
@@ -134,6 +134,60 @@ int tls_BIO_mbuf_set(BIO* b, struct tls_mbuf* rd, struct tls_mbuf* wr)
 
 
 
+/** sets the records counters for an mbuf BIO.
+ * @return 1 on success, 0 on error (openssl BIO convention).
+ */
+int tls_BIO_mbuf_set_rec_cnt(BIO* b, struct tls_rec_cnt* rd,
+								struct tls_rec_cnt* wr)
+{
+	struct tls_bio_mbuf_data* d;
+
+	if (unlikely(b->ptr == 0)){
+		BUG("null BIO ptr\n");
+		return 0;
+	}
+	d = b->ptr;
+	d->rd_cnt = rd;
+	d->wr_cnt = wr;
+	return 1;
+}
+
+
+
+/** count the tls records in a chunk of the read or written stream.
+ * Only the records headers are looked at, the sequence number restarts
+ * after a ChangeCipherSpec record (with a new key).
+ */
+static void tls_rec_cnt_update(struct tls_rec_cnt* rc,
+								const unsigned char* p, int len)
+{
+	int n;
+
+	while (len > 0) {
+		if (rc->left) {
+			n = MIN_int(rc->left, len);
+			rc->left -= n;
+			p += n;
+			len -= n;
+			continue;
+		}
+		rc->hdr[rc->hdr_len++] = *p++;
+		len--;
+		if (rc->hdr_len == sizeof(rc->hdr)) {
+			rc->hdr_len = 0;
+			rc->left = (rc->hdr[3] << 8) | rc->hdr[4];
+			if (rc->hdr[0] == 20 /* change_cipher_spec */) {
+				rc->ccs = 1;
+				rc->seq = 0;
+			} else if (rc->ccs) {
+				rc->seq++;
+			}
+		}
+	}
+}
+
+
+
 /** create a new BIO.
  * (internal openssl use via the tls_mbuf method)
  * @return 1 on success, 0 on error.
@@ -152,6 +206,8 @@ static int tls_bio_mbuf_new(BIO* b)
 		return 0;
 	d->rd = 0;
 	d->wr = 0;
+	d->rd_cnt = 0;
+	d->wr_cnt = 0;
 	b->ptr = d;
 	return 1;
 }
@@ -220,6 +276,8 @@ static int tls_bio_mbuf_read(BIO* b, char* dst, int dst_len)
 		memcpy(dst, rd->buf+rd->pos, ret);
 		TLS_BIO_DBG("read(%p, %p, %d) called with rd=%p pos=%d => %d bytes\n",
 						b, dst, dst_len, rd->buf, rd->pos, ret);
+		if (unlikely(d->rd_cnt))
+			tls_rec_cnt_update(d->rd_cnt, rd->buf+rd->pos, ret);
 		rd->pos += ret;
 /*		if (unlikely(rd->pos < rd->used))
 			BIO_set_retry_read(b);
@@ -268,6 +326,8 @@ static int tls_bio_mbuf_write(BIO* b, const char* src, int src_len)
 	ret = MIN_int(wr->size - wr->used, src_len);
 	memcpy(wr->buf + wr->used, src, ret);
 	wr->used += ret;
+	if (unlikely(d->wr_cnt))
+		tls_rec_cnt_update(d->wr_cnt, (unsigned char*)src, ret);
 /*	if (unlikely(ret < src_len))
 		BIO_set_retry_write();
 */
@@ -40,15 +40,32 @@ struct tls_mbuf {
 	int size; /**< total buffer size (fixed) */
 };
 
+/* tls records counter (for kTLS, which needs the records sequence
+   numbers that openssl does not export) */
+struct tls_rec_cnt {
+	unsigned char hdr[5]; /**< header of the current record */
+	unsigned int hdr_len; /**< header bytes seen so far */
+	unsigned int left;    /**< payload bytes of the current record to go */
+	unsigned int ccs;     /**< ChangeCipherSpec seen */
+	unsigned long long seq; /**< complete records since ChangeCipherSpec */
+};
+
+/** true if the counted stream stops at a record boundary */
+#define tls_rec_cnt_boundary(rc) ((rc)->hdr_len == 0 && (rc)->left == 0)
+
 struct tls_bio_mbuf_data {
 	struct tls_mbuf* rd;
 	struct tls_mbuf* wr;
+	struct tls_rec_cnt* rd_cnt; /**< if set, counts the records read */
+	struct tls_rec_cnt* wr_cnt; /**< if set, counts the records written */
 };
 
 
 BIO_METHOD* tls_BIO_mbuf(void);
 BIO* tls_BIO_new_mbuf(struct tls_mbuf* rd, struct tls_mbuf* wr);
 int tls_BIO_mbuf_set(BIO* b, struct tls_mbuf* rd, struct tls_mbuf* wr);
+int tls_BIO_mbuf_set_rec_cnt(BIO* b, struct tls_rec_cnt* rd,
+								struct tls_rec_cnt* wr);
 
 
 
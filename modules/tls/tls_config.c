@@ -155,6 +155,7 @@ static cfg_option_t options[] = {
 	{"cipher_list",         .f = cfg_parse_str_opt, .flags = CFG_STR_SHMMEM},
 	{"ca_list",             .f = cfg_parse_str_opt, .flags = CFG_STR_SHMMEM},
 	{"crl",                 .f = cfg_parse_str_opt, .flags = CFG_STR_SHMMEM},
+	{"ktls",                .f = cfg_parse_bool_opt},
 	{0}
 };
 
@@ -178,6 +179,7 @@ static void update_opt_variables(void)
 	options[12].param = &domain->cipher_list;
 	options[13].param = &domain->ca_file;
 	options[14].param = &domain->crl_file;
+	options[15].param = &domain->ktls;
 }
 
 
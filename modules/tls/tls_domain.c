@@ -41,6 +41,8 @@
 #include "tls_init.h"
 #include "tls_domain.h"
 #include "tls_cfg.h"
+#include "tls_session.h"
+#include "tls_ktls.h"
 
 /*
  * ECDHE is enabled only on OpenSSL 1.0.0e and later.
@@ -154,6 +156,7 @@ tls_domain_t* tls_new_domain(int type, struct ip_addr *ip, unsigned short port)
 	d->verify_cert = -1;
 	d->verify_depth = -1;
 	d->require_cert = -1;
+	d->ktls = -1;
 	return d;
 }
 
@@ -325,6 +328,12 @@ static int fill_missing(tls_domain_t* d, tls_domain_t* parent)
 	if (d->verify_depth == -1) d->verify_depth = parent->verify_depth;
 	LOG(L_INFO, "%s: verify_depth=%d\n", tls_domain_str(d), d->verify_depth);
 
+	if (d->ktls == -1) d->ktls = parent->ktls;
+	LOG(L_INFO, "%s: ktls=%d\n", tls_domain_str(d), d->ktls);
+	if (d->ktls > 0 && !tls_ktls_supported())
+		WARN("%s: kTLS support not compiled in, using openssl\n",
+				tls_domain_str(d));
+
 	return 0;
 }
 
@@ -784,13 +793,9 @@ static int set_session_cache(tls_domain_t* d)
 	procs_no=get_max_procs();
 	tls_session_id=cfg_get(tls, tls_cfg, session_id);
 	for(i = 0; i < procs_no; i++) {
-		/* janakj: I am not sure if session cache makes sense in ser, session
-		 * cache is stored in SSL_CTX and we have one SSL_CTX per process,
-		 * thus sessions among processes will not be reused
-		 */
-		SSL_CTX_set_session_cache_mode(d->ctx[i],
-				cfg_get(tls, tls_cfg, session_cache) ? SSL_SESS_CACHE_SERVER :
-				SSL_SESS_CACHE_OFF);
+		/* the session cache in SSL_CTX is per process (one SSL_CTX per
+		 * process), so the sessions are kept in a shared cache instead */
+		tls_sess_setup_ctx(d, d->ctx[i], cfg_get(tls, tls_cfg, session_cache));
 		/* not really needed is SSL_SESS_CACHE_OFF */
 		SSL_CTX_set_session_id_context(d->ctx[i],
 					(unsigned char*)tls_session_id.s, tls_session_id.len);
@@ -30,6 +30,7 @@
 
 #include "../../str.h"
 #include "../../ip_addr.h"
+#include "../../atomic_ops.h"
 #include <openssl/ssl.h>
 
 
@@ -70,6 +71,17 @@ enum tls_domain_type {
 };
 
 
+/**
+ * Session resumption counters, updated by all the processes
+ */
+typedef struct tls_sess_stats {
+	atomic_t handshakes;   /**< completed handshakes */
+	atomic_t resumed;      /**< abbreviated (resumed) handshakes */
+	atomic_t cache_hits;   /**< sessions found in the shared cache */
+	atomic_t cache_misses; /**< sessions not found in the shared cache */
+} tls_sess_stats_t;
+
+
 /**
  * separate configuration per ip:port
  */
@@ -87,7 +99,9 @@ typedef struct tls_domain {
 	str cipher_list;
 	enum tls_method method;
 	str crl_file;
+	int ktls;
 	struct tls_domain* next;
+	tls_sess_stats_t sess_stats;
 } tls_domain_t;
 
 
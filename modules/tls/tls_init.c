@@ -59,6 +59,7 @@
 #include "tls_locking.h"
 #include "tls_ct_wrq.h"
 #include "tls_cfg.h"
+#include "tls_session.h"
 
 /* will be set to 1 when the TLS env is initialized to make destroy safe */
 static int tls_mod_initialized = 0;
@@ -686,4 +687,5 @@ void destroy_tls_h(void)
 	tls_destroy_cfg();
 	tls_destroy_locks();
 	tls_ct_wq_destroy();
+	tls_sess_destroy();
 }
@@ -0,0 +1,484 @@
+/*
+ * TLS module
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * SIP-router TLS support :: kernel TLS (Linux kTLS) offload
+ * @file
+ * @ingroup tls
+ * Module: @ref tls
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <openssl/ssl.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include "../../dprint.h"
+#include "../../tcp_read.h"
+#include "../../cfg/cfg.h"
+#include "../../cfg_core.h"
+#include "tls_mod.h"
+#include "tls_bio.h"
+#include "tls_ktls.h"
+
+#if defined(__OS_linux) && defined(TLS1_2_VERSION)
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4,17,0)
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <linux/tls.h>
+#define TLS_KTLS
+#endif
+#endif
+
+#ifdef TLS_KTLS
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#ifndef TLS_GET_RECORD_TYPE
+#define TLS_GET_RECORD_TYPE 2
+#endif
+
+/* TLS record content types */
+#define TLS_KTLS_REC_ALERT      21
+#define TLS_KTLS_REC_HANDSHAKE  22
+#define TLS_KTLS_REC_DATA       23
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+#define SSL_get_client_random(ssl, out, len) \
+	(memcpy((out), (ssl)->s3->client_random, (len)), (len))
+#define SSL_get_server_random(ssl, out, len) \
+	(memcpy((out), (ssl)->s3->server_random, (len)), (len))
+#define SSL_SESSION_get_master_key(sess, out, len) \
+	(memcpy((out), (sess)->master_key, (sess)->master_key_length), \
+		(sess)->master_key_length)
+#endif
+
+#define TLS_KTLS_LABEL      "key expansion"
+#define TLS_KTLS_LABEL_LEN  (sizeof(TLS_KTLS_LABEL) - 1)
+#define TLS_KTLS_SEED_LEN   (TLS_KTLS_LABEL_LEN + 2 * SSL3_RANDOM_SIZE)
+#define TLS_KTLS_SALT_LEN   4  /* implicit part of the GCM nonce */
+
+/* keys of both directions */
+typedef struct tls_ktls_keys {
+	unsigned char tx_key[32];
+	unsigned char rx_key[32];
+	unsigned char tx_salt[TLS_KTLS_SALT_LEN];
+	unsigned char rx_salt[TLS_KTLS_SALT_LEN];
+} tls_ktls_keys_t;
+
+/* set when the kernel has no tls support, to stop trying */
+static int tls_ktls_unavailable = 0;
+
+
+/**
+ * @brief Key length of the negotiated cipher, if usable with kTLS
+ * @return 16 or 32, 0 if the connection can't be offloaded
+ */
+static int tls_ktls_key_len(SSL* ssl)
+{
+	const char* name;
+
+	if (SSL_version(ssl) != TLS1_2_VERSION)
+		return 0;
+	name = SSL_get_cipher_name(ssl);
+	if (name == 0)
+		return 0;
+	if (strstr(name, "AES128-GCM-SHA256"))
+		return 16;
+#ifdef TLS_CIPHER_AES_GCM_256
+	if (strstr(name, "AES256-GCM-SHA384"))
+		return 32;
+#endif
+	return 0;
+}
+
+
+/**
+ * @brief TLS 1.2 P_hash (RFC 5246, section 5)
+ * @return 0 on success, -1 on error
+ */
+static int tls_ktls_p_hash(const EVP_MD* md, unsigned char* secret,
+						int secret_len, unsigned char* seed,
+						unsigned char* out, int out_len)
+{
+	unsigned char a[EVP_MAX_MD_SIZE + TLS_KTLS_SEED_LEN];
+	unsigned char h[EVP_MAX_MD_SIZE];
+	unsigned int a_len;
+	unsigned int h_len;
+	int n;
+
+	/* A(1) = HMAC(secret, seed), each block is HMAC(secret, A(i) + seed) */
+	if (HMAC(md, secret, secret_len, seed, TLS_KTLS_SEED_LEN, a, &a_len)
+			== 0)
+		return -1;
+	while (out_len > 0) {
+		memcpy(a + a_len, seed, TLS_KTLS_SEED_LEN);
+		if (HMAC(md, secret, secret_len, a, a_len + TLS_KTLS_SEED_LEN,
+					h, &h_len) == 0)
+			goto error;
+		n = (out_len < (int)h_len) ? out_len : (int)h_len;
+		memcpy(out, h, n);
+		out += n;
+		out_len -= n;
+		if (HMAC(md, secret, secret_len, a, a_len, h, &a_len) == 0)
+			goto error;
+		memcpy(a, h, a_len);
+	}
+	OPENSSL_cleanse(a, sizeof(a));
+	OPENSSL_cleanse(h, sizeof(h));
+	return 0;
+error:
+	OPENSSL_cleanse(a, sizeof(a));
+	OPENSSL_cleanse(h, sizeof(h));
+	return -1;
+}
+
+
+/**
+ * @brief Derive the record keys from the master secret
+ * @return 0 on success, -1 on error
+ */
+static int tls_ktls_keys(SSL* ssl, int key_len, int server,
+							tls_ktls_keys_t* k)
+{
+	unsigned char master[SSL_MAX_MASTER_KEY_LENGTH];
+	unsigned char seed[TLS_KTLS_SEED_LEN];
+	unsigned char block[2 * 32 + 2 * TLS_KTLS_SALT_LEN];
+	unsigned char* cli;
+	unsigned char* srv;
+	SSL_SESSION* sess;
+	int master_len;
+	int ret;
+
+	sess = SSL_get_session(ssl);
+	if (sess == 0)
+		return -1;
+	master_len = SSL_SESSION_get_master_key(sess, master, sizeof(master));
+	if (master_len <= 0)
+		return -1;
+	/* key_block = PRF(master, "key expansion", server_random +
+	 *                 client_random), no MAC keys for AEAD ciphers */
+	memcpy(seed, TLS_KTLS_LABEL, TLS_KTLS_LABEL_LEN);
+	SSL_get_server_random(ssl, seed + TLS_KTLS_LABEL_LEN, SSL3_RANDOM_SIZE);
+	SSL_get_client_random(ssl, seed + TLS_KTLS_LABEL_LEN + SSL3_RANDOM_SIZE,
+							SSL3_RANDOM_SIZE);
+	ret = tls_ktls_p_hash((key_len == 16) ? EVP_sha256() : EVP_sha384(),
+				master, master_len, seed, block,
+				2 * key_len + 2 * TLS_KTLS_SALT_LEN);
+	if (ret == 0) {
+		cli = block;
+		srv = block + key_len;
+		memcpy(server ? k->rx_key : k->tx_key, cli, key_len);
+		memcpy(server ? k->tx_key : k->rx_key, srv, key_len);
+		cli = block + 2 * key_len;
+		srv = cli + TLS_KTLS_SALT_LEN;
+		memcpy(server ? k->rx_salt : k->tx_salt, cli, TLS_KTLS_SALT_LEN);
+		memcpy(server ? k->tx_salt : k->rx_salt, srv, TLS_KTLS_SALT_LEN);
+	}
+	OPENSSL_cleanse(master, sizeof(master));
+	OPENSSL_cleanse(block, sizeof(block));
+	return ret;
+}
+
+
+/**
+ * @brief Pass the keys of one direction to the kernel
+ * @param dir TLS_TX or TLS_RX
+ * @return setsockopt() return
+ */
+static int tls_ktls_set(int fd, int dir, int key_len, unsigned char* key,
+						unsigned char* salt, unsigned long long seq)
+{
+	union {
+		struct tls12_crypto_info_aes_gcm_128 gcm128;
+#ifdef TLS_CIPHER_AES_GCM_256
+		struct tls12_crypto_info_aes_gcm_256 gcm256;
+#endif
+	} ci;
+	unsigned char rec_seq[8];
+	socklen_t len;
+	int ret;
+	int i;
+
+	for (i = 7; i >= 0; i--) {
+		rec_seq[i] = seq & 0xff;
+		seq >>= 8;
+	}
+	memset(&ci, 0, sizeof(ci));
+	/* the explicit nonce is the record sequence number, as openssl does */
+#ifdef TLS_CIPHER_AES_GCM_256
+	if (key_len == 32) {
+		ci.gcm256.info.version = TLS_1_2_VERSION;
+		ci.gcm256.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+		memcpy(ci.gcm256.key, key, key_len);
+		memcpy(ci.gcm256.salt, salt, TLS_KTLS_SALT_LEN);
+		memcpy(ci.gcm256.iv, rec_seq, sizeof(rec_seq));
+		memcpy(ci.gcm256.rec_seq, rec_seq, sizeof(rec_seq));
+		len = sizeof(ci.gcm256);
+	} else
+#endif
+	{
+		ci.gcm128.info.version = TLS_1_2_VERSION;
+		ci.gcm128.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+		memcpy(ci.gcm128.key, key, key_len);
+		memcpy(ci.gcm128.salt, salt, TLS_KTLS_SALT_LEN);
+		memcpy(ci.gcm128.iv, rec_seq, sizeof(rec_seq));
+		memcpy(ci.gcm128.rec_seq, rec_seq, sizeof(rec_seq));
+		len = sizeof(ci.gcm128);
+	}
+	ret = setsockopt(fd, SOL_TLS, dir, &ci, len);
+	OPENSSL_cleanse(&ci, sizeof(ci));
+	return ret;
+}
+
+#endif /* TLS_KTLS */
+
+
+
+int tls_ktls_supported(void)
+{
+#ifdef TLS_KTLS
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+
+/*
+ * Prepare a new connection for kTLS
+ */
+void tls_ktls_init_con(struct tls_extra_data* tls_c, tls_domain_t* dom)
+{
+#ifdef TLS_KTLS
+	/* a renegotiation would need new keys in the middle of the stream */
+	if (dom->ktls <= 0 || sr_tls_renegotiation || tls_ktls_unavailable)
+		return;
+	if (tls_BIO_mbuf_set_rec_cnt(tls_c->rwbio, &tls_c->rec_rd,
+									&tls_c->rec_wr) == 0)
+		return;
+	tls_c->flags |= F_TLS_CON_KTLS;
+#endif /* TLS_KTLS */
+}
+
+
+/*
+ * Try to switch an established connection to kTLS
+ */
+int tls_ktls_enable(struct tcp_connection* c, int fd, int rx_ok)
+{
+#ifdef TLS_KTLS
+	struct tls_extra_data* tls_c;
+	tls_ktls_keys_t k;
+	int key_len;
+	int tx;
+	int rx;
+
+	tls_c = (struct tls_extra_data*)c->extra_data;
+	if (tls_c->state != S_TLS_ESTABLISHED)
+		return 0;
+	/* tx: everything openssl wrote is already in the socket */
+	tx = !(tls_c->flags & F_TLS_CON_KTLS_TX)
+			&& tls_c->rec_wr.ccs && tls_rec_cnt_boundary(&tls_c->rec_wr)
+			&& !tls_write_wants_read(tls_c)
+			&& (tls_c->ct_wq == 0 || tls_c->ct_wq->queued == 0)
+#ifdef TCP_ASYNC
+			&& c->wbuf_q.first == 0
+#endif
+			;
+	/* rx: openssl consumed all the received data, up to a record end */
+	rx = rx_ok && !(tls_c->flags & F_TLS_CON_KTLS_RX)
+			&& tls_c->rec_rd.ccs && tls_rec_cnt_boundary(&tls_c->rec_rd)
+			&& SSL_pending(tls_c->ssl) == 0;
+	if (!tx && !rx)
+		return 0;
+
+	key_len = tls_ktls_key_len(tls_c->ssl);
+	if (key_len == 0) {
+		DBG("cipher %s not supported by kTLS\n",
+				SSL_get_cipher_name(tls_c->ssl));
+		goto fallback;
+	}
+	if (tls_ktls_keys(tls_c->ssl, key_len,
+				(c->flags & F_CONN_PASSIVE) ? 1 : 0, &k) < 0) {
+		ERR("failed to derive the kTLS keys\n");
+		goto fallback;
+	}
+	if (!(tls_c->flags & (F_TLS_CON_KTLS_TX | F_TLS_CON_KTLS_RX)) &&
+			setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) < 0) {
+		if (errno == ENOENT || errno == ENOPROTOOPT) {
+			INFO("kTLS not available (%s), using openssl\n",
+					strerror(errno));
+			tls_ktls_unavailable = 1;
+		} else {
+			DBG("TCP_ULP failed: %s\n", strerror(errno));
+		}
+		goto fallback_keys;
+	}
+	if (tx) {
+		if (tls_ktls_set(fd, TLS_TX, key_len, k.tx_key, k.tx_salt,
+							tls_c->rec_wr.seq) < 0) {
+			DBG("TLS_TX failed: %s\n", strerror(errno));
+			goto fallback_keys;
+		}
+		tls_c->flags |= F_TLS_CON_KTLS_TX;
+	}
+	if (rx) {
+		if (tls_ktls_set(fd, TLS_RX, key_len, k.rx_key, k.rx_salt,
+							tls_c->rec_rd.seq) < 0) {
+			DBG("TLS_RX failed: %s\n", strerror(errno));
+			goto fallback_keys;
+		}
+		tls_c->flags |= F_TLS_CON_KTLS_RX;
+	}
+	OPENSSL_cleanse(&k, sizeof(k));
+	DBG("kTLS enabled on %p (tx %d, rx %d)\n", c,
+			(tls_c->flags & F_TLS_CON_KTLS_TX) ? 1 : 0,
+			(tls_c->flags & F_TLS_CON_KTLS_RX) ? 1 : 0);
+	return 0;
+
+fallback_keys:
+	OPENSSL_cleanse(&k, sizeof(k));
+fallback:
+	/* the directions already offloaded stay so, nothing else is tried */
+	tls_c->flags &= ~F_TLS_CON_KTLS;
+	return -1;
+#else
+	return -1;
+#endif /* TLS_KTLS */
+}
+
+
+/*
+ * Send a close_notify alert through the kernel
+ */
+void tls_ktls_close_notify(int fd)
+{
+#ifdef TLS_KTLS
+	unsigned char alert[2] = { 1 /* warning */, 0 /* close_notify */ };
+	char cbuf[CMSG_SPACE(sizeof(unsigned char))];
+	struct msghdr msg;
+	struct cmsghdr* cmsg;
+	struct iovec iov;
+
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = alert;
+	iov.iov_len = sizeof(alert);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_TLS;
+	cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+	*CMSG_DATA(cmsg) = 21; /* alert */
+	/* it's a close, don't wait if it can't be sent immediately */
+	if (sendmsg(fd, &msg, MSG_DONTWAIT) < 0)
+		DBG("close_notify not sent: %s\n", strerror(errno));
+#endif /* TLS_KTLS */
+}
+
+
+/*
+ * Read the data decrypted by the kernel (tcp_read() replacement).
+ * Non data records are returned by the kernel one at a time, with their
+ * type in a TLS_GET_RECORD_TYPE control message (a plain read() would
+ * fail with EIO on them): a close_notify alert is handled as EOF, any
+ * other alert or a handshake message (renegotiation, not supported once
+ * the keys are in the kernel) as a read error.
+ */
+int tls_ktls_read(struct tcp_connection* c, int* flags)
+{
+#ifdef TLS_KTLS
+	char cbuf[CMSG_SPACE(sizeof(unsigned char))];
+	struct tcp_req* r;
+	struct msghdr msg;
+	struct cmsghdr* cmsg;
+	struct iovec iov;
+	unsigned char type;
+	int bytes_free;
+	int n;
+
+	r = &c->req;
+	bytes_free = r->b_size - (int)(r->pos - r->buf);
+	if (unlikely(bytes_free == 0)) {
+		ERR("Buffer overrun, dropping\n");
+		r->error = TCP_REQ_OVERRUN;
+		return -1;
+	}
+again:
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = r->pos;
+	iov.iov_len = bytes_free;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	n = recvmsg(c->fd, &msg, 0);
+	if (unlikely(n < 0)) {
+		if (errno == EINTR)
+			goto again;
+		if (errno == EAGAIN || errno == EWOULDBLOCK) {
+			*flags |= RD_CONN_SHORT_READ;
+			return 0;
+		}
+		LOG(cfg_get(core, core_cfg, corelog), "kTLS read error on %p: %s"
+				" (%d)\n", c, strerror(errno), errno);
+		r->error = TCP_READ_ERROR;
+		return -1;
+	}
+	type = TLS_KTLS_REC_DATA;
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if (cmsg && cmsg->cmsg_level == SOL_TLS &&
+			cmsg->cmsg_type == TLS_GET_RECORD_TYPE)
+		type = *(unsigned char*)CMSG_DATA(cmsg);
+	if (unlikely(type != TLS_KTLS_REC_DATA)) {
+		/* the record was read into the request buffer, drop it */
+		if (type == TLS_KTLS_REC_ALERT && n == 2 && r->pos[1] == 0) {
+			DBG("close_notify received on %p\n", c);
+			n = 0;
+		} else {
+			if (type == TLS_KTLS_REC_ALERT && n == 2)
+				ERR("TLS alert %d (level %d) received on %p\n",
+						(unsigned char)r->pos[1], (unsigned char)r->pos[0], c);
+			else
+				ERR("unexpected TLS record type %d (%d bytes) received on"
+						" %p\n", type, n, c);
+			r->error = TCP_READ_ERROR;
+			return -1;
+		}
+	}
+	if (n == 0 || (n < bytes_free && (*flags & RD_CONN_FORCE_EOF))) {
+		c->state = S_CONN_EOF;
+		*flags |= RD_CONN_EOF | RD_CONN_SHORT_READ;
+		DBG("EOF on %p, FD %d\n", c, c->fd);
+	} else if (n < bytes_free)
+		*flags |= RD_CONN_SHORT_READ;
+	r->pos += n;
+	return n;
+#else
+	return -1;
+#endif /* TLS_KTLS */
+}
@@ -0,0 +1,89 @@
+/*
+ * TLS module
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * SIP-router TLS support :: kernel TLS (Linux kTLS) offload
+ * @file
+ * @ingroup tls
+ * Module: @ref tls
+ *
+ * The handshake is done by openssl through the mbuf BIO as usual. Once
+ * established, for TLS 1.2 with AES-GCM, the record keys are derived from
+ * the master secret and the kernel is asked to encrypt (TLS_TX) and
+ * decrypt (TLS_RX) the following records, so that the data goes through
+ * the plain tcp send and read paths. Each direction is switched only at a
+ * point where the exact record sequence number is known (see
+ * struct tls_rec_cnt) and nothing is left in the user space buffers;
+ * otherwise, or if the kernel does not support it, the connection stays
+ * on openssl.
+ */
+
+#ifndef _TLS_KTLS_H
+#define _TLS_KTLS_H
+
+#include "../../tcp_conn.h"
+#include "tls_domain.h"
+#include "tls_server.h"
+
+/**
+ * @brief Returns true if kTLS support was compiled in
+ */
+int tls_ktls_supported(void);
+
+
+/**
+ * @brief Prepare a new connection for kTLS, if enabled in its domain
+ * @param tls_c connection tls data
+ * @param dom connection domain
+ */
+void tls_ktls_init_con(struct tls_extra_data* tls_c, tls_domain_t* dom);
+
+
+/**
+ * @brief Try to switch an established connection to kTLS
+ *
+ * Must be called by the reader with c->write_lock held, after all the
+ * openssl output was sent.
+ * @param c tcp connection
+ * @param fd connection fd
+ * @param rx_ok no received data left in openssl or in the read buffers
+ * @return 0, -1 if kTLS could not be enabled (the connection stays on
+ * openssl from now on)
+ */
+int tls_ktls_enable(struct tcp_connection* c, int fd, int rx_ok);
+
+
+/**
+ * @brief Send a close_notify alert on a connection encrypted by the kernel
+ * @param fd connection fd
+ */
+void tls_ktls_close_notify(int fd);
+
+
+/**
+ * @brief Read from a connection decrypted by the kernel (kTLS RX)
+ *
+ * Like tcp_read(), but it also receives the TLS control records: a
+ * close_notify alert is handled as EOF, anything else as an error.
+ * @param c tcp connection
+ * @param flags read flags (RD_CONN_*), value/result
+ * @return number of bytes read, 0 on EOF (or nothing to read), -1 on error
+ */
+int tls_ktls_read(struct tcp_connection* c, int* flags);
+
+#endif /* _TLS_KTLS_H */
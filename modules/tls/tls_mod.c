@@ -49,6 +49,7 @@
 #include "tls_util.h"
 #include "tls_mod.h"
 #include "tls_cfg.h"
+#include "tls_session.h"
 
 #ifndef TLS_HOOKS
 	#error "TLS_HOOKS must be defined, or the tls module won't work"
@@ -99,6 +100,7 @@ static tls_domain_t mod_params = {
 	{0, },                /* Cipher list */
 	TLS_USE_TLSv1,    /* TLS method */
 	STR_STATIC_INIT(TLS_CRL_FILE), /* Certificate revocation list */
+	0,                /* kTLS */
 	0                 /* next */
 };
 
@@ -120,6 +122,7 @@ tls_domain_t srv_defaults = {
 	{0, 0},                /* Cipher list */
 	TLS_USE_TLSv1,    /* TLS method */
 	STR_STATIC_INIT(TLS_CRL_FILE), /* Certificate revocation list */
+	0,                /* kTLS */
 	0                 /* next */
 };
 
@@ -141,6 +144,7 @@ tls_domain_t cli_defaults = {
 	{0, 0},                /* Cipher list */
 	TLS_USE_TLSv1,    /* TLS method */
 	{0, 0}, /* Certificate revocation list */
+	0,                /* kTLS */
 	0                 /* next */
 };
 
@@ -199,6 +203,11 @@ static param_export_t params[] = {
 	{"low_mem_threshold1",  PARAM_INT,    &default_tls_cfg.low_mem_threshold1},
 	{"low_mem_threshold2",  PARAM_INT,    &default_tls_cfg.low_mem_threshold2},
 	{"renegotiation",       PARAM_INT,    &sr_tls_renegotiation},
+	{"ktls",                PARAM_INT,    &mod_params.ktls},
+	{"session_cache_size",  PARAM_INT,    &tls_session_cache_size},
+	{"session_lifetime",    PARAM_INT,    &tls_session_lifetime},
+	{"session_tickets",     PARAM_INT,    &tls_session_tickets},
+	{"ticket_key_rotation", PARAM_INT,    &tls_ticket_key_rotation},
 	{0, 0, 0}
 };
 
@@ -330,6 +339,10 @@ static int mod_init(void)
 		ERR("Unable to initialize TLS buffering\n");
 		goto error;
 	}
+	if (tls_sess_init() < 0) {
+		ERR("Unable to initialize TLS session resumption\n");
+		goto error;
+	}
 	if (cfg_get(tls, tls_cfg, config_file).s) {
 		*tls_domains_cfg = 
 			tls_load_config(&cfg_get(tls, tls_cfg, config_file));
@@ -40,6 +40,7 @@
 #include "tls_ct_wrq.h"
 #include "tls_rpc.h"
 #include "tls_cfg.h"
+#include "tls_session.h"
 
 static const char* tls_reload_doc[2] = {
 	"Reload TLS configuration file",
@@ -112,6 +113,7 @@ static void tls_list(rpc_t* rpc, void* c)
 	void* handle;
 	char* tls_info;
 	char* state;
+	char* ktls;
 	struct tls_extra_data* tls_d;
 	struct tcp_connection* con;
 	int i, len, timeout;
@@ -166,23 +168,39 @@ static void tls_list(rpc_t* rpc, void* c)
 							state = "established";
 							break;
 					}
-					rpc->struct_add(handle, "sddds",
+					switch(tls_d->flags &
+							(F_TLS_CON_KTLS_TX | F_TLS_CON_KTLS_RX)) {
+						case F_TLS_CON_KTLS_TX | F_TLS_CON_KTLS_RX:
+							ktls = "tx+rx";
+							break;
+						case F_TLS_CON_KTLS_TX:
+							ktls = "tx";
+							break;
+						case F_TLS_CON_KTLS_RX:
+							ktls = "rx";
+							break;
+						default:
+							ktls = "no";
+					}
+					rpc->struct_add(handle, "sdddss",
 							"cipher", tls_info,
 							"ct_wq_size", tls_d->ct_wq?
 											tls_d->ct_wq->queued:0,
 							"enc_rd_buf", tls_d->enc_rd_buf?
 											tls_d->enc_rd_buf->size:0,
 							"flags", tls_d->flags,
-							"state", state
+							"state", state,
+							"ktls", ktls
 							);
 				lock_release(&con->write_lock);
 			} else {
-				rpc->struct_add(handle, "sddds",
+				rpc->struct_add(handle, "sdddss",
 						"cipher", "unknown",
 						"ct_wq_size", 0,
 						"enc_rd_buf", 0,
 						"flags", 0,
-						"state", "pre-init"
+						"state", "pre-init",
+						"ktls", "no"
 						);
 			}
 		}
@@ -203,10 +221,55 @@ static void tls_info(rpc_t* rpc, void* c)
 
 	tcp_get_info(&ti);
 	rpc->add(c, "{", &handle);
-	rpc->struct_add(handle, "ddd",
+	rpc->struct_add(handle, "ddddd",
 			"max_connections", ti.tls_max_connections,
 			"opened_connections", ti.tls_connections_no,
-			"clear_text_write_queued_bytes", tls_ct_wq_total_bytes());
+			"clear_text_write_queued_bytes", tls_ct_wq_total_bytes(),
+			"session_cache_entries", tls_sess_cache_entries(),
+			"ticket_key_rotations", tls_sess_ticket_rotations());
+}
+
+
+
+static const char* tls_sessions_doc[2] = {
+	"Session resumption statistics of the TLS domains.",
+	0 };
+
+static void tls_sessions_domain(rpc_t* rpc, void* c, tls_domain_t* d)
+{
+	void* handle;
+	int handshakes;
+	int resumed;
+
+	handshakes = atomic_get(&d->sess_stats.handshakes);
+	resumed = atomic_get(&d->sess_stats.resumed);
+	rpc->add(c, "{", &handle);
+	rpc->struct_add(handle, "sddddd",
+			"domain", tls_domain_str(d),
+			"handshakes", handshakes,
+			"resumed", resumed,
+			"hit_rate", handshakes ? (int)(100LL * resumed / handshakes) : 0,
+			"cache_hits", atomic_get(&d->sess_stats.cache_hits),
+			"cache_misses", atomic_get(&d->sess_stats.cache_misses));
+}
+
+static void tls_sessions(rpc_t* rpc, void* c)
+{
+	tls_domains_cfg_t* cfg;
+	tls_domain_t* d;
+
+	/* the current configuration is not freed while the lock is held */
+	lock_get(tls_domains_cfg_lock);
+	cfg = *tls_domains_cfg;
+	if (cfg->srv_default)
+		tls_sessions_domain(rpc, c, cfg->srv_default);
+	for (d = cfg->srv_list; d; d = d->next)
+		tls_sessions_domain(rpc, c, d);
+	if (cfg->cli_default)
+		tls_sessions_domain(rpc, c, cfg->cli_default);
+	for (d = cfg->cli_list; d; d = d->next)
+		tls_sessions_domain(rpc, c, d);
+	lock_release(tls_domains_cfg_lock);
 }
 
 
@@ -258,5 +321,6 @@ rpc_export_t tls_rpc[] = {
 	{"tls.list",   tls_list,   tls_list_doc,   RET_ARRAY},
 	{"tls.info",   tls_info,   tls_info_doc, 0},
 	{"tls.options",tls_options, tls_options_doc, 0},
+	{"tls.sessions", tls_sessions, tls_sessions_doc, RET_ARRAY},
 	{0, 0, 0, 0}
 };
@@ -55,6 +55,8 @@
 #include "tls_bio.h"
 #include "tls_dump_vf.h"
 #include "tls_cfg.h"
+#include "tls_session.h"
+#include "tls_ktls.h"
 
 /* low memory treshold for openssl bug #1491 workaround */
 #define LOW_MEM_NEW_CONNECTION_TEST() \
@@ -208,6 +210,8 @@ static int tls_complete_init(struct tcp_connection* c)
 
 	/* link the extra data struct inside ssl connection*/
 	SSL_set_app_data(data->ssl, data);
+	tls_sess_set_con(data->ssl, c);
+	tls_ktls_init_con(data, dom);
 
 	return 0;
 
@@ -347,6 +351,7 @@ int tls_accept(struct tcp_connection *c, int* error)
 	if (unlikely(ret == 1)) {
 		DBG("TLS accept successful\n");
 		tls_c->state = S_TLS_ESTABLISHED;
+		tls_sess_handshake(ssl);
 		tls_log = cfg_get(tls, tls_cfg, log);
 		LOG(tls_log, "tls_accept: new connection from %s:%d using %s %s %d\n",
 		    ip_addr2a(&c->rcv.src_ip), c->rcv.src_port,
@@ -412,6 +417,7 @@ int tls_connect(struct tcp_connection *c, int* error)
 	if (unlikely(ret == 1)) {
 		DBG("TLS connect successful\n");
 		tls_c->state = S_TLS_ESTABLISHED;
+		tls_sess_handshake(ssl);
 		tls_log = cfg_get(tls, tls_cfg, log);
 		LOG(tls_log, "tls_connect: new connection to %s:%d using %s %s %d\n", 
 		    ip_addr2a(&c->rcv.src_ip), c->rcv.src_port,
@@ -602,6 +608,13 @@ void tls_h_close(struct tcp_connection *c, int fd)
 				lock_release(&c->write_lock);
 				return;
 			}
+			if (((struct tls_extra_data*)c->extra_data)->flags &
+					F_TLS_CON_KTLS_TX) {
+				/* openssl is no longer in sync with the kernel state */
+				tls_ktls_close_notify(fd);
+				lock_release(&c->write_lock);
+				return;
+			}
 			tls_mbuf_init(&rd, 0, 0); /* no read */
 			tls_mbuf_init(&wr, wr_buf, sizeof(wr_buf));
 			if (tls_set_mbufs(c, &rd, &wr)==0) {
@@ -689,6 +702,11 @@ int tls_encode_f(struct tcp_connection *c,
 		return -1;
 	}
 	tls_c = (struct tls_extra_data*)c->extra_data;
+	if (tls_c->flags & F_TLS_CON_KTLS_TX) {
+		/* encrypted by the kernel, send the clear text as it is */
+		TLS_WR_TRACE("(%p) end: kTLS => %d\n", c, *plen);
+		return *plen;
+	}
 	ssl = tls_c->ssl;
 	tls_mbuf_init(&rd, 0, 0); /* no read */
 	tls_mbuf_init(&wr, wr_buf, sizeof(wr_buf));
@@ -927,6 +945,9 @@ int tls_read_f(struct tcp_connection* c, int* flags)
 	   If it's != 0 is changed only on destroy. It's not possible to have
 	   parallel reads.*/
 	tls_c = c->extra_data;
+	if (tls_c->flags & F_TLS_CON_KTLS_RX)
+		/* decrypted by the kernel */
+		return tls_ktls_read(c, flags);
 	bytes_free = c->req.b_size - (int)(r->pos - r->buf);
 	if (unlikely(bytes_free == 0)) {
 		ERR("Buffer overrun, dropping\n");
@@ -1121,6 +1142,9 @@ continue_ssl_read:
 ssl_read_skipped:
 			;
 		}
+		if (unlikely(tls_c->flags & F_TLS_CON_KTLS_TX))
+			/* can't be sent anymore, openssl is out of sync */
+			wr.used = 0;
 		if (unlikely(wr.used != 0 && ssl_error != SSL_ERROR_ZERO_RETURN)) {
 			TLS_RD_TRACE("(%p, %p) tcpconn_send_unsafe %d bytes\n",
 							c, flags, wr.used);
@@ -1133,6 +1157,10 @@ ssl_read_skipped:
 				goto error_send;
 			}
 		}
+		if (unlikely(tls_c->flags & F_TLS_CON_KTLS))
+			/* all the openssl output is sent, try switching to kTLS */
+			tls_ktls_enable(c, c->fd, ssl_error == SSL_ERROR_WANT_READ &&
+								rd.pos == rd.used && tls_c->enc_rd_buf == 0);
 	/* quickly catch bugs: segfault if accessed and not set */
 	tls_set_mbufs(c, 0, 0);
 	lock_release(&c->write_lock);
@@ -1158,6 +1186,13 @@ ssl_read_skipped:
 						rd.used - rd.pos, rd.pos);
 				goto bug;
 			}
+			if (unlikely(tls_c->flags & F_TLS_CON_KTLS_RX)) {
+				/* the next records are decrypted by the kernel */
+				if ((*flags & (RD_CONN_EOF | RD_CONN_SHORT_READ)) == 0 &&
+						bytes_free)
+					*flags |= RD_CONN_REPEAT_READ;
+				goto end;
+			}
 			if (unlikely((*flags & (RD_CONN_EOF | RD_CONN_SHORT_READ)) == 0) &&
 							bytes_free){
 				/* there might still be data to read and there is space
@@ -31,6 +31,7 @@
 #include "../../tcp_conn.h"
 #include "tls_domain.h"
 #include "tls_ct_wrq.h"
+#include "tls_bio.h"
 
 enum tls_conn_states {
 						S_TLS_NONE = 0,
@@ -49,6 +50,10 @@ struct tls_rd_buf {
 #define F_TLS_CON_WR_WANTS_RD    1 /* write wants read */
 #define F_TLS_CON_HANDSHAKED     2 /* connection is handshaked */
 #define F_TLS_CON_RENEGOTIATION  4 /* renegotiation by clinet */
+#define F_TLS_CON_KTLS           8 /* kTLS enabled in the domain and
+										still possible on the connection */
+#define F_TLS_CON_KTLS_TX       16 /* encryption done by the kernel */
+#define F_TLS_CON_KTLS_RX       32 /* decryption done by the kernel */
 
 struct tls_extra_data {
 	tls_domains_cfg_t* cfg; /* Configuration used for this connection */
@@ -60,6 +65,8 @@ struct tls_extra_data {
 	struct tls_rd_buf* enc_rd_buf;
 	unsigned int flags;
 	enum  tls_conn_states state;
+	struct tls_rec_cnt rec_rd; /* records read and written, counted */
+	struct tls_rec_cnt rec_wr; /* only if F_TLS_CON_KTLS */
 };
 
 
@@ -0,0 +1,700 @@
+/*
+ * TLS module
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * SIP-router TLS support :: session resumption shared by all the processes
+ * @file
+ * @ingroup tls
+ * Module: @ref tls
+ */
+
+#include <string.h>
+#include <time.h>
+#include <openssl/ssl.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/opensslv.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+# include <openssl/core_names.h>
+# include <openssl/params.h>
+#else
+# include <openssl/hmac.h>
+#endif
+#include "../../dprint.h"
+#include "../../hashes.h"
+#include "../../locking.h"
+#include "../../timer.h"
+#include "../../mem/shm_mem.h"
+#include "tls_session.h"
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L || \
+	defined SSL_CTX_set_tlsext_ticket_key_cb
+#define TLS_SESS_TICKETS
+#endif
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+#define TLS_SESS_ID_CONST const
+#else
+#define TLS_SESS_ID_CONST
+#endif
+
+#define TLS_SESS_HASH_SIZE  1024  /* must be a power of 2 */
+#define TLS_SESS_LOCKS      64
+#define TLS_SESS_KEY_MAX    64    /* domain tag + session id or peer */
+#define TLS_SESS_DER_MAX    16384 /* larger sessions are not cached */
+
+int tls_session_cache_size = 16384;
+int tls_session_lifetime = 3600;
+int tls_session_tickets = 1;
+int tls_ticket_key_rotation = 3600;
+
+
+/* cached session, the key and the DER encoded session follow the
+ * structure */
+typedef struct tls_sess {
+	struct tls_sess* next;
+	struct tls_sess* prev;
+	unsigned int hash;
+	time_t expires;
+	unsigned int key_len;
+	unsigned int der_len;
+} tls_sess_t;
+
+typedef struct tls_sess_cache {
+	atomic_t entries;
+	tls_sess_t* table[TLS_SESS_HASH_SIZE];
+} tls_sess_cache_t;
+
+typedef struct tls_ticket_key {
+	unsigned char name[16];
+	unsigned char aes_key[32];
+	unsigned char hmac_key[32];
+} tls_ticket_key_t;
+
+/* keys[0] encrypts the new tickets, keys[1] (the previous one) is still
+ * accepted until the next rotation */
+typedef struct tls_ticket_keys {
+	gen_lock_t lock;
+	tls_ticket_key_t keys[2];
+	int keys_no;
+	unsigned int rotations;
+} tls_ticket_keys_t;
+
+static tls_sess_cache_t* tls_sess_cache = 0;
+static gen_lock_set_t* tls_sess_locks = 0;
+static tls_ticket_keys_t* tls_ticket_keys = 0;
+
+static int tls_sess_dom_idx = -1; /* SSL_CTX ex_data: tls_domain_t */
+static int tls_sess_con_idx = -1; /* SSL ex_data: tcp_connection */
+
+#define tls_sess_lock(h)    lock_set_get(tls_sess_locks, (h)%TLS_SESS_LOCKS)
+#define tls_sess_unlock(h)  lock_set_release(tls_sess_locks, \
+								(h)%TLS_SESS_LOCKS)
+#define tls_sess_key(e)     ((unsigned char*)((e)+1))
+#define tls_sess_der(e)     (tls_sess_key(e)+(e)->key_len)
+
+
+
+/**
+ * @brief Build a cache key: domain tag followed by the session id or peer
+ * @return key length
+ */
+static int tls_sess_mk_key(tls_domain_t* d, const unsigned char* id,
+							int id_len, unsigned char* key)
+{
+	int len;
+
+	len = 0;
+	key[len++] = (unsigned char)d->type;
+	key[len++] = d->port >> 8;
+	key[len++] = d->port & 0xff;
+	key[len++] = d->ip.len;
+	memcpy(key + len, d->ip.u.addr, d->ip.len);
+	len += d->ip.len;
+	memcpy(key + len, id, id_len);
+	return len + id_len;
+}
+
+
+/**
+ * @brief Build the cache key of a client session (by peer address)
+ * @return key length
+ */
+static int tls_sess_peer_key(tls_domain_t* d, struct tcp_connection* c,
+								unsigned char* key)
+{
+	unsigned char peer[sizeof(c->rcv.src_ip.u.addr) + 2];
+	int len;
+
+	len = c->rcv.src_ip.len;
+	memcpy(peer, c->rcv.src_ip.u.addr, len);
+	peer[len++] = c->rcv.src_port >> 8;
+	peer[len++] = c->rcv.src_port & 0xff;
+	return tls_sess_mk_key(d, peer, len, key);
+}
+
+
+/* unlinks and frees an entry, the slot must be locked */
+static void tls_sess_unlink(unsigned int idx, tls_sess_t* e)
+{
+	if (e->prev)
+		e->prev->next = e->next;
+	else
+		tls_sess_cache->table[idx] = e->next;
+	if (e->next)
+		e->next->prev = e->prev;
+	atomic_dec(&tls_sess_cache->entries);
+	shm_free(e);
+}
+
+
+/* returns the entry with the given key, dropping the expired ones on the
+ * way; the slot must be locked */
+static tls_sess_t* tls_sess_find(unsigned int idx, unsigned int h,
+								unsigned char* key, int key_len, time_t now)
+{
+	tls_sess_t* e;
+	tls_sess_t* next;
+
+	for (e = tls_sess_cache->table[idx]; e; e = next) {
+		next = e->next;
+		if (e->expires <= now) {
+			tls_sess_unlink(idx, e);
+			continue;
+		}
+		if (e->hash == h && e->key_len == key_len
+				&& memcmp(tls_sess_key(e), key, key_len) == 0)
+			return e;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief Add a session to the shared cache, replacing the one with the
+ * same key
+ */
+static void tls_sess_store(unsigned char* key, int key_len,
+							SSL_SESSION* sess)
+{
+	tls_sess_t* e;
+	tls_sess_t* old;
+	unsigned char* p;
+	unsigned int h;
+	unsigned int idx;
+	time_t now;
+	int len;
+
+	len = i2d_SSL_SESSION(sess, 0);
+	if (len <= 0 || len > TLS_SESS_DER_MAX)
+		return;
+	e = (tls_sess_t*)shm_malloc(sizeof(tls_sess_t) + key_len + len);
+	if (e == 0) {
+		ERR("no more shm memory\n");
+		return;
+	}
+	e->key_len = key_len;
+	e->der_len = len;
+	memcpy(tls_sess_key(e), key, key_len);
+	p = tls_sess_der(e);
+	i2d_SSL_SESSION(sess, &p);
+	e->expires = SSL_SESSION_get_time(sess) + SSL_SESSION_get_timeout(sess);
+	h = get_hash1_raw((char*)key, key_len);
+	e->hash = h;
+	idx = h & (TLS_SESS_HASH_SIZE - 1);
+	now = time(0);
+
+	tls_sess_lock(idx);
+	old = tls_sess_find(idx, h, key, key_len, now);
+	if (old) {
+		tls_sess_unlink(idx, old);
+	} else if (atomic_get(&tls_sess_cache->entries) >=
+					tls_session_cache_size) {
+		/* full: make room by dropping the oldest session of the slot */
+		for (old = tls_sess_cache->table[idx]; old && old->next;
+				old = old->next);
+		if (old == 0) {
+			tls_sess_unlock(idx);
+			shm_free(e);
+			return;
+		}
+		tls_sess_unlink(idx, old);
+	}
+	e->prev = 0;
+	e->next = tls_sess_cache->table[idx];
+	if (e->next)
+		e->next->prev = e;
+	tls_sess_cache->table[idx] = e;
+	atomic_inc(&tls_sess_cache->entries);
+	tls_sess_unlock(idx);
+}
+
+
+/**
+ * @brief Get a copy of a cached session
+ * @return new SSL_SESSION (owned by the caller) or 0 if not found
+ */
+static SSL_SESSION* tls_sess_fetch(unsigned char* key, int key_len)
+{
+	tls_sess_t* e;
+	SSL_SESSION* sess;
+	const unsigned char* p;
+	unsigned int h;
+	unsigned int idx;
+
+	sess = 0;
+	h = get_hash1_raw((char*)key, key_len);
+	idx = h & (TLS_SESS_HASH_SIZE - 1);
+	tls_sess_lock(idx);
+	e = tls_sess_find(idx, h, key, key_len, time(0));
+	if (e) {
+		p = tls_sess_der(e);
+		sess = d2i_SSL_SESSION(0, &p, e->der_len);
+	}
+	tls_sess_unlock(idx);
+	return sess;
+}
+
+
+/**
+ * @brief Remove a session from the shared cache
+ */
+static void tls_sess_remove(unsigned char* key, int key_len)
+{
+	tls_sess_t* e;
+	unsigned int h;
+	unsigned int idx;
+
+	h = get_hash1_raw((char*)key, key_len);
+	idx = h & (TLS_SESS_HASH_SIZE - 1);
+	tls_sess_lock(idx);
+	e = tls_sess_find(idx, h, key, key_len, time(0));
+	if (e)
+		tls_sess_unlink(idx, e);
+	tls_sess_unlock(idx);
+}
+
+
+
+/* openssl external session cache callbacks */
+
+static int tls_sess_new_cb(SSL* ssl, SSL_SESSION* sess)
+{
+	tls_domain_t* d;
+	struct tcp_connection* c;
+	unsigned char key[TLS_SESS_KEY_MAX];
+	const unsigned char* id;
+	unsigned int id_len;
+	int key_len;
+
+	d = SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), tls_sess_dom_idx);
+	if (d == 0)
+		return 0;
+	if (d->type & TLS_DOMAIN_CLI) {
+		c = SSL_get_ex_data(ssl, tls_sess_con_idx);
+		if (c == 0)
+			return 0;
+		key_len = tls_sess_peer_key(d, c, key);
+	} else {
+		id = SSL_SESSION_get_id(sess, &id_len);
+		if (id_len == 0)
+			return 0;
+		key_len = tls_sess_mk_key(d, id, id_len, key);
+	}
+	tls_sess_store(key, key_len, sess);
+	/* the session was serialized, no reference is kept */
+	return 0;
+}
+
+
+static SSL_SESSION* tls_sess_get_cb(SSL* ssl, TLS_SESS_ID_CONST
+									unsigned char* id, int id_len, int* copy)
+{
+	tls_domain_t* d;
+	SSL_SESSION* sess;
+	unsigned char key[TLS_SESS_KEY_MAX];
+
+	*copy = 0;
+	d = SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), tls_sess_dom_idx);
+	if (d == 0 || id_len <= 0 || id_len > SSL_MAX_SSL_SESSION_ID_LENGTH)
+		return 0;
+	sess = tls_sess_fetch(key, tls_sess_mk_key(d, id, id_len, key));
+	if (sess)
+		atomic_inc(&d->sess_stats.cache_hits);
+	else
+		atomic_inc(&d->sess_stats.cache_misses);
+	return sess;
+}
+
+
+static void tls_sess_remove_cb(SSL_CTX* ctx, SSL_SESSION* sess)
+{
+	tls_domain_t* d;
+	unsigned char key[TLS_SESS_KEY_MAX];
+	const unsigned char* id;
+	unsigned int id_len;
+
+	d = SSL_CTX_get_ex_data(ctx, tls_sess_dom_idx);
+	/* client sessions are replaced by the next handshake with the peer */
+	if (d == 0 || (d->type & TLS_DOMAIN_CLI))
+		return;
+	id = SSL_SESSION_get_id(sess, &id_len);
+	if (id_len == 0)
+		return;
+	tls_sess_remove(key, tls_sess_mk_key(d, id, id_len, key));
+}
+
+
+
+#ifdef TLS_SESS_TICKETS
+
+/**
+ * @brief Generate a new random ticket key
+ * @return 0 on success, -1 on error
+ */
+static int tls_ticket_key_new(tls_ticket_key_t* k)
+{
+	if (RAND_bytes(k->name, sizeof(k->name)) <= 0
+			|| RAND_bytes(k->aes_key, sizeof(k->aes_key)) <= 0
+			|| RAND_bytes(k->hmac_key, sizeof(k->hmac_key)) <= 0) {
+		ERR("failed to generate a session ticket key\n");
+		return -1;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief Timer callback replacing the current ticket key
+ */
+static void tls_ticket_key_rotate(unsigned int ticks, void* param)
+{
+	tls_ticket_key_t k;
+
+	if (tls_ticket_key_new(&k) < 0)
+		return;
+	lock_get(&tls_ticket_keys->lock);
+	tls_ticket_keys->keys[1] = tls_ticket_keys->keys[0];
+	tls_ticket_keys->keys[0] = k;
+	tls_ticket_keys->keys_no = 2;
+	tls_ticket_keys->rotations++;
+	lock_release(&tls_ticket_keys->lock);
+	OPENSSL_cleanse(&k, sizeof(k));
+	DBG("session ticket key rotated\n");
+}
+
+
+/**
+ * @brief Get the key for a new ticket (enc) or the one a ticket was
+ * encrypted with
+ * @return 1 for the current key, 2 for the previous one (the ticket should
+ * be renewed), 0 if not found
+ */
+static int tls_ticket_key_get(unsigned char* name, int enc,
+								tls_ticket_key_t* k)
+{
+	int i;
+	int ret;
+
+	ret = 0;
+	lock_get(&tls_ticket_keys->lock);
+	if (enc) {
+		*k = tls_ticket_keys->keys[0];
+		memcpy(name, k->name, sizeof(k->name));
+		ret = 1;
+	} else {
+		for (i = 0; i < tls_ticket_keys->keys_no; i++) {
+			if (memcmp(name, tls_ticket_keys->keys[i].name,
+						sizeof(k->name)) == 0) {
+				*k = tls_ticket_keys->keys[i];
+				ret = i + 1;
+				break;
+			}
+		}
+	}
+	lock_release(&tls_ticket_keys->lock);
+	return ret;
+}
+
+
+/**
+ * @brief Setup the ticket cipher, common part of the ticket key callbacks
+ * @return see tls_ticket_key_get(), -1 on error
+ */
+static int tls_ticket_cipher_init(unsigned char* name, unsigned char* iv,
+						EVP_CIPHER_CTX* ectx, int enc, tls_ticket_key_t* k)
+{
+	int ret;
+
+	if (enc && RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) <= 0)
+		return -1;
+	ret = tls_ticket_key_get(name, enc, k);
+	if (ret <= 0)
+		return ret;
+	if (enc)
+		EVP_EncryptInit_ex(ectx, EVP_aes_256_cbc(), 0, k->aes_key, iv);
+	else
+		EVP_DecryptInit_ex(ectx, EVP_aes_256_cbc(), 0, k->aes_key, iv);
+	return ret;
+}
+
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+static int tls_ticket_key_cb(SSL* ssl, unsigned char* name, unsigned char* iv,
+						EVP_CIPHER_CTX* ectx, EVP_MAC_CTX* hctx, int enc)
+{
+	tls_ticket_key_t k;
+	OSSL_PARAM params[2];
+	int ret;
+
+	ret = tls_ticket_cipher_init(name, iv, ectx, enc, &k);
+	if (ret > 0) {
+		params[0] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+							"SHA256", 0);
+		params[1] = OSSL_PARAM_construct_end();
+		if (EVP_MAC_init(hctx, k.hmac_key, sizeof(k.hmac_key), params) != 1)
+			ret = -1;
+	}
+	OPENSSL_cleanse(&k, sizeof(k));
+	return ret;
+}
+#else
+static int tls_ticket_key_cb(SSL* ssl, unsigned char* name, unsigned char* iv,
+						EVP_CIPHER_CTX* ectx, HMAC_CTX* hctx, int enc)
+{
+	tls_ticket_key_t k;
+	int ret;
+
+	ret = tls_ticket_cipher_init(name, iv, ectx, enc, &k);
+	if (ret > 0)
+		HMAC_Init_ex(hctx, k.hmac_key, sizeof(k.hmac_key), EVP_sha256(), 0);
+	OPENSSL_cleanse(&k, sizeof(k));
+	return ret;
+}
+#endif /* openssl >= 3.0.0 */
+
+#endif /* TLS_SESS_TICKETS */
+
+
+
+/*
+ * Init the shared session cache and ticket keys
+ */
+int tls_sess_init(void)
+{
+	tls_sess_dom_idx = SSL_CTX_get_ex_new_index(0, "tls domain", 0, 0, 0);
+	tls_sess_con_idx = SSL_get_ex_new_index(0, "tcp connection", 0, 0, 0);
+	if (tls_sess_dom_idx < 0 || tls_sess_con_idx < 0) {
+		ERR("failed to get the openssl ex_data indexes\n");
+		return -1;
+	}
+
+	if (tls_session_cache_size > 0) {
+		tls_sess_cache = shm_malloc(sizeof(tls_sess_cache_t));
+		if (tls_sess_cache == 0) {
+			ERR("no more shm memory\n");
+			goto error;
+		}
+		memset(tls_sess_cache, 0, sizeof(tls_sess_cache_t));
+		atomic_set(&tls_sess_cache->entries, 0);
+		tls_sess_locks = lock_set_alloc(TLS_SESS_LOCKS);
+		if (tls_sess_locks == 0 || lock_set_init(tls_sess_locks) == 0) {
+			ERR("failed to init the session cache locks\n");
+			if (tls_sess_locks) {
+				lock_set_dealloc(tls_sess_locks);
+				tls_sess_locks = 0;
+			}
+			goto error;
+		}
+	}
+
+#ifdef TLS_SESS_TICKETS
+	if (tls_session_tickets) {
+		tls_ticket_keys = shm_malloc(sizeof(tls_ticket_keys_t));
+		if (tls_ticket_keys == 0) {
+			ERR("no more shm memory\n");
+			goto error;
+		}
+		memset(tls_ticket_keys, 0, sizeof(tls_ticket_keys_t));
+		if (lock_init(&tls_ticket_keys->lock) == 0) {
+			ERR("failed to init the ticket keys lock\n");
+			goto error;
+		}
+		if (tls_ticket_key_new(&tls_ticket_keys->keys[0]) < 0)
+			goto error;
+		tls_ticket_keys->keys_no = 1;
+		if (tls_ticket_key_rotation > 0 &&
+				register_timer(tls_ticket_key_rotate, 0,
+					tls_ticket_key_rotation) < 0) {
+			ERR("failed to register the ticket key rotation timer\n");
+			goto error;
+		}
+	}
+#else
+	if (tls_session_tickets)
+		WARN("session tickets not supported by this openssl version\n");
+#endif /* TLS_SESS_TICKETS */
+	return 0;
+
+error:
+	tls_sess_destroy();
+	return -1;
+}
+
+
+/*
+ * Free the shared session cache and ticket keys
+ */
+void tls_sess_destroy(void)
+{
+	tls_sess_t* e;
+	int i;
+
+	if (tls_sess_cache) {
+		for (i = 0; i < TLS_SESS_HASH_SIZE; i++) {
+			while (tls_sess_cache->table[i]) {
+				e = tls_sess_cache->table[i];
+				tls_sess_cache->table[i] = e->next;
+				shm_free(e);
+			}
+		}
+		shm_free(tls_sess_cache);
+		tls_sess_cache = 0;
+	}
+	if (tls_sess_locks) {
+		lock_set_destroy(tls_sess_locks);
+		lock_set_dealloc(tls_sess_locks);
+		tls_sess_locks = 0;
+	}
+	if (tls_ticket_keys) {
+		lock_destroy(&tls_ticket_keys->lock);
+		OPENSSL_cleanse(tls_ticket_keys, sizeof(tls_ticket_keys_t));
+		shm_free(tls_ticket_keys);
+		tls_ticket_keys = 0;
+	}
+}
+
+
+/*
+ * Setup session caching and tickets on a domain SSL_CTX
+ */
+void tls_sess_setup_ctx(tls_domain_t* d, SSL_CTX* ctx, int cache)
+{
+	SSL_CTX_set_ex_data(ctx, tls_sess_dom_idx, d);
+	if (tls_session_lifetime > 0)
+		SSL_CTX_set_timeout(ctx, tls_session_lifetime);
+
+	if (cache && tls_sess_cache) {
+		/* only the shared cache is used, the internal one would be
+		 * per process */
+		SSL_CTX_set_session_cache_mode(ctx,
+				((d->type & TLS_DOMAIN_CLI) ? SSL_SESS_CACHE_CLIENT :
+					SSL_SESS_CACHE_SERVER) |
+				SSL_SESS_CACHE_NO_INTERNAL |
+				SSL_SESS_CACHE_NO_AUTO_CLEAR);
+		SSL_CTX_sess_set_new_cb(ctx, tls_sess_new_cb);
+		SSL_CTX_sess_set_get_cb(ctx, tls_sess_get_cb);
+		SSL_CTX_sess_set_remove_cb(ctx, tls_sess_remove_cb);
+	} else {
+		SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+	}
+
+	if (d->type & TLS_DOMAIN_CLI)
+		return;
+#ifdef TLS_SESS_TICKETS
+	if (tls_ticket_keys) {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, tls_ticket_key_cb);
+#else
+		SSL_CTX_set_tlsext_ticket_key_cb(ctx, tls_ticket_key_cb);
+#endif
+		return;
+	}
+#endif /* TLS_SESS_TICKETS */
+#ifdef SSL_OP_NO_TICKET
+	/* the default ticket keys are random per SSL_CTX, i.e. per process */
+	if (tls_session_tickets == 0)
+		SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+#endif
+}
+
+
+/*
+ * Link a new SSL to its connection and offer the cached peer session
+ */
+void tls_sess_set_con(SSL* ssl, struct tcp_connection* c)
+{
+	tls_domain_t* d;
+	SSL_SESSION* sess;
+	unsigned char key[TLS_SESS_KEY_MAX];
+
+	SSL_set_ex_data(ssl, tls_sess_con_idx, c);
+	if (c->flags & F_CONN_PASSIVE)
+		return;
+	if (!(SSL_CTX_get_session_cache_mode(SSL_get_SSL_CTX(ssl))
+				& SSL_SESS_CACHE_CLIENT))
+		return;
+	d = SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), tls_sess_dom_idx);
+	if (d == 0)
+		return;
+	sess = tls_sess_fetch(key, tls_sess_peer_key(d, c, key));
+	if (sess == 0) {
+		atomic_inc(&d->sess_stats.cache_misses);
+		return;
+	}
+	atomic_inc(&d->sess_stats.cache_hits);
+	if (SSL_set_session(ssl, sess) != 1)
+		DBG("cached session for %s:%d not usable\n",
+				ip_addr2a(&c->rcv.src_ip), c->rcv.src_port);
+	SSL_SESSION_free(sess);
+}
+
+
+/*
+ * Update the domain resumption counters
+ */
+void tls_sess_handshake(SSL* ssl)
+{
+	tls_domain_t* d;
+
+	d = SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), tls_sess_dom_idx);
+	if (d == 0)
+		return;
+	atomic_inc(&d->sess_stats.handshakes);
+	if (SSL_session_reused(ssl))
+		atomic_inc(&d->sess_stats.resumed);
+}
+
+
+int tls_sess_cache_entries(void)
+{
+	return tls_sess_cache ? atomic_get(&tls_sess_cache->entries) : 0;
+}
+
+
+unsigned int tls_sess_ticket_rotations(void)
+{
+	unsigned int n;
+
+	if (tls_ticket_keys == 0)
+		return 0;
+	lock_get(&tls_ticket_keys->lock);
+	n = tls_ticket_keys->rotations;
+	lock_release(&tls_ticket_keys->lock);
+	return n;
+}
@@ -0,0 +1,96 @@
+/*
+ * TLS module
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * SIP-router TLS support :: session resumption shared by all the processes
+ * @file
+ * @ingroup tls
+ * Module: @ref tls
+ *
+ * Every process has its own SSL_CTX, so neither the internal openssl
+ * session cache nor the default (random per SSL_CTX) session ticket keys
+ * allow resuming a session on a connection handled by another process.
+ * The sessions are kept instead in a shm hash table plugged in the
+ * external session cache callbacks (server sessions by session id, client
+ * ones by peer address) and the RFC 5077 ticket keys are kept in shm and
+ * rotated by a timer.
+ */
+
+#ifndef _TLS_SESSION_H
+#define _TLS_SESSION_H
+
+#include <openssl/ssl.h>
+#include "../../tcp_conn.h"
+#include "tls_domain.h"
+
+extern int tls_session_cache_size;   /**< max. cached sessions */
+extern int tls_session_lifetime;     /**< session timeout (s) */
+extern int tls_session_tickets;      /**< use the shared ticket keys */
+extern int tls_ticket_key_rotation;  /**< ticket key lifetime (s) */
+
+
+/**
+ * @brief Init the shared session cache and ticket keys (from mod_init)
+ * @return 0 on success, -1 on error
+ */
+int tls_sess_init(void);
+
+
+/**
+ * @brief Free the shared session cache and ticket keys
+ */
+void tls_sess_destroy(void);
+
+
+/**
+ * @brief Setup session caching and tickets on a domain SSL_CTX
+ * @param d domain owning the context
+ * @param ctx SSL context
+ * @param cache use the shared session cache
+ */
+void tls_sess_setup_ctx(tls_domain_t* d, SSL_CTX* ctx, int cache);
+
+
+/**
+ * @brief Link a new SSL to its connection and, for outgoing connections,
+ * offer the session cached for the peer
+ * @param ssl new SSL object
+ * @param c tcp connection
+ */
+void tls_sess_set_con(SSL* ssl, struct tcp_connection* c);
+
+
+/**
+ * @brief Update the domain resumption counters after a handshake
+ * @param ssl established SSL connection
+ */
+void tls_sess_handshake(SSL* ssl);
+
+
+/**
+ * @brief Number of sessions in the shared cache
+ */
+int tls_sess_cache_entries(void);
+
+
+/**
+ * @brief Number of ticket key rotations since startup
+ */
+unsigned int tls_sess_ticket_rotations(void);
+
+#endif /* _TLS_SESSION_H */
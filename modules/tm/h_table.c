@@ -50,6 +50,7 @@
  */
 
 #include <stdlib.h>
+#include <sched.h>
 
 
 #include "../../mem/shm_mem.h"
@@ -95,31 +96,88 @@ enum kill_reason get_kr() {
 }
 
 
+/* exclusive (write) lock of a hash entry: takes the entry mutex, which
+ * keeps out new readers and other writers, then waits for the readers
+ * already inside to leave */
 void lock_hash(int i) 
 {
-
+	struct entry* e;
 	int mypid;
 
+	e = &_tm_table->entries[i];
 	mypid = my_pid();
-	if (likely(atomic_get(&_tm_table->entries[i].locker_pid) != mypid)) {
-		lock(&_tm_table->entries[i].mutex);
-		atomic_set(&_tm_table->entries[i].locker_pid, mypid);
+	if (likely(atomic_get(&e->locker_pid) != mypid)) {
+		lock(&e->mutex);
+		atomic_set(&e->writer, 1);
+		membar_atomic_setget();
+		while (unlikely(atomic_get(&e->readers)))
+			sched_yield();
+		membar_enter_lock();
+		atomic_set(&e->locker_pid, mypid);
 	} else {
 		/* locked within the same process that called us*/
-		_tm_table->entries[i].rec_lock_level++;
+		e->rec_lock_level++;
 	}
 }
 
 
 void unlock_hash(int i) 
 {
-	if (likely(_tm_table->entries[i].rec_lock_level == 0)) {
-		atomic_set(&_tm_table->entries[i].locker_pid, 0);
-		unlock(&_tm_table->entries[i].mutex);
+	struct entry* e;
+
+	e = &_tm_table->entries[i];
+	if (likely(e->rec_lock_level == 0)) {
+		atomic_set(&e->locker_pid, 0);
+		membar_write_atomic_setget();
+		atomic_set(&e->writer, 0);
+		unlock(&e->mutex);
 	} else  {
 		/* recursive locked => decrease rec. lock count */
-		_tm_table->entries[i].rec_lock_level--;
+		e->rec_lock_level--;
+	}
+}
+
+
+/* shared (read) lock of a hash entry, for matching only: the synonym list
+ * may be walked and the found cell ref'ed, but nothing may be linked or
+ * unlinked. Readers don't touch the entry mutex unless a writer holds it.
+ * If the calling process already holds the write lock, it is taken
+ * recursively instead. */
+void lock_hash_read(int i)
+{
+	struct entry* e;
+
+	e = &_tm_table->entries[i];
+	if (unlikely(atomic_get(&e->locker_pid) == my_pid())) {
+		e->rec_lock_level++;
+		return;
+	}
+	for(;;) {
+		atomic_inc(&e->readers);
+		membar_atomic_op();
+		if (likely(atomic_get(&e->writer) == 0))
+			break;
+		/* writer inside or waiting => back off and sleep on the mutex
+		 * until it's done */
+		atomic_dec(&e->readers);
+		lock(&e->mutex);
+		unlock(&e->mutex);
+	}
+	membar_enter_lock();
+}
+
+
+void unlock_hash_read(int i)
+{
+	struct entry* e;
+
+	e = &_tm_table->entries[i];
+	if (unlikely(atomic_get(&e->locker_pid) == my_pid())) {
+		unlock_hash(i);
+		return;
 	}
+	membar_leave_lock();
+	atomic_dec(&e->readers);
 }
 
 
@@ -106,8 +106,14 @@ struct async_state;
 #define LOCK_HASH(_h) lock_hash((_h))
 #define UNLOCK_HASH(_h) unlock_hash((_h))
 
+/* read (shared) lock, only for walking a synonym list and ref-ing cells */
+#define LOCK_HASH_READ(_h) lock_hash_read((_h))
+#define UNLOCK_HASH_READ(_h) unlock_hash_read((_h))
+
 void lock_hash(int i);
 void unlock_hash(int i);
+void lock_hash_read(int i);
+void unlock_hash_read(int i);
 
 
 #define NO_CANCEL       ( (char*) 0 )
@@ -501,6 +507,8 @@ typedef struct entry
 	ser_lock_t      mutex;
 	atomic_t locker_pid; /* pid of the process that holds the lock */
 	int rec_lock_level; /* recursive lock count */
+	atomic_t readers; /* processes holding the entry read lock */
+	atomic_t writer; /* set while a process holds/waits for the write lock */
 	/* currently highest sequence number in a synonym list */
 	unsigned int    next_label;
 #ifdef TM_HASH_STATS
@@ -120,6 +120,7 @@ void tm_shutdown()
 	/* destroy the hash table */
 	DBG("DEBUG: tm_shutdown : emptying hash table\n");
 	free_hash_table( );
+	tm_timer_shards_destroy();
 	DBG("DEBUG: tm_shutdown : removing semaphores\n");
 	lock_cleanup();
 	DBG("DEBUG: tm_shutdown : destroying tmcb lists\n");
@@ -173,7 +174,8 @@ void put_on_wait(  struct cell  *Trans  )
 		4.									WAIT timer executed,
 											transaction deleted
 	*/
-	if (timer_add(&Trans->wait_timer, cfg_get(tm, tm_cfg, wait_timeout))==0){
+	if (tm_timer_add(&Trans->wait_timer, cfg_get(tm, tm_cfg, wait_timeout),
+						Trans->hash_index)==0){
 		/* sucess */
 		t_stats_wait();
 	}else{
@@ -507,6 +507,8 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked,
 	int match_status;
 	struct cell *e2e_ack_trans;
 	struct entry* hash_bucket;
+	unsigned int bucket_label;
+	int write_locked;
 
 	/* parse all*/
 	if (unlikely(check_transaction_quadruple(p_msg)==0))
@@ -526,7 +528,22 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked,
 	DBG("t_lookup_request: start searching: hash=%d, isACK=%d\n",
 		p_msg->hash_index,isACK);
 
+	if (!p_msg->via1) {
+		LOG(L_ERR, "ERROR: t_lookup_request: no via\n");
+		set_t(0, T_BR_UNDEFINED);
+		return 0;
+	}
+	branch=p_msg->via1->branch;
+	hash_bucket=&(get_tm_table()->entries[p_msg->hash_index]);
 
+	/* matching needs only the read lock, so that retransmissions of the
+	 * same transaction don't serialize on the entry; the write lock is
+	 * taken only if the caller wants to add a new transaction */
+	write_locked=0;
+	LOCK_HASH_READ(p_msg->hash_index);
+	bucket_label=hash_bucket->next_label;
+
+match:
 	/* assume not found */
 	e2e_ack_trans = 0;
 
@@ -534,16 +551,9 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked,
 	 * so, we can do very quick matching and skip the old-RFC bizzar
 	 * comparison of many header fields
 	 */
-	if (!p_msg->via1) {
-		LOG(L_ERR, "ERROR: t_lookup_request: no via\n");
-		set_t(0, T_BR_UNDEFINED);
-		return 0;
-	}
-	branch=p_msg->via1->branch;
 	if (branch && branch->value.s && branch->value.len>MCOOKIE_LEN
 			&& memcmp(branch->value.s,MCOOKIE,MCOOKIE_LEN)==0) {
 		/* huhuhu! the cookie is there -- let's proceed fast */
-		LOCK_HASH(p_msg->hash_index);
 		match_status=matching_3261(p_msg,&p_cell, 
 				/* skip transactions with different method; otherwise CANCEL 
 				 * would  match the previous INVITE trans.  */
@@ -561,11 +571,7 @@ int t_lookup_request( struct sip_msg* p_msg , int leave_new_locked,
 	 * of parsed uri, which was simply too bloated */
 	DBG("DEBUG: proceeding to pre-RFC3261 transaction matching\n");
 	*cancel=0;
-	/* lock the whole entry*/
-	LOCK_HASH(p_msg->hash_index);
 
-	hash_bucket=&(get_tm_table()->entries[p_msg->hash_index]);
-	
 	if (likely(!isACK)) {	
 		/* all the transactions from the entry are compared */
 		clist_foreach(hash_bucket, p_cell, next_c){
@@ -700,20 +706,37 @@ notfound:
 		p_cell=e2e_ack_trans;
 		goto e2e_ack;
 	}
-		
+
+	if (leave_new_locked && !write_locked) {
+		/* re-lock for writing; match again only if some transaction
+		 * was added in the meantime (next_label changed) */
+		UNLOCK_HASH_READ(p_msg->hash_index);
+		LOCK_HASH(p_msg->hash_index);
+		write_locked=1;
+		if (unlikely(hash_bucket->next_label!=bucket_label))
+			goto match;
+	}
 	/* no transaction found */
 	set_t(0, T_BR_UNDEFINED);
 	if (!leave_new_locked) {
-		UNLOCK_HASH(p_msg->hash_index);
+		UNLOCK_HASH_READ(p_msg->hash_index);
 	}
 	DBG("DEBUG: t_lookup_request: no transaction found\n");
 	return -1;
 
 e2e_ack:
+	if (leave_new_locked && !write_locked) {
+		/* the matched cell might be gone while re-locking => always
+		 * match again under the write lock */
+		UNLOCK_HASH_READ(p_msg->hash_index);
+		LOCK_HASH(p_msg->hash_index);
+		write_locked=1;
+		goto match;
+	}
 	t_ack=p_cell;	/* e2e proxied ACK */
 	set_t(0, T_BR_UNDEFINED);
 	if (!leave_new_locked) {
-		UNLOCK_HASH(p_msg->hash_index);
+		UNLOCK_HASH_READ(p_msg->hash_index);
 	}
 	DBG("DEBUG: t_lookup_request: e2e proxy ACK found\n");
 	return -2;
@@ -722,7 +745,10 @@ found:
 	set_t(p_cell, T_BR_UNDEFINED);
 	REF_UNSAFE( T );
 	set_kr(REQ_EXIST);
-	UNLOCK_HASH( p_msg->hash_index );
+	if (write_locked)
+		UNLOCK_HASH( p_msg->hash_index );
+	else
+		UNLOCK_HASH_READ( p_msg->hash_index );
 	DBG("DEBUG: t_lookup_request: transaction found (T=%p)\n",T);
 	return 1;
 }
@@ -774,7 +800,7 @@ struct cell* t_lookupOriginalT(  struct sip_msg* p_msg )
 	if (branch && branch->value.s && branch->value.len>MCOOKIE_LEN
 			&& memcmp(branch->value.s,MCOOKIE,MCOOKIE_LEN)==0) {
 		/* huhuhu! the cookie is there -- let's proceed fast */
-		LOCK_HASH(hash_index);
+		LOCK_HASH_READ(hash_index);
 		ret=matching_3261(p_msg, &p_cell,
 				/* we are seeking the original transaction --
 				 * skip CANCEL transactions during search
@@ -785,7 +811,7 @@ struct cell* t_lookupOriginalT(  struct sip_msg* p_msg )
 
 	/* no cookies --proceed to old-fashioned pre-3261 t-matching */
 
-	LOCK_HASH(hash_index);
+	LOCK_HASH_READ(hash_index);
 
 	hash_bucket=&(get_tm_table()->entries[hash_index]);
 	/* all the transactions from the entry are compared */
@@ -850,7 +876,7 @@ struct cell* t_lookupOriginalT(  struct sip_msg* p_msg )
 notfound:
 	/* no transaction found */
 	DBG("DEBUG: t_lookupOriginalT: no CANCEL matching found! \n" );
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	DBG("DEBUG: t_lookupOriginalT completed\n");
 	return 0;
 
@@ -858,7 +884,7 @@ found:
 	DBG("DEBUG: t_lookupOriginalT: canceled transaction"
 		" found (%p)! \n",p_cell );
 	REF_UNSAFE( p_cell );
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	DBG("DEBUG: t_lookupOriginalT completed\n");
 	return p_cell;
 }
@@ -955,7 +981,7 @@ int t_reply_matching( struct sip_msg *p_msg , int *p_branch )
 	cseq_method=get_cseq(p_msg)->method;
 	is_cancel=cseq_method.len==CANCEL_LEN 
 		&& memcmp(cseq_method.s, CANCEL, CANCEL_LEN)==0;
-	LOCK_HASH(hash_index);
+	LOCK_HASH_READ(hash_index);
 	hash_bucket=&(get_tm_table()->entries[hash_index]);
 	/* all the transactions from the entry are compared */
 	clist_foreach(hash_bucket, p_cell, next_c){
@@ -1000,7 +1026,7 @@ int t_reply_matching( struct sip_msg *p_msg , int *p_branch )
 		set_t(p_cell, (int)branch_id);
 		*p_branch =(int) branch_id;
 		REF_UNSAFE( T );
-		UNLOCK_HASH(hash_index);
+		UNLOCK_HASH_READ(hash_index);
 		DBG("DEBUG: t_reply_matching: reply matched (T=%p)!\n",T);
 		if(likely(!(p_msg->msg_flags&FL_TM_RPL_MATCHED))) {
 			/* if this is a 200 for INVITE, we will wish to store to-tags to be
@@ -1039,7 +1065,7 @@ int t_reply_matching( struct sip_msg *p_msg , int *p_branch )
 	} /* for cycle */
 
 	/* nothing found */
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	DBG("DEBUG: t_reply_matching: no matching transaction exists\n");
 
 nomatch2:
@@ -1617,7 +1643,7 @@ int t_lookup_ident(struct cell ** trans, unsigned int hash_index,
 		return -1;
 	}
 	
-	LOCK_HASH(hash_index);
+	LOCK_HASH_READ(hash_index);
 
 #ifndef E2E_CANCEL_HOP_BY_HOP
 #warning "t_lookup_ident() can only reliably match INVITE transactions in " \
@@ -1629,7 +1655,7 @@ int t_lookup_ident(struct cell ** trans, unsigned int hash_index,
 		prefetch_loc_r(p_cell->next_c, 1);
 		if(p_cell->label == label){
 			REF_UNSAFE(p_cell);
-    			UNLOCK_HASH(hash_index);
+    			UNLOCK_HASH_READ(hash_index);
 			set_t(p_cell, T_BR_UNDEFINED);
 			*trans=p_cell;
 			DBG("DEBUG: t_lookup_ident: transaction found\n");
@@ -1637,7 +1663,7 @@ int t_lookup_ident(struct cell ** trans, unsigned int hash_index,
 		}
     }
 	
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	set_t(0, T_BR_UNDEFINED);
 	*trans=p_cell;
 
@@ -1718,7 +1744,7 @@ int t_lookup_callid(struct cell ** trans, str callid, str cseq) {
 	DBG("created comparable cseq header field: >%.*s<\n", 
 			(int)(endpos - cseq_header), cseq_header); 
 
-	LOCK_HASH(hash_index);
+	LOCK_HASH_READ(hash_index);
 	DBG("just locked hash index %u, looking for transactions there:\n", hash_index);
 
 	hash_bucket=&(get_tm_table()->entries[hash_index]);
@@ -1734,7 +1760,7 @@ int t_lookup_callid(struct cell ** trans, str callid, str cseq) {
 					p_cell->callid.len, p_cell->callid.s, p_cell->cseq_n.len,
 					p_cell->cseq_n.s);
 			REF_UNSAFE(p_cell);
-			UNLOCK_HASH(hash_index);
+			UNLOCK_HASH_READ(hash_index);
 			set_t(p_cell, T_BR_UNDEFINED);
 			*trans=p_cell;
 			DBG("DEBUG: t_lookup_callid: transaction found.\n");
@@ -1745,7 +1771,7 @@ int t_lookup_callid(struct cell ** trans, str callid, str cseq) {
 			
 	}
 
-	UNLOCK_HASH(hash_index);
+	UNLOCK_HASH_READ(hash_index);
 	DBG("DEBUG: t_lookup_callid: transaction not found.\n");
     
 	return -1;
@@ -116,6 +116,7 @@
 #include "lock.h"
 
 #include "../../timer.h"
+#include "timer_shards.h"
 #include "h_table.h"
 #include "config.h"
 
@@ -236,10 +237,17 @@ inline static int _set_fr_retr(struct retr_buf* rb, unsigned retr_ms)
 		return 0;
 	}
 #ifdef TIMER_DEBUG
-	ret=timer_add_safe(&(rb)->timer, (timeout<retr_ticks)?timeout:retr_ticks,
+	if (tm_timer_shards)
+		ret=tm_shard_timer_add(&(rb)->timer,
+							(timeout<retr_ticks)?timeout:retr_ticks,
+							rb->my_T->hash_index);
+	else
+		ret=timer_add_safe(&(rb)->timer,
+							(timeout<retr_ticks)?timeout:retr_ticks,
 							file, func, line);
 #else
-	ret=timer_add(&(rb)->timer, (timeout<retr_ticks)?timeout:retr_ticks);
+	ret=tm_timer_add(&(rb)->timer, (timeout<retr_ticks)?timeout:retr_ticks,
+						rb->my_T->hash_index);
 #endif
 	if (ret==0) rb->t_active=1;
 	membar_write_atomic_op(); /* make sure t_active will be commited to mem.
@@ -257,7 +265,7 @@ do{ \
 	(rb)->flags|=F_RB_DEL_TIMER; /* timer should be deleted */ \
 	if ((rb)->t_active){ \
 		(rb)->t_active=0; \
-		timer_del(&(rb)->timer); \
+		tm_timer_del(&(rb)->timer, (rb)->my_T->hash_index); \
 	}\
 }while(0)
 
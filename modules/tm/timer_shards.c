@@ -0,0 +1,317 @@
+/*
+ * tm sharded timers
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of sip-router, a free SIP server.
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*!
+ * \file
+ * \brief TM :: sharded transaction timers
+ *
+ * The add/del semantics are the same as for the core timer (timer.c):
+ * an expired timer stays "active" and must be re-inited before being
+ * added again, deleting a timer whose handler is running waits for the
+ * handler to finish (unless the handler called tm_timer_allow_del()) and
+ * a handler cannot delete itself.
+ * \ingroup tm
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+
+#include "../../dprint.h"
+#include "../../globals.h"
+#include "../../ut.h"
+#include "../../sr_module.h"
+#include "../../pt.h"
+#include "../../timer_proc.h"
+#include "../../local_timer.h"
+#include "../../locking.h"
+#include "../../counters.h"
+#include "../../udp_server.h"
+#include "../../cfg/cfg_struct.h"
+#include "../../mem/mem.h"
+#include "../../mem/shm_mem.h"
+#include "timer_shards.h"
+
+/* the shard processes wake up twice per tick */
+#define TM_SHARD_SLEEP_US	(1000000/TIMER_TICKS_HZ/2)
+
+struct tm_timer_shard {
+	gen_lock_t lock;
+	struct timer_ln* volatile running; /* timer whose handler is running */
+	volatile ticks_t lag_max; /* max. expire delay seen, in ticks */
+	struct local_timer lt;
+};
+
+struct tm_shard_cnts {
+	counter_handle_t expired;
+	counter_handle_t lag;
+};
+
+int tm_timer_shards=0;
+
+static struct tm_timer_shard* tm_shards=0;
+static struct tm_shard_cnts* tm_shard_cnts=0;
+/* shard run by the current process (0 if not a shard timer process) */
+static struct tm_timer_shard* crt_shard=0;
+
+#define tm_get_shard(h) (&tm_shards[(h)%tm_timer_shards])
+
+
+
+/* counter callback: max. timer lag of a shard, in ms */
+static counter_val_t tm_shard_lag_max_get(counter_handle_t h, void* param)
+{
+	return TICKS_TO_MS(((struct tm_timer_shard*)param)->lag_max);
+}
+
+
+
+/* registers "shard<n>.expired", "shard<n>.lag" (total lag in ms) and
+ * "shard<n>.lag_max" in the "tm_timer" group */
+static int tm_shard_cnts_init(int n)
+{
+	counter_handle_t h;
+	char* cname;
+	int len;
+
+	len=sizeof("shard.lag_max")+INT2STR_MAX_LEN;
+	cname=pkg_malloc(3*len);
+	if (cname==0){
+		LOG(L_ERR, "ERROR: tm: tm_shard_cnts_init: out of memory\n");
+		return -1;
+	}
+	snprintf(cname, len, "shard%d.expired", n);
+	if (counter_register(&tm_shard_cnts[n].expired, "tm_timer", cname, 0,
+				0, 0, "expired transaction timers", 0)<0)
+		goto error;
+	cname+=len;
+	snprintf(cname, len, "shard%d.lag", n);
+	if (counter_register(&tm_shard_cnts[n].lag, "tm_timer", cname, 0,
+				0, 0, "total delay (ms) of the expired timers", 0)<0)
+		goto error;
+	cname+=len;
+	snprintf(cname, len, "shard%d.lag_max", n);
+	if (counter_register(&h, "tm_timer", cname, CNT_F_NO_RESET,
+				tm_shard_lag_max_get, &tm_shards[n],
+				"maximum delay (ms) of an expired timer", 0)<0)
+		goto error;
+	return 0;
+error:
+	LOG(L_ERR, "ERROR: tm: failed to register the timer counters for"
+			" shard %d\n", n);
+	return -1;
+}
+
+
+
+/* allocates the shards, must be called from mod_init */
+int tm_timer_shards_init(void)
+{
+	int i;
+
+	if (tm_timer_shards<=0){
+		tm_timer_shards=0;
+		return 0;
+	}
+	if (dont_fork){
+		LOG(L_WARN, "WARNING: tm: timer_shards ignored in no-fork mode\n");
+		tm_timer_shards=0;
+		return 0;
+	}
+	tm_shards=shm_malloc(tm_timer_shards*sizeof(*tm_shards));
+	tm_shard_cnts=pkg_malloc(tm_timer_shards*sizeof(*tm_shard_cnts));
+	if (tm_shards==0 || tm_shard_cnts==0){
+		LOG(L_ERR, "ERROR: tm: tm_timer_shards_init: out of memory\n");
+		goto error;
+	}
+	memset(tm_shards, 0, tm_timer_shards*sizeof(*tm_shards));
+	for (i=0; i<tm_timer_shards; i++){
+		if (lock_init(&tm_shards[i].lock)==0 ||
+				init_local_timer(&tm_shards[i].lt, get_ticks_raw())<0){
+			LOG(L_ERR, "ERROR: tm: failed to init timer shard %d\n", i);
+			goto error;
+		}
+		if (tm_shard_cnts_init(i)<0)
+			goto error;
+	}
+	if (register_basic_timers(tm_timer_shards)<0){
+		LOG(L_ERR, "ERROR: tm: failed to register the timer shard"
+				" processes\n");
+		goto error;
+	}
+	return 0;
+error:
+	tm_timer_shards_destroy();
+	tm_timer_shards=0;
+	return -1;
+}
+
+
+
+void tm_timer_shards_destroy(void)
+{
+	if (tm_shards){
+		shm_free(tm_shards);
+		tm_shards=0;
+	}
+	if (tm_shard_cnts){
+		pkg_free(tm_shard_cnts);
+		tm_shard_cnts=0;
+	}
+}
+
+
+
+/* runs the handlers of all the expired timers of a shard
+ * (called from the shard process) */
+static void tm_timer_shard_run(struct tm_timer_shard* s, int n)
+{
+	struct timer_head* expired;
+	struct timer_ln* tl;
+	ticks_t t;
+	ticks_t ret;
+	ticks_t lag;
+
+	expired=&s->lt.timer_lst.expired;
+	lock_get(&s->lock);
+	t=get_ticks_raw();
+	local_timer_mv_expired(&s->lt, t);
+	while(expired->next!=(struct timer_ln*)expired){
+		tl=expired->next;
+		_timer_rm_list(tl); /* detach */
+		tl->next=tl->prev=0;
+		s->running=tl;
+		lock_release(&s->lock);
+			lag=get_ticks_raw()-tl->expire;
+			if ((s_ticks_t)lag>0){
+				if (lag>s->lag_max)
+					s->lag_max=lag;
+				counter_add(tm_shard_cnts[n].lag, TICKS_TO_MS(lag));
+			}
+			counter_inc(tm_shard_cnts[n].expired);
+			ret=tl->f(t, tl, tl->data);
+			/* reset the configuration group handles */
+			cfg_reset_all();
+		lock_get(&s->lock);
+		if (ret!=0){
+			/* not one-shot, re-add it */
+			if (ret!=(ticks_t)-1) /* ! periodic */
+				tl->initial_timeout=ret;
+			tl->flags&=~F_TIMER_ACTIVE;
+			local_timer_add(&s->lt, tl, tl->initial_timeout, t);
+		}
+		s->running=0;
+	}
+	lock_release(&s->lock);
+}
+
+
+
+/* forks the shard timer processes, must be called from child_init with
+ * rank==PROC_MAIN */
+int tm_timer_shards_fork(void)
+{
+	char desc[32];
+	int pid;
+	int i;
+
+	for (i=0; i<tm_timer_shards; i++){
+		snprintf(desc, sizeof(desc), "tm timer shard %d", i);
+		pid=fork_process(PROC_TIMER, desc, 1);
+		if (pid<0){
+			LOG(L_ERR, "ERROR: tm: failed to fork timer shard %d\n", i);
+			return -1;
+		}
+		if (pid==0){
+			/* child */
+			crt_shard=&tm_shards[i];
+			if (cfg_child_init()) return -1;
+			for(;;){
+				sleep_us(TM_SHARD_SLEEP_US);
+				cfg_update();
+				/* send the retransmissions with few sendmmsg() */
+				udp_send_batch_begin();
+				tm_timer_shard_run(crt_shard, i);
+				udp_send_batch_flush();
+			}
+		}
+	}
+	return 0;
+}
+
+
+
+int tm_shard_timer_add(struct timer_ln* tl, ticks_t delta, unsigned int h)
+{
+	struct tm_timer_shard* s;
+	int ret;
+
+	s=tm_get_shard(h);
+	lock_get(&s->lock);
+	ret=local_timer_add(&s->lt, tl, delta, get_ticks_raw());
+	lock_release(&s->lock);
+	return ret;
+}
+
+
+
+/* returns <0 on error (-1 if not active/already deleted, -2 if called
+ * from the timer handler itself), 0 on success */
+int tm_shard_timer_del(struct timer_ln* tl, unsigned int h)
+{
+	struct tm_timer_shard* s;
+	int ret;
+
+	s=tm_get_shard(h);
+again:
+	/* quick exit if timer inactive */
+	if (!(tl->flags & F_TIMER_ACTIVE))
+		return -1;
+	lock_get(&s->lock);
+	if (unlikely(s->running==tl)){
+		lock_release(&s->lock);
+		if (crt_shard==s){
+			LOG(L_CRIT, "BUG: tm: timer handle %p tried to delete itself\n",
+					tl);
+			return -2;
+		}
+		sched_yield(); /* wait for it to complete */
+		goto again;
+	}
+	if ((tl->next!=0) && (tl->prev!=0)){
+		local_timer_del(&s->lt, tl);
+		ret=0;
+	}else
+		ret=-1; /* already detached */
+	lock_release(&s->lock);
+	return ret;
+}
+
+
+
+/* see timer_allow_del() */
+void tm_shard_timer_allow_del(void)
+{
+	if (crt_shard)
+		crt_shard->running=0;
+	else
+		LOG(L_CRIT, "BUG: tm: timer_allow_del called outside a timer"
+				" handle\n");
+}
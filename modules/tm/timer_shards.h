@@ -0,0 +1,70 @@
+/*
+ * tm sharded timers
+ *
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of sip-router, a free SIP server.
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*!
+ * \file
+ * \brief TM :: sharded transaction timers
+ *
+ * When timer_shards is set, the retransmission/final response timers and
+ * the wait timer of a transaction are not added to the core timer, but to
+ * one of timer_shards hierarchical timing wheels (local_timer.h), picked
+ * by the transaction hash index. Each wheel has its own lock and its own
+ * timer process, so expiring the timers of many transactions scales with
+ * the number of shards instead of going through the single core timer
+ * process.
+ * \ingroup tm
+ */
+
+#ifndef _tm_timer_shards_h
+#define _tm_timer_shards_h
+
+#include "../../timer.h"
+#include "../../compiler_opt.h"
+
+/* number of timer shards (modparam), 0 == use the core timer */
+extern int tm_timer_shards;
+
+int tm_timer_shards_init(void);
+int tm_timer_shards_fork(void);
+void tm_timer_shards_destroy(void);
+
+int tm_shard_timer_add(struct timer_ln* tl, ticks_t delta, unsigned int h);
+int tm_shard_timer_del(struct timer_ln* tl, unsigned int h);
+void tm_shard_timer_allow_del(void);
+
+/* timer_add()/timer_del()/timer_allow_del() replacements for the timers
+ * of the transaction with hash index _h */
+#define tm_timer_add(_tl, _delta, _h) \
+	(likely(tm_timer_shards==0)?timer_add((_tl), (_delta)): \
+		tm_shard_timer_add((_tl), (_delta), (_h)))
+
+#define tm_timer_del(_tl, _h) \
+	(likely(tm_timer_shards==0)?timer_del((_tl)): \
+		tm_shard_timer_del((_tl), (_h)))
+
+#define tm_timer_allow_del() \
+	do{ \
+		if (likely(tm_timer_shards==0)) \
+			timer_allow_del(); \
+		else \
+			tm_shard_timer_allow_del(); \
+	}while(0)
+
+#endif /* _tm_timer_shards_h */
@@ -549,6 +549,7 @@ static param_export_t params[]={
 	{"remap_503_500",       PARAM_INT, &tm_remap_503_500                     },
 	{"failure_exec_mode",   PARAM_INT, &tm_failure_exec_mode                 },
 	{"dns_reuse_rcv_socket",PARAM_INT, &tm_dns_reuse_rcv_socket              },
+	{"timer_shards",        PARAM_INT, &tm_timer_shards                      },
 #ifdef CANCEL_REASON_SUPPORT
 	{"local_cancel_reason", PARAM_INT, &default_tm_cfg.local_cancel_reason   },
 	{"e2e_cancel_reason",   PARAM_INT, &default_tm_cfg.e2e_cancel_reason     },
@@ -866,6 +867,11 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if (tm_timer_shards_init()<0) {
+		LOG(L_ERR, "ERROR: mod_init: timer shards init failed\n");
+		return -1;
+	}
+
 	if (init_tmcb_lists()!=1) {
 		LOG(L_CRIT, "ERROR:tm:mod_init: failed to init tmcb lists\n");
 		return -1;
@@ -933,6 +939,11 @@ static int child_init(int rank)
 				" generator\n");
 		return -2;
 	}
+	if (rank == PROC_MAIN && tm_timer_shards_fork() < 0) {
+		LOG(L_ERR, "ERROR: child_init: failed to start the timer shard"
+				" processes\n");
+		return -1;
+	}
 	return 0;
 }
 
@@ -46,6 +46,7 @@
 #include "usrloc.h"
 #include "urecord.h"
 #include "ucontact.h"
+#include "ul_istr.h"
 #include "usrloc.h"
 
 static int ul_xavp_contact_clone = 1;
@@ -81,8 +82,128 @@ void ucontact_xavp_store(ucontact_t *_c)
 }
 #endif
 
+/*! \brief strings of a contact, in the order they are kept in its block */
+#define UL_CSTR_NO    7
+#define UL_CSTR_UA    2
+#define UL_CSTR_PATH  4
+
+/*!
+ * \brief Get the string fields of a contact
+ * \param _c contact
+ * \param _f filled with UL_CSTR_NO pointers to the fields
+ */
+static inline void ucontact_str_fields(ucontact_t* _c, str** _f)
+{
+	_f[0] = &_c->c;
+	_f[1] = &_c->callid;
+	_f[2] = &_c->user_agent;
+	_f[3] = &_c->received;
+	_f[4] = &_c->path;
+	_f[5] = &_c->ruid;
+	_f[6] = &_c->instance;
+}
+
+/*! \brief pool flag of a string field, 0 if it cannot be pooled */
+static inline unsigned int ucontact_str_iflag(int _i)
+{
+	if (_i==UL_CSTR_UA)
+		return UL_ISTR_UA;
+	if (_i==UL_CSTR_PATH)
+		return UL_ISTR_PATH;
+	return 0;
+}
+
+/*!
+ * \brief Compute which string values should be kept in the string pool
+ * \param _v new values of the string fields
+ * \return UL_ISTR_* flags
+ */
+static inline unsigned int ucontact_str_pooled(str** _v)
+{
+	unsigned int istrs;
+
+	istrs = 0;
+	if (ul_intern_strings) {
+		if (_v[UL_CSTR_UA] && _v[UL_CSTR_UA]->len>0)
+			istrs |= UL_ISTR_UA;
+		if (_v[UL_CSTR_PATH] && _v[UL_CSTR_PATH]->len>0)
+			istrs |= UL_ISTR_PATH;
+	}
+	return istrs;
+}
+
+/*!
+ * \brief Size of the string block for the given values
+ * \param _v new values of the string fields, 0 if not set
+ * \param _istrs fields kept in the string pool
+ */
+static inline int ucontact_str_len(str** _v, unsigned int _istrs)
+{
+	int len;
+	int i;
+
+	len = 0;
+	for (i=0; i<UL_CSTR_NO; i++) {
+		if (_v[i] && !(_istrs & ucontact_str_iflag(i)))
+			len += _v[i]->len;
+	}
+	return len;
+}
+
+/*!
+ * \brief Copy the string values, except the pooled ones, to a block
+ * \note a value can be the current content of its own field, it is read
+ * before the field is changed
+ * \param _c contact
+ * \param _v new values of the string fields, 0 if not set
+ * \param _istrs fields kept in the string pool
+ * \param _p string block
+ */
+static inline void ucontact_str_copy(ucontact_t* _c, str** _v,
+		unsigned int _istrs, char* _p)
+{
+	str* f[UL_CSTR_NO];
+	int i;
+
+	ucontact_str_fields(_c, f);
+	for (i=0; i<UL_CSTR_NO; i++) {
+		if (_istrs & ucontact_str_iflag(i))
+			continue;
+		if (_v[i]==0) {
+			f[i]->s = 0;
+			f[i]->len = 0;
+			continue;
+		}
+		/* memmove, an in place update can copy a field over itself */
+		memmove(_p, _v[i]->s, _v[i]->len);
+		f[i]->len = _v[i]->len;
+		f[i]->s = _p;
+		_p += _v[i]->len;
+	}
+}
+
+/*!
+ * \brief Free the pooled strings and the string block of a contact
+ * \param _c contact
+ */
+static inline void ucontact_str_free(ucontact_t* _c)
+{
+	if (_c->istrs & UL_ISTR_UA)
+		ul_istr_unref(&_c->user_agent);
+	if (_c->istrs & UL_ISTR_PATH)
+		ul_istr_unref(&_c->path);
+	_c->istrs = 0;
+	if (_c->sbuf && _c->sbuf!=(char*)(_c+1))
+		shm_free(_c->sbuf);
+	_c->sbuf = 0;
+}
+
 /*!
  * \brief Create a new contact structure
+ *
+ * The contact and its strings are allocated as a single shm block, the
+ * User-Agent and Path values are shared through the string pool if
+ * intern_strings is set.
  * \param _dom domain
  * \param _aor address of record
  * \param _contact contact string
@@ -92,35 +213,44 @@ void ucontact_xavp_store(ucontact_t *_c)
 ucontact_t* new_ucontact(str* _dom, str* _aor, str* _contact, ucontact_info_t* _ci)
 {
 	ucontact_t *c;
+	str* v[UL_CSTR_NO];
+	unsigned int istrs;
+	int len;
 
 	if(unlikely(_ci->ruid.len<=0)) {
 		LM_ERR("no ruid for aor: %.*s\n", _aor->len, ZSW(_aor->s));
 		return 0;
 	}
 
-	c = (ucontact_t*)shm_malloc(sizeof(ucontact_t));
+	v[0] = _contact;
+	v[1] = _ci->callid;
+	v[2] = _ci->user_agent;
+	v[3] = (_ci->received.s && _ci->received.len) ? &_ci->received : 0;
+	v[4] = (_ci->path && _ci->path->len) ? _ci->path : 0;
+	v[5] = &_ci->ruid;
+	v[6] = (_ci->instance.s && _ci->instance.len) ? &_ci->instance : 0;
+	istrs = ucontact_str_pooled(v);
+	len = ucontact_str_len(v, istrs);
+
+	c = (ucontact_t*)shm_malloc(sizeof(ucontact_t) + len);
 	if (!c) {
 		LM_ERR("no more shm memory\n");
 		return 0;
 	}
 	memset(c, 0, sizeof(ucontact_t));
+	c->sbuf = (char*)(c+1);
+	c->sbuf_len = len;
+	c->msize = sizeof(ucontact_t) + len;
 
-	if (shm_str_dup( &c->c, _contact) < 0) goto error;
-	if (shm_str_dup( &c->callid, _ci->callid) < 0) goto error;
-	if (shm_str_dup( &c->user_agent, _ci->user_agent) < 0) goto error;
-
-	if (_ci->received.s && _ci->received.len) {
-		if (shm_str_dup( &c->received, &_ci->received) < 0) goto error;
-	}
-	if (_ci->path && _ci->path->len) {
-		if (shm_str_dup( &c->path, _ci->path) < 0) goto error;
+	if (istrs & UL_ISTR_UA) {
+		if (ul_istr_ref(v[UL_CSTR_UA], &c->user_agent) < 0) goto error;
+		c->istrs |= UL_ISTR_UA;
 	}
-	if (_ci->ruid.s && _ci->ruid.len) {
-		if (shm_str_dup( &c->ruid, &_ci->ruid) < 0) goto error;
-	}
-	if (_ci->instance.s && _ci->instance.len) {
-		if (shm_str_dup( &c->instance, &_ci->instance) < 0) goto error;
+	if (istrs & UL_ISTR_PATH) {
+		if (ul_istr_ref(v[UL_CSTR_PATH], &c->path) < 0) goto error;
+		c->istrs |= UL_ISTR_PATH;
 	}
+	ucontact_str_copy(c, v, istrs, c->sbuf);
 
 	c->domain = _dom;
 	c->aor = _aor;
@@ -144,16 +274,7 @@ ucontact_t* new_ucontact(str* _dom, str* _aor, str* _contact, ucontact_info_t* _
 	return c;
 error:
 	LM_ERR("no more shm memory\n");
-	if (c->path.s) shm_free(c->path.s);
-	if (c->received.s) shm_free(c->received.s);
-	if (c->user_agent.s) shm_free(c->user_agent.s);
-	if (c->callid.s) shm_free(c->callid.s);
-	if (c->c.s) shm_free(c->c.s);
-	if (c->ruid.s) shm_free(c->ruid.s);
-	if (c->instance.s) shm_free(c->instance.s);
-#ifdef WITH_XAVP
-	if (c->xavp) xavp_destroy_list(&c->xavp);
-#endif
+	ucontact_str_free(c);
 	shm_free(c);
 	return 0;
 }
@@ -167,13 +288,7 @@ error:
 void free_ucontact(ucontact_t* _c)
 {
 	if (!_c) return;
-	if (_c->path.s) shm_free(_c->path.s);
-	if (_c->received.s) shm_free(_c->received.s);
-	if (_c->user_agent.s) shm_free(_c->user_agent.s);
-	if (_c->callid.s) shm_free(_c->callid.s);
-	if (_c->c.s) shm_free(_c->c.s);
-	if (_c->ruid.s) shm_free(_c->ruid.s);
-	if (_c->instance.s) shm_free(_c->instance.s);
+	ucontact_str_free(_c);
 #ifdef WITH_XAVP
 	if (_c->xavp) xavp_destroy_list(&_c->xavp);
 #endif
@@ -249,53 +364,108 @@ void print_ucontact(FILE* _f, ucontact_t* _c)
  */
 int mem_update_ucontact(ucontact_t* _c, ucontact_info_t* _ci)
 {
-#define update_str(_old,_new) \
-	do{\
-		if ((_old)->len < (_new)->len) { \
-			ptr = (char*)shm_malloc((_new)->len); \
-			if (ptr == 0) { \
-				LM_ERR("no more shm memory\n"); \
-				return -1; \
-			}\
-			memcpy(ptr, (_new)->s, (_new)->len);\
-			if ((_old)->s) shm_free((_old)->s);\
-			(_old)->s = ptr;\
-		} else {\
-			memcpy((_old)->s, (_new)->s, (_new)->len);\
-		}\
-		(_old)->len = (_new)->len;\
-	} while(0)
-
-	char* ptr;
+	str* f[UL_CSTR_NO];
+	str* v[UL_CSTR_NO];
+	str ua = {0, 0};
+	str path = {0, 0};
+	str old_ua;
+	str old_path;
+	unsigned int istrs;
+	unsigned int iflag;
+	unsigned int old_istrs;
+	char* buf;
+	int fit;
+	int len;
+	int i;
+
+	/* new values, by default the current ones */
+	ucontact_str_fields(_c, f);
+	for (i=0; i<UL_CSTR_NO; i++)
+		v[i] = (f[i]->s) ? f[i] : 0;
 
 	if(_ci->instance.s!=NULL && _ci->instance.len>0)
 	{
 		/* when we have instance set, update contact address */
 		if(_ci->c!=NULL && _ci->c->s!=NULL && _ci->c->len>0)
-			update_str( &_c->c, _ci->c);
+			v[0] = _ci->c;
 	}
-
 	/* refresh call-id */
 	if(_ci->callid!=NULL && _ci->callid->s!=NULL && _ci->callid->len>0)
-		update_str( &_c->callid, _ci->callid);
-	update_str( &_c->user_agent, _ci->user_agent);
-
-	if (_ci->received.s && _ci->received.len) {
-		update_str( &_c->received, &_ci->received);
-	} else {
-		if (_c->received.s) shm_free(_c->received.s);
-		_c->received.s = 0;
-		_c->received.len = 0;
+		v[1] = _ci->callid;
+	v[2] = _ci->user_agent;
+	v[3] = (_ci->received.s && _ci->received.len) ? &_ci->received : 0;
+	v[4] = _ci->path;
+
+	/* pooled values: take the new references first */
+	istrs = ucontact_str_pooled(v);
+	old_istrs = _c->istrs;
+	old_ua = _c->user_agent;
+	old_path = _c->path;
+	if ((istrs & UL_ISTR_UA) && !((old_istrs & UL_ISTR_UA)
+				&& STR_EQ(old_ua, *v[UL_CSTR_UA]))) {
+		if (ul_istr_ref(v[UL_CSTR_UA], &ua) < 0)
+			return -1;
 	}
-	
-	if (_ci->path) {
-		update_str( &_c->path, _ci->path);
-	} else {
-		if (_c->path.s) shm_free(_c->path.s);
-		_c->path.s = 0;
-		_c->path.len = 0;
+	if ((istrs & UL_ISTR_PATH) && !((old_istrs & UL_ISTR_PATH)
+				&& STR_EQ(old_path, *v[UL_CSTR_PATH]))) {
+		if (ul_istr_ref(v[UL_CSTR_PATH], &path) < 0) {
+			if (ua.s) ul_istr_unref(&ua);
+			return -1;
+		}
 	}
 
+	/* do the changed values fit in place of the old ones? */
+	fit = 1;
+	for (i=0; i<UL_CSTR_NO && fit; i++) {
+		iflag = ucontact_str_iflag(i);
+		if ((istrs & iflag) || v[i]==0 || v[i]==f[i])
+			continue;
+		if (f[i]->s==0 || (old_istrs & iflag) || v[i]->len > f[i]->len)
+			fit = 0;
+	}
+	if (fit) {
+		for (i=0; i<UL_CSTR_NO; i++) {
+			if ((istrs & ucontact_str_iflag(i)) || v[i]==f[i])
+				continue;
+			if (v[i]==0) {
+				f[i]->s = 0;
+				f[i]->len = 0;
+			} else {
+				memcpy(f[i]->s, v[i]->s, v[i]->len);
+				f[i]->len = v[i]->len;
+			}
+		}
+	} else {
+		/* move all the strings to a new block */
+		len = ucontact_str_len(v, istrs);
+		buf = (char*)shm_malloc(len ? len : 1);
+		if (buf == 0) {
+			LM_ERR("no more shm memory\n");
+			if (ua.s) ul_istr_unref(&ua);
+			if (path.s) ul_istr_unref(&path);
+			return -1;
+		}
+		ucontact_str_copy(_c, v, istrs, buf);
+		if (_c->sbuf != (char*)(_c+1)) {
+			shm_free(_c->sbuf);
+			_c->msize -= _c->sbuf_len;
+		}
+		_c->sbuf = buf;
+		_c->sbuf_len = len;
+		_c->msize += len;
+	}
+
+	/* release the old pooled values that are not used anymore */
+	if ((old_istrs & UL_ISTR_UA) && (ua.s || !(istrs & UL_ISTR_UA)))
+		ul_istr_unref(&old_ua);
+	if ((old_istrs & UL_ISTR_PATH) && (path.s || !(istrs & UL_ISTR_PATH)))
+		ul_istr_unref(&old_path);
+	if (ua.s)
+		_c->user_agent = ua;
+	if (path.s)
+		_c->path = path;
+	_c->istrs = istrs;
+
 #ifdef WITH_XAVP
 	ucontact_xavp_store(_c);
 #endif
@@ -462,9 +632,10 @@ int st_flush_ucontact(ucontact_t* _c)
 /*!
  * \brief Insert contact into the database
  * \param _c inserted contact
+ * \param _upsert if set, use insert_update (update the row on duplicate key)
  * \return 0 on success, -1 on failure
  */
-int db_insert_ucontact(ucontact_t* _c)
+static int db_store_ucontact(ucontact_t* _c, int _upsert)
 {
 	char* dom;
 	db_key_t keys[18];
@@ -625,7 +796,12 @@ int db_insert_ucontact(ucontact_t* _c)
 		return -1;
 	}
 
-	if (ul_dbf.insert(ul_dbh, keys, vals, nr_cols) < 0) {
+	if (_upsert) {
+		if (ul_dbf.insert_update(ul_dbh, keys, vals, nr_cols) < 0) {
+			LM_ERR("inserting/updating contact in db failed\n");
+			return -1;
+		}
+	} else if (ul_dbf.insert(ul_dbh, keys, vals, nr_cols) < 0) {
 		LM_ERR("inserting contact in db failed\n");
 		return -1;
 	}
@@ -640,6 +816,29 @@ int db_insert_ucontact(ucontact_t* _c)
 }
 
 
+/*!
+ * \brief Insert contact into the database
+ * \param _c inserted contact
+ * \return 0 on success, -1 on failure
+ */
+int db_insert_ucontact(ucontact_t* _c)
+{
+	return db_store_ucontact(_c, 0);
+}
+
+
+/*!
+ * \brief Insert contact into the database or update it if the ruid exists
+ * \note requires DB_CAP_INSERT_UPDATE and an unique key on ruid
+ * \param _c inserted or updated contact
+ * \return 0 on success, -1 on failure
+ */
+int db_insert_update_ucontact(ucontact_t* _c)
+{
+	return db_store_ucontact(_c, 1);
+}
+
+
 /*!
  * \brief Update contact in the database by address
  * \param _c updated contact
@@ -124,6 +124,14 @@ int st_flush_ucontact(ucontact_t* _c);
 int db_insert_ucontact(ucontact_t* _c);
 
 
+/*!
+ * \brief Insert contact into the database or update it if the ruid exists
+ * \param _c inserted or updated contact
+ * \return 0 on success, -1 on failure
+ */
+int db_insert_update_ucontact(ucontact_t* _c);
+
+
 /*!
  * \brief Update contact in the database
  * \param _c updated contact
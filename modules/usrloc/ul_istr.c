@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ *  \brief USRLOC - Pool of interned contact strings
+ *  \ingroup usrloc
+ */
+
+#include <string.h>
+
+#include "../../dprint.h"
+#include "../../hashes.h"
+#include "../../locking.h"
+#include "../../mem/shm_mem.h"
+#include "ul_istr.h"
+
+#define UL_ISTR_HASH_SIZE  1024   /*!< must be a power of 2 */
+#define UL_ISTR_LOCKS      64
+
+/*! pooled string, the value follows the structure */
+typedef struct ul_istr {
+	struct ul_istr* next;
+	struct ul_istr* prev;
+	unsigned int hash;
+	unsigned int refs;
+	int len;
+} ul_istr_t;
+
+int ul_intern_strings = 0;
+
+static ul_istr_t** ul_istr_table = 0;
+static gen_lock_set_t* ul_istr_locks = 0;
+
+#define ul_istr_lock(h)    lock_set_get(ul_istr_locks, (h)%UL_ISTR_LOCKS)
+#define ul_istr_unlock(h)  lock_set_release(ul_istr_locks, (h)%UL_ISTR_LOCKS)
+#define ul_istr_value(e)   ((char*)((e)+1))
+
+
+int ul_istr_init(void)
+{
+	if (ul_intern_strings==0)
+		return 0;
+	ul_istr_table = (ul_istr_t**)shm_malloc(
+			UL_ISTR_HASH_SIZE*sizeof(ul_istr_t*));
+	if (ul_istr_table==0) {
+		LM_ERR("no more shm memory\n");
+		return -1;
+	}
+	memset(ul_istr_table, 0, UL_ISTR_HASH_SIZE*sizeof(ul_istr_t*));
+	ul_istr_locks = lock_set_alloc(UL_ISTR_LOCKS);
+	if (ul_istr_locks==0 || lock_set_init(ul_istr_locks)==0) {
+		LM_ERR("failed to init the string pool locks\n");
+		if (ul_istr_locks) {
+			lock_set_dealloc(ul_istr_locks);
+			ul_istr_locks = 0;
+		}
+		shm_free(ul_istr_table);
+		ul_istr_table = 0;
+		return -1;
+	}
+	return 0;
+}
+
+
+void ul_istr_destroy(void)
+{
+	ul_istr_t* e;
+	int i;
+
+	if (ul_istr_table==0)
+		return;
+	for (i=0; i<UL_ISTR_HASH_SIZE; i++) {
+		while (ul_istr_table[i]) {
+			e = ul_istr_table[i];
+			ul_istr_table[i] = e->next;
+			shm_free(e);
+		}
+	}
+	shm_free(ul_istr_table);
+	ul_istr_table = 0;
+	lock_set_destroy(ul_istr_locks);
+	lock_set_dealloc(ul_istr_locks);
+	ul_istr_locks = 0;
+}
+
+
+int ul_istr_ref(str* _src, str* _dst)
+{
+	ul_istr_t* e;
+	unsigned int h;
+	unsigned int idx;
+
+	h = core_hash(_src, 0, 0);
+	idx = h & (UL_ISTR_HASH_SIZE-1);
+	ul_istr_lock(idx);
+	for (e=ul_istr_table[idx]; e; e=e->next) {
+		if (e->hash==h && e->len==_src->len
+				&& memcmp(ul_istr_value(e), _src->s, _src->len)==0) {
+			e->refs++;
+			goto done;
+		}
+	}
+	e = (ul_istr_t*)shm_malloc(sizeof(ul_istr_t) + _src->len);
+	if (e==0) {
+		ul_istr_unlock(idx);
+		LM_ERR("no more shm memory\n");
+		return -1;
+	}
+	e->hash = h;
+	e->refs = 1;
+	e->len = _src->len;
+	memcpy(ul_istr_value(e), _src->s, _src->len);
+	e->prev = 0;
+	e->next = ul_istr_table[idx];
+	if (e->next)
+		e->next->prev = e;
+	ul_istr_table[idx] = e;
+done:
+	ul_istr_unlock(idx);
+	_dst->s = ul_istr_value(e);
+	_dst->len = e->len;
+	return 0;
+}
+
+
+void ul_istr_unref(str* _s)
+{
+	ul_istr_t* e;
+	unsigned int idx;
+
+	e = ((ul_istr_t*)_s->s) - 1;
+	idx = e->hash & (UL_ISTR_HASH_SIZE-1);
+	ul_istr_lock(idx);
+	if (--e->refs==0) {
+		if (e->prev)
+			e->prev->next = e->next;
+		else
+			ul_istr_table[idx] = e->next;
+		if (e->next)
+			e->next->prev = e->prev;
+	} else {
+		e = 0;
+	}
+	ul_istr_unlock(idx);
+	if (e)
+		shm_free(e);
+}
+
+
+void ul_istr_get_stats(ul_istr_stats_t* _st)
+{
+	ul_istr_t* e;
+	int i;
+
+	memset(_st, 0, sizeof(ul_istr_stats_t));
+	if (ul_istr_table==0)
+		return;
+	for (i=0; i<UL_ISTR_HASH_SIZE; i++) {
+		ul_istr_lock(i);
+		for (e=ul_istr_table[i]; e; e=e->next) {
+			_st->strings++;
+			_st->bytes += sizeof(ul_istr_t) + e->len;
+			_st->refs += e->refs;
+			_st->saved += (unsigned long)(e->refs - 1) * e->len;
+		}
+		ul_istr_unlock(i);
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ *  \brief USRLOC - Pool of interned contact strings
+ *
+ *  Values repeated over many contacts (User-Agent, Path) can be kept
+ *  only once in shared memory, reference counted. The contacts point to
+ *  the pooled copy, which is freed when its last user is gone.
+ *  \ingroup usrloc
+ */
+
+#ifndef _UL_ISTR_H
+#define _UL_ISTR_H
+
+#include "../../str.h"
+
+/*! \brief strings of a contact kept in the pool (ucontact_t istrs) */
+#define UL_ISTR_UA    (1<<0)
+#define UL_ISTR_PATH  (1<<1)
+
+extern int ul_intern_strings; /*!< use the pool (modparam) */
+
+/*! \brief pool statistics */
+typedef struct ul_istr_stats {
+	unsigned long strings;   /*!< number of pooled strings */
+	unsigned long bytes;     /*!< memory used by the pool */
+	unsigned long refs;      /*!< number of contacts using them */
+	unsigned long saved;     /*!< bytes saved by sharing */
+} ul_istr_stats_t;
+
+int ul_istr_init(void);
+void ul_istr_destroy(void);
+
+/*!
+ * \brief Get a reference to the pooled copy of a string
+ * \param _src string value
+ * \param _dst set to the pooled copy
+ * \return 0 on success, -1 if out of memory
+ */
+int ul_istr_ref(str* _src, str* _dst);
+
+/*!
+ * \brief Release a reference got with ul_istr_ref()
+ * \param _s pooled string
+ */
+void ul_istr_unref(str* _s);
+
+void ul_istr_get_stats(ul_istr_stats_t* _st);
+
+#endif /* _UL_ISTR_H */
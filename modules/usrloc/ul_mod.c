@@ -68,6 +68,9 @@
 #include "ul_mi.h"
 #include "ul_rpc.h"
 #include "ul_callback.h"
+#include "ul_wb.h"
+#include "ul_istr.h"
+#include "ul_snapshot.h"
 #include "usrloc.h"
 
 MODULE_VERSION
@@ -222,12 +225,23 @@ static param_export_t params[] = {
 	{"db_check_update",     INT_PARAM, &ul_db_check_update},
 	{"xavp_contact",        STR_PARAM, &ul_xavp_contact_name.s},
 	{"db_ops_ruid",         INT_PARAM, &ul_db_ops_ruid},
+	{"db_writers",          INT_PARAM, &ul_db_writers},
+	{"db_batch_size",       INT_PARAM, &ul_db_batch_size},
+	{"db_queue_max",        INT_PARAM, &ul_db_queue_max},
+	{"intern_strings",      INT_PARAM, &ul_intern_strings},
+	{"snapshot_file",       STR_PARAM, &ul_snapshot_file.s},
+	{"snapshot_interval",   INT_PARAM, &ul_snapshot_interval},
 	{0, 0, 0}
 };
 
 
 stat_export_t mod_stats[] = {
 	{"registered_users" ,  STAT_IS_FUNC, (stat_var**)get_number_of_users  },
+	{"db_wb_queued" ,      STAT_IS_FUNC, (stat_var**)ul_wb_get_queued     },
+	{"db_wb_queue_full" ,  STAT_IS_FUNC, (stat_var**)ul_wb_get_queue_full },
+	{"db_wb_written" ,     STAT_IS_FUNC, (stat_var**)ul_wb_get_written    },
+	{"db_wb_failed" ,      STAT_IS_FUNC, (stat_var**)ul_wb_get_failed     },
+	{"db_wb_batches" ,     STAT_IS_FUNC, (stat_var**)ul_wb_get_batches    },
 	{0,0,0}
 };
 
@@ -342,6 +356,12 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if(ul_istr_init()!=0)
+	{
+		LM_ERR("string pool initialization failed\n");
+		return -1;
+	}
+
 	/* Register cache timer */
 	if(ul_timer_procs<=0)
 	{
@@ -374,6 +394,16 @@ static int mod_init(void)
 		}
 	}
 
+	if (ul_wb_init() < 0) {
+		LM_ERR("failed to init the db write-back engine\n");
+		return -1;
+	}
+
+	if (ul_snapshot_init() < 0) {
+		LM_ERR("failed to init the snapshot\n");
+		return -1;
+	}
+
 	if (nat_bflag==(unsigned int)-1) {
 		nat_bflag = 0;
 	} else if ( nat_bflag>=8*sizeof(nat_bflag) ) {
@@ -419,6 +449,22 @@ static int child_init(int _rank)
 		}
 	}
 
+	/* load the snapshot before any process is forked */
+	if(_rank==PROC_INIT && ul_snapshot_load()<0)
+		return -1;
+
+	if(_rank==PROC_MAIN && ul_snapshot_fork()<0)
+		return -1;
+
+	/* db writers must be forked before the main process connects to db */
+	if(_rank==PROC_MAIN && ul_wb_async())
+	{
+		if(ul_wb_fork()<0) {
+			LM_ERR("failed to start the db writer processes\n");
+			return -1;
+		}
+	}
+
 	/* connecting to DB ? */
 	switch (db_mode) {
 		case NO_DB:
@@ -451,6 +497,9 @@ static int child_init(int _rank)
 	if (_rank==PROC_SIPINIT && db_mode!=DB_ONLY) {
 		/* if cache is used, populate domains from DB */
 		for( ptr=root ; ptr ; ptr=ptr->next) {
+			/* already loaded from the snapshot file */
+			if (ul_snapshot_loaded(ptr->d))
+				continue;
 			if (preload_udomain(ul_dbh, ptr->d) < 0) {
 				LM_ERR("child(%d): failed to preload domain '%.*s'\n",
 						_rank, ptr->name.len, ZSW(ptr->name.s));
@@ -496,13 +545,20 @@ static void destroy(void)
 	/* we need to sync DB in order to flush the cache */
 	if (ul_dbh) {
 		ul_unlock_locks();
+		/* write first what the db writers left in their queues */
+		ul_wb_destroy();
 		if (synchronize_all_udomains(0, 1) != 0) {
 			LM_ERR("flushing cache failed\n");
 		}
 		ul_dbf.close(ul_dbh);
 	}
 
+	/* save the location tables for the next start */
+	ul_unlock_locks();
+	ul_snapshot_destroy();
+
 	free_all_udomains();
+	ul_istr_destroy();
 	ul_destroy_locks();
 
 	/* free callbacks list */
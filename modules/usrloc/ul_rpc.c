@@ -27,6 +27,7 @@
 #include "ucontact.h"
 #include "udomain.h"
 #include "ul_mod.h"
+#include "ul_istr.h"
 #include "utime.h"
 
 /*! CSEQ nr used */
@@ -194,8 +195,40 @@ int rpc_dump_contact(rpc_t* rpc, void* ctx, void *ih, ucontact_t* c)
 	return 0;
 }
 
+/*! \brief memory used by the records and contacts of a domain */
+typedef struct ul_rpc_mem {
+	unsigned long records;
+	unsigned long contacts;
+	unsigned long bytes;
+	unsigned long chunks;   /*!< shm allocations */
+} ul_rpc_mem_t;
+
+static void ul_rpc_domain_mem(udomain_t* dom, ul_rpc_mem_t* mem)
+{
+	struct urecord* r;
+	ucontact_t* c;
+	int i;
+
+	memset(mem, 0, sizeof(ul_rpc_mem_t));
+	for(i=0; i<dom->size; i++) {
+		lock_ulslot( dom, i);
+		for( r = dom->table[i].first ; r ; r=r->next ) {
+			mem->records++;
+			mem->bytes += sizeof(urecord_t) + r->aor.len;
+			mem->chunks += 2;
+			for( c=r->contacts ; c ; c=c->next) {
+				mem->contacts++;
+				mem->bytes += c->msize;
+				mem->chunks += (c->sbuf!=(char*)(c+1)) ? 2 : 1;
+			}
+		}
+		unlock_ulslot( dom, i);
+	}
+}
+
 static void ul_rpc_dump(rpc_t* rpc, void* ctx)
 {
+	ul_rpc_mem_t mem;
 	struct urecord* r;
 	dlist_t* dl;
 	udomain_t* dom;
@@ -271,9 +304,12 @@ static void ul_rpc_dump(rpc_t* rpc, void* ctx)
 			rpc->fault(ctx, 500, "Internal error creating stats struct");
 			return;
 		}
-		if(rpc->struct_add(sh, "dd",
+		ul_rpc_domain_mem(dom, &mem);
+		if(rpc->struct_add(sh, "dddd",
 				"Records", n,
-				"Max-Slots", max)<0)
+				"Max-Slots", max,
+				"Contacts", (int)mem.contacts,
+				"Memory-KB", (int)(mem.bytes>>10))<0)
 		{
 			rpc->fault(ctx, 500, "Internal error adding stats");
 			return;
@@ -798,6 +834,71 @@ static const char* ul_rpc_db_expired_contacts_doc[2] = {
 	0
 };
 
+static const char* ul_rpc_mem_doc[2] = {
+	"Memory used by the location tables (all or the given one)",
+	0
+};
+
+static void ul_rpc_mem(rpc_t* rpc, void* ctx)
+{
+	ul_rpc_mem_t mem;
+	ul_istr_stats_t ist;
+	dlist_t* dl;
+	str table = {0, 0};
+	void* th;
+	int found;
+
+	rpc->scan(ctx, "*S", &table);
+
+	found = 0;
+	for( dl=root ; dl ; dl=dl->next ) {
+		if (table.len>0 && (dl->name.len!=table.len
+					|| memcmp(dl->name.s, table.s, table.len)))
+			continue;
+		found = 1;
+		ul_rpc_domain_mem(dl->d, &mem);
+		if (rpc->add(ctx, "{", &th) < 0)
+		{
+			rpc->fault(ctx, 500, "Internal error creating top rpc");
+			return;
+		}
+		if(rpc->struct_add(th, "Sddddd",
+				"Domain", &dl->name,
+				"Records", (int)mem.records,
+				"Contacts", (int)mem.contacts,
+				"Memory-KB", (int)(mem.bytes>>10),
+				"Contact-Avg", (mem.contacts)
+						? (int)(mem.bytes/mem.contacts) : 0,
+				"Chunks", (int)mem.chunks)<0)
+		{
+			rpc->fault(ctx, 500, "Internal error adding domain memory");
+			return;
+		}
+	}
+	if (!found) {
+		rpc->fault(ctx, 500, "Table not found");
+		return;
+	}
+	if (ul_intern_strings) {
+		ul_istr_get_stats(&ist);
+		if (rpc->add(ctx, "{", &th) < 0)
+		{
+			rpc->fault(ctx, 500, "Internal error creating top rpc");
+			return;
+		}
+		if(rpc->struct_add(th, "sdddd",
+				"Domain", "[string pool]",
+				"Strings", (int)ist.strings,
+				"References", (int)ist.refs,
+				"Memory-KB", (int)(ist.bytes>>10),
+				"Saved-KB", (int)(ist.saved>>10))<0)
+		{
+			rpc->fault(ctx, 500, "Internal error adding pool memory");
+			return;
+		}
+	}
+}
+
 rpc_export_t ul_rpc[] = {
 	{"ul.dump",   ul_rpc_dump,   ul_rpc_dump_doc,   0},
 	{"ul.lookup",   ul_rpc_lookup,   ul_rpc_lookup_doc,   0},
@@ -808,6 +909,7 @@ rpc_export_t ul_rpc[] = {
 	{"ul.db_users", ul_rpc_db_users, ul_rpc_db_users_doc, 0},
 	{"ul.db_contacts", ul_rpc_db_contacts, ul_rpc_db_contacts_doc, 0},
 	{"ul.db_expired_contacts", ul_rpc_db_expired_contacts, ul_rpc_db_expired_contacts_doc, 0},
+	{"ul.mem", ul_rpc_mem, ul_rpc_mem_doc, 0},
 	{0, 0, 0, 0}
 };
 
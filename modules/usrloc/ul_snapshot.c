@@ -0,0 +1,650 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ *  \brief USRLOC - Binary snapshot of the location tables
+ *  \ingroup usrloc
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "../../dprint.h"
+#include "../../ut.h"
+#include "../../crc.h"
+#include "../../pt.h"
+#include "../../sr_module.h"
+#include "../../timer_proc.h"
+#include "../../socket_info.h"
+#include "../../mem/mem.h"
+#include "ul_mod.h"
+#include "dlist.h"
+#include "udomain.h"
+#include "urecord.h"
+#include "ucontact.h"
+#include "ul_snapshot.h"
+
+#define UL_SNAP_MAGIC    "KULSNAP"
+#define UL_SNAP_VERSION  1
+#define UL_SNAP_ENDIAN   0x01020304
+
+/* entry types */
+#define UL_SNAP_DOMAIN   'D'
+#define UL_SNAP_RECORD   'R'
+#define UL_SNAP_CONTACT  'C'
+
+/* strings of a contact entry, after the fixed part */
+#define UL_SNAP_CSTRS    8
+
+/*! file header, the payload follows it */
+typedef struct ul_snap_hdr {
+	char magic[8];
+	uint32_t version;
+	uint32_t endian;     /*!< UL_SNAP_ENDIAN in the writer byte order */
+	uint32_t hdr_size;
+	uint32_t crc;        /*!< CRC32 of the payload */
+	uint64_t payload;    /*!< payload size */
+	int64_t created;
+	uint32_t domains;
+	uint32_t records;
+	uint32_t contacts;
+	uint32_t reserved;
+} ul_snap_hdr_t;
+
+/*! fixed part of a contact entry, followed by UL_SNAP_CSTRS strings
+ * (contact, ruid, received, path, callid, user_agent, instance, socket),
+ * each as a 32 bit length and the value */
+typedef struct ul_snap_contact {
+	int64_t expires;
+	int64_t last_modified;
+	int32_t q;
+	int32_t cseq;
+	uint32_t flags;
+	uint32_t cflags;
+	uint32_t methods;
+	uint32_t reg_id;
+	uint32_t state;
+	uint32_t reserved;
+} ul_snap_contact_t;
+
+/*! local buffer used to serialize a hash slot */
+typedef struct ul_snap_buf {
+	char* s;
+	int len;
+	int size;
+} ul_snap_buf_t;
+
+str ul_snapshot_file = {0, 0};
+int ul_snapshot_interval = 300;
+
+/* domains loaded from the snapshot (pkg, inherited by the children) */
+static udomain_t** ul_snap_domains = 0;
+static int ul_snap_domains_no = 0;
+static int ul_snap_domains_max = 0;
+/* set when the startup is complete, no snapshot is written before */
+static int ul_snap_ready = 0;
+
+
+int ul_snapshot_init(void)
+{
+	if (ul_snapshot_file.s==0)
+		return 0;
+	ul_snapshot_file.len = strlen(ul_snapshot_file.s);
+	if (ul_snapshot_file.len==0) {
+		ul_snapshot_file.s = 0;
+		return 0;
+	}
+	if (db_mode==DB_ONLY) {
+		LM_WARN("snapshot_file cannot be used in DB_ONLY db_mode -"
+				" ignoring it\n");
+		ul_snapshot_file.s = 0;
+		ul_snapshot_file.len = 0;
+		return 0;
+	}
+	if (ul_snapshot_interval>0 && !dont_fork) {
+		if (register_basic_timers(1)<0) {
+			LM_ERR("failed to register the snapshot process\n");
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+static inline unsigned int ul_snap_crc(unsigned int _crc, char* _p, int _len)
+{
+	while (_len--) {
+		_crc = crc_32_tab[((unsigned char)_crc ^ (unsigned char)*_p)] ^ (_crc >> 8);
+		_p++;
+	}
+	return _crc;
+}
+
+
+/* ================ writing ================ */
+
+static int ul_snap_put(ul_snap_buf_t* _b, void* _p, int _len)
+{
+	char* s;
+	int size;
+
+	if (_b->len + _len > _b->size) {
+		size = 2*_b->size;
+		if (size < _b->len + _len)
+			size = _b->len + _len;
+		s = (char*)pkg_realloc(_b->s, size);
+		if (s==0) {
+			LM_ERR("no more pkg memory\n");
+			return -1;
+		}
+		_b->s = s;
+		_b->size = size;
+	}
+	memcpy(_b->s + _b->len, _p, _len);
+	_b->len += _len;
+	return 0;
+}
+
+static int ul_snap_put_str(ul_snap_buf_t* _b, str* _s)
+{
+	uint32_t len;
+
+	len = (_s->s) ? _s->len : 0;
+	if (ul_snap_put(_b, &len, sizeof(len))<0)
+		return -1;
+	return (len) ? ul_snap_put(_b, _s->s, len) : 0;
+}
+
+static int ul_snap_put_type(ul_snap_buf_t* _b, uint32_t _t)
+{
+	return ul_snap_put(_b, &_t, sizeof(_t));
+}
+
+static int ul_snap_put_contact(ul_snap_buf_t* _b, ucontact_t* _c)
+{
+	ul_snap_contact_t sc;
+	str sock = {0, 0};
+
+	memset(&sc, 0, sizeof(sc));
+	sc.expires = _c->expires;
+	sc.last_modified = _c->last_modified;
+	sc.q = _c->q;
+	sc.cseq = _c->cseq;
+	sc.flags = _c->flags;
+	sc.cflags = _c->cflags;
+	sc.methods = _c->methods;
+	sc.reg_id = _c->reg_id;
+	sc.state = _c->state;
+	if (_c->sock)
+		sock = _c->sock->sock_str;
+	if (ul_snap_put_type(_b, UL_SNAP_CONTACT)<0
+			|| ul_snap_put(_b, &sc, sizeof(sc))<0
+			|| ul_snap_put_str(_b, &_c->c)<0
+			|| ul_snap_put_str(_b, &_c->ruid)<0
+			|| ul_snap_put_str(_b, &_c->received)<0
+			|| ul_snap_put_str(_b, &_c->path)<0
+			|| ul_snap_put_str(_b, &_c->callid)<0
+			|| ul_snap_put_str(_b, &_c->user_agent)<0
+			|| ul_snap_put_str(_b, &_c->instance)<0
+			|| ul_snap_put_str(_b, &sock)<0)
+		return -1;
+	return 0;
+}
+
+/*!
+ * \brief Write the local buffer to the file and reset it
+ */
+static int ul_snap_flush(int _fd, ul_snap_buf_t* _b, ul_snap_hdr_t* _h)
+{
+	char* p;
+	int n;
+	int len;
+
+	_h->crc = ul_snap_crc(_h->crc, _b->s, _b->len);
+	_h->payload += _b->len;
+	p = _b->s;
+	len = _b->len;
+	while (len>0) {
+		n = write(_fd, p, len);
+		if (n<0) {
+			if (errno==EINTR)
+				continue;
+			LM_ERR("failed to write the snapshot: %s\n", strerror(errno));
+			return -1;
+		}
+		p += n;
+		len -= n;
+	}
+	_b->len = 0;
+	return 0;
+}
+
+/*!
+ * \brief Serialize the valid contacts of a slot, under the slot lock
+ */
+static int ul_snap_slot(udomain_t* _d, int _i, ul_snap_buf_t* _b,
+		ul_snap_hdr_t* _h, time_t _now)
+{
+	urecord_t* r;
+	ucontact_t* c;
+	int rec;
+
+	lock_ulslot(_d, _i);
+	for (r=_d->table[_i].first; r; r=r->next) {
+		rec = 0;
+		for (c=r->contacts; c; c=c->next) {
+			if (!VALID_CONTACT(c, _now))
+				continue;
+			if (rec==0) {
+				if (ul_snap_put_type(_b, UL_SNAP_RECORD)<0
+						|| ul_snap_put_str(_b, &r->aor)<0)
+					goto error;
+				_h->records++;
+				rec = 1;
+			}
+			if (ul_snap_put_contact(_b, c)<0)
+				goto error;
+			_h->contacts++;
+		}
+	}
+	unlock_ulslot(_d, _i);
+	return 0;
+error:
+	unlock_ulslot(_d, _i);
+	return -1;
+}
+
+int ul_snapshot_write(void)
+{
+	ul_snap_hdr_t h;
+	ul_snap_buf_t b;
+	dlist_t* dl;
+	char* tmp;
+	time_t now;
+	int fd;
+	int i;
+
+	if (ul_snapshot_file.s==0)
+		return 0;
+	tmp = (char*)pkg_malloc(ul_snapshot_file.len + 5);
+	if (tmp==0) {
+		LM_ERR("no more pkg memory\n");
+		return -1;
+	}
+	memcpy(tmp, ul_snapshot_file.s, ul_snapshot_file.len);
+	memcpy(tmp + ul_snapshot_file.len, ".tmp", 5);
+	memset(&b, 0, sizeof(b));
+	memset(&h, 0, sizeof(h));
+
+	fd = open(tmp, O_WRONLY|O_CREAT|O_TRUNC, 0600);
+	if (fd<0) {
+		LM_ERR("failed to open %s: %s\n", tmp, strerror(errno));
+		pkg_free(tmp);
+		return -1;
+	}
+	/* header placeholder, written at the end */
+	if (write(fd, &h, sizeof(h))!=sizeof(h)) {
+		LM_ERR("failed to write %s: %s\n", tmp, strerror(errno));
+		goto error;
+	}
+	h.crc = 0xffffffff;
+	now = time(0);
+	for (dl=root; dl; dl=dl->next) {
+		if (ul_snap_put_type(&b, UL_SNAP_DOMAIN)<0
+				|| ul_snap_put_str(&b, &dl->name)<0)
+			goto error;
+		h.domains++;
+		for (i=0; i<dl->d->size; i++) {
+			if (ul_snap_slot(dl->d, i, &b, &h, now)<0)
+				goto error;
+			/* write in chunks, the slots are usually small */
+			if (b.len>=65536 && ul_snap_flush(fd, &b, &h)<0)
+				goto error;
+		}
+	}
+	if (b.len && ul_snap_flush(fd, &b, &h)<0)
+		goto error;
+
+	memcpy(h.magic, UL_SNAP_MAGIC, sizeof(UL_SNAP_MAGIC));
+	h.version = UL_SNAP_VERSION;
+	h.endian = UL_SNAP_ENDIAN;
+	h.hdr_size = sizeof(h);
+	h.crc = ~h.crc;
+	h.created = now;
+	if (pwrite(fd, &h, sizeof(h), 0)!=sizeof(h) || fsync(fd)<0) {
+		LM_ERR("failed to write %s: %s\n", tmp, strerror(errno));
+		goto error;
+	}
+	close(fd);
+	fd = -1;
+	if (rename(tmp, ul_snapshot_file.s)<0) {
+		LM_ERR("failed to rename %s: %s\n", tmp, strerror(errno));
+		goto error;
+	}
+	LM_DBG("snapshot written: %u domains, %u records, %u contacts\n",
+			h.domains, h.records, h.contacts);
+	if (b.s)
+		pkg_free(b.s);
+	pkg_free(tmp);
+	return 0;
+error:
+	if (fd>=0)
+		close(fd);
+	unlink(tmp);
+	if (b.s)
+		pkg_free(b.s);
+	pkg_free(tmp);
+	return -1;
+}
+
+
+static void ul_snapshot_timer(unsigned int ticks, void* param)
+{
+	if (ul_snapshot_write()<0)
+		LM_ERR("failed to write the usrloc snapshot\n");
+}
+
+int ul_snapshot_fork(void)
+{
+	if (ul_snapshot_file.s==0)
+		return 0;
+	ul_snap_ready = 1;
+	if (ul_snapshot_interval<=0 || dont_fork)
+		return 0;
+	if (fork_basic_timer(PROC_TIMER, "USRLOC snapshot", 0 /*socks flag*/,
+				ul_snapshot_timer, 0, ul_snapshot_interval)<0) {
+		LM_ERR("failed to start the snapshot process\n");
+		return -1;
+	}
+	return 0;
+}
+
+void ul_snapshot_destroy(void)
+{
+	if (ul_snapshot_file.s==0 || ul_snap_ready==0)
+		return;
+	if (ul_snapshot_write()<0)
+		LM_ERR("failed to write the final usrloc snapshot\n");
+	else
+		LM_INFO("usrloc snapshot written to %.*s\n",
+				ul_snapshot_file.len, ul_snapshot_file.s);
+}
+
+
+/* ================ loading ================ */
+
+static inline int ul_snap_get(char** _p, char* _end, void* _v, int _len)
+{
+	if (_end - *_p < _len)
+		return -1;
+	memcpy(_v, *_p, _len);
+	*_p += _len;
+	return 0;
+}
+
+/* the value is not copied, it points to the mapped file */
+static inline int ul_snap_get_str(char** _p, char* _end, str* _s)
+{
+	uint32_t len;
+
+	if (ul_snap_get(_p, _end, &len, sizeof(len))<0 || _end - *_p < len)
+		return -1;
+	_s->s = (len) ? *_p : 0;
+	_s->len = len;
+	*_p += len;
+	return 0;
+}
+
+static struct socket_info* ul_snap_sock(str* _s)
+{
+	char buf[MAX_SOCKET_STR + 1];
+	struct socket_info* si;
+	str host;
+	int port;
+	int proto;
+
+	if (_s->len==0)
+		return 0;
+	if (_s->len>MAX_SOCKET_STR) {
+		LM_ERR("bad socket <%.*s>\n", _s->len, _s->s);
+		return 0;
+	}
+	memcpy(buf, _s->s, _s->len);
+	buf[_s->len] = 0;
+	if (parse_phostport(buf, &host.s, &host.len, &port, &proto)!=0) {
+		LM_ERR("bad socket <%s>\n", buf);
+		return 0;
+	}
+	si = grep_sock_info(&host, (unsigned short)port, proto);
+	if (si==0)
+		LM_INFO("non-local socket <%s>...ignoring\n", buf);
+	return si;
+}
+
+/*!
+ * \brief Insert a contact entry in the location table
+ */
+static int ul_snap_load_contact(udomain_t* _d, urecord_t** _r, str* _aor,
+		ul_snap_contact_t* _sc, str* _v)
+{
+	ucontact_info_t ci;
+	ucontact_t* c;
+
+	if (*_r==0 && get_urecord(_d, _aor, _r)>0) {
+		if (mem_insert_urecord(_d, _aor, _r)<0) {
+			LM_ERR("failed to create a record\n");
+			return -1;
+		}
+	}
+	memset(&ci, 0, sizeof(ci));
+	ci.expires = _sc->expires;
+	ci.last_modified = _sc->last_modified;
+	ci.q = _sc->q;
+	ci.cseq = _sc->cseq;
+	ci.flags = _sc->flags;
+	ci.cflags = _sc->cflags;
+	ci.methods = _sc->methods;
+	ci.reg_id = _sc->reg_id;
+	ci.c = &_v[0];
+	ci.ruid = _v[1];
+	ci.received = _v[2];
+	ci.path = &_v[3];
+	ci.callid = &_v[4];
+	ci.user_agent = &_v[5];
+	ci.instance = _v[6];
+	ci.sock = ul_snap_sock(&_v[7]);
+	ci.tcpconn_id = -1;
+	c = mem_insert_ucontact(*_r, &_v[0], &ci);
+	if (c==0) {
+		LM_ERR("inserting contact failed\n");
+		return -1;
+	}
+	c->state = (cstate_t)_sc->state;
+	return 0;
+}
+
+/*!
+ * \brief Walk the payload
+ * \param _p payload
+ * \param _end end of payload
+ * \param _load 0 only checks the structure, 1 loads the contacts
+ * \return 0 on success, -1 on error
+ */
+static int ul_snap_parse(char* _p, char* _end, int _load)
+{
+	ul_snap_contact_t sc;
+	str v[UL_SNAP_CSTRS];
+	udomain_t* d;
+	urecord_t* r;
+	uint32_t t;
+	str name;
+	str aor = {0, 0};
+	int i;
+
+	d = 0;
+	r = 0;
+	while (_p<_end) {
+		if (ul_snap_get(&_p, _end, &t, sizeof(t))<0)
+			return -1;
+		switch (t) {
+			case UL_SNAP_DOMAIN:
+				if (ul_snap_get_str(&_p, _end, &name)<0)
+					return -1;
+				if (!_load)
+					break;
+				d = 0;
+				if (ul_snap_domains_no>=ul_snap_domains_max)
+					return -1;
+				if (find_domain(&name, &d)!=0) {
+					LM_INFO("domain '%.*s' from snapshot not used -"
+							" skipping it\n", name.len, ZSW(name.s));
+					d = 0;
+					break;
+				}
+				ul_snap_domains[ul_snap_domains_no++] = d;
+				break;
+			case UL_SNAP_RECORD:
+				if (ul_snap_get_str(&_p, _end, &aor)<0 || aor.len==0)
+					return -1;
+				r = 0;
+				break;
+			case UL_SNAP_CONTACT:
+				if (aor.len==0 || ul_snap_get(&_p, _end, &sc, sizeof(sc))<0)
+					return -1;
+				for (i=0; i<UL_SNAP_CSTRS; i++)
+					if (ul_snap_get_str(&_p, _end, &v[i])<0)
+						return -1;
+				if (v[1].len==0 || sc.state>CS_DIRTY)
+					return -1; /* no ruid or bad state */
+				if (_load && d
+						&& ul_snap_load_contact(d, &r, &aor, &sc, v)<0)
+					return -1;
+				break;
+			default:
+				return -1;
+		}
+	}
+	return 0;
+}
+
+int ul_snapshot_load(void)
+{
+	ul_snap_hdr_t* h;
+	struct stat st;
+	char* map;
+	char* p;
+	unsigned int crc;
+	int ret;
+	int fd;
+
+	if (ul_snapshot_file.s==0)
+		return 0;
+	fd = open(ul_snapshot_file.s, O_RDONLY);
+	if (fd<0) {
+		if (errno==ENOENT) {
+			LM_INFO("no usrloc snapshot %.*s\n", ul_snapshot_file.len,
+					ul_snapshot_file.s);
+			return 0;
+		}
+		LM_ERR("failed to open %.*s: %s\n", ul_snapshot_file.len,
+				ul_snapshot_file.s, strerror(errno));
+		return 0;
+	}
+	ret = 0;
+	map = MAP_FAILED;
+	if (fstat(fd, &st)<0 || st.st_size<sizeof(ul_snap_hdr_t)) {
+		LM_ERR("invalid snapshot %.*s - ignoring it\n",
+				ul_snapshot_file.len, ul_snapshot_file.s);
+		goto done;
+	}
+	map = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map==MAP_FAILED) {
+		LM_ERR("failed to map %.*s: %s\n", ul_snapshot_file.len,
+				ul_snapshot_file.s, strerror(errno));
+		goto done;
+	}
+	h = (ul_snap_hdr_t*)map;
+	if (memcmp(h->magic, UL_SNAP_MAGIC, sizeof(UL_SNAP_MAGIC))!=0
+			|| h->endian!=UL_SNAP_ENDIAN) {
+		LM_ERR("%.*s is not a usrloc snapshot of this host - ignoring it\n",
+				ul_snapshot_file.len, ul_snapshot_file.s);
+		goto done;
+	}
+	if (h->version!=UL_SNAP_VERSION) {
+		LM_ERR("unsupported snapshot version %u (expected %u) - ignoring"
+				" it\n", h->version, UL_SNAP_VERSION);
+		goto done;
+	}
+	if (h->hdr_size!=sizeof(ul_snap_hdr_t)
+			|| h->payload!=(uint64_t)(st.st_size - h->hdr_size)) {
+		LM_ERR("truncated snapshot %.*s - ignoring it\n",
+				ul_snapshot_file.len, ul_snapshot_file.s);
+		goto done;
+	}
+	p = map + h->hdr_size;
+	crc = ~ul_snap_crc(0xffffffff, p, h->payload);
+	if (crc!=h->crc || ul_snap_parse(p, p + h->payload, 0)<0) {
+		LM_ERR("corrupted snapshot %.*s - ignoring it\n",
+				ul_snapshot_file.len, ul_snapshot_file.s);
+		goto done;
+	}
+	if (h->domains) {
+		ul_snap_domains = (udomain_t**)pkg_malloc(
+				h->domains*sizeof(udomain_t*));
+		if (ul_snap_domains==0) {
+			LM_ERR("no more pkg memory\n");
+			ret = -1;
+			goto done;
+		}
+		ul_snap_domains_max = h->domains;
+	}
+	if (ul_snap_parse(p, p + h->payload, 1)<0) {
+		LM_ERR("failed to load the snapshot\n");
+		ret = -1;
+		goto done;
+	}
+	LM_INFO("loaded %u records and %u contacts from snapshot %.*s"
+			" (created %ld seconds ago)\n", h->records, h->contacts,
+			ul_snapshot_file.len, ul_snapshot_file.s,
+			(long)(time(0) - h->created));
+done:
+	if (map!=MAP_FAILED)
+		munmap(map, st.st_size);
+	close(fd);
+	return ret;
+}
+
+int ul_snapshot_loaded(udomain_t* _d)
+{
+	int i;
+
+	for (i=0; i<ul_snap_domains_no; i++)
+		if (ul_snap_domains[i]==_d)
+			return 1;
+	return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ *  \brief USRLOC - Binary snapshot of the location tables
+ *
+ *  The in-memory location tables are periodically saved by a background
+ *  process in a binary file: a fixed header (magic, format version,
+ *  byte order, payload size, CRC32 of the payload) followed by the
+ *  domains and their contacts. The records are serialized one hash slot
+ *  at a time, so a slot lock is held only while its records are copied
+ *  to a local buffer. The file is written under a temporary name and
+ *  renamed when complete, so a reader never sees a partial snapshot.
+ *
+ *  At startup (PROC_INIT, before any worker is forked) the snapshot is
+ *  mmap()ed, checked and loaded in the location tables; the domains
+ *  loaded from it are not preloaded from database anymore.
+ *  \ingroup usrloc
+ */
+
+#ifndef _UL_SNAPSHOT_H
+#define _UL_SNAPSHOT_H
+
+#include "udomain.h"
+
+extern str ul_snapshot_file;      /*!< snapshot path, disabled if not set */
+extern int ul_snapshot_interval;  /*!< seconds between snapshots */
+
+/*! \brief checks the params and registers the snapshot process */
+int ul_snapshot_init(void);
+
+/*! \brief loads the snapshot, called with rank==PROC_INIT */
+int ul_snapshot_load(void);
+
+/*! \brief true if the domain was loaded from the snapshot */
+int ul_snapshot_loaded(udomain_t* _d);
+
+/*! \brief forks the snapshot process, called with rank==PROC_MAIN */
+int ul_snapshot_fork(void);
+
+/*! \brief writes the snapshot file
+ * \return 0 on success, -1 on error */
+int ul_snapshot_write(void);
+
+/*! \brief writes the final snapshot at shutdown (main process) */
+void ul_snapshot_destroy(void);
+
+#endif /* _UL_SNAPSHOT_H */
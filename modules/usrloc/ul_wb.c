@@ -0,0 +1,452 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ *  \brief USRLOC - Asynchronous write-back of the contacts
+ *  \ingroup usrloc
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../../dprint.h"
+#include "../../ut.h"
+#include "../../pt.h"
+#include "../../sr_module.h"
+#include "../../globals.h"
+#include "../../locking.h"
+#include "../../timer_proc.h"
+#include "../../cfg/cfg_struct.h"
+#include "../../mem/shm_mem.h"
+#include "../../lib/srdb1/db.h"
+#include "ul_mod.h"
+#include "ul_wb.h"
+
+/*! writers sleep time when their queue is empty, in us */
+#define UL_WB_SLEEP_US	100000
+
+/*! snapshot of a contact, the strings are allocated after the structure */
+typedef struct ul_wb_job {
+	struct ul_wb_job* next;
+	int op;
+	str aor;
+	ucontact_t c;
+} ul_wb_job_t;
+
+/*! queue of a writer process */
+typedef struct ul_wb_queue {
+	gen_lock_t lock;
+	ul_wb_job_t* first;
+	ul_wb_job_t* last;
+	int size;
+	/* statistics, changed only under lock */
+	unsigned long full;
+	unsigned long written;
+	unsigned long failed;
+	unsigned long batches;
+} ul_wb_queue_t;
+
+int ul_db_writers = 0;
+int ul_db_batch_size = 100;
+int ul_db_queue_max = 100000;
+
+static ul_wb_queue_t* ul_wb_queues = 0;
+/* max. size of a writer queue */
+static int ul_wb_queue_size = 0;
+/* use insert_update for the updates */
+static int ul_wb_upsert = 0;
+
+
+int ul_wb_init(void)
+{
+	int i;
+
+	if (ul_db_writers<=0) {
+		ul_db_writers = 0;
+		return 0;
+	}
+	if (db_mode!=WRITE_BACK) {
+		LM_ERR("db_writers can be used only in write-back db_mode\n");
+		return -1;
+	}
+	if (ul_xavp_contact_name.s) {
+		LM_WARN("db_writers cannot be used with xavp_contact - ignoring"
+				" it\n");
+		ul_db_writers = 0;
+		return 0;
+	}
+	if (dont_fork) {
+		LM_WARN("db_writers ignored in no-fork mode\n");
+		ul_db_writers = 0;
+		return 0;
+	}
+	if (ul_db_batch_size<=0)
+		ul_db_batch_size = 1;
+	ul_wb_queue_size = ul_db_queue_max / ul_db_writers;
+	if (ul_wb_queue_size<=0)
+		ul_wb_queue_size = 1;
+	ul_wb_upsert = ul_db_ops_ruid
+		&& DB_CAPABILITY(ul_dbf, DB_CAP_INSERT_UPDATE);
+
+	ul_wb_queues = (ul_wb_queue_t*)shm_malloc(
+			ul_db_writers*sizeof(ul_wb_queue_t));
+	if (ul_wb_queues==0) {
+		LM_ERR("no more shared memory\n");
+		return -1;
+	}
+	memset(ul_wb_queues, 0, ul_db_writers*sizeof(ul_wb_queue_t));
+	for (i=0; i<ul_db_writers; i++) {
+		if (lock_init(&ul_wb_queues[i].lock)==0) {
+			LM_ERR("failed to init the lock of writer queue %d\n", i);
+			goto error;
+		}
+	}
+	if (register_basic_timers(ul_db_writers)<0) {
+		LM_ERR("failed to register the db writer processes\n");
+		goto error;
+	}
+	return 0;
+error:
+	shm_free(ul_wb_queues);
+	ul_wb_queues = 0;
+	ul_db_writers = 0;
+	return -1;
+}
+
+
+/*!
+ * \brief Copy a string into the job buffer
+ * \note keeps a null s pointer (e.g. no received or path)
+ */
+static inline void ul_wb_str_copy(str* _dst, str* _src, char** _p)
+{
+	if (_src->s==0) {
+		_dst->s = 0;
+		_dst->len = 0;
+		return;
+	}
+	_dst->s = *_p;
+	_dst->len = _src->len;
+	if (_src->len)
+		memcpy(_dst->s, _src->s, _src->len);
+	*_p += _src->len;
+}
+
+
+/*!
+ * \brief Snapshot of a contact for writing it to the database
+ * \param _c contact
+ * \param _op operation
+ * \return job on success, 0 if out of memory
+ */
+static ul_wb_job_t* ul_wb_job_new(ucontact_t* _c, int _op)
+{
+	ul_wb_job_t* j;
+	char* p;
+	int len;
+
+	len = sizeof(ul_wb_job_t) + _c->aor->len + _c->ruid.len + _c->c.len
+		+ _c->received.len + _c->path.len + _c->callid.len
+		+ _c->user_agent.len + _c->instance.len;
+	j = (ul_wb_job_t*)shm_malloc(len);
+	if (j==0) {
+		LM_ERR("no more shared memory\n");
+		return 0;
+	}
+	j->next = 0;
+	j->op = _op;
+	memcpy(&j->c, _c, sizeof(ucontact_t));
+	j->c.next = j->c.prev = 0;
+#ifdef WITH_XAVP
+	j->c.xavp = 0;
+#endif
+	p = (char*)(j+1);
+	ul_wb_str_copy(&j->aor, _c->aor, &p);
+	j->c.aor = &j->aor;
+	ul_wb_str_copy(&j->c.ruid, &_c->ruid, &p);
+	ul_wb_str_copy(&j->c.c, &_c->c, &p);
+	ul_wb_str_copy(&j->c.received, &_c->received, &p);
+	ul_wb_str_copy(&j->c.path, &_c->path, &p);
+	ul_wb_str_copy(&j->c.callid, &_c->callid, &p);
+	ul_wb_str_copy(&j->c.user_agent, &_c->user_agent, &p);
+	ul_wb_str_copy(&j->c.instance, &_c->instance, &p);
+	return j;
+}
+
+
+int ul_wb_enqueue(urecord_t* _r, ucontact_t* _c, int _op)
+{
+	ul_wb_queue_t* q;
+	ul_wb_job_t* j;
+
+	q = &ul_wb_queues[_r->aorhash % ul_db_writers];
+	/* cheap check without lock, avoids the copy when the queue is full */
+	if (q->size>=ul_wb_queue_size)
+		goto full;
+	j = ul_wb_job_new(_c, _op);
+	if (j==0)
+		return -1;
+	lock_get(&q->lock);
+	if (q->size>=ul_wb_queue_size) {
+		lock_release(&q->lock);
+		shm_free(j);
+		goto full;
+	}
+	if (q->last)
+		q->last->next = j;
+	else
+		q->first = j;
+	q->last = j;
+	q->size++;
+	lock_release(&q->lock);
+	return 0;
+full:
+	lock_get(&q->lock);
+	q->full++;
+	lock_release(&q->lock);
+	return -1;
+}
+
+
+static void ul_wb_free_jobs(ul_wb_job_t* _jobs)
+{
+	ul_wb_job_t* j;
+
+	while (_jobs) {
+		j = _jobs;
+		_jobs = _jobs->next;
+		shm_free(j);
+	}
+}
+
+
+/*!
+ * \brief Run the database operation of a job
+ * \return 0 on success, -1 on failure
+ */
+static int ul_wb_run_job(ul_wb_job_t* _j)
+{
+	switch (_j->op) {
+		case UL_WB_INSERT:
+			return db_insert_ucontact(&_j->c);
+		case UL_WB_UPDATE:
+			if (ul_wb_upsert)
+				return db_insert_update_ucontact(&_j->c);
+			if (ul_db_update_as_insert)
+				return db_insert_ucontact(&_j->c);
+			return db_update_ucontact(&_j->c);
+		case UL_WB_DELETE:
+			return db_delete_ucontact(&_j->c);
+	}
+	LM_CRIT("BUG: unknown write-back operation %d\n", _j->op);
+	return -1;
+}
+
+
+/*!
+ * \brief Write a batch of jobs to the database and free them
+ *
+ * The batch is done in a single transaction if the database module
+ * supports it. If the transaction fails, it is rolled back and the jobs
+ * are replayed one by one, so that one bad row does not lose the others.
+ * \param _jobs list of jobs
+ * \param _n number of jobs
+ * \param _written set to the number of successful jobs
+ * \return number of failed jobs
+ */
+static int ul_wb_flush_jobs(ul_wb_job_t* _jobs, int _n, int* _written)
+{
+	ul_wb_job_t* j;
+	int failed;
+
+	failed = 0;
+	if (_n>1 && ul_dbf.start_transaction && ul_dbf.end_transaction
+			&& ul_dbf.abort_transaction
+			&& ul_dbf.start_transaction(ul_dbh, DB_LOCKING_NONE)==0) {
+		for (j=_jobs; j; j=j->next) {
+			if (ul_wb_run_job(j)<0) {
+				failed = 1;
+				break;
+			}
+		}
+		if (failed==0 && ul_dbf.end_transaction(ul_dbh)==0)
+			goto done;
+		ul_dbf.abort_transaction(ul_dbh);
+		LM_WARN("failed to write a batch of %d contacts, retrying them"
+				" one by one\n", _n);
+		failed = 0;
+	}
+	for (j=_jobs; j; j=j->next) {
+		if (ul_wb_run_job(j)<0) {
+			LM_ERR("failed to write contact to the database (aor: %.*s)\n",
+					j->aor.len, ZSW(j->aor.s));
+			failed++;
+		}
+	}
+done:
+	ul_wb_free_jobs(_jobs);
+	*_written = _n - failed;
+	return failed;
+}
+
+
+/*!
+ * \brief Detach up to ul_db_batch_size jobs from a queue
+ * \return number of jobs
+ */
+static int ul_wb_pop(ul_wb_queue_t* _q, ul_wb_job_t** _jobs)
+{
+	ul_wb_job_t* j;
+	int n;
+
+	*_jobs = _q->first;
+	if (_q->first==0)
+		return 0;
+	n = 1;
+	for (j=_q->first; j->next && n<ul_db_batch_size; j=j->next)
+		n++;
+	_q->first = j->next;
+	if (_q->first==0)
+		_q->last = 0;
+	j->next = 0;
+	_q->size -= n;
+	return n;
+}
+
+
+/*!
+ * \brief Main loop of a writer process
+ */
+static void ul_wb_writer(ul_wb_queue_t* _q)
+{
+	ul_wb_job_t* jobs;
+	int written;
+	int failed;
+	int n;
+
+	for(;;) {
+		lock_get(&_q->lock);
+		n = ul_wb_pop(_q, &jobs);
+		lock_release(&_q->lock);
+		if (n==0) {
+			sleep_us(UL_WB_SLEEP_US);
+			cfg_update();
+			continue;
+		}
+		failed = ul_wb_flush_jobs(jobs, n, &written);
+		lock_get(&_q->lock);
+		_q->batches++;
+		_q->written += written;
+		_q->failed += failed;
+		lock_release(&_q->lock);
+	}
+}
+
+
+int ul_wb_fork(void)
+{
+	char desc[32];
+	int pid;
+	int i;
+
+	for (i=0; i<ul_db_writers; i++) {
+		snprintf(desc, sizeof(desc), "USRLOC DB writer %d", i);
+		pid = fork_process(PROC_TIMER, desc, 0);
+		if (pid<0) {
+			LM_ERR("failed to fork db writer %d\n", i);
+			return -1;
+		}
+		if (pid==0) {
+			/* child */
+			if (cfg_child_init())
+				return -1;
+			ul_dbh = ul_dbf.init(&db_url);
+			if (ul_dbh==0) {
+				LM_ERR("db writer %d: failed to connect to database\n", i);
+				return -1;
+			}
+			ul_wb_writer(&ul_wb_queues[i]);
+		}
+	}
+	return 0;
+}
+
+
+void ul_wb_destroy(void)
+{
+	ul_wb_job_t* jobs;
+	int written;
+	int i;
+	int n;
+
+	if (ul_wb_queues==0)
+		return;
+	/* the writers are gone, flush what they left without locking */
+	for (i=0; i<ul_db_writers; i++) {
+		while ((n = ul_wb_pop(&ul_wb_queues[i], &jobs))>0) {
+			if (ul_dbh)
+				ul_wb_flush_jobs(jobs, n, &written);
+			else
+				ul_wb_free_jobs(jobs);
+		}
+	}
+	shm_free(ul_wb_queues);
+	ul_wb_queues = 0;
+	/* from now on the timer routines write synchronously */
+	ul_db_writers = 0;
+}
+
+
+#define UL_WB_STAT_SUM(field) \
+	do { \
+		unsigned long s; \
+		int i; \
+		s = 0; \
+		if (ul_wb_queues==0) \
+			return 0; \
+		for (i=0; i<ul_db_writers; i++) \
+			s += ul_wb_queues[i].field; \
+		return s; \
+	} while(0)
+
+unsigned long ul_wb_get_queued(void)
+{
+	UL_WB_STAT_SUM(size);
+}
+
+unsigned long ul_wb_get_queue_full(void)
+{
+	UL_WB_STAT_SUM(full);
+}
+
+unsigned long ul_wb_get_written(void)
+{
+	UL_WB_STAT_SUM(written);
+}
+
+unsigned long ul_wb_get_failed(void)
+{
+	UL_WB_STAT_SUM(failed);
+}
+
+unsigned long ul_wb_get_batches(void)
+{
+	UL_WB_STAT_SUM(batches);
+}
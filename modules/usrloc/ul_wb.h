@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*! \file
+ *  \brief USRLOC - Asynchronous write-back of the contacts
+ *
+ *  When db_writers is set, the usrloc timer does not write the dirty,
+ *  new and expired contacts to the database itself. It takes a snapshot
+ *  of each contact (while holding the slot lock, as before) into a job
+ *  allocated in shared memory and appends it to the queue of one of the
+ *  db_writers processes, picked by the AOR hash, so that all the
+ *  operations on a contact are done in order by the same writer. Each
+ *  writer process has its own database connection and flushes up to
+ *  db_batch_size jobs at a time, in a single transaction when the
+ *  database module supports it.
+ *  \ingroup usrloc
+ */
+
+#ifndef _UL_WB_H
+#define _UL_WB_H
+
+#include "urecord.h"
+#include "ucontact.h"
+
+#define UL_WB_INSERT 1
+#define UL_WB_UPDATE 2
+#define UL_WB_DELETE 3
+
+extern int ul_db_writers;     /*!< number of writer processes, 0 == sync */
+extern int ul_db_batch_size;  /*!< max. number of jobs per batch */
+extern int ul_db_queue_max;   /*!< max. number of queued jobs (all writers) */
+
+/*! \brief true if the timer should queue the db operations */
+#define ul_wb_async() (ul_db_writers>0)
+
+/*! \brief allocates the writer queues, must be called from mod_init */
+int ul_wb_init(void);
+
+/*! \brief forks the writer processes, must be called from child_init
+ * with rank==PROC_MAIN */
+int ul_wb_fork(void);
+
+/*! \brief writes the still queued jobs and frees the queues
+ * \note called only from the main process at shutdown, with ul_dbh open */
+void ul_wb_destroy(void);
+
+/*!
+ * \brief Queue a database operation for a contact
+ * \param _r record the contact belongs to
+ * \param _c contact, it is copied so it can be changed or freed afterwards
+ * \param _op UL_WB_INSERT, UL_WB_UPDATE or UL_WB_DELETE
+ * \return 0 on success, -1 if the queue is full or out of memory (the
+ * caller should do the operation itself or retry it later)
+ */
+int ul_wb_enqueue(urecord_t* _r, ucontact_t* _c, int _op);
+
+/* statistics */
+unsigned long ul_wb_get_queued(void);
+unsigned long ul_wb_get_queue_full(void);
+unsigned long ul_wb_get_written(void);
+unsigned long ul_wb_get_failed(void);
+unsigned long ul_wb_get_batches(void);
+
+#endif /* _UL_WB_H */
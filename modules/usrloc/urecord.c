@@ -45,6 +45,7 @@
 #include "usrloc.h"
 #include "utime.h"
 #include "ul_callback.h"
+#include "ul_wb.h"
 #include "usrloc.h"
 
 /*! contact matching mode */
@@ -347,6 +348,16 @@ static inline void wb_timer(urecord_t* _r)
 		}
 
 		if (!VALID_CONTACT(ptr, act_time)) {
+			/* Should we remove the contact from the database ? The
+			 * delete goes through the writer queue of the AoR, after the
+			 * pending jobs of the contact; if the queue is full keep the
+			 * contact and retry on the next run */
+			if (ul_wb_async() && st_expired_ucontact(ptr) == 1
+					&& ul_wb_enqueue(_r, ptr, UL_WB_DELETE) < 0) {
+				ptr = ptr->next;
+				continue;
+			}
+
 			/* run callbacks for EXPIRE event */
 			if (exists_ulcb_type(UL_CONTACT_EXPIRE)) {
 				run_ul_callbacks( UL_CONTACT_EXPIRE, ptr);
@@ -360,13 +371,11 @@ static inline void wb_timer(urecord_t* _r)
 			t = ptr;
 			ptr = ptr->next;
 
-			/* Should we remove the contact from the database ? */
-			if (st_expired_ucontact(t) == 1) {
-				if (db_delete_ucontact(t) < 0) {
-					LM_ERR("failed to delete contact from the database"
-							" (aor: %.*s)\n",
-							t->aor->len, ZSW(t->aor->s));
-				}
+			if (!ul_wb_async() && st_expired_ucontact(t) == 1
+					&& db_delete_ucontact(t) < 0) {
+				LM_ERR("failed to delete contact from the database"
+						" (aor: %.*s)\n",
+						t->aor->len, ZSW(t->aor->s));
 			}
 
 			mem_delete_ucontact(_r, t);
@@ -375,6 +384,14 @@ static inline void wb_timer(urecord_t* _r)
 			old_state = ptr->state;
 			op = st_flush_ucontact(ptr);
 
+			if (op != 0 && ul_wb_async()) {
+				/* on backpressure keep the old state, retried next time */
+				if (ul_wb_enqueue(_r, ptr,
+						(op == 1) ? UL_WB_INSERT : UL_WB_UPDATE) < 0)
+					ptr->state = old_state;
+				op = 0;
+			}
+
 			switch(op) {
 			case 0: /* do nothing, contact is synchronized */
 				break;
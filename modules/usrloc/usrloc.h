@@ -95,6 +95,10 @@ typedef struct ucontact {
 #ifdef WITH_XAVP
 	sr_xavp_t * xavp;       /*!< per contact xavps */
 #endif
+	char* sbuf;             /*!< Block holding the strings of the contact */
+	unsigned int sbuf_len;  /*!< Size of the string block */
+	unsigned int msize;     /*!< Shared memory used by the contact */
+	unsigned int istrs;     /*!< Strings kept in the usrloc string pool */
 	struct ucontact* next;  /*!< Next contact in the linked list */
 	struct ucontact* prev;  /*!< Previous contact in the linked list */
 } ucontact_t;
@@ -145,6 +145,9 @@ static inline void _wsconn_rm(ws_connection_t *wsc)
 	else if (wsc->sub_protocol == SUB_PROTOCOL_MSRP)
 		update_stat(ws_msrp_current_connections, -1);
 
+	if (wsc->frag_buf)
+		shm_free(wsc->frag_buf);
+	ws_deflate_destroy(wsc->deflate);
 	shm_free(wsc);
 }
 
@@ -193,7 +196,8 @@ void wsconn_destroy(void)
 	}
 }
 
-int wsconn_add(struct receive_info rcv, unsigned int sub_protocol)
+int wsconn_add(struct receive_info rcv, unsigned int sub_protocol,
+		ws_deflate_t *deflate)
 {
 	int cur_cons, max_cons;
 	int id = rcv.proto_reserved1;
@@ -215,6 +219,7 @@ int wsconn_add(struct receive_info rcv, unsigned int sub_protocol)
 	wsc->state = WS_S_OPEN;
 	wsc->rcv = rcv;
 	wsc->sub_protocol = sub_protocol;
+	wsc->deflate = deflate;
 	wsc->run_event = 0;
 	atomic_set(&wsc->refcnt, 0);
 
@@ -313,6 +318,9 @@ static void wsconn_dtor(ws_connection_t *wsc)
 	if (wsc->run_event)
 		wsconn_run_route(wsc);
 
+	if (wsc->frag_buf)
+		shm_free(wsc->frag_buf);
+	ws_deflate_destroy(wsc->deflate);
 	shm_free(wsc);
 
 	LM_DBG("wsconn_dtor for [%p] destroyed\n", wsc);
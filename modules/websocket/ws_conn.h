@@ -33,6 +33,7 @@
 
 #include "../../lib/kcore/kstats_wrapper.h"
 #include "../../lib/kmi/tree.h"
+#include "ws_deflate.h"
 
 typedef enum
 {
@@ -60,6 +61,12 @@ typedef struct ws_connection
 
 	unsigned int sub_protocol;
 
+	char *frag_buf;		/* payload of a fragmented message being */
+	unsigned int frag_len;	/* reassembled (shm), its length and the */
+	unsigned int frag_opcode; /* opcode of its first frame */
+
+	ws_deflate_t *deflate;	/* permessage-deflate, if negotiated */
+
 	atomic_t refcnt;
 	int      run_event;
 } ws_connection_t;
@@ -89,7 +96,8 @@ extern stat_var *ws_msrp_max_concurrent_connections;
 
 int wsconn_init(void);
 void wsconn_destroy(void);
-int wsconn_add(struct receive_info rcv, unsigned int sub_protocol);
+int wsconn_add(struct receive_info rcv, unsigned int sub_protocol,
+		ws_deflate_t *deflate);
 int wsconn_rm(ws_connection_t *wsc, ws_conn_eventroute_t run_event_route);
 int wsconn_update(ws_connection_t *wsc);
 void wsconn_close_now(ws_connection_t *wsc);
@@ -0,0 +1,619 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#include "../../dprint.h"
+#include "../../mem/mem.h"
+#include "../../mem/shm_mem.h"
+#include "ws_deflate.h"
+
+int ws_permessage_deflate = 0;
+int ws_deflate_server_no_context_takeover = 0;
+int ws_deflate_client_no_context_takeover = 0;
+int ws_deflate_server_max_window_bits = 15;
+int ws_deflate_client_max_window_bits = 15;
+int ws_deflate_compression_level = Z_DEFAULT_COMPRESSION;
+
+stat_var *ws_deflate_handshakes;
+stat_var *ws_deflate_tx_bytes;
+stat_var *ws_deflate_tx_compressed_bytes;
+stat_var *ws_deflate_rx_bytes;
+stat_var *ws_deflate_rx_compressed_bytes;
+stat_var *ws_deflate_cpu_usecs;
+
+static str str_permessage_deflate = str_init("permessage-deflate");
+static str str_server_no_context_takeover
+				= str_init("server_no_context_takeover");
+static str str_client_no_context_takeover
+				= str_init("client_no_context_takeover");
+static str str_server_max_window_bits = str_init("server_max_window_bits");
+static str str_client_max_window_bits = str_init("client_max_window_bits");
+
+/* end of a Z_SYNC_FLUSH, removed from the messages sent and added back to
+   the ones received (RFC 7692, section 7.2) */
+static unsigned char deflate_tail[4] = {0x00, 0x00, 0xff, 0xff};
+
+/* Per process streams for the connections without context takeover,
+   reset after each message.  tx is indexed by the window bits, the 15
+   bits rx stream can inflate data compressed with any window. */
+static z_stream *tx_streams[16];
+static z_stream *rx_stream;
+
+#define MIN_SERVER_WINDOW_BITS	9	/* zlib does not deflate with 8 */
+#define MIN_CLIENT_WINDOW_BITS	8
+#define MAX_WINDOW_BITS		15
+
+typedef struct ws_deflate_offer
+{
+	int server_no_context_takeover;
+	int client_no_context_takeover;
+	int server_max_window_bits;	/* 0 if not present */
+	int client_max_window_bits;	/* 0 if not present, -1 if no value */
+} ws_deflate_offer_t;
+
+static voidpf zalloc_shm(voidpf opaque, uInt items, uInt size)
+{
+	return shm_malloc(items * size);
+}
+
+static void zfree_shm(voidpf opaque, voidpf p)
+{
+	shm_free(p);
+}
+
+static voidpf zalloc_pkg(voidpf opaque, uInt items, uInt size)
+{
+	return pkg_malloc(items * size);
+}
+
+static void zfree_pkg(voidpf opaque, voidpf p)
+{
+	pkg_free(p);
+}
+
+static z_stream *stream_new(int shared, int compress, int wbits)
+{
+	z_stream *zs;
+	int ret;
+
+	zs = shared ? shm_malloc(sizeof(z_stream))
+			: pkg_malloc(sizeof(z_stream));
+	if (zs == NULL)
+	{
+		LM_ERR("allocating %s memory\n", shared ? "shared" : "pkg");
+		return NULL;
+	}
+	memset(zs, 0, sizeof(z_stream));
+	zs->zalloc = shared ? zalloc_shm : zalloc_pkg;
+	zs->zfree = shared ? zfree_shm : zfree_pkg;
+
+	/* negative window bits - raw deflate data, without zlib header */
+	if (compress)
+		ret = deflateInit2(zs, ws_deflate_compression_level,
+				Z_DEFLATED, -wbits, 8, Z_DEFAULT_STRATEGY);
+	else
+		ret = inflateInit2(zs, -wbits);
+	if (ret != Z_OK)
+	{
+		LM_ERR("initialising zlib stream (%d)\n", ret);
+		if (shared)
+			shm_free(zs);
+		else
+			pkg_free(zs);
+		return NULL;
+	}
+
+	return zs;
+}
+
+static void stream_free(z_stream *zs, int compress)
+{
+	if (compress)
+		deflateEnd(zs);
+	else
+		inflateEnd(zs);
+	shm_free(zs);
+}
+
+static inline void cpu_time(struct timespec *ts)
+{
+	if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, ts) < 0)
+		memset(ts, 0, sizeof(struct timespec));
+}
+
+static inline void update_cpu_stat(struct timespec *start)
+{
+	struct timespec end;
+	long usecs;
+
+	cpu_time(&end);
+	usecs = (end.tv_sec - start->tv_sec) * 1000000
+			+ (end.tv_nsec - start->tv_nsec) / 1000;
+	if (usecs > 0)
+		update_stat(ws_deflate_cpu_usecs, usecs);
+}
+
+int ws_deflate_init(void)
+{
+	if (!ws_permessage_deflate)
+		return 0;
+
+	if (ws_deflate_server_max_window_bits < MIN_SERVER_WINDOW_BITS
+		|| ws_deflate_server_max_window_bits > MAX_WINDOW_BITS)
+	{
+		LM_ERR("deflate_server_max_window_bits must be between %d and "
+			"%d\n", MIN_SERVER_WINDOW_BITS, MAX_WINDOW_BITS);
+		return -1;
+	}
+	if (ws_deflate_client_max_window_bits < MIN_CLIENT_WINDOW_BITS
+		|| ws_deflate_client_max_window_bits > MAX_WINDOW_BITS)
+	{
+		LM_ERR("deflate_client_max_window_bits must be between %d and "
+			"%d\n", MIN_CLIENT_WINDOW_BITS, MAX_WINDOW_BITS);
+		return -1;
+	}
+	if (ws_deflate_compression_level < Z_DEFAULT_COMPRESSION
+		|| ws_deflate_compression_level > Z_BEST_COMPRESSION)
+	{
+		LM_ERR("deflate_compression_level must be between %d and %d\n",
+			Z_DEFAULT_COMPRESSION, Z_BEST_COMPRESSION);
+		return -1;
+	}
+
+	return 0;
+}
+
+unsigned long ws_deflate_ratio(void)
+{
+	unsigned long plain, compressed;
+
+	plain = get_stat_val(ws_deflate_tx_bytes)
+			+ get_stat_val(ws_deflate_rx_bytes);
+	compressed = get_stat_val(ws_deflate_tx_compressed_bytes)
+			+ get_stat_val(ws_deflate_rx_compressed_bytes);
+	if (plain == 0)
+		return 0;
+
+	/* size of the compressed data, in percents of the original one */
+	return compressed * 100 / plain;
+}
+
+/* next ';' separated token in [*p, end), without the white spaces */
+static int next_token(char **p, char *end, str *tok)
+{
+	char *s = *p, *e;
+
+	if (s >= end)
+		return 0;
+	for (e = s; e < end && *e != ';'; e++);
+	*p = e + 1;
+
+	while (s < e && (*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n'))
+		s++;
+	while (e > s && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\r'
+				|| e[-1] == '\n'))
+		e--;
+	tok->s = s;
+	tok->len = e - s;
+	return 1;
+}
+
+static int window_bits_value(str *val, int min)
+{
+	int bits = 0, i;
+
+	if (val->len >= 2 && val->s[0] == '"' && val->s[val->len - 1] == '"')
+	{
+		val->s++;
+		val->len -= 2;
+	}
+	if (val->len < 1 || val->len > 2)
+		return -1;
+	for (i = 0; i < val->len; i++)
+	{
+		if (val->s[i] < '0' || val->s[i] > '9')
+			return -1;
+		bits = bits * 10 + val->s[i] - '0';
+	}
+	if (bits < min || bits > MAX_WINDOW_BITS)
+		return -1;
+
+	return bits;
+}
+
+#define param_is(name, val) ((name).len == (val).len \
+			&& strncasecmp((name).s, (val).s, (val).len) == 0)
+
+/* 1 if [p, end) is a valid permessage-deflate offer, 0 if not */
+static int parse_offer(char *p, char *end, ws_deflate_offer_t *o)
+{
+	str tok, name, val;
+	char *eq;
+
+	memset(o, 0, sizeof(ws_deflate_offer_t));
+
+	if (!next_token(&p, end, &tok) || !param_is(tok, str_permessage_deflate))
+		return 0;
+
+	while (next_token(&p, end, &tok))
+	{
+		if (tok.len == 0)
+			continue;
+
+		name = tok;
+		val.s = NULL;
+		val.len = 0;
+		if ((eq = memchr(tok.s, '=', tok.len)) != NULL)
+		{
+			name.len = eq - tok.s;
+			while (name.len > 0 && (name.s[name.len - 1] == ' '
+					|| name.s[name.len - 1] == '\t'))
+				name.len--;
+			val.s = eq + 1;
+			val.len = tok.s + tok.len - val.s;
+			while (val.len > 0 && (*val.s == ' ' || *val.s == '\t'))
+			{
+				val.s++;
+				val.len--;
+			}
+		}
+
+		if (param_is(name, str_server_no_context_takeover))
+		{
+			if (val.s || o->server_no_context_takeover)
+				return 0;
+			o->server_no_context_takeover = 1;
+		}
+		else if (param_is(name, str_client_no_context_takeover))
+		{
+			if (val.s || o->client_no_context_takeover)
+				return 0;
+			o->client_no_context_takeover = 1;
+		}
+		else if (param_is(name, str_server_max_window_bits))
+		{
+			if (!val.s || o->server_max_window_bits)
+				return 0;
+			o->server_max_window_bits = window_bits_value(&val,
+							MIN_CLIENT_WINDOW_BITS);
+			if (o->server_max_window_bits < 0)
+				return 0;
+		}
+		else if (param_is(name, str_client_max_window_bits))
+		{
+			if (o->client_max_window_bits)
+				return 0;
+			if (!val.s)
+				o->client_max_window_bits = -1;
+			else if ((o->client_max_window_bits = window_bits_value(
+					&val, MIN_CLIENT_WINDOW_BITS)) < 0)
+				return 0;
+		}
+		else
+		{
+			LM_DBG("unknown permessage-deflate parameter %.*s\n",
+				name.len, name.s);
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+int ws_deflate_negotiate(str *offers, ws_deflate_t **pdf, char *resp, int len)
+{
+	ws_deflate_offer_t o;
+	ws_deflate_t *df;
+	char *p, *end, *offer_end;
+	int server_wbits, client_wbits, n;
+
+	p = offers->s;
+	end = offers->s + offers->len;
+	for (; p < end; p = offer_end + 1)
+	{
+		if ((offer_end = memchr(p, ',', end - p)) == NULL)
+			offer_end = end;
+
+		if (!parse_offer(p, offer_end, &o))
+			continue;
+
+		server_wbits = ws_deflate_server_max_window_bits;
+		if (o.server_max_window_bits)
+		{
+			/* can't honour a limit under what zlib supports */
+			if (o.server_max_window_bits < MIN_SERVER_WINDOW_BITS)
+				continue;
+			if (o.server_max_window_bits < server_wbits)
+				server_wbits = o.server_max_window_bits;
+		}
+
+		/* the client window can only be limited if it offered to */
+		client_wbits = MAX_WINDOW_BITS;
+		if (o.client_max_window_bits)
+		{
+			client_wbits = ws_deflate_client_max_window_bits;
+			if (o.client_max_window_bits > 0
+				&& o.client_max_window_bits < client_wbits)
+				client_wbits = o.client_max_window_bits;
+		}
+
+		n = snprintf(resp, len, "%.*s%s%s",
+			str_permessage_deflate.len, str_permessage_deflate.s,
+			(o.server_no_context_takeover
+				|| ws_deflate_server_no_context_takeover)
+				? "; server_no_context_takeover" : "",
+			ws_deflate_client_no_context_takeover
+				? "; client_no_context_takeover" : "");
+		if (o.server_max_window_bits && n < len)
+			n += snprintf(resp + n, len - n, "; %.*s=%d",
+				str_server_max_window_bits.len,
+				str_server_max_window_bits.s, server_wbits);
+		if (o.client_max_window_bits && n < len)
+			n += snprintf(resp + n, len - n, "; %.*s=%d",
+				str_client_max_window_bits.len,
+				str_client_max_window_bits.s, client_wbits);
+		if (n >= len)
+		{
+			LM_ERR("extension response too long\n");
+			return -1;
+		}
+
+		df = shm_malloc(sizeof(ws_deflate_t));
+		if (df == NULL)
+		{
+			LM_ERR("allocating shared memory\n");
+			return -1;
+		}
+		memset(df, 0, sizeof(ws_deflate_t));
+		if (lock_init(&df->lock) == 0)
+		{
+			LM_ERR("initialising lock\n");
+			shm_free(df);
+			return -1;
+		}
+		if (!o.server_no_context_takeover
+				&& !ws_deflate_server_no_context_takeover)
+			df->flags |= WS_DEFLATE_SERVER_TAKEOVER;
+		if (!o.client_no_context_takeover
+				&& !ws_deflate_client_no_context_takeover)
+			df->flags |= WS_DEFLATE_CLIENT_TAKEOVER;
+		df->server_wbits = server_wbits;
+		/* zlib deflates with 9 bits when asked for 8 */
+		df->client_wbits = client_wbits < MIN_SERVER_WINDOW_BITS
+					? MIN_SERVER_WINDOW_BITS : client_wbits;
+
+		LM_DBG("accepted %.*s\n", n, resp);
+		*pdf = df;
+		update_stat(ws_deflate_handshakes, 1);
+		return 1;
+	}
+
+	return 0;
+}
+
+void ws_deflate_destroy(ws_deflate_t *df)
+{
+	if (df == NULL)
+		return;
+
+	if (df->tx)
+		stream_free(df->tx, 1);
+	if (df->rx)
+		stream_free(df->rx, 0);
+	lock_destroy(&df->lock);
+	shm_free(df);
+}
+
+int ws_deflate_compress(ws_deflate_t *df, char *in, unsigned int len,
+			char **out, unsigned int *olen)
+{
+	struct timespec start;
+	z_stream *zs;
+	unsigned int size, used;
+	char *buf, *nbuf;
+	int ret;
+
+	cpu_time(&start);
+
+	if (df->flags & WS_DEFLATE_SERVER_TAKEOVER)
+	{
+		if (df->tx == NULL
+			&& (df->tx = stream_new(1, 1, df->server_wbits)) == NULL)
+			return -1;
+		zs = df->tx;
+	}
+	else
+	{
+		if (tx_streams[df->server_wbits] == NULL
+			&& (tx_streams[df->server_wbits]
+				= stream_new(0, 1, df->server_wbits)) == NULL)
+			return -1;
+		zs = tx_streams[df->server_wbits];
+	}
+
+	/* room for the sync flush as well */
+	size = deflateBound(zs, len) + 16;
+	if ((buf = pkg_malloc(size)) == NULL)
+	{
+		LM_ERR("allocating pkg memory\n");
+		return -1;
+	}
+
+	zs->next_in = (Bytef *) in;
+	zs->avail_in = len;
+	zs->next_out = (Bytef *) buf;
+	zs->avail_out = size;
+	for (;;)
+	{
+		ret = deflate(zs, Z_SYNC_FLUSH);
+		if (ret != Z_OK && ret != Z_BUF_ERROR)
+		{
+			LM_ERR("compressing message (%d)\n", ret);
+			goto error;
+		}
+		if (zs->avail_in == 0 && zs->avail_out > 0)
+			break;
+
+		used = size - zs->avail_out;
+		if ((nbuf = pkg_realloc(buf, size * 2)) == NULL)
+		{
+			LM_ERR("allocating pkg memory\n");
+			goto error;
+		}
+		buf = nbuf;
+		size *= 2;
+		zs->next_out = (Bytef *) buf + used;
+		zs->avail_out = size - used;
+	}
+
+	*olen = size - zs->avail_out;
+	if (*olen >= sizeof(deflate_tail)
+		&& memcmp(buf + *olen - sizeof(deflate_tail), deflate_tail,
+				sizeof(deflate_tail)) == 0)
+		*olen -= sizeof(deflate_tail);
+	*out = buf;
+
+	if (!(df->flags & WS_DEFLATE_SERVER_TAKEOVER))
+		deflateReset(zs);
+
+	update_stat(ws_deflate_tx_bytes, len);
+	update_stat(ws_deflate_tx_compressed_bytes, *olen);
+	update_cpu_stat(&start);
+
+	return 0;
+
+error:
+	pkg_free(buf);
+	deflateReset(zs);
+	return -1;
+}
+
+int ws_deflate_decompress(ws_deflate_t *df, char *in, unsigned int len,
+			char **out, unsigned int *olen, unsigned int max)
+{
+	struct timespec start;
+	z_stream *zs;
+	unsigned int size, used;
+	char *buf, *nbuf;
+	int ret, tail = 0;
+
+	cpu_time(&start);
+
+	if (df->flags & WS_DEFLATE_CLIENT_TAKEOVER)
+	{
+		if (df->rx == NULL
+			&& (df->rx = stream_new(1, 0, df->client_wbits)) == NULL)
+			return -1;
+		zs = df->rx;
+	}
+	else
+	{
+		if (rx_stream == NULL
+			&& (rx_stream = stream_new(0, 0, MAX_WINDOW_BITS)) == NULL)
+			return -1;
+		zs = rx_stream;
+	}
+
+	size = len * 4 + 64;
+	if (size > max)
+		size = max;
+	/* one more byte for the 0 receive_msg() needs */
+	if ((buf = pkg_malloc(size + 1)) == NULL)
+	{
+		LM_ERR("allocating pkg memory\n");
+		return -1;
+	}
+
+	zs->next_in = (Bytef *) in;
+	zs->avail_in = len;
+	zs->next_out = (Bytef *) buf;
+	zs->avail_out = size;
+	for (;;)
+	{
+		if (zs->avail_out == 0)
+		{
+			if (size >= max)
+			{
+				LM_WARN("decompressed message is too long "
+					"(> %u)\n", max);
+				ret = -2;
+				goto error;
+			}
+			used = size;
+			size = size * 2 > max ? max : size * 2;
+			if ((nbuf = pkg_realloc(buf, size + 1)) == NULL)
+			{
+				LM_ERR("allocating pkg memory\n");
+				ret = -1;
+				goto error;
+			}
+			buf = nbuf;
+			zs->next_out = (Bytef *) buf + used;
+			zs->avail_out = size - used;
+		}
+
+		ret = inflate(zs, Z_SYNC_FLUSH);
+		if (ret == Z_STREAM_END)
+		{
+			/* final block - no more data in this context */
+			inflateReset(zs);
+			break;
+		}
+		if ((ret != Z_OK && ret != Z_BUF_ERROR)
+			|| (ret == Z_BUF_ERROR && zs->avail_in > 0
+				&& zs->avail_out > 0))
+		{
+			LM_WARN("invalid compressed message (%d)\n", ret);
+			ret = -1;
+			goto error;
+		}
+		if (zs->avail_in == 0 && zs->avail_out > 0)
+		{
+			if (tail)
+				break;
+			zs->next_in = deflate_tail;
+			zs->avail_in = sizeof(deflate_tail);
+			tail = 1;
+		}
+	}
+
+	*olen = size - zs->avail_out;
+	buf[*olen] = '\0';
+	*out = buf;
+
+	if (!(df->flags & WS_DEFLATE_CLIENT_TAKEOVER))
+		inflateReset(zs);
+
+	update_stat(ws_deflate_rx_compressed_bytes, len);
+	update_stat(ws_deflate_rx_bytes, *olen);
+	update_cpu_stat(&start);
+
+	return 0;
+
+error:
+	pkg_free(buf);
+	inflateReset(zs);
+	return ret;
+}
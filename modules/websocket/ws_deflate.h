@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef _WS_DEFLATE_H
+#define _WS_DEFLATE_H
+
+#include <zlib.h>
+
+#include "../../locking.h"
+#include "../../str.h"
+#include "../../lib/kcore/kstats_wrapper.h"
+
+/* permessage-deflate (RFC 7692) negotiated on a connection */
+#define WS_DEFLATE_SERVER_TAKEOVER	(1<<0)	/* keep the compression */
+#define WS_DEFLATE_CLIENT_TAKEOVER	(1<<1)	/* context between messages */
+
+typedef struct ws_deflate
+{
+	unsigned int flags;
+	int server_wbits;	/* LZ77 window of the messages we send */
+	int client_wbits;	/* and of the ones we receive */
+
+	/* The streams are only kept with context takeover, in shm, as any
+	   process may send on the connection.  tx is used under lock,
+	   which is also held while the frame is sent so that messages
+	   go out in the order they were compressed.  rx is only used by
+	   the process reading the connection. */
+	gen_lock_t lock;
+	z_stream *tx;
+	z_stream *rx;
+} ws_deflate_t;
+
+extern int ws_permessage_deflate;
+extern int ws_deflate_server_no_context_takeover;
+extern int ws_deflate_client_no_context_takeover;
+extern int ws_deflate_server_max_window_bits;
+extern int ws_deflate_client_max_window_bits;
+extern int ws_deflate_compression_level;
+
+extern stat_var *ws_deflate_handshakes;
+extern stat_var *ws_deflate_tx_bytes;
+extern stat_var *ws_deflate_tx_compressed_bytes;
+extern stat_var *ws_deflate_rx_bytes;
+extern stat_var *ws_deflate_rx_compressed_bytes;
+extern stat_var *ws_deflate_cpu_usecs;
+
+int ws_deflate_init(void);
+unsigned long ws_deflate_ratio(void);
+
+/* Parses a Sec-WebSocket-Extensions header body and accepts the first
+   usable permessage-deflate offer: returns 1 with *df allocated and the
+   response extension in resp (up to len bytes), 0 when nothing was
+   accepted and -1 on error. */
+int ws_deflate_negotiate(str *offers, ws_deflate_t **df, char *resp, int len);
+void ws_deflate_destroy(ws_deflate_t *df);
+
+/* Compress/decompress a whole message, the result is in pkg memory (0
+   terminated for decompress) and must be freed by the caller.  For tx,
+   df->lock must be held. */
+int ws_deflate_compress(ws_deflate_t *df, char *in, unsigned int len,
+			char **out, unsigned int *olen);
+int ws_deflate_decompress(ws_deflate_t *df, char *in, unsigned int len,
+			char **out, unsigned int *olen, unsigned int max);
+
+#endif /* _WS_DEFLATE_H */
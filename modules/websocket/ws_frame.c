@@ -27,7 +27,12 @@
  */
 
 #include <limits.h>
+#include <stdint.h>
+#include <string.h>
 #include <unistr.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 #include "../../events.h"
 #include "../../receive.h"
 #include "../../stats.h"
@@ -39,6 +44,7 @@
 #include "../../lib/kmi/tree.h"
 #include "../../mem/mem.h"
 #include "ws_conn.h"
+#include "ws_deflate.h"
 #include "ws_frame.h"
 #include "ws_mod.h"
 #include "ws_handshake.h"
@@ -100,6 +106,7 @@ typedef enum
 /* 0xb - 0xf are reserved for further control frames */
 
 int ws_keepalive_mechanism = DEFAULT_KEEPALIVE_MECHANISM;
+int ws_max_fragmented_size = DEFAULT_MAX_FRAGMENTED_SIZE;
 str ws_ping_application_data = {0, 0};
 
 stat_var *ws_failed_connections;
@@ -161,7 +168,9 @@ static int encode_and_send_ws_frame(ws_frame_t *frame, conn_close_t conn_close)
 		return -1;
 	}
 
-	if (frame->rsv1 || frame->rsv2 || frame->rsv3)
+	/* RSV1 marks the messages compressed with permessage-deflate */
+	if ((frame->rsv1 && frame->wsc->deflate == NULL)
+		|| frame->rsv2 || frame->rsv3)
 	{
 		LM_ERR("WebSocket reserved fields with non-zero values\n");
 		return -1;
@@ -215,7 +224,8 @@ static int encode_and_send_ws_frame(ws_frame_t *frame, conn_close_t conn_close)
 		return -1;
 	}
 	memset(send_buf, 0, sizeof(unsigned char) * frame_length);
-	send_buf[pos++] = 0x80 | (frame->opcode & 0xff);
+	send_buf[pos++] = 0x80 | (frame->rsv1 ? BYTE0_MASK_RSV1 : 0)
+				| (frame->opcode & 0xff);
 	if (extended_length == 0)
 		send_buf[pos++] = (frame->payload_len & 0xff);
 	else if (extended_length == 2)
@@ -400,12 +410,55 @@ static int close_connection(ws_connection_t **p_wsc, ws_close_type_t type,
 	return 0;
 }
 
+/* XOR the payload with the masking key, in place.  The key is repeated in
+   a 64 bit word (and in a vector register when built with SSE2/AVX2) so
+   that the payload is processed in blocks instead of byte by byte. */
+static void mask_payload(char *p, unsigned int len, unsigned char *key)
+{
+	unsigned int i;
+	uint32_t k32;
+	uint64_t k64, w;
+
+	memcpy(&k32, key, 4);
+	k64 = ((uint64_t) k32 << 32) | k32;
+
+#if defined(__AVX2__)
+	if (len >= 32)
+	{
+		__m256i vk = _mm256_set1_epi32((int) k32);
+		for (; len >= 32; p += 32, len -= 32)
+			_mm256_storeu_si256((__m256i *) p, _mm256_xor_si256(
+				_mm256_loadu_si256((__m256i *) p), vk));
+	}
+#endif
+#if defined(__SSE2__)
+	if (len >= 16)
+	{
+		__m128i vk = _mm_set1_epi32((int) k32);
+		for (; len >= 16; p += 16, len -= 16)
+			_mm_storeu_si128((__m128i *) p, _mm_xor_si128(
+				_mm_loadu_si128((__m128i *) p), vk));
+	}
+#endif
+	for (; len >= 8; p += 8, len -= 8)
+	{
+		memcpy(&w, p, 8);
+		w ^= k64;
+		memcpy(p, &w, 8);
+	}
+
+	/* every block above is a multiple of 4 bytes long, so the tail
+	   starts again with the first byte of the key */
+	for (i = 0; i < len; i++)
+		p[i] ^= key[i & 3];
+}
+
 static int decode_and_validate_ws_frame(ws_frame_t *frame,
                                         tcp_event_info_t *tcpinfo,
                                         short *err_code, str *err_text)
 {
-	unsigned int i, len = tcpinfo->len;
-	int mask_start, j;
+	unsigned int len = tcpinfo->len;
+	int mask_start;
 	char *buf = tcpinfo->buf;
 
 	LM_DBG("decoding WebSocket frame\n");
@@ -427,16 +480,22 @@ static int decode_and_validate_ws_frame(ws_frame_t *frame,
 	frame->opcode = (buf[0] & 0xff) & BYTE0_MASK_OPCODE;
 	frame->mask = (buf[1] & 0xff) & BYTE1_MASK_MASK;
 	
-	if (!frame->fin)
+	/* control frames must not be fragmented, data frames only if
+	   reassembly is enabled */
+	if (!frame->fin && (frame->opcode & 0x08 || ws_max_fragmented_size <= 0))
 	{
-		LM_WARN("WebSocket fragmentation not supported in the sip "
-			"sub-protocol\n");
+		LM_WARN("WebSocket fragmentation not supported for opcode "
+			"0x%x\n", (unsigned char) frame->opcode);
 		*err_code = 1002;
 		*err_text = str_status_protocol_error;
 		return -1;
 	}
 
-	if (frame->rsv1 || frame->rsv2 || frame->rsv3)
+	/* RSV1 is only valid on the first frame of a compressed message */
+	if ((frame->rsv1 && (frame->wsc->deflate == NULL
+			|| (frame->opcode != OPCODE_TEXT_FRAME
+				&& frame->opcode != OPCODE_BINARY_FRAME)))
+		|| frame->rsv2 || frame->rsv3)
 	{
 		LM_WARN("WebSocket reserved fields with non-zero values\n");
 		*err_code = 1002;
@@ -446,6 +505,7 @@ static int decode_and_validate_ws_frame(ws_frame_t *frame,
 
 	switch(frame->opcode)
 	{
+	case OPCODE_CONTINUATION:
 	case OPCODE_TEXT_FRAME:
 	case OPCODE_BINARY_FRAME:
 		LM_DBG("supported non-control frame: 0x%x\n",
@@ -539,12 +599,8 @@ static int decode_and_validate_ws_frame(ws_frame_t *frame,
 		return -1;
 	}
 	frame->payload_data = &buf[mask_start + 4];
-	for (i = 0; i < frame->payload_len; i++)
-	{
-		j = i % 4;
-		frame->payload_data[i]
-			= frame->payload_data[i] ^ frame->masking_key[j];
-	}
+	mask_payload(frame->payload_data, frame->payload_len,
+			frame->masking_key);
 
 	LM_DBG("Rx (decoded): %.*s\n",
 		(int) frame->payload_len, frame->payload_data);
@@ -607,6 +663,102 @@ static int handle_pong(ws_frame_t *frame)
 	return 0;
 }
 
+/* Collects the fragments of a text/binary message in the connection.
+   Returns 1 for a message received in a single frame (left in place in
+   the read buffer), 2 when frame is the last fragment (payload_data is
+   then the reassembled message, in shm, to be freed by the caller), 0
+   when more fragments are expected and -1 on error. */
+static int handle_fragment(ws_frame_t *frame, short *err_code, str *err_text)
+{
+	ws_connection_t *wsc = frame->wsc;
+	unsigned int len;
+	char *buf;
+
+	if (frame->opcode == OPCODE_CONTINUATION)
+	{
+		if (wsc->frag_buf == NULL)
+		{
+			LM_WARN("continuation frame without a fragmented "
+				"message\n");
+			goto protocol_error;
+		}
+	}
+	else if (wsc->frag_buf != NULL)
+	{
+		LM_WARN("new message before the last fragment of the "
+			"previous one\n");
+		goto protocol_error;
+	}
+	else if (frame->fin)
+		return 1;
+
+	len = wsc->frag_len + frame->payload_len;
+	if (len > (unsigned int) ws_max_fragmented_size || len < wsc->frag_len)
+	{
+		LM_WARN("fragmented message is too long (> %d)\n",
+			ws_max_fragmented_size);
+		*err_code = 1009;
+		*err_text = str_status_message_too_big;
+		goto error;
+	}
+
+	if ((buf = shm_malloc(sizeof(char) * (len + 1))) == NULL)
+	{
+		LM_ERR("allocating shared memory\n");
+		*err_code = 1009;
+		*err_text = str_status_message_too_big;
+		goto error;
+	}
+	if (wsc->frag_buf != NULL)
+	{
+		memcpy(buf, wsc->frag_buf, wsc->frag_len);
+		shm_free(wsc->frag_buf);
+	}
+	else
+		wsc->frag_opcode = frame->opcode
+				| (frame->rsv1 ? BYTE0_MASK_RSV1 : 0);
+	memcpy(&buf[wsc->frag_len], frame->payload_data, frame->payload_len);
+	wsc->frag_buf = buf;
+	wsc->frag_len = len;
+
+	if (!frame->fin)
+	{
+		LM_DBG("fragment received - %u bytes so far\n", len);
+		return 0;
+	}
+
+	/* receive_msg() expects a 0 terminated buffer */
+	buf[len] = '\0';
+	frame->opcode = wsc->frag_opcode & BYTE0_MASK_OPCODE;
+	frame->rsv1 = wsc->frag_opcode & BYTE0_MASK_RSV1;
+	frame->payload_data = buf;
+	frame->payload_len = len;
+	wsc->frag_buf = NULL;
+	wsc->frag_len = 0;
+
+	return 2;
+
+protocol_error:
+	*err_code = 1002;
+	*err_text = str_status_protocol_error;
+error:
+	if (wsc->frag_buf != NULL)
+	{
+		shm_free(wsc->frag_buf);
+		wsc->frag_buf = NULL;
+		wsc->frag_len = 0;
+	}
+	return -1;
+}
+
+static inline void free_message(char *msg_buf, char *zmsg_buf)
+{
+	if (msg_buf)
+		shm_free(msg_buf);
+	if (zmsg_buf)
+		pkg_free(zmsg_buf);
+}
+
 int ws_frame_receive(void *data)
 {
 	ws_frame_t frame;
@@ -616,6 +768,8 @@ int ws_frame_receive(void *data)
 	int ret         = 0;
 	short err_code  = 0;
 	str   err_text  = {NULL, 0};
+	char  *msg_buf  = NULL;
+	char  *zmsg_buf = NULL;
 
 	update_stat(ws_received_frames, 1);
 
@@ -646,8 +800,51 @@ int ws_frame_receive(void *data)
 
 	switch(opcode)
 	{
+	case OPCODE_CONTINUATION:
 	case OPCODE_TEXT_FRAME:
 	case OPCODE_BINARY_FRAME:
+		ret = handle_fragment(&frame, &err_code, &err_text);
+		if (ret <= 0)
+		{
+			if (ret < 0 && close_connection(&frame.wsc, LOCAL_CLOSE,
+						err_code, err_text) < 0)
+				LM_ERR("closing connection\n");
+
+			wsconn_put(frame.wsc);
+
+			return ret;
+		}
+		if (ret == 2)
+			msg_buf = frame.payload_data;
+
+		if (frame.rsv1)
+		{
+			ret = ws_deflate_decompress(frame.wsc->deflate,
+					frame.payload_data, frame.payload_len,
+					&zmsg_buf, &frame.payload_len,
+					ws_max_fragmented_size > 0
+						? ws_max_fragmented_size
+						: BUF_SIZE);
+			if (msg_buf)
+			{
+				shm_free(msg_buf);
+				msg_buf = NULL;
+			}
+			if (ret < 0)
+			{
+				if (close_connection(&frame.wsc, LOCAL_CLOSE,
+					ret == -2 ? 1009 : 1002,
+					ret == -2 ? str_status_message_too_big
+						: str_status_protocol_error) < 0)
+					LM_ERR("closing connection\n");
+
+				wsconn_put(frame.wsc);
+
+				return -1;
+			}
+			frame.payload_data = zmsg_buf;
+		}
+
 		if (likely(frame.wsc->sub_protocol == SUB_PROTOCOL_SIP))
 		{
 			LM_DBG("Rx SIP message:\n%.*s\n", frame.payload_len,
@@ -656,9 +853,11 @@ int ws_frame_receive(void *data)
 
 			wsconn_put(frame.wsc);
 
-			return receive_msg(frame.payload_data,
+			ret = receive_msg(frame.payload_data,
 						frame.payload_len,
 						tcpinfo->rcv);
+			free_message(msg_buf, zmsg_buf);
+			return ret;
 		}
 		else if (frame.wsc->sub_protocol == SUB_PROTOCOL_MSRP)
 		{
@@ -677,14 +876,17 @@ int ws_frame_receive(void *data)
 
 				wsconn_put(frame.wsc);
 
-				return sr_event_exec(SREV_TCP_MSRP_FRAME,
+				ret = sr_event_exec(SREV_TCP_MSRP_FRAME,
 							(void *) &tev);
+				free_message(msg_buf, zmsg_buf);
+				return ret;
 			}
 			else
 			{
 				LM_ERR("no callback registered for MSRP\n");
 
 				wsconn_put(frame.wsc);
+				free_message(msg_buf, zmsg_buf);
 
 				return -1;
 			}
@@ -721,6 +923,9 @@ int ws_frame_transmit(void *data)
 {
 	ws_event_info_t *wsev = (ws_event_info_t *) data;
 	ws_frame_t frame;
+	ws_deflate_t *df = NULL;
+	char *zbuf = NULL;
+	int ret;
 
 	memset(&frame, 0, sizeof(frame));
 	frame.fin = 1;
@@ -735,7 +940,36 @@ int ws_frame_transmit(void *data)
 	LM_DBG("Tx message:\n%.*s\n", frame.payload_len,
 			frame.payload_data);
 
-	if (encode_and_send_ws_frame(&frame, CONN_CLOSE_DONT) < 0)
+	if (frame.wsc && (df = frame.wsc->deflate) != NULL)
+	{
+		/* with context takeover the lock is kept until the frame is
+		   sent, the client must get the messages in order */
+		lock_get(&df->lock);
+		if (ws_deflate_compress(df, frame.payload_data,
+				frame.payload_len, &zbuf, &frame.payload_len) < 0)
+		{
+			lock_release(&df->lock);
+			LM_ERR("compressing message\n");
+			wsconn_put(frame.wsc);
+			return -1;
+		}
+		if (!(df->flags & WS_DEFLATE_SERVER_TAKEOVER))
+		{
+			lock_release(&df->lock);
+			df = NULL;
+		}
+		frame.rsv1 = 1;
+		frame.payload_data = zbuf;
+	}
+
+	ret = encode_and_send_ws_frame(&frame, CONN_CLOSE_DONT);
+
+	if (df)
+		lock_release(&df->lock);
+	if (zbuf)
+		pkg_free(zbuf);
+
+	if (ret < 0)
 	{	
 		LM_ERR("sending message\n");
 
@@ -52,6 +52,9 @@ extern int ws_keepalive_mechanism;
 
 #define DEFAULT_KEEPALIVE_TIMEOUT		180 /* seconds */
 
+#define DEFAULT_MAX_FRAGMENTED_SIZE		BUF_SIZE
+extern int ws_max_fragmented_size;
+
 extern str ws_ping_application_data;
 #define DEFAULT_PING_APPLICATION_DATA		SERVER_HDR
 #define DEFAULT_PING_APPLICATION_DATA_LEN	SERVER_HDR_LEN
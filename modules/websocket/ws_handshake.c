@@ -42,6 +42,7 @@
 #include "../sl/sl.h"
 #include "../tls/tls_cfg.h"
 #include "ws_conn.h"
+#include "ws_deflate.h"
 #include "ws_handshake.h"
 #include "ws_mod.h"
 #include "config.h"
@@ -69,6 +70,8 @@ static str str_hdr_sec_websocket_accept = str_init("Sec-WebSocket-Accept");
 static str str_hdr_sec_websocket_key = str_init("Sec-WebSocket-Key");
 static str str_hdr_sec_websocket_protocol = str_init("Sec-WebSocket-Protocol");
 static str str_hdr_sec_websocket_version = str_init("Sec-WebSocket-Version");
+static str str_hdr_sec_websocket_extensions
+				= str_init("Sec-WebSocket-Extensions");
 static str str_hdr_origin = str_init("Origin");
 static str str_hdr_access_control_allow_origin
 				= str_init("Access-Control-Allow-Origin");
@@ -79,6 +82,7 @@ static str str_hdr_access_control_allow_origin
 #define SEC_WEBSOCKET_PROTOCOL	(1<<4)
 #define SEC_WEBSOCKET_VERSION	(1<<5)
 #define ORIGIN			(1<<6)
+#define SEC_WEBSOCKET_EXTENSIONS	(1<<7)
 
 #define REQUIRED_HEADERS	(CONNECTION | UPGRADE | SEC_WEBSOCKET_KEY\
 					| SEC_WEBSOCKET_PROTOCOL\
@@ -96,6 +100,9 @@ static char headers_buf[HDR_BUF_LEN];
 
 static char key_buf[base64_enc_len(SHA_DIGEST_LENGTH)];
 
+#define EXT_BUF_LEN		(128)
+static char ext_buf[EXT_BUF_LEN];
+
 static int ws_send_reply(sip_msg_t *msg, int code, str *reason, str *hdrs)
 {
 	if (hdrs && hdrs->len > 0)
@@ -131,6 +138,7 @@ int ws_handle_handshake(struct sip_msg *msg)
 	struct hdr_field *hdr = msg->headers;
 	struct tcp_connection *con;
 	ws_connection_t *wsc;
+	ws_deflate_t *deflate = NULL;
 
 	/* Make sure that the connection is closed after the response _and_
 	   the existing connection (from the request) is reused for the
@@ -305,6 +313,27 @@ int ws_handle_handshake(struct sip_msg *msg)
 			origin = hdr->body;
 			hdr_flags |= ORIGIN;
 		}
+		/* Decode and negotiate Sec-WebSocket-Extensions */
+		else if (ws_permessage_deflate
+				&& cmp_hdrname_strzn(&hdr->name,
+				str_hdr_sec_websocket_extensions.s,
+				str_hdr_sec_websocket_extensions.len) == 0)
+		{
+			LM_DBG("found %.*s: %.*s\n",
+				hdr->name.len, hdr->name.s,
+				hdr->body.len, hdr->body.s);
+
+			/* the first acceptable offer wins */
+			if (deflate == NULL && ws_deflate_negotiate(&hdr->body,
+					&deflate, ext_buf, EXT_BUF_LEN) < 0)
+			{
+				ws_send_reply(msg, 500,
+					&str_status_internal_server_error,
+					NULL);
+				goto end;
+			}
+			hdr_flags |= SEC_WEBSOCKET_EXTENSIONS;
+		}
 
 		hdr = hdr->next;
 	}
@@ -366,7 +395,12 @@ int ws_handle_handshake(struct sip_msg *msg)
 				base64_enc_len(SHA_DIGEST_LENGTH));
 
 	/* Add the connection to the WebSocket connection table */
-	wsconn_add(msg->rcv, sub_protocol);
+	if (wsconn_add(msg->rcv, sub_protocol, deflate) < 0)
+	{
+		ws_send_reply(msg, 500, &str_status_internal_server_error,
+				NULL);
+		goto end;
+	}
 
 	/* Make sure Kamailio core sends future messages on this connection
 	   directly to this module */
@@ -410,6 +444,16 @@ int ws_handle_handshake(struct sip_msg *msg)
 					str_hdr_sec_websocket_protocol.s,
 					str_msrp.len, str_msrp.s);
 
+	if (deflate != NULL)
+		headers.len += snprintf(headers.s + headers.len,
+					HDR_BUF_LEN - headers.len,
+					"%.*s: %s\r\n",
+					str_hdr_sec_websocket_extensions.len,
+					str_hdr_sec_websocket_extensions.s,
+					ext_buf);
+	/* now owned by the connection */
+	deflate = NULL;
+
 	headers.len += snprintf(headers.s + headers.len,
 				HDR_BUF_LEN - headers.len,
 				"%.*s: %.*s\r\n"
@@ -444,6 +488,7 @@ int ws_handle_handshake(struct sip_msg *msg)
 	tcpconn_put(con);
 	return 1;
 end:
+	ws_deflate_destroy(deflate);
 	if (con)
 		tcpconn_put(con);
 	return 0;
@@ -92,11 +92,25 @@ static param_export_t params[]=
 	{ "keepalive_mechanism",	INT_PARAM, &ws_keepalive_mechanism },
 	{ "keepalive_timeout",		INT_PARAM, &ws_keepalive_timeout },
 	{ "ping_application_data",	STR_PARAM, &ws_ping_application_data.s },
+	{ "max_fragmented_size",	INT_PARAM, &ws_max_fragmented_size },
 
 	/* ws_handshake.c */
 	{ "sub_protocols",		INT_PARAM, &ws_sub_protocols },
 	{ "cors_mode",			INT_PARAM, &ws_cors_mode },
 
+	/* ws_deflate.c */
+	{ "permessage_deflate",		INT_PARAM, &ws_permessage_deflate },
+	{ "deflate_server_no_context_takeover",	INT_PARAM,
+				&ws_deflate_server_no_context_takeover },
+	{ "deflate_client_no_context_takeover",	INT_PARAM,
+				&ws_deflate_client_no_context_takeover },
+	{ "deflate_server_max_window_bits",	INT_PARAM,
+				&ws_deflate_server_max_window_bits },
+	{ "deflate_client_max_window_bits",	INT_PARAM,
+				&ws_deflate_client_max_window_bits },
+	{ "deflate_compression_level",	INT_PARAM,
+				&ws_deflate_compression_level },
+
 	/* ws_mod.c */
 	{ "keepalive_interval",		INT_PARAM, &ws_keepalive_interval },
 	{ "keepalive_processes",	INT_PARAM, &ws_keepalive_processes },
@@ -137,6 +151,15 @@ static stat_export_t stats[] =
 	{ "ws_sip_successful_handshakes",      0, &ws_sip_successful_handshakes },
 	{ "ws_msrp_successful_handshakes",     0, &ws_msrp_successful_handshakes },
 
+	/* ws_deflate.c */
+	{ "ws_deflate_handshakes",             0, &ws_deflate_handshakes },
+	{ "ws_deflate_tx_bytes",               0, &ws_deflate_tx_bytes },
+	{ "ws_deflate_tx_compressed_bytes",    0, &ws_deflate_tx_compressed_bytes },
+	{ "ws_deflate_rx_bytes",               0, &ws_deflate_rx_bytes },
+	{ "ws_deflate_rx_compressed_bytes",    0, &ws_deflate_rx_compressed_bytes },
+	{ "ws_deflate_ratio",       STAT_IS_FUNC, (stat_var **) ws_deflate_ratio },
+	{ "ws_deflate_cpu_usecs",              0, &ws_deflate_cpu_usecs },
+
 	{ 0, 0, 0 }
 };
 
@@ -247,6 +270,12 @@ static int mod_init(void)
 		register_sync_timers(ws_keepalive_processes);
 	}
 
+	if (ws_deflate_init() < 0)
+	{
+		LM_ERR("checking permessage-deflate parameters\n");
+		goto error;
+	}
+
 	if (ws_sub_protocols & SUB_PROTOCOL_MSRP
 		&& !sr_event_enabled(SREV_TCP_MSRP_FRAME))
 		ws_sub_protocols &= ~SUB_PROTOCOL_MSRP;
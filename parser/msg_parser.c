@@ -65,6 +65,7 @@
 #include "../error.h"
 #include "../core_stats.h"
 #include "../globals.h"
+#include "../pvar.h"
 #include "parse_hname2.h"
 #include "parse_uri.h"
 #include "parse_content.h"
@@ -752,6 +753,7 @@ void reset_new_uri(struct sip_msg* const msg)
 	msg->new_uri.s = 0;
 	msg->new_uri.len = 0;
 	msg->parsed_uri_ok = 0;
+	pv_vcache_invalidate();
 }
 
 
@@ -784,6 +786,7 @@ int set_dst_uri(struct sip_msg* const msg, const str* const uri)
 		msg->dst_uri.s = ptr;
 		msg->dst_uri.len = uri->len;
 	}
+	pv_vcache_invalidate();
 	return 0;
 }
 
@@ -795,6 +798,7 @@ void reset_dst_uri(struct sip_msg* const msg)
 	}
 	msg->dst_uri.s = 0;
 	msg->dst_uri.len = 0;
+	pv_vcache_invalidate();
 }
 
 int set_path_vector(struct sip_msg* msg, str* path)
@@ -37,6 +37,7 @@
 #include "dprint.h"
 #include "hashes.h"
 #include "route.h"
+#include "counters.h"
 #include "pvapi.h"
 #include "pvar.h"
 
@@ -1247,12 +1248,177 @@ int pv_get_spec_index(struct sip_msg* msg, pv_param_p ip, int *idx, int *flags)
 	return 0;
 }
 
+/**
+ * PV values cache
+ */
+#define PV_VCACHE_GETF_SIZE	16
+
+typedef struct _pv_vcache
+{
+	pv_spec_t *spec;
+	struct sip_msg *msg;
+	unsigned int msgid;
+	char *mbuf;        /* message buffer */
+	str ruri;          /* R-URI and dst URI when the value was taken */
+	str duri;
+	unsigned int gen;
+	pv_value_t val;
+	int vsize;         /* size of val.rs.s buffer */
+} pv_vcache_t;
+
+unsigned int _pv_vcache_gen = 0;
+
+static pv_getf_t _pv_vcache_getf[PV_VCACHE_GETF_SIZE];
+static int _pv_vcache_getf_no = 0;
+static pv_vcache_t *_pv_vcache = NULL;
+
+static struct {
+	counter_handle_t hits;
+	counter_handle_t misses;
+} _pv_vcache_cnts;
+
+static counter_def_t _pv_vcache_cnt_defs[] = {
+	{&_pv_vcache_cnts.hits, "vcache_hits", 0, 0, 0,
+		"PV values got from the per message cache"},
+	{&_pv_vcache_cnts.misses, "vcache_misses", 0, 0, 0,
+		"PV values computed and stored in the per message cache"},
+	{0, 0, 0, 0, 0, 0 }
+};
+
+/**
+ * init the values cache, called from mod_init
+ */
+int pv_vcache_init(void)
+{
+	if(_pv_vcache!=NULL)
+		return 0;
+	_pv_vcache = (pv_vcache_t*)pkg_malloc(PV_VCACHE_SIZE*sizeof(pv_vcache_t));
+	if(_pv_vcache==NULL)
+	{
+		LM_ERR("no more pkg memory\n");
+		return -1;
+	}
+	memset(_pv_vcache, 0, PV_VCACHE_SIZE*sizeof(pv_vcache_t));
+	if(counter_register_array("pv", _pv_vcache_cnt_defs) < 0)
+	{
+		LM_ERR("failed to register the cache counters\n");
+		pkg_free(_pv_vcache);
+		_pv_vcache = NULL;
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * enable the values cache for a get function - the value must depend
+ * only on the content of the message, R-URI and dst URI
+ */
+int pv_vcache_register_getf(pv_getf_t f)
+{
+	int i;
+
+	for(i=0; i<_pv_vcache_getf_no; i++)
+		if(_pv_vcache_getf[i]==f)
+			return 0;
+	if(_pv_vcache_getf_no>=PV_VCACHE_GETF_SIZE)
+	{
+		LM_ERR("too many cached getters\n");
+		return -1;
+	}
+	_pv_vcache_getf[_pv_vcache_getf_no++] = f;
+	return 0;
+}
+
+/**
+ * return the cache slot for the spec or NULL if its value is not cached
+ */
+static pv_vcache_t* pv_vcache_slot(pv_spec_p sp)
+{
+	int i;
+
+	if(sp->pvp.pvn.type==PV_NAME_PVAR || sp->pvp.pvi.type==PV_IDX_PVAR)
+		return NULL;
+	for(i=0; i<_pv_vcache_getf_no; i++)
+		if(_pv_vcache_getf[i]==sp->getf)
+			return &_pv_vcache[
+				(((unsigned long)sp)>>4) & (PV_VCACHE_SIZE-1)];
+	return NULL;
+}
+
+#define pv_vcache_valid(vc, m) ((vc)->msg==(m) && (vc)->msgid==(m)->id \
+		&& (vc)->gen==_pv_vcache_gen && (vc)->mbuf==(m)->buf \
+		&& (vc)->ruri.s==(m)->new_uri.s && (vc)->ruri.len==(m)->new_uri.len \
+		&& (vc)->duri.s==(m)->dst_uri.s && (vc)->duri.len==(m)->dst_uri.len)
+
+/**
+ * get the value of the spec using the cache
+ */
+static int pv_vcache_get(struct sip_msg* msg, pv_spec_p sp,
+		pv_vcache_t *vc, pv_value_t *value)
+{
+	char *p;
+	int ret;
+
+	if(pv_vcache_valid(vc, msg))
+	{
+		if(vc->spec==sp)
+		{
+			counter_inc(_pv_vcache_cnts.hits);
+			*value = vc->val;
+			return 0;
+		}
+		/* slot used by another spec for this message - keep its value,
+		 * it can be still in use */
+		return (*sp->getf)(msg, &(sp->pvp), value);
+	}
+
+	ret = (*sp->getf)(msg, &(sp->pvp), value);
+	if(ret!=0)
+		return ret;
+	if((value->flags&PV_VAL_STR) && value->rs.len>PV_VCACHE_VMAX)
+		return 0;
+	counter_inc(_pv_vcache_cnts.misses);
+	if((value->flags&PV_VAL_STR) && value->rs.len>=vc->vsize)
+	{
+		p = (char*)pkg_malloc(value->rs.len+1);
+		if(p==NULL)
+		{
+			vc->spec = NULL;
+			return 0;
+		}
+		if(vc->val.rs.s)
+			pkg_free(vc->val.rs.s);
+		vc->val.rs.s = p;
+		vc->vsize = value->rs.len+1;
+	}
+	vc->spec = sp;
+	vc->msg = msg;
+	vc->msgid = msg->id;
+	vc->mbuf = msg->buf;
+	vc->ruri = msg->new_uri;
+	vc->duri = msg->dst_uri;
+	vc->gen = _pv_vcache_gen;
+	vc->val.flags = value->flags;
+	vc->val.ri = value->ri;
+	vc->val.rs.len = 0;
+	if(value->flags&PV_VAL_STR)
+	{
+		/* keep a private copy, the getters can return values in
+		 * static buffers */
+		memcpy(vc->val.rs.s, value->rs.s, value->rs.len);
+		vc->val.rs.s[value->rs.len] = '\0';
+		vc->val.rs.len = value->rs.len;
+	}
+	return 0;
+}
+
 /**
  *
  */
 int pv_get_spec_value(struct sip_msg* msg, pv_spec_p sp, pv_value_t *value)
 {
 	int ret = 0;
+	pv_vcache_t *vc;
 
 	if(msg==NULL || sp==NULL || sp->getf==NULL || value==NULL
 			|| sp->type==PVT_NONE)
@@ -1263,7 +1429,10 @@ int pv_get_spec_value(struct sip_msg* msg, pv_spec_p sp, pv_value_t *value)
 	
 	memset(value, 0, sizeof(pv_value_t));
 
-	ret = (*sp->getf)(msg, &(sp->pvp), value);
+	if(_pv_vcache_getf_no>0 && (vc=pv_vcache_slot(sp))!=NULL)
+		ret = pv_vcache_get(msg, sp, vc, value);
+	else
+		ret = (*sp->getf)(msg, &(sp->pvp), value);
 	if(ret!=0)
 		return ret;
 		
@@ -1282,6 +1451,7 @@ int pv_set_spec_value(struct sip_msg* msg, pv_spec_p sp, int op,
 		return 0; /* no op */
 	if(pv_alter_context(sp) && is_route_type(LOCAL_ROUTE))
 		return 0; /* no op */
+	pv_vcache_invalidate();
 	return sp->setf(msg, &sp->pvp, op, value);
 }
 
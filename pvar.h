@@ -240,6 +240,22 @@ typedef struct _pv_cache
 
 pv_cache_t **pv_cache_get_table(void);
 
+/**
+ * Per message cache of PV values
+ * - enabled for the getters registered with pv_vcache_register_getf()
+ * - a value is reused for the same message while the generation counter
+ *   is not changed (lumps, R-URI or dst URI changes, PV assignments)
+ */
+#define PV_VCACHE_SIZE	128	/*!< number of cached values */
+#define PV_VCACHE_VMAX	1024	/*!< max size of a cached string value */
+
+extern unsigned int _pv_vcache_gen;
+
+#define pv_vcache_invalidate()	(_pv_vcache_gen++)
+
+int pv_vcache_init(void);
+int pv_vcache_register_getf(pv_getf_t f);
+
 
 /**
  * Transformations
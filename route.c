@@ -115,6 +115,10 @@ int route_type = REQUEST_ROUTE;
  */
 int scr_opt_lev=9;
 
+/** resolve the if() and while() with constant conditions at startup
+ * (fold_const_conditions core parameter) */
+int fold_const_cond=0;
+
 inline static void destroy_rlist(struct route_list* rt)
 {
 	struct str_hash_entry* e;
@@ -2165,11 +2169,123 @@ static int fix_rl(struct route_list* rt)
 
 
 
+/** replaces in place the action a with the actions list l.
+ * The content of the first action of l is copied over a, so all the
+ * pointers to a (previous action, switch jump tables) stay valid.
+ * @return 0 on success, -1 if a has to be kept (l is empty and a is the
+ *  last action, so its return code is the one of the whole list)
+ */
+static int fold_replace_action(struct action* a, struct action* l)
+{
+	struct action* last;
+
+	if (l==0){
+		if (a->next==0)
+			return -1;
+		/* a is skipped => a becomes its successor */
+		l=a->next;
+	}else{
+		for (last=l; last->next; last=last->next);
+		last->next=a->next;
+	}
+	memcpy(a, l, sizeof(*a));
+	return 0;
+}
+
+
+
+/** folds the constant conditions of an actions list, after all the
+ * actions were fixed.
+ * The if() and while() with constant conditions are resolved:
+ *  if (ct) {A} else {B}  => A or B inlined in the list
+ *  while (ct false) {A}  => removed
+ * if() does not catch return & break, so running the inlined branch
+ * has the same effect as running it from the if() action.
+ * @return number of resolved actions
+ */
+static int fold_const_actions(struct action* a)
+{
+	struct action* t;
+	struct action* l;
+	struct rval_expr* rve;
+	int n;
+	int v;
+
+	n=0;
+	t=a;
+	while(t){
+		switch(t->type){
+			case IF_T:
+				rve=(struct rval_expr*)t->val[0].u.data;
+				if (rve && rve_is_constant(rve) &&
+						rval_expr_eval_int(0, 0, &v, rve)==0){
+					l=(v>0)?t->val[1].u.data:t->val[2].u.data;
+					if ((v>0 && t->val[1].type!=ACTIONS_ST) ||
+							(v<=0 && t->val[2].type!=ACTIONS_ST))
+						l=0;
+					DBG("fold: if at %s:%d resolved to %s branch\n",
+							(t->cfile)?t->cfile:"", t->cline,
+							(v>0)?"true":"false");
+					if (fold_replace_action(t, l)==0){
+						rve_destroy(rve);
+						n++;
+						/* check again the new content of t */
+						continue;
+					}
+				}
+				if ((t->val[1].type==ACTIONS_ST)&&(t->val[1].u.data))
+					n+=fold_const_actions((struct action*)t->val[1].u.data);
+				if ((t->val[2].type==ACTIONS_ST)&&(t->val[2].u.data))
+					n+=fold_const_actions((struct action*)t->val[2].u.data);
+				break;
+			case WHILE_T:
+				rve=(struct rval_expr*)t->val[0].u.data;
+				if (rve && rve_is_constant(rve) &&
+						rval_expr_eval_int(0, 0, &v, rve)==0 && v==0){
+					DBG("fold: while at %s:%d removed\n",
+							(t->cfile)?t->cfile:"", t->cline);
+					if (fold_replace_action(t, 0)==0){
+						rve_destroy(rve);
+						n++;
+						continue;
+					}
+				}
+				if ((t->val[1].type==ACTIONS_ST)&&(t->val[1].u.data))
+					n+=fold_const_actions((struct action*)t->val[1].u.data);
+				break;
+			default:
+				/* switch() and match() are not walked: their jump tables
+				   point inside the same actions list */
+				break;
+		}
+		t=t->next;
+	}
+	return n;
+}
+
+
+
+static int fold_const_rl(struct route_list* rt)
+{
+	int i;
+	int n;
+
+	n=0;
+	for(i=0;i<rt->idx; i++){
+		if(rt->rlist[i])
+			n+=fold_const_actions(rt->rlist[i]);
+	}
+	return n;
+}
+
+
+
 /* fixes all action tables */
 /* returns 0 if ok , <0 on error */
 int fix_rls()
 {
 	int ret;
+	int n;
 	
 	if ((ret=fix_rl(&main_rt))!=0)
 		return ret;
@@ -2184,6 +2300,15 @@ int fix_rls()
 	if ((ret=fix_rl(&event_rt))!=0)
 		return ret;
 
+	if (fold_const_cond){
+		n=fold_const_rl(&main_rt);
+		n+=fold_const_rl(&onreply_rt);
+		n+=fold_const_rl(&failure_rt);
+		n+=fold_const_rl(&branch_rt);
+		n+=fold_const_rl(&onsend_rt);
+		n+=fold_const_rl(&event_rt);
+		DBG("fold: %d constant conditions resolved\n", n);
+	}
 	return 0;
 }
 
@@ -92,6 +92,8 @@ extern struct route_list event_rt;
 
 /* script optimization level */
 extern int scr_opt_lev;
+/* fold the constant if/while conditions */
+extern int fold_const_cond;
 
 int init_routes(void);
 void destroy_routes(void);
@@ -248,6 +248,7 @@ static inline struct socket_info* new_sock_info(	char* name,
 	si=(struct socket_info*) pkg_malloc(sizeof(struct socket_info));
 	if (si==0) goto error;
 	memset(si, 0, sizeof(struct socket_info));
+	si->cpu_affinity=-1;
 	si->socket=-1;
 	si->name.len=strlen(name);
 	si->name.s=(char*)pkg_malloc(si->name.len+1); /* include \0 */
@@ -733,6 +734,10 @@ static struct socket_info* new_sock2list(char* name, struct name_lst* addr_l,
 		si->workers = socket_workers;
 		socket_workers = 0;
 	}
+	if(socket_cpu_affinity>=0) {
+		si->cpu_affinity = socket_cpu_affinity;
+		socket_cpu_affinity = -1;
+	}
 	sock_listadd(list, si);
 	return si;
 error:
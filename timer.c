@@ -63,6 +63,7 @@
 #include "locking.h"
 #include "sched_yield.h"
 #include "cfg/cfg_struct.h"
+#include "udp_server.h"
 
 
 /* how often will the timer handler be called (in ticks) */
@@ -995,7 +996,10 @@ void timer_main()
 			/* update the local cfg if needed */
 			cfg_update();
 
+			/* send the retransmissions of a tick with few sendmmsg() */
+			udp_send_batch_begin();
 			timer_handler();
+			udp_send_batch_flush();
 		}
 		pause();
 	}
@@ -42,6 +42,10 @@
  *               (in linux it's enabled by default which produces udp packets
  *                with the DF flag ser) (patch from hscholz)
  *  2010-06-15  support for using raw sockets for sending (andrei)
+ *  2026-10-18  optional recvmmsg()/sendmmsg() batching (udp_rcv_batch,
+ *               udp_snd_batch)
+ *  2026-10-18  optional per worker SO_REUSEPORT sockets (udp_reuse_port),
+ *               per socket cpu affinity and receive queue drop counters
  */
 
 
@@ -51,6 +55,9 @@
  * Module: @ref core
  */
 
+#if defined(__OS_linux) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* recvmmsg(), sendmmsg() */
+#endif
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
@@ -59,10 +66,13 @@
 #include <netinet/in_systm.h>
 #include <netinet/ip.h>
 #include <errno.h>
+#include <unistd.h>
 #include <arpa/inet.h>
 #ifdef __linux__
+	#include <sched.h>
 	#include <linux/types.h>
 	#include <linux/errqueue.h>
+	#include <linux/sock_diag.h>
 #endif
 
 
@@ -81,6 +91,25 @@
 #include "raw_sock.h"
 #endif /* USE_RAW_SOCKS */
 
+#if defined(__OS_linux) && defined(MSG_WAITFORONE) && !defined(DYN_BUF)
+#define USE_UDP_MMSG
+#endif
+
+
+#ifdef USE_UDP_MMSG
+/* queue of datagrams waiting to be sent with one sendmmsg() (per process) */
+static struct udp_snd_batch {
+	int active; /* udp_send() queues instead of sending */
+	int no;     /* queued datagrams */
+	int used;   /* used bytes in buf */
+	struct socket_info* si; /* all queued datagrams use the same socket */
+	struct mmsghdr msgs[UDP_BATCH_MAX];
+	struct iovec iov[UDP_BATCH_MAX];
+	union sockaddr_union to[UDP_BATCH_MAX];
+	char buf[UDP_SND_BATCH_BUF];
+} udp_sbatch;
+#endif /* USE_UDP_MMSG */
+
 
 #ifdef DBG_MSG_QA
 /* message quality assurance -- frequently, bugs in ser have
@@ -279,7 +308,71 @@ static int setup_mcast_rcvr(int sock, union sockaddr_union* addr)
 #endif /* USE_MCAST */
 
 
-int udp_init(struct socket_info* sock_info)
+#ifdef USE_UDP_MMSG
+/* registers a counter named "<sock_str>.<name>" in the "udp_batch" group */
+static int udp_batch_cnt_register(counter_handle_t* h, struct socket_info* si,
+									char* name, const char* doc)
+{
+	char* cname;
+	int len;
+
+	len=si->sock_str.len+1+strlen(name);
+	cname=pkg_malloc(len+1);
+	if (cname==0){
+		LOG(L_ERR, "ERROR: udp_init: out of memory\n");
+		return -1;
+	}
+	snprintf(cname, len+1, "%.*s.%s", si->sock_str.len, si->sock_str.s, name);
+	if (counter_register(h, "udp_batch", cname, 0, 0, 0, doc, 0)<0){
+		pkg_free(cname);
+		return -1;
+	}
+	return 0;
+}
+#endif /* USE_UDP_MMSG */
+
+
+
+/* registers the per socket recvmmsg/sendmmsg counters, if batching
+ * is enabled (must be called before forking) */
+static int udp_batch_cnts_init(struct socket_info* si)
+{
+#ifdef USE_UDP_MMSG
+	if ((udp_rcv_batch<=1 && udp_snd_batch<=1) || si->udp_cnts ||
+			!counters_initialized())
+		return 0;
+	si->udp_cnts=pkg_malloc(sizeof(*si->udp_cnts));
+	if (si->udp_cnts==0){
+		LOG(L_ERR, "ERROR: udp_init: out of memory\n");
+		return -1;
+	}
+	memset(si->udp_cnts, 0, sizeof(*si->udp_cnts));
+	if (udp_batch_cnt_register(&si->udp_cnts->rcv_calls, si, "rcv_calls",
+				"recvmmsg() calls")<0 ||
+		udp_batch_cnt_register(&si->udp_cnts->rcv_msgs, si, "rcv_msgs",
+				"datagrams received with recvmmsg()")<0 ||
+		udp_batch_cnt_register(&si->udp_cnts->snd_calls, si, "snd_calls",
+				"sendmmsg() calls")<0 ||
+		udp_batch_cnt_register(&si->udp_cnts->snd_msgs, si, "snd_msgs",
+				"datagrams sent with sendmmsg()")<0){
+		LOG(L_ERR, "ERROR: udp_init: failed to register the batch counters"
+				" for %.*s\n", si->sock_str.len, si->sock_str.s);
+		pkg_free(si->udp_cnts);
+		si->udp_cnts=0;
+		return -1;
+	}
+#else
+	if (udp_rcv_batch>1 || udp_snd_batch>1)
+		LOG(L_WARN, "WARNING: udp_init: recvmmsg()/sendmmsg() not supported,"
+				" udp_rcv_batch and udp_snd_batch are ignored\n");
+#endif /* USE_UDP_MMSG */
+	return 0;
+}
+
+
+
+/* creates, sets the options and binds sock_info->socket */
+static int udp_sock_init(struct socket_info* sock_info)
 {
 	union sockaddr_union* addr;
 	int optval;
@@ -312,6 +405,17 @@ int udp_init(struct socket_info* sock_info)
 		LOG(L_ERR, "ERROR: udp_init: setsockopt: %s\n", strerror(errno));
 		goto error;
 	}
+#ifdef SO_REUSEPORT
+	if (udp_reuse_port && !dont_fork){
+		optval=1;
+		if (setsockopt(sock_info->socket, SOL_SOCKET, SO_REUSEPORT,
+						(void*)&optval, sizeof(optval)) ==-1){
+			LOG(L_ERR, "ERROR: udp_init: setsockopt(SO_REUSEPORT): %s\n",
+					strerror(errno));
+			goto error;
+		}
+	}
+#endif /* SO_REUSEPORT */
 	/* tos */
 	optval = tos;
 	if (addr->s.sa_family==AF_INET){
@@ -417,6 +521,296 @@ error:
 
 
 
+/* creates one extra socket bound to the same address for each udp worker
+ * of si (SO_REUSEPORT), so that the kernel load balances the datagrams
+ * between the workers instead of waking all of them on a shared socket */
+static int udp_reuseport_init(struct socket_info* si)
+{
+#ifdef SO_REUSEPORT
+	int s0;
+	int n;
+	int i;
+
+	n=(si->workers>0)?si->workers:children_no;
+	if (n<=1)
+		return 0;
+	si->rcv_socks=pkg_malloc(n*sizeof(int));
+	if (si->rcv_socks==0){
+		LOG(L_ERR, "ERROR: udp_init: out of memory\n");
+		return -1;
+	}
+	s0=si->socket;
+	si->rcv_socks[0]=s0;
+	for (i=1; i<n; i++){
+		if (udp_sock_init(si)<0){
+			LOG(L_ERR, "ERROR: udp_init: failed to create worker socket %d"
+					" for %.*s\n", i, si->sock_str.len, si->sock_str.s);
+			si->socket=s0;
+			for (i--; i>0; i--)
+				close(si->rcv_socks[i]);
+			pkg_free(si->rcv_socks);
+			si->rcv_socks=0;
+			return -1;
+		}
+		si->rcv_socks[i]=si->socket;
+	}
+	si->socket=s0;
+	si->rcv_socks_no=n;
+	return 0;
+#else /* SO_REUSEPORT */
+	LOG(L_WARN, "WARNING: udp_init: SO_REUSEPORT not supported,"
+			" udp_reuse_port is ignored\n");
+	return 0;
+#endif /* SO_REUSEPORT */
+}
+
+
+
+#if defined(__OS_linux) && defined(SO_MEMINFO)
+/* counter callback: datagrams dropped by the kernel on all the receive
+ * sockets of a listen address (e.g. full receive queue) */
+static counter_val_t udp_drops_get(counter_handle_t h, void* param)
+{
+	struct socket_info* si;
+	__u32 mi[SK_MEMINFO_VARS];
+	socklen_t len;
+	counter_val_t drops;
+	int i;
+
+	si=(struct socket_info*)param;
+	drops=0;
+	for (i=0; i<(si->rcv_socks?si->rcv_socks_no:1); i++){
+		len=sizeof(mi);
+		if (getsockopt(si->rcv_socks?si->rcv_socks[i]:si->socket,
+						SOL_SOCKET, SO_MEMINFO, mi, &len)==0 &&
+				len>SK_MEMINFO_DROPS*sizeof(mi[0]))
+			drops+=mi[SK_MEMINFO_DROPS];
+	}
+	return drops;
+}
+
+
+
+/* registers the "<sock_str>.drops" counter in the "udp" group */
+static int udp_drops_cnt_init(struct socket_info* si)
+{
+	counter_handle_t h;
+	char* cname;
+	int len;
+
+	if (!counters_initialized())
+		return 0;
+	len=si->sock_str.len+sizeof(".drops")-1;
+	cname=pkg_malloc(len+1);
+	if (cname==0){
+		LOG(L_ERR, "ERROR: udp_init: out of memory\n");
+		return -1;
+	}
+	snprintf(cname, len+1, "%.*s.drops", si->sock_str.len, si->sock_str.s);
+	if (counter_register(&h, "udp", cname, CNT_F_NO_RESET, udp_drops_get, si,
+				"datagrams dropped by the kernel on receive (e.g. full"
+				" socket queue)", 0)<0){
+		LOG(L_ERR, "ERROR: udp_init: failed to register the drops counter"
+				" for %.*s\n", si->sock_str.len, si->sock_str.s);
+		pkg_free(cname);
+		return -1;
+	}
+	return 0;
+}
+#else
+#define udp_drops_cnt_init(si) 0
+#endif /* __OS_linux && SO_MEMINFO */
+
+
+
+int udp_init(struct socket_info* si)
+{
+	if (udp_sock_init(si)<0)
+		return -1;
+	if (udp_reuse_port && !dont_fork && udp_reuseport_init(si)<0)
+		return -1;
+	if (udp_batch_cnts_init(si)<0)
+		return -1;
+	if (udp_drops_cnt_init(si)<0)
+		return -1;
+	return 0;
+}
+
+
+
+/* per udp worker initializations, to be called from the child process idx
+ * of the socket si, after fork: switches to the worker own socket (if
+ * udp_reuse_port) and sets the cpu affinity (if configured for si) */
+int udp_child_init(struct socket_info* si, int idx)
+{
+#ifdef __OS_linux
+	cpu_set_t cpus;
+	long ncpu;
+	int cpu;
+#endif /* __OS_linux */
+
+	if (si->rcv_socks && idx<si->rcv_socks_no)
+		si->socket=si->rcv_socks[idx];
+	if (si->cpu_affinity<0)
+		return 0;
+#ifdef __OS_linux
+	ncpu=sysconf(_SC_NPROCESSORS_ONLN);
+	if (ncpu<=0)
+		ncpu=1;
+	cpu=(si->cpu_affinity+idx)%ncpu;
+	CPU_ZERO(&cpus);
+	CPU_SET(cpu, &cpus);
+	if (sched_setaffinity(0, sizeof(cpus), &cpus)<0){
+		LOG(L_WARN, "WARNING: udp_child_init: failed to set the cpu affinity"
+				" to %d: %s\n", cpu, strerror(errno));
+		return 0;
+	}
+	DBG("udp worker %d of %.*s bound to cpu %d\n", idx, si->sock_str.len,
+			si->sock_str.s, cpu);
+#else
+	LOG(L_WARN, "WARNING: udp_child_init: cpu affinity not supported\n");
+#endif /* __OS_linux */
+	return 0;
+}
+
+
+
+/* handles one received datagram (buf must have space for the
+ * terminating 0 at buf[len])
+ * returns 0 if the message was passed further, -1 if it was dropped */
+static inline int udp_rcv_msg(char* buf, unsigned len,
+								union sockaddr_union* from,
+								struct receive_info* ri)
+{
+	char *tmp;
+
+	/* we must 0-term the messages, receive_msg expects it */
+	buf[len]=0; /* no need to save the previous char */
+
+	ri->src_su=*from;
+	su2ip_addr(&ri->src_ip, from);
+	ri->src_port=su_getport(from);
+
+	if(unlikely(sr_event_enabled(SREV_NET_DGRAM_IN)))
+	{
+		void *sredp[3];
+		sredp[0] = (void*)buf;
+		sredp[1] = (void*)(&len);
+		sredp[2] = (void*)ri;
+		if(sr_event_exec(SREV_NET_DGRAM_IN, (void*)sredp)<0) {
+			/* data handled by callback - continue to next packet */
+			return -1;
+		}
+	}
+#ifndef NO_ZERO_CHECKS
+	if (!unlikely(sr_event_enabled(SREV_STUN_IN)) || (unsigned char)*buf != 0x00) {
+		if (len<MIN_UDP_PACKET) {
+			tmp=ip_addr2a(&ri->src_ip);
+			DBG("udp_rcv_loop: probing packet received from %s %d\n",
+				tmp, htons(ri->src_port));
+			return -1;
+		}
+	}
+/* historically, zero-terminated packets indicated a bug in clients
+ * that calculated wrongly packet length and included string-terminating
+ * zero; today clients exist with legitimate binary payloads and we
+ * shall not check for zero-terminated payloads
+ */
+#ifdef TRASH_ZEROTERMINATED_PACKETS
+	if (buf[len-1]==0) {
+		tmp=ip_addr2a(&ri->src_ip);
+		LOG(L_WARN, "WARNING: udp_rcv_loop: "
+				"upstream bug - 0-terminated packet from %s %d\n",
+				tmp, htons(ri->src_port));
+		len--;
+	}
+#endif
+#endif
+#ifdef DBG_MSG_QA
+	if (!dbg_msg_qa(buf, len)) {
+		LOG(L_WARN, "WARNING: an incoming message didn't pass test,"
+					"  drop it: %.*s\n", len, buf );
+		return -1;
+	}
+#endif
+	if (ri->src_port==0){
+		tmp=ip_addr2a(&ri->src_ip);
+		LOG(L_INFO, "udp_rcv_loop: dropping 0 port packet from %s\n", tmp);
+		return -1;
+	}
+	
+	/* update the local config */
+	cfg_update();
+	if (unlikely(sr_event_enabled(SREV_STUN_IN)) && (unsigned char)*buf == 0x00) {
+		/* stun_process_msg releases buf memory if necessary */
+		if ((stun_process_msg(buf, len, ri)) != 0) {
+			return -1; /* some error occurred */
+		}
+	} else {
+		/* receive_msg must free buf too!*/
+		receive_msg(buf, len, ri);
+	}
+	return 0;
+}
+
+
+
+#ifdef USE_UDP_MMSG
+/* recvmmsg() version of the receive loop: reads up to udp_rcv_batch
+ * datagrams with one system call, then handles them one by one.
+ * The replies and requests sent while handling a batch are queued and sent
+ * with sendmmsg() at the end of it, if udp_snd_batch is set. */
+static int udp_rcv_batch_loop(struct receive_info* ri)
+{
+	static char bufs[UDP_BATCH_MAX][BUF_SIZE+1];
+	static union sockaddr_union froms[UDP_BATCH_MAX];
+	struct mmsghdr msgs[UDP_BATCH_MAX];
+	struct iovec iov[UDP_BATCH_MAX];
+	int vlen;
+	int n;
+	int i;
+
+	vlen=(udp_rcv_batch>UDP_BATCH_MAX)?UDP_BATCH_MAX:udp_rcv_batch;
+	memset(msgs, 0, sizeof(msgs));
+	for (i=0; i<vlen; i++){
+		iov[i].iov_base=bufs[i];
+		iov[i].iov_len=BUF_SIZE;
+		msgs[i].msg_hdr.msg_name=&froms[i].s;
+		msgs[i].msg_hdr.msg_iov=&iov[i];
+		msgs[i].msg_hdr.msg_iovlen=1;
+	}
+	for(;;){
+		for (i=0; i<vlen; i++)
+			msgs[i].msg_hdr.msg_namelen=sockaddru_len(bind_address->su);
+		n=recvmmsg(bind_address->socket, msgs, vlen, MSG_WAITFORONE, 0);
+		if (n==-1){
+			if (errno==EAGAIN){
+				DBG("udp_rcv_loop: packet with bad checksum received\n");
+				continue;
+			}
+			LOG(L_ERR, "ERROR: udp_rcv_loop:recvmmsg:[%d] %s\n",
+						errno, strerror(errno));
+			if ((errno==EINTR)||(errno==EWOULDBLOCK)|| (errno==ECONNREFUSED))
+				continue;
+			return -1;
+		}
+		if (bind_address->udp_cnts){
+			counter_inc(bind_address->udp_cnts->rcv_calls);
+			counter_add(bind_address->udp_cnts->rcv_msgs, n);
+		}
+		if (udp_snd_batch>1)
+			udp_send_batch_begin();
+		for (i=0; i<n; i++)
+			udp_rcv_msg(bufs[i], msgs[i].msg_len, &froms[i], ri);
+		if (udp_snd_batch>1)
+			udp_send_batch_flush();
+	}
+	return -1;
+}
+#endif /* USE_UDP_MMSG */
+
+
+
 int udp_rcv_loop()
 {
 	unsigned len;
@@ -425,7 +819,6 @@ int udp_rcv_loop()
 #else
 	static char buf [BUF_SIZE+1];
 #endif
-	char *tmp;
 	union sockaddr_union* from;
 	unsigned int fromlen;
 	struct receive_info ri;
@@ -446,6 +839,13 @@ int udp_rcv_loop()
 	/* initialize the config framework */
 	if (cfg_child_init()) goto error;
 
+#ifdef USE_UDP_MMSG
+	if (udp_rcv_batch>1){
+		udp_rcv_batch_loop(&ri);
+		goto error;
+	}
+#endif /* USE_UDP_MMSG */
+
 	for(;;){
 #ifdef DYN_BUF
 		buf=pkg_malloc(BUF_SIZE+1);
@@ -469,72 +869,7 @@ int udp_rcv_loop()
 				continue; /* goto skip;*/
 			else goto error;
 		}
-		/* we must 0-term the messages, receive_msg expects it */
-		buf[len]=0; /* no need to save the previous char */
-
-		ri.src_su=*from;
-		su2ip_addr(&ri.src_ip, from);
-		ri.src_port=su_getport(from);
-
-		if(unlikely(sr_event_enabled(SREV_NET_DGRAM_IN)))
-		{
-			void *sredp[3];
-			sredp[0] = (void*)buf;
-			sredp[1] = (void*)(&len);
-			sredp[2] = (void*)(&ri);
-			if(sr_event_exec(SREV_NET_DGRAM_IN, (void*)sredp)<0) {
-				/* data handled by callback - continue to next packet */
-				continue;
-			}
-		}
-#ifndef NO_ZERO_CHECKS
-		if (!unlikely(sr_event_enabled(SREV_STUN_IN)) || (unsigned char)*buf != 0x00) {
-			if (len<MIN_UDP_PACKET) {
-				tmp=ip_addr2a(&ri.src_ip);
-				DBG("udp_rcv_loop: probing packet received from %s %d\n",
-					tmp, htons(ri.src_port));
-				continue;
-			}
-		}
-/* historically, zero-terminated packets indicated a bug in clients
- * that calculated wrongly packet length and included string-terminating
- * zero; today clients exist with legitimate binary payloads and we
- * shall not check for zero-terminated payloads
- */
-#ifdef TRASH_ZEROTERMINATED_PACKETS
-		if (buf[len-1]==0) {
-			tmp=ip_addr2a(&ri.src_ip);
-			LOG(L_WARN, "WARNING: udp_rcv_loop: "
-					"upstream bug - 0-terminated packet from %s %d\n",
-					tmp, htons(ri.src_port));
-			len--;
-		}
-#endif
-#endif
-#ifdef DBG_MSG_QA
-		if (!dbg_msg_qa(buf, len)) {
-			LOG(L_WARN, "WARNING: an incoming message didn't pass test,"
-						"  drop it: %.*s\n", len, buf );
-			continue;
-		}
-#endif
-		if (ri.src_port==0){
-			tmp=ip_addr2a(&ri.src_ip);
-			LOG(L_INFO, "udp_rcv_loop: dropping 0 port packet from %s\n", tmp);
-			continue;
-		}
-		
-		/* update the local config */
-		cfg_update();
-		if (unlikely(sr_event_enabled(SREV_STUN_IN)) && (unsigned char)*buf == 0x00) {
-			/* stun_process_msg releases buf memory if necessary */
-			if ((stun_process_msg(buf, len, &ri)) != 0) {
-				continue; /* some error occurred */
-			}
-		} else {
-			/* receive_msg must free buf too!*/
-			receive_msg(buf, len, &ri);
-		}
+		udp_rcv_msg(buf, len, from, &ri);
 		
 	/* skip: do other stuff */
 		
@@ -552,6 +887,103 @@ error:
 
 
 
+#ifdef USE_UDP_MMSG
+/* sends all the queued datagrams, using as few sendmmsg() as possible */
+static void udp_send_batch_send(void)
+{
+	struct ip_addr ip; /* used only on error, for debugging */
+	struct socket_info* si;
+	int i;
+	int n;
+
+	si=udp_sbatch.si;
+	i=0;
+	while(i<udp_sbatch.no){
+		n=sendmmsg(si->socket, &udp_sbatch.msgs[i], udp_sbatch.no-i, 0);
+		if (unlikely(n==-1)){
+			if (errno==EINTR) continue;
+			/* the first datagram could not be sent, skip it */
+			su2ip_addr(&ip, &udp_sbatch.to[i]);
+			LOG(L_ERR, "ERROR: udp_send: sendmmsg(sock,%p,%u,0,%s:%d,%d):"
+					" %s(%d)\n", udp_sbatch.iov[i].iov_base,
+					(unsigned)udp_sbatch.iov[i].iov_len, ip_addr2a(&ip),
+					su_getport(&udp_sbatch.to[i]),
+					(int)udp_sbatch.msgs[i].msg_hdr.msg_namelen,
+					strerror(errno), errno);
+			n=1;
+		} else if (si->udp_cnts){
+			counter_inc(si->udp_cnts->snd_calls);
+			counter_add(si->udp_cnts->snd_msgs, n);
+		}
+		i+=n;
+	}
+	udp_sbatch.no=0;
+	udp_sbatch.used=0;
+	udp_sbatch.si=0;
+}
+
+
+
+/* queues a copy of buf:len for sending with the next sendmmsg()
+ * returns len */
+static int udp_send_batch_add(struct dest_info* dst, char *buf, unsigned len)
+{
+	struct msghdr* h;
+	char* p;
+	int i;
+
+	if (udp_sbatch.no && (udp_sbatch.si!=dst->send_sock ||
+				udp_sbatch.no==UDP_BATCH_MAX ||
+				udp_sbatch.no==udp_snd_batch ||
+				udp_sbatch.used+len>UDP_SND_BATCH_BUF))
+		udp_send_batch_send();
+	i=udp_sbatch.no;
+	p=udp_sbatch.buf+udp_sbatch.used;
+	memcpy(p, buf, len);
+	udp_sbatch.iov[i].iov_base=p;
+	udp_sbatch.iov[i].iov_len=len;
+	udp_sbatch.to[i]=dst->to;
+	h=&udp_sbatch.msgs[i].msg_hdr;
+	memset(h, 0, sizeof(*h));
+	h->msg_name=&udp_sbatch.to[i].s;
+	h->msg_namelen=sockaddru_len(dst->to);
+	h->msg_iov=&udp_sbatch.iov[i];
+	h->msg_iovlen=1;
+	udp_sbatch.si=dst->send_sock;
+	udp_sbatch.used+=len;
+	udp_sbatch.no++;
+	return len;
+}
+#endif /* USE_UDP_MMSG */
+
+
+
+/* starts queueing the datagrams sent from the current process, they will
+ * be sent with sendmmsg() by udp_send_batch_flush() (or earlier, if the
+ * queue fills up). While queueing, send errors are only logged, udp_send()
+ * reports success. Nop if udp_snd_batch is not set or not supported. */
+void udp_send_batch_begin(void)
+{
+#ifdef USE_UDP_MMSG
+	if (udp_snd_batch>1)
+		udp_sbatch.active=1;
+#endif /* USE_UDP_MMSG */
+}
+
+
+
+/* sends all the datagrams queued since udp_send_batch_begin() */
+void udp_send_batch_flush(void)
+{
+#ifdef USE_UDP_MMSG
+	if (udp_sbatch.no)
+		udp_send_batch_send();
+	udp_sbatch.active=0;
+#endif /* USE_UDP_MMSG */
+}
+
+
+
 /* send buf:len over udp to dst (uses only the to and send_sock dst members)
  * returns the numbers of bytes sent on success (>=0) and -1 on error
  */
@@ -578,6 +1010,10 @@ int udp_send(struct dest_info* dst, char *buf, unsigned len)
 					dst->send_sock->address.af == AF_INET) )) {
 #endif /* USE_RAW_SOCKS */
 		/* normal send over udp socket */
+#ifdef USE_UDP_MMSG
+		if (unlikely(udp_sbatch.active) && len<=UDP_SND_BATCH_BUF)
+			return udp_send_batch_add(dst, buf, len);
+#endif /* USE_UDP_MMSG */
 		tolen=sockaddru_len(dst->to);
 again:
 		n=sendto(dst->send_sock->socket, buf, len, 0, &dst->to.s, tolen);
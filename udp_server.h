@@ -32,14 +32,32 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include "ip_addr.h"
+#include "counters.h"
 
 #define MAX_RECV_BUFFER_SIZE	256*1024
 #define BUFFER_INCREMENT	2048
 
+/** max. datagrams handled by one recvmmsg()/sendmmsg() call */
+#define UDP_BATCH_MAX		32
+/** space for copies of the datagrams queued for sendmmsg() */
+#define UDP_SND_BATCH_BUF	(128*1024)
+
+/** per socket batching counters (group "udp_batch") */
+struct udp_batch_cnts {
+	counter_handle_t rcv_calls; /* recvmmsg() calls */
+	counter_handle_t rcv_msgs;  /* datagrams received with recvmmsg() */
+	counter_handle_t snd_calls; /* sendmmsg() calls */
+	counter_handle_t snd_msgs;  /* datagrams sent with sendmmsg() */
+};
+
 
 int udp_init(struct socket_info* si);
+int udp_child_init(struct socket_info* si, int idx);
 int udp_send(struct dest_info* dst, char *buf, unsigned len);
 int udp_rcv_loop(void);
 
+void udp_send_batch_begin(void);
+void udp_send_batch_flush(void);
+
 
 #endif
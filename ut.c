@@ -35,6 +35,13 @@
 #include <libgen.h>
 
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #include "ut.h"
 #include "mem/mem.h"
 #include "globals.h"
@@ -297,3 +304,44 @@ char *str_search(str *text, str *needle)
 
     return NULL;
 }
+
+
+#ifdef __SSE2__
+/**
+ * @brief q_memchr() for inputs of at least 16 bytes: compares 32 (AVX2)
+ * or 16 (SSE2) bytes at a time and a byte at a time for the tail
+ */
+char* q_memchr_vec(char* p, int c, unsigned int size)
+{
+	char* end;
+#ifdef __AVX2__
+	__m256i c32;
+#endif
+	__m128i c16;
+	unsigned int m;
+
+	end=p+size;
+#ifdef __AVX2__
+	if (size>=32){
+		c32=_mm256_set1_epi8((char)c);
+		for(; p+32<=end; p+=32){
+			m=_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+						_mm256_loadu_si256((const __m256i*)p), c32));
+			if (m) return p+__builtin_ctz(m);
+		}
+	}
+#endif
+	if (end-p>=16){
+		c16=_mm_set1_epi8((char)c);
+		for(; p+16<=end; p+=16){
+			m=_mm_movemask_epi8(_mm_cmpeq_epi8(
+						_mm_loadu_si128((const __m128i*)p), c16));
+			if (m) return p+__builtin_ctz(m);
+		}
+	}
+	for(;p<end;p++){
+		if ((unsigned char)*p==(unsigned char)c) return p;
+	}
+	return 0;
+}
+#endif /* __SSE2__ */
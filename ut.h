@@ -432,14 +432,26 @@ static inline char* ushort2str(unsigned short u)
 
 
 
-/* fast memchr version */
+#ifdef __SSE2__
+char* q_memchr_vec(char* p, int c, unsigned int size);
+#endif
+
+/* fast memchr version
+ * inlined byte loop for short inputs, longer ones are handed to
+ * q_memchr_vec() (ut.c) which compares 32 (AVX2) or 16 (SSE2) bytes at a
+ * time when the target supports it; used by the parser for finding header
+ * ends and the ':' of unknown header names */
 static inline char* q_memchr(char* p, int c, unsigned int size)
 {
 	char* end;
 
+#ifdef __SSE2__
+	if (size>=16)
+		return q_memchr_vec(p, c, size);
+#endif
 	end=p+size;
 	for(;p<end;p++){
-		if (*p==(unsigned char)c) return p;
+		if ((unsigned char)*p==(unsigned char)c) return p;
 	}
 	return 0;
 }